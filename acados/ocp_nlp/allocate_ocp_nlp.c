@@ -121,6 +121,8 @@ static void allocate_ocp_nlp_in_sim_solver(int_t N, int_t *nx, int_t *nu, int_t
         d_zeros(&simulators[i]->out->grad, nx_i + nu_i, 1);
         simulators[i]->out->info = (sim_info *)malloc(sizeof(sim_info));
 
+        simulators[i]->calculate_workspace_size = NULL;
+        simulators[i]->shift_memory = NULL;
         simulators[i]->mem = NULL;
     }
 }
@@ -31,17 +31,22 @@ ocp_nlp_sm_gn_args *ocp_nlp_sm_gn_create_arguments() {
     ocp_nlp_sm_gn_args *args =
         (ocp_nlp_sm_gn_args *)malloc(sizeof(ocp_nlp_sm_gn_args));
     args->freezeSens = false;
+    args->num_threads = 1;
     return args;
 }
 
 int_t ocp_nlp_sm_gn_calculate_memory_size(const ocp_nlp_sm_in *sm_in,
                                           void *args_) {
+    ocp_nlp_sm_gn_args *args = (ocp_nlp_sm_gn_args *)args_;
+
     int_t size = sizeof(ocp_nlp_sm_gn_memory);
+    size += args->num_threads * sizeof(void *);  // sim_work
     return size;
 }
 
 char *ocp_nlp_sm_gn_assign_memory(const ocp_nlp_sm_in *sm_in, void *args_,
                                   void **mem_, void *raw_memory) {
+    ocp_nlp_sm_gn_args *args = (ocp_nlp_sm_gn_args *)args_;
     ocp_nlp_sm_gn_memory **sm_memory = (ocp_nlp_sm_gn_memory **)mem_;
 
     // char pointer
@@ -50,6 +55,9 @@ char *ocp_nlp_sm_gn_assign_memory(const ocp_nlp_sm_in *sm_in, void *args_,
     *sm_memory = (ocp_nlp_sm_gn_memory *)c_ptr;
     c_ptr += sizeof(ocp_nlp_sm_gn_memory);
 
+    (*sm_memory)->sim_work = (void **)c_ptr;
+    c_ptr += args->num_threads * sizeof(void *);
+
     return c_ptr;
 }
 
@@ -182,11 +190,11 @@ ocp_nlp_sm_gn_workspace *ocp_nlp_sm_gn_create_workspace(
     return work;
 }
 
-int_t ocp_nlp_sm_gn(const ocp_nlp_sm_in *sm_in, ocp_nlp_sm_out *sm_out,
-                    void *args_, void *memory_, void *workspace_) {
-    ocp_nlp_sm_gn_workspace *work = (ocp_nlp_sm_gn_workspace *)workspace_;
-    ocp_nlp_sm_gn_memory *mem = memory_;
-
+static void ocp_nlp_sm_gn_stage(const ocp_nlp_sm_in *sm_in,
+                                ocp_nlp_sm_out *sm_out,
+                                const ocp_nlp_sm_gn_memory *mem,
+                                ocp_nlp_sm_gn_workspace *work, const int_t i,
+                                void *thread_sim_work) {
     const int_t N = sm_in->N;
     const int_t *nx = sm_in->nx;
     const int_t *nu = sm_in->nu;
@@ -203,7 +211,7 @@ int_t ocp_nlp_sm_gn(const ocp_nlp_sm_in *sm_in, ocp_nlp_sm_out *sm_out,
     ocp_nlp_ls_cost *ls_cost = (ocp_nlp_ls_cost *)sm_in->cost;
     ocp_nlp_function **path_constraints = sm_in->path_constraints;
 
-    for (int_t i = 0; i < N; i++) {
+    if (i < N) {
         // Adjoint-based gradient correction (used for)
         // TODO(nielsvd): create new sensitivity methods for inexact newton methods
         sim_RK_opts *sim_opts = (sim_RK_opts *)sim[i]->args;
@@ -218,10 +226,15 @@ int_t ocp_nlp_sm_gn(const ocp_nlp_sm_in *sm_in, ocp_nlp_sm_out *sm_out,
             sim[i]->in->sens_adj = false;
         }
 
+        // Integrators are only thread-safe with a workspace per thread
+        void *sim_work = sim[i]->work;
+        if (thread_sim_work != NULL && sim[i]->calculate_workspace_size != NULL)
+            sim_work = thread_sim_work;
+
         // Pass state and control to integrator
         for (int_t j = 0; j < nx[i]; j++) sim[i]->in->x[j] = sm_in->x[i][j];
         for (int_t j = 0; j < nu[i]; j++) sim[i]->in->u[j] = sm_in->u[i][j];
-        sim[i]->fun(sim[i]->in, sim[i]->out, sim[i]->args, sim[i]->mem, sim[i]->work);
+        sim[i]->fun(sim[i]->in, sim[i]->out, sim[i]->args, sim[i]->mem, sim_work);
 
         // Sensitivities for the linearization of the system dynamics
         // TODO(rien): transition functions for changing dimensions not yet
@@ -233,49 +246,90 @@ int_t ocp_nlp_sm_gn(const ocp_nlp_sm_in *sm_in, ocp_nlp_sm_out *sm_out,
         }
     }
 
-    for (int_t i = 0; i <= N; i++) {
-        // Least squares cost for shooting node i
-        const int_t ny = ls_cost->fun[i]->ny;
-        casadi_wrapper_in *ls_in = ls_cost->fun[i]->in;
-        casadi_wrapper_out *ls_out = ls_cost->fun[i]->out;
-        casadi_wrapper_args *ls_args = ls_cost->fun[i]->args;
-        casadi_wrapper_workspace *ls_work = ls_cost->fun[i]->work;
-
-        // Sensitivities for the quadratic approximation of the objective
-        // Compute residual vector F and its Jacobian
-        casadi_wrapper(ls_in, ls_out, ls_args, ls_work);
-        for (int_t j = 0; j < ny; j++) work->F[i][j] -= ls_cost->y_ref[i][j];
-        // Take transpose of DF
-        for (int_t j = 0; j < nx[i] + nu[i]; j++) {
-            for (int_t k = 0; k < ny; k++)
-                work->DFT[i][k * (nx[i] + nu[i]) + j] = work->DF[i][j * ny + k];
+    // Least squares cost for shooting node i
+    const int_t ny = ls_cost->fun[i]->ny;
+    casadi_wrapper_in *ls_in = ls_cost->fun[i]->in;
+    casadi_wrapper_out *ls_out = ls_cost->fun[i]->out;
+    casadi_wrapper_args *ls_args = ls_cost->fun[i]->args;
+    casadi_wrapper_workspace *ls_work = ls_cost->fun[i]->work;
+
+    // Sensitivities for the quadratic approximation of the objective
+    // Compute residual vector F and its Jacobian
+    casadi_wrapper(ls_in, ls_out, ls_args, ls_work);
+    for (int_t j = 0; j < ny; j++) work->F[i][j] -= ls_cost->y_ref[i][j];
+    // Take transpose of DF
+    for (int_t j = 0; j < nx[i] + nu[i]; j++) {
+        for (int_t k = 0; k < ny; k++)
+            work->DFT[i][k * (nx[i] + nu[i]) + j] = work->DF[i][j * ny + k];
+    }
+
+    // Compute Gauss-Newton Hessian
+    for (int_t j = 0; j < (nx[i] + nu[i]) * ny; j++) work->DFTW[i][j] = 0;
+    dgemm_nn_3l(nx[i] + nu[i], ny, ny, work->DFT[i], nx[i] + nu[i],
+                (real_t *)ls_cost->W[i], ny, work->DFTW[i], nx[i] + nu[i]);
+    dgemm_nn_3l(nx[i] + nu[i], nx[i] + nu[i], ny, work->DFTW[i],
+                nx[i] + nu[i], work->DF[i], ny, hess_l[i], nx[i] + nu[i]);
+    // Compute gradient of cost
+    for (int_t j = 0; j < (nx[i] + nu[i]); j++) grad_f[i][j] = 0;
+    dgemv_n_3l(nx[i] + nu[i], ny, work->DFTW[i], nx[i] + nu[i], work->F[i],
+               grad_f[i]);
+
+    if (sm_in->ng[i] > 0) {
+        // Path constraints for shooting node i
+        casadi_wrapper_in *pc_in = path_constraints[i]->in;
+        casadi_wrapper_out *pc_out = path_constraints[i]->out;
+        casadi_wrapper_args *pc_args = path_constraints[i]->args;
+        casadi_wrapper_workspace *pc_work = path_constraints[i]->work;
+        // Sensitivities for the linearization of the path constraints
+        casadi_wrapper(pc_in, pc_out, pc_args, pc_work);
+        for (int_t j = 0; j < ng[i]; j++) {
+            g[i][j] = work->G[i][j];
+            for (int_t k = 0; k < nx[i] + nu[i]; k++)
+                jac_g[i][k * ng[i] + j] = work->DG[i][k * ng[i] + j];
         }
+    }
+}
 
-        // Compute Gauss-Newton Hessian
-        for (int_t j = 0; j < (nx[i] + nu[i]) * ny; j++) work->DFTW[i][j] = 0;
-        dgemm_nn_3l(nx[i] + nu[i], ny, ny, work->DFT[i], nx[i] + nu[i],
-                    (real_t *)ls_cost->W[i], ny, work->DFTW[i], nx[i] + nu[i]);
-        dgemm_nn_3l(nx[i] + nu[i], nx[i] + nu[i], ny, work->DFTW[i],
-                    nx[i] + nu[i], work->DF[i], ny, hess_l[i], nx[i] + nu[i]);
-        // Compute gradient of cost
-        for (int_t j = 0; j < (nx[i] + nu[i]); j++) grad_f[i][j] = 0;
-        dgemv_n_3l(nx[i] + nu[i], ny, work->DFTW[i], nx[i] + nu[i], work->F[i],
-                   grad_f[i]);
+typedef struct {
+    const ocp_nlp_sm_in *sm_in;
+    ocp_nlp_sm_out *sm_out;
+    ocp_nlp_sm_gn_memory *mem;
+    ocp_nlp_sm_gn_workspace *work;
+} ocp_nlp_sm_gn_task;
+
+static void ocp_nlp_sm_gn_thread(void *ctx, int_t thread_id,
+                                 int_t num_threads) {
+    ocp_nlp_sm_gn_task *task = (ocp_nlp_sm_gn_task *)ctx;
+    const int_t num_nodes = task->sm_in->N + 1;
+
+    // Fixed partition of the shooting nodes over the threads. Every node only
+    // writes to its own outputs, so the result does not depend on scheduling.
+    int_t first = (thread_id * num_nodes) / num_threads;
+    int_t last = ((thread_id + 1) * num_nodes) / num_threads;
+    for (int_t i = first; i < last; i++)
+        ocp_nlp_sm_gn_stage(task->sm_in, task->sm_out, task->mem, task->work, i,
+                            task->mem->sim_work[thread_id]);
+}
 
-        if (sm_in->ng[i] > 0) {
-            // Path constraints for shooting node i
-            casadi_wrapper_in *pc_in = path_constraints[i]->in;
-            casadi_wrapper_out *pc_out = path_constraints[i]->out;
-            casadi_wrapper_args *pc_args = path_constraints[i]->args;
-            casadi_wrapper_workspace *pc_work = path_constraints[i]->work;
-            // Sensitivities for the linearization of the path constraints
-            casadi_wrapper(pc_in, pc_out, pc_args, pc_work);
-            for (int_t j = 0; j < ng[i]; j++) {
-                g[i][j] = work->G[i][j];
-                for (int_t k = 0; k < nx[i] + nu[i]; k++)
-                    jac_g[i][k * ng[i] + j] = work->DG[i][k * ng[i] + j];
-            }
-        }
+int_t ocp_nlp_sm_gn(const ocp_nlp_sm_in *sm_in, ocp_nlp_sm_out *sm_out,
+                    void *args_, void *memory_, void *workspace_) {
+    ocp_nlp_sm_gn_workspace *work = (ocp_nlp_sm_gn_workspace *)workspace_;
+    ocp_nlp_sm_gn_memory *mem = memory_;
+
+    const int_t N = sm_in->N;
+    const int_t *nx = sm_in->nx;
+    const int_t *nu = sm_in->nu;
+
+    real_t **grad_f = (real_t **)sm_out->grad_f;
+
+    sim_solver **sim = sm_in->sim;
+
+    if (mem->num_threads > 1) {
+        ocp_nlp_sm_gn_task task = {sm_in, sm_out, mem, work};
+        acados_thread_pool_run(mem->pool, &ocp_nlp_sm_gn_thread, &task);
+    } else {
+        for (int_t i = 0; i <= N; i++)
+            ocp_nlp_sm_gn_stage(sm_in, sm_out, mem, work, i, NULL);
     }
 
     // Adjoint-based gradient correction
@@ -307,6 +361,28 @@ void ocp_nlp_sm_gn_initialize(const ocp_nlp_sm_in *sm_in, void *args_,
     (*mem)->inexact_init = false;
 
     int_t N = sm_in->N;
+    ocp_nlp_sm_gn_args *args = (ocp_nlp_sm_gn_args *)args_;
+
+    // Persistent worker pool and one integrator workspace per thread. The pool may end up with a
+    // single thread, in which case the stages run serially on the workspaces of the integrators.
+    (*mem)->num_threads = 1;
+    (*mem)->pool = NULL;
+    if (args->num_threads > 1) {
+        (*mem)->pool = acados_thread_pool_create(args->num_threads);
+        (*mem)->num_threads = acados_thread_pool_num_threads((*mem)->pool);
+    }
+    if ((*mem)->num_threads > 1) {
+        sim_solver **sim = sm_in->sim;
+        int_t sim_work_size = 0;
+        for (int_t i = 0; i < N; i++) {
+            if (sim[i]->calculate_workspace_size != NULL) {
+                int_t size = sim[i]->calculate_workspace_size(sim[i]->in, sim[i]->args);
+                if (size > sim_work_size) sim_work_size = size;
+            }
+        }
+        for (int_t t = 0; t < (*mem)->num_threads; t++)
+            (*mem)->sim_work[t] = (sim_work_size > 0) ? malloc(sim_work_size) : NULL;
+    }
     ocp_nlp_ls_cost *ls_cost = (ocp_nlp_ls_cost *)sm_in->cost;
     ocp_nlp_function **path_constraints = sm_in->path_constraints;
 
@@ -337,6 +413,11 @@ void ocp_nlp_sm_gn_destroy(void *mem_, void *work_) {
     ocp_nlp_sm_gn_memory *mem = (ocp_nlp_sm_gn_memory *)mem_;
     ocp_nlp_sm_gn_workspace *work = (ocp_nlp_sm_gn_workspace *)work_;
 
+    if (mem->num_threads > 1) {
+        for (int_t t = 0; t < mem->num_threads; t++) free(mem->sim_work[t]);
+    }
+    acados_thread_pool_destroy(mem->pool);
+
     free(mem);
     free(work);
 }
@@ -25,6 +25,7 @@ extern "C" {
 #endif
 
 #include "acados/ocp_nlp/ocp_nlp_sm_common.h"
+#include "acados/utils/threads.h"
 #include "acados/utils/types.h"
 
 typedef struct {
@@ -34,9 +35,21 @@ typedef struct {
     int_t N;
 } ocp_nlp_ls_cost;
 
-typedef struct { bool freezeSens; } ocp_nlp_sm_gn_args;
+typedef struct {
+    bool freezeSens;
+    // Number of threads that evaluate the shooting intervals, 1 is serial.
+    // Every thread gets its own integrator workspace for all stages whose
+    // sim_solver provides calculate_workspace_size, other stages keep using
+    // sim[i]->work, which then must not be shared between stages.
+    int_t num_threads;
+} ocp_nlp_sm_gn_args;
 
-typedef struct { bool inexact_init; } ocp_nlp_sm_gn_memory;
+typedef struct {
+    bool inexact_init;
+    int_t num_threads;
+    acados_thread_pool *pool;
+    void **sim_work;  // sim_work[num_threads], NULL when running serially
+} ocp_nlp_sm_gn_memory;
 
 typedef struct {
     real_t **F;
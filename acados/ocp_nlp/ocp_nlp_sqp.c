@@ -28,6 +28,7 @@
 
 #include "acados/ocp_nlp/ocp_nlp_common.h"
 #include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/ocp_qp/ocp_qp_hpipm_in.h"
 #include "acados/utils/print.h"
 #include "acados/utils/timing.h"
 #include "acados/utils/types.h"
@@ -41,6 +42,8 @@ void prepare_qp(const ocp_nlp_in *nlp_in, ocp_nlp_sqp_args *sqp_args,
     const int_t **idxb = nlp_in->idxb;
     const int_t *ng = nlp_in->ng;
 
+    const ocp_qp_in *qp_in = sqp_args->qp_solver->qp_in;
+
     real_t **qp_A = (real_t **)sqp_args->qp_solver->qp_in->A;
     real_t **qp_B = (real_t **)sqp_args->qp_solver->qp_in->B;
     real_t **qp_b = (real_t **)sqp_args->qp_solver->qp_in->b;
@@ -68,8 +71,20 @@ void prepare_qp(const ocp_nlp_in *nlp_in, ocp_nlp_sqp_args *sqp_args,
     real_t **nlp_lg = (real_t **)nlp_in->lg;
     real_t **nlp_ug = (real_t **)nlp_in->ug;
 
+    struct d_ocp_qp *qp_hpipm = sqp_mem->qp_hpipm;
+
     // Objective
     for (int_t i = 0; i <= N; i++) {
+        for (int_t j = 0; j < nx[i]; j++) {
+            qp_q[i][j] = grad_f[i][j];
+        }
+        for (int_t j = 0; j < nu[i]; j++) {
+            qp_r[i][j] = grad_f[i][nx[i] + j];
+        }
+        if (qp_hpipm) {
+            ocp_qp_hpipm_in_set_objective(qp_hpipm, i, hess_l[i], qp_q[i], qp_r[i]);
+            continue;
+        }
         for (int_t j = 0; j < nx[i]; j++) {
             for (int_t k = 0; k < nx[i]; k++) {
                 qp_Q[i][j * nx[i] + k] = hess_l[i][j * (nx[i] + nu[i]) + k];
@@ -85,18 +100,13 @@ void prepare_qp(const ocp_nlp_in *nlp_in, ocp_nlp_sqp_args *sqp_args,
                     hess_l[i][(nx[i] + j) * (nx[i] + nu[i]) + nx[i] + k];
             }
         }
-        for (int_t j = 0; j < nx[i]; j++) {
-            qp_q[i][j] = grad_f[i][j];
-        }
-        for (int_t j = 0; j < nu[i]; j++) {
-            qp_r[i][j] = grad_f[i][nx[i] + j];
-        }
     }
 
     // State-continuity constraints, and state/control bounds
     for (int_t i = 0; i < N; i++) {
         for (int_t j = 0; j < nx[i]; j++) {
             qp_b[i][j] = h[i][j] - nlp_x[i + 1][j];
+            if (qp_hpipm) continue;
             for (int_t k = 0; k < nx[i]; k++) {
                 qp_A[i][k * nx[i] + j] = jac_h[i][k * nx[i] + j];
             }
@@ -104,6 +114,8 @@ void prepare_qp(const ocp_nlp_in *nlp_in, ocp_nlp_sqp_args *sqp_args,
                 qp_B[i][k * nx[i] + j] = jac_h[i][(nx[i] + k) * nx[i] + j];
             }
         }
+        if (qp_hpipm)
+            ocp_qp_hpipm_in_set_dynamics(qp_hpipm, i, jac_h[i], qp_b[i]);
         for (int_t j = 0; j < nb[i]; j++) {
 #ifdef FLIP_BOUNDS
             if (idxb[i][j] < nu[i]) {
@@ -123,18 +135,26 @@ void prepare_qp(const ocp_nlp_in *nlp_in, ocp_nlp_sqp_args *sqp_args,
             }
 #endif
         }
+        if (qp_hpipm)
+            ocp_qp_hpipm_in_set_bounds(qp_hpipm, i, qp_in->idxb[i], qp_lb[i], qp_ub[i]);
     }
+    // The terminal bounds are not linearized above, pass them on as they are
+    if (qp_hpipm)
+        ocp_qp_hpipm_in_set_bounds(qp_hpipm, N, qp_in->idxb[N], qp_lb[N], qp_ub[N]);
 
     // Path constraints
     for (int_t i = 0; i <= N; i++) {
         for (int_t j = 0; j < ng[i]; j++) {
             qp_lc[i][j] = nlp_lg[i][j] - g[i][j];
             qp_uc[i][j] = nlp_ug[i][j] - g[i][j];
+            if (qp_hpipm) continue;
             for (int_t k = 0; k < nx[i]; k++)
                 qp_Cx[i][k * ng[i] + j] = jac_g[i][k * ng[i] + j];
             for (int_t k = 0; k < nu[i]; k++)
                 qp_Cu[i][k * ng[i] + j] = jac_g[i][(nx[i] + k) * ng[i] + j];
         }
+        if (qp_hpipm)
+            ocp_qp_hpipm_in_set_constraints(qp_hpipm, i, jac_g[i], qp_lc[i], qp_uc[i]);
     }
 }
 
@@ -197,26 +217,180 @@ void store_variables(const ocp_nlp_in *nlp_in, ocp_nlp_out *nlp_out,
     }
 }
 
+// Infinity norms of the KKT residuals at the current iterate, using the
+// multipliers of the last QP in the HPIPM sign convention, i.e.
+// grad_z L = grad_f + jac_h' * pi_i - [pi_{i-1}; 0] + lam_ub - lam_lb
+//            + jac_g' * (lam_ug - lam_lg)
+static void compute_kkt_residuals(const ocp_nlp_in *nlp_in,
+                                  ocp_nlp_sqp_memory *sqp_mem, real_t *res_stat,
+                                  real_t *res_eq, real_t *res_ineq,
+                                  real_t *res_comp) {
+    const int_t N = nlp_in->N;
+    const int_t *nx = nlp_in->nx;
+    const int_t *nu = nlp_in->nu;
+    const int_t *nb = nlp_in->nb;
+    const int_t *ng = nlp_in->ng;
+    const int_t **idxb = nlp_in->idxb;
+
+    real_t **grad_f = (real_t **)sqp_mem->common->grad_f;
+    real_t **jac_h = (real_t **)sqp_mem->common->jac_h;
+    real_t **jac_g = (real_t **)sqp_mem->common->jac_g;
+    real_t **h = (real_t **)sqp_mem->common->h;
+    real_t **g = (real_t **)sqp_mem->common->g;
+
+    real_t **nlp_x = (real_t **)sqp_mem->common->x;
+    real_t **nlp_u = (real_t **)sqp_mem->common->u;
+    real_t **nlp_pi = (real_t **)sqp_mem->common->pi;
+    real_t **nlp_lam = (real_t **)sqp_mem->common->lam;
+
+    *res_stat = 0;
+    *res_eq = 0;
+    *res_ineq = 0;
+    *res_comp = 0;
+
+    for (int_t i = 0; i <= N; i++) {
+        const real_t *lam_lb = nlp_lam[i];
+        const real_t *lam_ub = nlp_lam[i] + nb[i];
+        const real_t *lam_lg = nlp_lam[i] + 2 * nb[i];
+        const real_t *lam_ug = nlp_lam[i] + 2 * nb[i] + ng[i];
+
+        // Stationarity, variables ordered as [x; u]
+        for (int_t k = 0; k < nx[i] + nu[i]; k++) {
+            real_t grad_lag = grad_f[i][k];
+            if (i < N) {
+                for (int_t j = 0; j < nx[i + 1]; j++)
+                    grad_lag += jac_h[i][k * nx[i] + j] * nlp_pi[i][j];
+            }
+            if (i > 0 && k < nx[i]) grad_lag -= nlp_pi[i - 1][k];
+            for (int_t j = 0; j < nb[i]; j++) {
+#ifdef FLIP_BOUNDS
+                int_t idx = (idxb[i][j] < nu[i]) ? nx[i] + idxb[i][j]
+                                                 : idxb[i][j] - nu[i];
+#else
+                int_t idx = idxb[i][j];
+#endif
+                if (idx == k) grad_lag += lam_ub[j] - lam_lb[j];
+            }
+            for (int_t j = 0; j < ng[i]; j++)
+                grad_lag += jac_g[i][k * ng[i] + j] * (lam_ug[j] - lam_lg[j]);
+            *res_stat = fmax(*res_stat, fabs(grad_lag));
+        }
+
+        // Continuity constraints
+        if (i < N) {
+            for (int_t j = 0; j < nx[i + 1]; j++)
+                *res_eq = fmax(*res_eq, fabs(h[i][j] - nlp_x[i + 1][j]));
+        }
+
+        // Bounds and path constraints, together with complementarity
+        for (int_t j = 0; j < nb[i]; j++) {
+#ifdef FLIP_BOUNDS
+            real_t z = (idxb[i][j] < nu[i]) ? nlp_u[i][idxb[i][j]]
+                                            : nlp_x[i][idxb[i][j] - nu[i]];
+#else
+            real_t z = (idxb[i][j] < nx[i]) ? nlp_x[i][idxb[i][j]]
+                                            : nlp_u[i][idxb[i][j] - nx[i]];
+#endif
+            real_t slack_lb = z - nlp_in->lb[i][j];
+            real_t slack_ub = nlp_in->ub[i][j] - z;
+            *res_ineq = fmax(*res_ineq, fmax(-slack_lb, -slack_ub));
+            *res_comp = fmax(*res_comp, fabs(lam_lb[j] * slack_lb));
+            *res_comp = fmax(*res_comp, fabs(lam_ub[j] * slack_ub));
+        }
+        for (int_t j = 0; j < ng[i]; j++) {
+            real_t slack_lg = g[i][j] - nlp_in->lg[i][j];
+            real_t slack_ug = nlp_in->ug[i][j] - g[i][j];
+            *res_ineq = fmax(*res_ineq, fmax(-slack_lg, -slack_ug));
+            *res_comp = fmax(*res_comp, fabs(lam_lg[j] * slack_lg));
+            *res_comp = fmax(*res_comp, fabs(lam_ug[j] * slack_ug));
+        }
+    }
+}
+
+// Store the KKT residuals of the current iterate as entry iter of the stats
+// and compare them with the tolerances
+static bool check_kkt_residuals(const ocp_nlp_in *nlp_in,
+                                const ocp_nlp_sqp_args *sqp_args,
+                                ocp_nlp_sqp_memory *sqp_mem, int_t iter) {
+    ocp_nlp_sqp_stats *stats = sqp_mem->stats;
+
+    compute_kkt_residuals(nlp_in, sqp_mem, &stats->res_stat[iter],
+                          &stats->res_eq[iter], &stats->res_ineq[iter],
+                          &stats->res_comp[iter]);
+    return stats->res_stat[iter] < sqp_args->tol_stat &&
+           stats->res_eq[iter] < sqp_args->tol_eq &&
+           stats->res_ineq[iter] < sqp_args->tol_ineq &&
+           stats->res_comp[iter] < sqp_args->tol_comp;
+}
+
+// Overwrite the QP bounds on the initial state with the deviation of the
+// measured state x0 from the current linearization point
+static void embed_initial_state(const ocp_nlp_in *nlp_in,
+                                ocp_nlp_sqp_args *sqp_args,
+                                ocp_nlp_sqp_memory *sqp_mem, const real_t *x0) {
+    const int_t *nb = nlp_in->nb;
+    const int_t **idxb = nlp_in->idxb;
+
+    real_t **qp_lb = (real_t **)sqp_args->qp_solver->qp_in->lb;
+    real_t **qp_ub = (real_t **)sqp_args->qp_solver->qp_in->ub;
+    real_t **nlp_x = (real_t **)sqp_mem->common->x;
+
+#ifdef FLIP_BOUNDS
+    const int_t *nu = nlp_in->nu;
+#else
+    const int_t *nx = nlp_in->nx;
+#endif
+
+    for (int_t j = 0; j < nb[0]; j++) {
+#ifdef FLIP_BOUNDS
+        if (idxb[0][j] >= nu[0]) {
+            int_t k = idxb[0][j] - nu[0];
+            qp_lb[0][j] = x0[k] - nlp_x[0][k];
+            qp_ub[0][j] = x0[k] - nlp_x[0][k];
+        }
+#else
+        if (idxb[0][j] < nx[0]) {
+            int_t k = idxb[0][j];
+            qp_lb[0][j] = x0[k] - nlp_x[0][k];
+            qp_ub[0][j] = x0[k] - nlp_x[0][k];
+        }
+#endif
+    }
+    if (sqp_mem->qp_hpipm)
+        ocp_qp_hpipm_in_set_bounds(sqp_mem->qp_hpipm, 0, sqp_args->qp_solver->qp_in->idxb[0],
+                                   qp_lb[0], qp_ub[0]);
+}
+
 ocp_nlp_sqp_args *ocp_nlp_sqp_create_arguments() {
     ocp_nlp_sqp_args *args =
         (ocp_nlp_sqp_args *)malloc(sizeof(ocp_nlp_sqp_args));
     args->maxIter = 10;
+    args->tol_stat = 1e-8;
+    args->tol_eq = 1e-8;
+    args->tol_ineq = 1e-8;
+    args->tol_comp = 1e-8;
+    args->qp_in_hpipm = 0;
 
     return args;
 }
 
 int_t ocp_nlp_sqp_calculate_memory_size(const ocp_nlp_in *nlp_in, void *args_) {
+    ocp_nlp_sqp_args *args = (ocp_nlp_sqp_args *)args_;
+
     int_t size = sizeof(ocp_nlp_sqp_memory);
 
     size += ocp_nlp_calculate_memory_size(nlp_in);
     size += sizeof(ocp_nlp_sm_in);
     size += sizeof(ocp_nlp_sm_out);
+    size += sizeof(ocp_nlp_sqp_stats);
+    size += 4 * (args->maxIter + 1) * sizeof(real_t);  // res_stat, res_eq, res_ineq, res_comp
 
     return size;
 }
 
 char *ocp_nlp_sqp_assign_memory(const ocp_nlp_in *nlp_in, void *args_,
                                 void **mem_, void *raw_memory) {
+    ocp_nlp_sqp_args *args = (ocp_nlp_sqp_args *)args_;
     ocp_nlp_sqp_memory **sqp_memory = (ocp_nlp_sqp_memory **)mem_;
     char *c_ptr = (char *)raw_memory;
 
@@ -232,6 +406,25 @@ char *ocp_nlp_sqp_assign_memory(const ocp_nlp_in *nlp_in, void *args_,
     (*sqp_memory)->sm_out = (ocp_nlp_sm_out *)c_ptr;
     c_ptr += sizeof(ocp_nlp_sm_out);
 
+    (*sqp_memory)->qp_hpipm = NULL;
+
+    ocp_nlp_sqp_stats *stats = (ocp_nlp_sqp_stats *)c_ptr;
+    c_ptr += sizeof(ocp_nlp_sqp_stats);
+    stats->sqp_iter = 0;
+    stats->converged = false;
+    stats->max_iter = args->maxIter;
+
+    stats->res_stat = (real_t *)c_ptr;
+    c_ptr += (args->maxIter + 1) * sizeof(real_t);
+    stats->res_eq = (real_t *)c_ptr;
+    c_ptr += (args->maxIter + 1) * sizeof(real_t);
+    stats->res_ineq = (real_t *)c_ptr;
+    c_ptr += (args->maxIter + 1) * sizeof(real_t);
+    stats->res_comp = (real_t *)c_ptr;
+    c_ptr += (args->maxIter + 1) * sizeof(real_t);
+
+    (*sqp_memory)->stats = stats;
+
     return c_ptr;
 }
 
@@ -290,16 +483,27 @@ int_t ocp_nlp_sqp(const ocp_nlp_in *nlp_in, ocp_nlp_out *nlp_out, void *args_,
     ocp_nlp_sqp_args *sqp_args = (ocp_nlp_sqp_args *)args_;
     ocp_nlp_sqp_memory *sqp_mem = (ocp_nlp_sqp_memory *)memory_;
 
-    // SQP iterations
-    int_t max_sqp_iterations = sqp_args->maxIter;
+    ocp_nlp_sqp_stats *stats = sqp_mem->stats;
+    stats->sqp_iter = 0;
+    stats->converged = false;
+
+    // The residuals are stored for every iteration, sized by maxIter at memory creation
+    if (sqp_args->maxIter > stats->max_iter) return -1;
 
-    for (int_t sqp_iter = 0; sqp_iter < max_sqp_iterations; sqp_iter++) {
+    // SQP iterations
+    for (int_t sqp_iter = 0; sqp_iter < sqp_args->maxIter; sqp_iter++) {
         // Compute/update quadratic approximation
         sqp_args->sensitivity_method->fun(sqp_mem->sm_in, sqp_mem->sm_out,
                                           sqp_args->sensitivity_method->args,
                                           sqp_args->sensitivity_method->mem,
                                           sqp_args->sensitivity_method->work);
 
+        // Check optimality of the current iterate
+        if (check_kkt_residuals(nlp_in, sqp_args, sqp_mem, sqp_iter)) {
+            stats->converged = true;
+            break;
+        }
+
         // Prepare QP
         prepare_qp(nlp_in, sqp_args, sqp_mem);
 
@@ -312,21 +516,16 @@ int_t ocp_nlp_sqp(const ocp_nlp_in *nlp_in, ocp_nlp_out *nlp_out, void *args_,
 
         // Update optimization variables (globalization)
         update_variables(nlp_in, sqp_args, sqp_mem);
+        stats->sqp_iter++;
+    }
 
-        // TODO(nielsvd): debug, remove... Norm of step-size
-        // real_t norm_step = 0;
-        // for (int_t i = 0; i <= nlp_in->N; i++) {
-        //     for (int_t j = 0; j < nlp_in->nx[i]; j++) {
-        //         norm_step += (sqp_args->qp_solver->qp_out->x[i][j]) *
-        //                      (sqp_args->qp_solver->qp_out->x[i][j]);
-        //     }
-        //     for (int_t j = 0; j < nlp_in->nu[i]; j++) {
-        //         norm_step += (sqp_args->qp_solver->qp_out->u[i][j]) *
-        //                      (sqp_args->qp_solver->qp_out->u[i][j]);
-        //     }
-        // }
-        // norm_step = sqrt(norm_step);
-        // printf("Norm_step = %.10e\n", norm_step);
+    // Check optimality of the iterate after the last QP step
+    if (!stats->converged && stats->sqp_iter == sqp_args->maxIter) {
+        sqp_args->sensitivity_method->fun(sqp_mem->sm_in, sqp_mem->sm_out,
+                                          sqp_args->sensitivity_method->args,
+                                          sqp_args->sensitivity_method->mem,
+                                          sqp_args->sensitivity_method->work);
+        stats->converged = check_kkt_residuals(nlp_in, sqp_args, sqp_mem, stats->sqp_iter);
     }
 
     // Post-process solution
@@ -335,6 +534,88 @@ int_t ocp_nlp_sqp(const ocp_nlp_in *nlp_in, ocp_nlp_out *nlp_out, void *args_,
     return return_status;
 }
 
+int_t ocp_nlp_sqp_rti_preparation(const ocp_nlp_in *nlp_in, void *args_,
+                                  void *memory_, void *workspace_) {
+    ocp_nlp_sqp_args *sqp_args = (ocp_nlp_sqp_args *)args_;
+    ocp_nlp_sqp_memory *sqp_mem = (ocp_nlp_sqp_memory *)memory_;
+
+    // Integration and linearization at the current iterate
+    sqp_args->sensitivity_method->fun(sqp_mem->sm_in, sqp_mem->sm_out,
+                                      sqp_args->sensitivity_method->args,
+                                      sqp_args->sensitivity_method->mem,
+                                      sqp_args->sensitivity_method->work);
+
+    // All QP data, the initial state bounds are overwritten in the feedback
+    prepare_qp(nlp_in, sqp_args, sqp_mem);
+
+    // Solver work that does not depend on the initial state, e.g. condensing
+    ocp_qp_solver *qp_solver = sqp_args->qp_solver;
+    if (qp_solver->prepare != NULL)
+        return qp_solver->prepare(qp_solver->qp_in, qp_solver->args, qp_solver->mem,
+                                  qp_solver->work);
+
+    return 0;
+}
+
+int_t ocp_nlp_sqp_rti_feedback(const ocp_nlp_in *nlp_in, ocp_nlp_out *nlp_out,
+                               const real_t *x0, void *args_, void *memory_,
+                               void *workspace_) {
+    ocp_nlp_sqp_args *sqp_args = (ocp_nlp_sqp_args *)args_;
+    ocp_nlp_sqp_memory *sqp_mem = (ocp_nlp_sqp_memory *)memory_;
+
+    embed_initial_state(nlp_in, sqp_args, sqp_mem, x0);
+
+    int_t qp_status = sqp_args->qp_solver->fun(
+        sqp_args->qp_solver->qp_in, sqp_args->qp_solver->qp_out,
+        sqp_args->qp_solver->args, sqp_args->qp_solver->mem,
+        sqp_args->qp_solver->work);
+
+    // Full step, as in a single SQP iteration
+    update_variables(nlp_in, sqp_args, sqp_mem);
+    store_variables(nlp_in, nlp_out, sqp_mem);
+
+    return qp_status;
+}
+
+void ocp_nlp_sqp_shift(const ocp_nlp_in *nlp_in, void *args_, void *memory_) {
+    ocp_nlp_sqp_memory *sqp_mem = (ocp_nlp_sqp_memory *)memory_;
+    (void)args_;
+
+    const int_t N = nlp_in->N;
+    const int_t *nx = nlp_in->nx;
+    const int_t *nu = nlp_in->nu;
+    const int_t *nb = nlp_in->nb;
+    const int_t *ng = nlp_in->ng;
+
+    real_t **nlp_x = (real_t **)sqp_mem->common->x;
+    real_t **nlp_u = (real_t **)sqp_mem->common->u;
+    real_t **nlp_pi = (real_t **)sqp_mem->common->pi;
+    real_t **nlp_lam = (real_t **)sqp_mem->common->lam;
+    sim_solver **sim = (sim_solver **)nlp_in->sim;
+
+    for (int_t i = 0; i < N; i++) {
+        if (nx[i] == nx[i + 1]) {
+            for (int_t j = 0; j < nx[i]; j++) nlp_x[i][j] = nlp_x[i + 1][j];
+        }
+        if (nb[i] == nb[i + 1] && ng[i] == ng[i + 1]) {
+            for (int_t j = 0; j < 2 * nb[i] + 2 * ng[i]; j++)
+                nlp_lam[i][j] = nlp_lam[i + 1][j];
+        }
+        if (i == N - 1) break;  // the last interval keeps u, pi and the integrator
+
+        if (nu[i] == nu[i + 1]) {
+            for (int_t j = 0; j < nu[i]; j++) nlp_u[i][j] = nlp_u[i + 1][j];
+        }
+        if (nx[i + 1] == nx[i + 2]) {
+            for (int_t j = 0; j < nx[i + 1]; j++) nlp_pi[i][j] = nlp_pi[i + 1][j];
+        }
+        if (sim[i]->shift_memory != NULL && sim[i]->shift_memory == sim[i + 1]->shift_memory &&
+            nx[i] == nx[i + 1] && nu[i] == nu[i + 1]) {
+            sim[i]->shift_memory(sim[i]->in, sim[i]->args, sim[i]->mem, sim[i + 1]->mem);
+        }
+    }
+}
+
 void ocp_nlp_sqp_initialize(const ocp_nlp_in *nlp_in, void *args_, void **mem_,
                             void **work_) {
     ocp_nlp_sqp_args *args = (ocp_nlp_sqp_args *)args_;
@@ -350,6 +631,16 @@ void ocp_nlp_sqp_initialize(const ocp_nlp_in *nlp_in, void *args_, void **mem_,
     ocp_nlp_sm *nlp_sm = args->sensitivity_method;
     ocp_qp_solver *qp_solver = args->qp_solver;
 
+    // Multipliers start at zero
+    for (int_t i = 0; i <= nlp_in->N; i++) {
+        if (i < nlp_in->N) {
+            for (int_t j = 0; j < nlp_in->nx[i + 1]; j++)
+                (*mem)->common->pi[i][j] = 0.0;
+        }
+        for (int_t j = 0; j < 2 * nlp_in->nb[i] + 2 * nlp_in->ng[i]; j++)
+            (*mem)->common->lam[i][j] = 0.0;
+    }
+
     // Sensitivity method input
     sm_in->N = nlp_in->N;
     sm_in->nx = nlp_in->nx;
@@ -376,6 +667,8 @@ void ocp_nlp_sqp_initialize(const ocp_nlp_in *nlp_in, void *args_, void **mem_,
     nlp_sm->initialize(sm_in, nlp_sm->args, &nlp_sm->mem, &nlp_sm->work);
     qp_solver->initialize(qp_solver->qp_in, qp_solver->args, &qp_solver->mem,
                           &qp_solver->work);
+    (*mem)->qp_hpipm =
+        args->qp_in_hpipm ? ocp_qp_hpipm_in_attach(qp_solver) : NULL;
 }
 
 void ocp_nlp_sqp_destroy(void *mem_, void *work_) {
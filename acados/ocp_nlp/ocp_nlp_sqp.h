@@ -27,24 +27,49 @@ extern "C" {
 #include "acados/ocp_nlp/ocp_nlp_common.h"
 #include "acados/ocp_nlp/ocp_nlp_sm_common.h"
 #include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/ocp_qp/ocp_qp_hpipm_in.h"
 #include "acados/utils/types.h"
 
 typedef struct {
     int_t maxIter;
+    // Tolerances on the infinity norms of the KKT residuals, the SQP method
+    // terminates as soon as all four are met
+    real_t tol_stat;
+    real_t tol_eq;
+    real_t tol_ineq;
+    real_t tol_comp;
+    // Write the QP matrices directly into the HPIPM structure of the QP
+    // solver (see ocp_qp_hpipm_in.h), if the solver supports it
+    int_t qp_in_hpipm;
     ocp_qp_solver *qp_solver;
     ocp_nlp_sm *sensitivity_method;
     // char qp_solver_name[MAX_STR_LEN];
     // char sm_method_name[MAX_STR_LEN];
 } ocp_nlp_sqp_args;
 
+typedef struct {
+    int_t sqp_iter;  // number of SQP iterations, i.e. QP solves
+    bool converged;
+    // KKT residuals at the start of every iteration and at the final iterate,
+    // sqp_iter + 1 entries, at most max_iter + 1 (maxIter at memory creation,
+    // ocp_nlp_sqp returns -1 if maxIter is increased afterwards)
+    int_t max_iter;
+    real_t *res_stat;
+    real_t *res_eq;
+    real_t *res_ineq;
+    real_t *res_comp;
+} ocp_nlp_sqp_stats;
+
 typedef struct {
     ocp_nlp_memory *common;
+    ocp_nlp_sqp_stats *stats;
 
     // TODO(nielsvd): qp solver and sensitivity method
     //       could be automatically initialized for user
     //       convenience, look into this!
     ocp_nlp_sm_in *sm_in;
     ocp_nlp_sm_out *sm_out;
+    struct d_ocp_qp *qp_hpipm;  // NULL if the QP data goes through qp_in
     // ocp_qp_solver *qp_solver;
     // ocp_nlp_sm *sensitivity_method;
 } ocp_nlp_sqp_memory;
@@ -73,6 +98,25 @@ ocp_nlp_sqp_workspace *ocp_nlp_sqp_create_workspace(const ocp_nlp_in *nlp_in,
 int_t ocp_nlp_sqp(const ocp_nlp_in *nlp_in, ocp_nlp_out *nlp_out, void *args_,
                   void *memory_, void *workspace_);
 
+// Real-time iteration: the preparation phase linearizes the NLP at the current
+// iterate, sets up the QP and, if the QP solver has a prepare function (e.g.
+// condensing), does that part of the QP solution too. None of it depends on
+// the initial state. The feedback phase embeds the measured initial state x0,
+// solves the prepared QP and writes the updated iterate (including u[0]) to
+// nlp_out. Every feedback has to be preceded by a preparation.
+int_t ocp_nlp_sqp_rti_preparation(const ocp_nlp_in *nlp_in, void *args_,
+                                  void *memory_, void *workspace_);
+
+int_t ocp_nlp_sqp_rti_feedback(const ocp_nlp_in *nlp_in, ocp_nlp_out *nlp_out,
+                               const real_t *x0, void *args_, void *memory_,
+                               void *workspace_);
+
+// Shift of the iterate by one shooting interval when the horizon advances by
+// one sample: x, u and the multipliers, and the memory of integrators with
+// lifted variables (see sim_solver.shift_memory). The last interval keeps its
+// values. Variables are only shifted between intervals of equal dimensions.
+void ocp_nlp_sqp_shift(const ocp_nlp_in *nlp_in, void *args_, void *memory_);
+
 void ocp_nlp_sqp_initialize(const ocp_nlp_in *nlp_in, void *args_, void **mem_,
                             void **work_);
 
@@ -0,0 +1,126 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "acados/ocp_qp/ocp_qp_batch.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/utils/threads.h"
+#include "acados/utils/timing.h"
+#include "acados/utils/types.h"
+
+typedef struct {
+    ocp_qp_batch_solver *batch;
+    ocp_qp_in **qp_in;
+    ocp_qp_out **qp_out;
+} ocp_qp_batch_task;
+
+static void ocp_qp_batch_solve_instance(void *ctx, int_t k, int_t thread_id) {
+    ocp_qp_batch_task *task = (ocp_qp_batch_task *)ctx;
+    ocp_qp_solver *solver = task->batch->solvers[k];
+    ocp_qp_in *qp_in = task->qp_in != NULL ? task->qp_in[k] : solver->qp_in;
+    ocp_qp_out *qp_out = task->qp_out != NULL ? task->qp_out[k] : solver->qp_out;
+
+    acados_timer timer;
+    acados_tic(&timer);
+    task->batch->status[k] = solver->fun(qp_in, qp_out, solver->args, solver->mem, solver->work);
+    task->batch->time[k] = acados_toc(&timer);
+    task->batch->thread_id[k] = thread_id;
+}
+
+ocp_qp_batch_args *ocp_qp_batch_create_arguments() {
+    ocp_qp_batch_args *args = (ocp_qp_batch_args *)malloc(sizeof(ocp_qp_batch_args));
+    args->num_threads = 1;
+    args->pin_threads = false;
+
+    return args;
+}
+
+ocp_qp_batch_solver *create_ocp_qp_batch_solver(int_t num_instances, ocp_qp_in **qp_in,
+                                                const char *solver_name, ocp_qp_batch_args *args) {
+    int_t size = sizeof(ocp_qp_batch_solver);
+    size += num_instances * sizeof(ocp_qp_solver *);
+    size += 2 * num_instances * sizeof(int_t);  // status, thread_id
+    size = (size + 7) / 8 * 8;
+    size += num_instances * sizeof(real_t);  // time
+
+    char *c_ptr = (char *)malloc(size);
+    char *ptr_end = c_ptr + size;
+
+    ocp_qp_batch_solver *batch = (ocp_qp_batch_solver *)c_ptr;
+    c_ptr += sizeof(ocp_qp_batch_solver);
+
+    batch->num_instances = num_instances;
+
+    batch->solvers = (ocp_qp_solver **)c_ptr;
+    c_ptr += num_instances * sizeof(ocp_qp_solver *);
+
+    batch->status = (int_t *)c_ptr;
+    c_ptr += num_instances * sizeof(int_t);
+
+    batch->thread_id = (int_t *)c_ptr;
+    c_ptr += num_instances * sizeof(int_t);
+
+    c_ptr = (char *)(((size_t)c_ptr + 7) / 8 * 8);
+    batch->time = (real_t *)c_ptr;
+    c_ptr += num_instances * sizeof(real_t);
+
+    assert(ptr_end >= c_ptr); (void)ptr_end;
+
+    for (int_t k = 0; k < num_instances; k++) {
+        batch->solvers[k] = create_ocp_qp_solver(qp_in[k], solver_name, NULL);
+        batch->status[k] = 0;
+        batch->thread_id[k] = 0;
+        batch->time[k] = 0.0;
+    }
+
+    batch->pool = acados_thread_pool_create(args->num_threads);
+    batch->num_threads = acados_thread_pool_num_threads(batch->pool);
+    if (args->pin_threads) acados_thread_pool_pin(batch->pool);
+
+    return batch;
+}
+
+int_t ocp_qp_batch_solve(ocp_qp_batch_solver *batch, ocp_qp_in **qp_in, ocp_qp_out **qp_out) {
+    ocp_qp_batch_task task = {batch, qp_in, qp_out};
+    acados_thread_pool_run_items(batch->pool, batch->num_instances, &ocp_qp_batch_solve_instance,
+                                 &task);
+
+    int_t num_failed = 0;
+    for (int_t k = 0; k < batch->num_instances; k++)
+        if (batch->status[k] != 0) num_failed++;
+
+    return num_failed;
+}
+
+void ocp_qp_batch_destroy(ocp_qp_batch_solver *batch) {
+    if (batch == NULL) return;
+
+    acados_thread_pool_destroy(batch->pool);
+    for (int_t k = 0; k < batch->num_instances; k++) {
+        ocp_qp_solver *solver = batch->solvers[k];
+        solver->destroy(solver->mem, solver->work);
+        free(solver->qp_out);
+        free(solver->args);
+        free(solver);
+    }
+    free(batch);
+}
@@ -0,0 +1,69 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef ACADOS_OCP_QP_OCP_QP_BATCH_H_
+#define ACADOS_OCP_QP_OCP_QP_BATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/utils/threads.h"
+#include "acados/utils/types.h"
+
+// Batch of independent OCP QPs, e.g. one per vehicle of a fleet, that are solved by a pool of
+// worker threads. Every instance has its own QP solver (arguments, memory and workspace), so the
+// instances may have different dimensions and can be tuned separately through solvers[k]->args.
+// Idle threads pick the next unsolved instance, which balances instances of different size.
+
+typedef struct {
+    int_t num_threads;  // number of threads, including the calling thread
+    bool pin_threads;  // pin every worker thread to its own processor
+} ocp_qp_batch_args;
+
+typedef struct {
+    int_t num_instances;
+    ocp_qp_solver **solvers;  // solvers[num_instances]
+    int_t *status;  // return value of the last solve of every instance
+    real_t *time;  // wall time of the last solve of every instance [s]
+    int_t *thread_id;  // thread that did the last solve of every instance
+    int_t num_threads;  // number of threads that are actually used
+    acados_thread_pool *pool;
+} ocp_qp_batch_solver;
+
+ocp_qp_batch_args *ocp_qp_batch_create_arguments();
+
+// Creates one solver of type solver_name with default arguments for each qp_in[k]
+ocp_qp_batch_solver *create_ocp_qp_batch_solver(int_t num_instances, ocp_qp_in **qp_in,
+                                                const char *solver_name, ocp_qp_batch_args *args);
+
+// Solves all instances, qp_in and qp_out may be NULL to use the ones of the solvers. Instance k
+// must keep the dimensions it had at creation. Returns the number of instances with nonzero status.
+int_t ocp_qp_batch_solve(ocp_qp_batch_solver *batch, ocp_qp_in **qp_in, ocp_qp_out **qp_out);
+
+void ocp_qp_batch_destroy(ocp_qp_batch_solver *batch);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // ACADOS_OCP_QP_OCP_QP_BATCH_H_
@@ -365,6 +365,26 @@ void ocp_qp_in_copy_objective(const real_t *Q, const real_t *S, const real_t *R,
         memcpy(hr[stage], r, qp_in->nu[stage]*sizeof(real_t));
 }
 
+void ocp_qp_out_shift(const ocp_qp_in *qp_in, ocp_qp_out *qp_out) {
+
+    int_t N = qp_in->N;
+    const int_t *nx = qp_in->nx;
+    const int_t *nu = qp_in->nu;
+    const int_t *nb = qp_in->nb;
+    const int_t *nc = qp_in->nc;
+
+    for (int_t k = 0; k < N; k++) {
+        if (nx[k] == nx[k+1])
+            memcpy(qp_out->x[k], qp_out->x[k+1], nx[k]*sizeof(real_t));
+        if (k < N-1 && nu[k] == nu[k+1])
+            memcpy(qp_out->u[k], qp_out->u[k+1], nu[k]*sizeof(real_t));
+        if (k < N-1 && nx[k+1] == nx[k+2])
+            memcpy(qp_out->pi[k], qp_out->pi[k+1], nx[k+1]*sizeof(real_t));
+        if (nb[k] == nb[k+1] && nc[k] == nc[k+1])
+            memcpy(qp_out->lam[k], qp_out->lam[k+1], 2*(nb[k]+nc[k])*sizeof(real_t));
+    }
+}
+
 ocp_qp_solver *create_ocp_qp_solver(const ocp_qp_in *qp_in, const char *solver_name,
                                     void *solver_options) {
     ocp_qp_solver *qp_solver = (ocp_qp_solver *) malloc(sizeof(ocp_qp_solver));
@@ -377,6 +397,7 @@ ocp_qp_solver *create_ocp_qp_solver(const ocp_qp_in *qp_in, const char *solver_n
         if (qp_solver->args == NULL)
             qp_solver->args = ocp_qp_qpdunes_create_arguments(QPDUNES_NONLINEAR_MPC);
         qp_solver->fun = &ocp_qp_qpdunes;
+        qp_solver->prepare = NULL;
         qp_solver->initialize = &ocp_qp_qpdunes_initialize;
         qp_solver->destroy = &ocp_qp_qpdunes_destroy;
 #ifdef OOQP
@@ -384,6 +405,7 @@ ocp_qp_solver *create_ocp_qp_solver(const ocp_qp_in *qp_in, const char *solver_n
         if (qp_solver->args == NULL)
             qp_solver->args = ocp_qp_ooqp_create_arguments();
         qp_solver->fun = &ocp_qp_ooqp;
+        qp_solver->prepare = NULL;
         qp_solver->initialize = &ocp_qp_ooqp_initialize;
         qp_solver->destroy = &ocp_qp_ooqp_destroy;
 #endif
@@ -391,6 +413,7 @@ ocp_qp_solver *create_ocp_qp_solver(const ocp_qp_in *qp_in, const char *solver_n
         if (qp_solver->args == NULL)
             qp_solver->args = ocp_qp_condensing_qpoases_create_arguments(qp_in);
         qp_solver->fun = &ocp_qp_condensing_qpoases;
+        qp_solver->prepare = &ocp_qp_condensing_qpoases_prepare;
         qp_solver->initialize = &ocp_qp_condensing_qpoases_initialize;
         qp_solver->destroy = &ocp_qp_condensing_qpoases_destroy;
 #ifdef ACADOS_WITH_HPMPC
@@ -398,6 +421,7 @@ ocp_qp_solver *create_ocp_qp_solver(const ocp_qp_in *qp_in, const char *solver_n
         if (qp_solver->args == NULL)
             qp_solver->args = ocp_qp_hpmpc_create_arguments(qp_in, HPMPC_DEFAULT_ARGUMENTS);
         qp_solver->fun = &ocp_qp_hpmpc;
+        qp_solver->prepare = NULL;
         qp_solver->initialize = &ocp_qp_hpmpc_initialize;
         qp_solver->destroy = &ocp_qp_hpmpc_destroy;
 #endif
@@ -405,12 +429,14 @@ ocp_qp_solver *create_ocp_qp_solver(const ocp_qp_in *qp_in, const char *solver_n
         if (qp_solver->args == NULL)
             qp_solver->args = ocp_qp_condensing_hpipm_create_arguments(qp_in);
         qp_solver->fun = &ocp_qp_condensing_hpipm;
+        qp_solver->prepare = &ocp_qp_condensing_hpipm_prepare;
         qp_solver->initialize = &ocp_qp_condensing_hpipm_initialize;
         qp_solver->destroy = &ocp_qp_condensing_hpipm_destroy;
     } else if (!strcmp(solver_name, "hpipm")) {
         if (qp_solver->args == NULL)
             qp_solver->args = ocp_qp_hpipm_create_arguments(qp_in);
         qp_solver->fun = &ocp_qp_hpipm;
+        qp_solver->prepare = &ocp_qp_hpipm_prepare;
         qp_solver->initialize = &ocp_qp_hpipm_initialize;
         qp_solver->destroy = &ocp_qp_hpipm_destroy;
     } else {
@@ -59,6 +59,10 @@ typedef struct {
 
 typedef struct {
     int_t (*fun)(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args, void *mem, void *work);
+    // Optional (NULL if not supported): does the part of fun that does not depend on the bounds of
+    // the first stage, e.g. condensing, ahead of time. The next call of fun then only reads the
+    // bounds of stage 0 from qp_in, all other data must be left unchanged in between.
+    int_t (*prepare)(const ocp_qp_in *qp_in, void *args, void *mem, void *work);
     void (*initialize)(const ocp_qp_in *qp_in, void *args, void **mem, void **work);
     void (*destroy)(void *mem, void *work);
     ocp_qp_in *qp_in;
@@ -92,6 +96,10 @@ void ocp_qp_in_copy_dynamics(const real_t *A, const real_t *B, const real_t *b,
 void ocp_qp_in_copy_objective(const real_t *Q, const real_t *S, const real_t *R, const real_t *q,
                               const real_t *r, ocp_qp_in *qp_in, int_t stage);
 
+// Shift a QP solution one stage forward in time, e.g. to warm start the next MPC sample. The last
+// stage keeps its values and stages whose dimensions differ from the next stage are not changed.
+void ocp_qp_out_shift(const ocp_qp_in *qp_in, ocp_qp_out *qp_out);
+
 ocp_qp_solver *create_ocp_qp_solver(const ocp_qp_in *qp_in, const char *name, void *options);
 
 #ifdef __cplusplus
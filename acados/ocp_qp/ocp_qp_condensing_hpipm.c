@@ -83,6 +83,8 @@ static void ocp_qp_condensing_hpipm_initialize_default_args(const ocp_qp_in *qp_
     args->iter_max = 50;
     args->alpha_min = 1e-8;
     args->mu0 = 1;
+    args->warm_start = 0;
+    args->qp_in_hpipm = 0;
 
     int N = qp_in->N;
 
@@ -320,6 +322,9 @@ char *ocp_qp_condensing_hpipm_assign_memory(const ocp_qp_in *qp_in, void *args_,
     d_create_dense_qp_ipm(qpd, ipm_arg, ipm_workspace, c_ptr);
     c_ptr += ipm_workspace->memsize;
 
+    (*hpipm_memory)->first_run = 1;
+    (*hpipm_memory)->prepared = 0;
+
     //
     for (int_t ii = 0; ii <= N; ii++) {
         (*hpipm_memory)->hidxb_rev[ii] = (int_t *) c_ptr;
@@ -348,6 +353,146 @@ ocp_qp_condensing_hpipm_memory *ocp_qp_condensing_hpipm_create_memory(const ocp_
 
 
 
+// Average complementarity of the dense solution kept from the previous call, clipped to
+// [res_m_max, mu0], as initial barrier parameter for a warm start. Slacks and multipliers of the
+// kept solution are first clipped to sqrt(res_m_max) so that the warm start is strictly interior.
+static real_t ocp_qp_condensing_hpipm_warm_start_mu0(const struct d_dense_qp *qpd,
+                                                     struct d_dense_qp_sol *qpd_sol,
+                                                     const ocp_qp_condensing_hpipm_args *args) {
+    int_t nc = 2*(qpd->nb + qpd->ng);
+    real_t *lam = qpd_sol->lam->pa;
+    real_t *t = qpd_sol->t->pa;
+
+    real_t t_min = sqrt(args->res_m_max);
+    real_t mu0 = args->mu0;
+    if (nc > 0) {
+        real_t complementarity = 0;
+        for (int_t ii = 0; ii < nc; ii++) {
+            t[ii] = fmax(t[ii], t_min);
+            lam[ii] = fmax(lam[ii], t_min);
+            complementarity += lam[ii]*t[ii];
+        }
+        mu0 = complementarity/nc;
+    }
+    if (mu0 < args->res_m_max) mu0 = args->res_m_max;
+    if (mu0 > args->mu0) mu0 = args->mu0;
+
+    return mu0;
+}
+
+
+
+// Convert qp_in into the HPIPM QP (unless the data was written there directly) and condense it
+static void ocp_qp_condensing_hpipm_condense(const ocp_qp_in *qp_in,
+                                             const ocp_qp_condensing_hpipm_args *args,
+                                             ocp_qp_condensing_hpipm_memory *memory) {
+    int_t ii, jj;
+
+    struct d_ocp_qp *qp = memory->qp;
+    int_t **hidxb_rev = (int_t **) memory->hidxb_rev;
+
+    // extract problem size
+    int_t N = qp_in->N;
+    int_t *nx = (int_t *) qp_in->nx;
+    int_t *nu = (int_t *) qp_in->nu;
+    int_t *nb = (int_t *)qp_in->nb;
+
+    // extract input data
+    real_t **hA = (real_t **)qp_in->A;
+    real_t **hB = (real_t **)qp_in->B;
+    real_t **hb = (real_t **)qp_in->b;
+    real_t **hQ = (real_t **)qp_in->Q;
+    real_t **hS = (real_t **)qp_in->S;
+    real_t **hR = (real_t **)qp_in->R;
+    real_t **hq = (real_t **)qp_in->q;
+    real_t **hr = (real_t **)qp_in->r;
+    real_t **hd_lb = (real_t **)qp_in->lb;
+    real_t **hd_ub = (real_t **)qp_in->ub;
+    real_t **hC = (real_t **)qp_in->Cx;
+    real_t **hD = (real_t **)qp_in->Cu;
+    real_t **hd_lg = (real_t **)qp_in->lc;
+    real_t **hd_ug = (real_t **)qp_in->uc;
+    int_t **hidxb = (int_t **)qp_in->idxb;
+
+    if (!args->qp_in_hpipm) {
+        // compute bounds indeces in order [u; x]
+        for (ii = 0; ii <= N; ii++) {
+            for (jj = 0; jj < nb[ii]; jj++) {
+                if (hidxb[ii][jj] < nx[ii])  {  // state constraint
+                    hidxb_rev[ii][jj] = hidxb[ii][jj]+nu[ii];
+                } else  {  // input constraint
+                    hidxb_rev[ii][jj] = hidxb[ii][jj]-nx[ii];
+                }
+            }
+        }
+
+        // ocp qp structure
+        d_cvt_colmaj_to_ocp_qp(hA, hB, hb, hQ, hS, hR, hq, hr, hidxb_rev, hd_lb, hd_ub,
+                               hC, hD, hd_lg, hd_ug, NULL, NULL, NULL, NULL, NULL, qp);
+    }
+
+    // dense qp structure
+    d_cond_qp_ocp2dense(qp, memory->qpd, memory->cond_workspace);
+}
+
+
+
+// Copy the bounds of the first stage into the HPIPM QP and into the box constraints of the dense
+// QP on x0, which are the last nx[0] dense variables. The rest of the condensed QP is unchanged.
+static void ocp_qp_condensing_hpipm_update_x0_bounds(const ocp_qp_in *qp_in,
+                                                     const ocp_qp_condensing_hpipm_args *args,
+                                                     ocp_qp_condensing_hpipm_memory *memory) {
+    int_t ii, jj;
+
+    struct d_ocp_qp *qp = memory->qp;
+    struct d_dense_qp *qpd = memory->qpd;
+
+    int_t nx0 = qp_in->nx[0];
+    int_t nu0 = qp_in->nu[0];
+    int_t nb0 = qp_in->nb[0];
+    int_t ng0 = qp_in->nc[0];
+    int_t nvd = qpd->nv;
+    int_t nbd = qpd->nb;
+    int_t ngd = qpd->ng;
+
+    // bounds in order [lb; lg; ub; ug]
+    real_t *d0 = qp->d->pa;
+    real_t *dd = qpd->d->pa;
+
+    if (!args->qp_in_hpipm) {
+        for (jj = 0; jj < nb0; jj++) {
+            d0[jj] = qp_in->lb[0][jj];
+            d0[nb0+ng0+jj] = qp_in->ub[0][jj];
+        }
+    }
+
+    for (ii = 0; ii < nbd; ii++) {
+        int_t idx = qpd->idxb[ii] - (nvd - nx0);
+        if (idx < 0) continue;
+        for (jj = 0; jj < nb0; jj++) {
+            if (qp->idxb[0][jj] == nu0 + idx) {
+                dd[ii] = d0[jj];
+                dd[nbd+ngd+ii] = d0[nb0+ng0+jj];
+            }
+        }
+    }
+}
+
+
+
+int_t ocp_qp_condensing_hpipm_prepare(const ocp_qp_in *qp_in, void *args_, void *memory_,
+                                      void *workspace_) {
+    ocp_qp_condensing_hpipm_args *args = (ocp_qp_condensing_hpipm_args *) args_;
+    ocp_qp_condensing_hpipm_memory *memory = (ocp_qp_condensing_hpipm_memory *) memory_;
+
+    ocp_qp_condensing_hpipm_condense(qp_in, args, memory);
+    memory->prepared = 1;
+
+    return ACADOS_SUCCESS;
+}
+
+
+
 int_t ocp_qp_condensing_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out,
                             void *args_,
                             void *memory_,
@@ -375,49 +520,18 @@ int_t ocp_qp_condensing_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out,
         memory->cond_workspace;
     struct d_dense_qp_ipm_arg *ipm_arg = memory->ipm_arg;
     struct d_dense_qp_ipm_workspace *ipm_workspace = memory->ipm_workspace;
-    int_t **hidxb_rev = (int_t **) memory->hidxb_rev;
 
     // extract problem size
     int_t N = qp_in->N;
-    int_t *nx = (int_t *) qp_in->nx;
-    int_t *nu = (int_t *) qp_in->nu;
     int_t *nb = (int_t *)qp_in->nb;
     int_t *ng = (int_t *)qp_in->nc;
 
-    // extract input data
-    real_t **hA = (real_t **)qp_in->A;
-    real_t **hB = (real_t **)qp_in->B;
-    real_t **hb = (real_t **)qp_in->b;
-    real_t **hQ = (real_t **)qp_in->Q;
-    real_t **hS = (real_t **)qp_in->S;
-    real_t **hR = (real_t **)qp_in->R;
-    real_t **hq = (real_t **)qp_in->q;
-    real_t **hr = (real_t **)qp_in->r;
-    real_t **hd_lb = (real_t **)qp_in->lb;
-    real_t **hd_ub = (real_t **)qp_in->ub;
-    real_t **hC = (real_t **)qp_in->Cx;
-    real_t **hD = (real_t **)qp_in->Cu;
-    real_t **hd_lg = (real_t **)qp_in->lc;
-    real_t **hd_ug = (real_t **)qp_in->uc;
-    int_t **hidxb = (int_t **)qp_in->idxb;
-
     // extract output struct members
     real_t **hx = qp_out->x;
     real_t **hu = qp_out->u;
     real_t **hpi = qp_out->pi;
     real_t **hlam = qp_out->lam;
 
-    // compute bounds indeces in order [u; x]
-    for (ii = 0; ii <= N; ii++) {
-        for (jj = 0; jj < nb[ii]; jj++) {
-            if (hidxb[ii][jj] < nx[ii])  {  // state constraint
-                hidxb_rev[ii][jj] = hidxb[ii][jj]+nu[ii];
-            } else  {  // input constraint
-                hidxb_rev[ii][jj] = hidxb[ii][jj]-nx[ii];
-            }
-        }
-    }
-
     //
     for (ii = 0; ii <= N; ii++) {
         hlam_lb[ii] = hlam[ii];
@@ -426,17 +540,22 @@ int_t ocp_qp_condensing_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out,
         hlam_ug[ii] = hlam[ii] + 2 * nb[ii] + ng[ii];
     }
 
-    // ocp qp structure
-    d_cvt_colmaj_to_ocp_qp(hA, hB, hb, hQ, hS, hR, hq, hr, hidxb_rev, hd_lb, hd_ub,
-                           hC, hD, hd_lg, hd_ug, NULL, NULL, NULL, NULL, NULL, qp);
-
-    // ocp qp sol structure
-    d_cond_qp_ocp2dense(qp, qpd, cond_workspace);
-
-    // dense qp structure
-
+    // dense qp structure, only the bounds on x0 are new after ocp_qp_condensing_hpipm_prepare
+    if (memory->prepared)
+        ocp_qp_condensing_hpipm_update_x0_bounds(qp_in, args, memory);
+    else
+        ocp_qp_condensing_hpipm_condense(qp_in, args, memory);
+    memory->prepared = 0;
 
     // ipm structure
+    if (args->warm_start && !memory->first_run) {
+        ipm_arg->mu0 = ocp_qp_condensing_hpipm_warm_start_mu0(qpd, qpd_sol, args);
+        ipm_arg->warm_start = 1;
+    } else {
+        ipm_arg->mu0 = args->mu0;
+        ipm_arg->warm_start = 0;
+    }
+    memory->first_run = 0;
 
     // solve ipm
     d_solve_dense_qp_ipm(qpd, qpd_sol, ipm_arg, ipm_workspace);
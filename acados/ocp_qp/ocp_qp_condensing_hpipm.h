@@ -37,6 +37,8 @@ typedef struct ocp_qp_condensing_hpipm_args_ {
     real_t mu0;
     void *scrapspace;
     int_t iter_max;
+    int_t warm_start;  // start from the dense solution of the previous call
+    int_t qp_in_hpipm;  // 1: data is read from memory->qp (see ocp_qp_hpipm_in.h), not qp_in
 } ocp_qp_condensing_hpipm_args;
 
 // struct of the solver memory
@@ -55,6 +57,8 @@ typedef struct ocp_qp_condensing_hpipm_memory_ {
     int_t **hidxb_rev;
     real_t inf_norm_res[5];
     int_t iter;
+    int_t first_run;
+    int_t prepared;  // condensed by ocp_qp_condensing_hpipm_prepare, x0 bounds still to update
 } ocp_qp_condensing_hpipm_memory;
 
 ocp_qp_condensing_hpipm_args *ocp_qp_condensing_hpipm_create_arguments(const ocp_qp_in *qp_in);
@@ -69,6 +73,10 @@ ocp_qp_condensing_hpipm_memory *ocp_qp_condensing_hpipm_create_memory(const ocp_
 
 int_t ocp_qp_condensing_hpipm_calculate_workspace_size(const ocp_qp_in *qp_in, void *args_);
 
+// Converts and condenses the QP, see prepare in ocp_qp_solver
+int_t ocp_qp_condensing_hpipm_prepare(const ocp_qp_in *qp_in, void *args_, void *memory_,
+                                      void *workspace_);
+
 int_t ocp_qp_condensing_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_,
                               void *memory_, void *workspace_);
 
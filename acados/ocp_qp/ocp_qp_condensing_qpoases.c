@@ -101,6 +101,9 @@ static void ocp_qp_condensing_qpoases_initialize_default_args(const ocp_qp_in *q
     args->cputime = 1000.0;  // maximum cpu time in seconds
     args->warm_start = 0;
     args->nwsr = 1000;
+    args->hotstart = 2;
+    args->print_level = 0;
+    args->qp_in_hpipm = 0;
 
     int N = qp_in->N;
 
@@ -397,6 +400,8 @@ char *ocp_qp_condensing_qpoases_assign_memory(const ocp_qp_in *qp_in, void *args
         c_ptr += nb[ii]*sizeof(int);
     }
 
+    (*qpoases_memory)->first_run = 1;
+
     return c_ptr;
 }
 
@@ -416,57 +421,27 @@ ocp_qp_condensing_qpoases_memory *ocp_qp_condensing_qpoases_create_memory(const
 
 
 
-int ocp_qp_condensing_qpoases(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_,
-                              void *memory_, void *workspace_) {
-    // cast structures
-    ocp_qp_condensing_qpoases_args *args =
-        (ocp_qp_condensing_qpoases_args *)args_;
-    ocp_qp_condensing_qpoases_memory *memory =
-        (ocp_qp_condensing_qpoases_memory *)memory_;
-
-    // initialize return code
-    int acados_status = ACADOS_SUCCESS;
-
-    // loop index
+// Convert qp_in into the HPIPM QP (unless the data was written there directly), condense it and
+// store the dense QP in the row-major arrays passed to qpOASES
+static void ocp_qp_condensing_qpoases_condense(const ocp_qp_in *qp_in,
+                                               const ocp_qp_condensing_qpoases_args *args,
+                                               ocp_qp_condensing_qpoases_memory *memory) {
     int ii, jj;
 
-    // extract memory
-    double **hlam_lb = memory->hlam_lb;
-    double **hlam_ub = memory->hlam_ub;
-    double **hlam_lg = memory->hlam_lg;
-    double **hlam_ug = memory->hlam_ug;
-    //  struct d_strmat *sR = memory->sR;
     struct d_ocp_qp *qp = memory->qp;
-    struct d_ocp_qp_sol *qp_sol = memory->qp_sol;
     struct d_dense_qp *qpd = memory->qpd;
-    struct d_dense_qp_sol *qpd_sol = memory->qpd_sol;
-    struct d_cond_qp_ocp2dense_workspace *cond_workspace =
-        memory->cond_workspace;
-    double *H = memory->H;
-    //  double *R = memory->R;
-    double *A = memory->A;
-    double *C = memory->C;
-    double *g = memory->g;
-    double *b = memory->b;
+    int *idxb = memory->idxb;
+    int **hidxb_rev = (int **) memory->hidxb_rev;
     double *d_lb0 = memory->d_lb0;
     double *d_ub0 = memory->d_ub0;
     double *d_lb = memory->d_lb;
     double *d_ub = memory->d_ub;
-    double *d_lg = memory->d_lg;
-    double *d_ug = memory->d_ug;
-    int *idxb = memory->idxb;
-    int **hidxb_rev = (int **) memory->hidxb_rev;
-    double *prim_sol = memory->prim_sol;
-    double *dual_sol = memory->dual_sol;
-    QProblemB *QPB = memory->QPB;
-    QProblem *QP = memory->QP;
 
     // extract ocp problem size
     int N = qp_in->N;
     int *nx = (int *) qp_in->nx;
     int *nu = (int *) qp_in->nu;
     int *nb = (int *)qp_in->nb;
-    int *ng = (int *)qp_in->nc;
 
     // extract input data
     double **hA = (double **)qp_in->A;
@@ -485,43 +460,29 @@ int ocp_qp_condensing_qpoases(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *
     double **hd_ug = (double **)qp_in->uc;
     int **hidxb = (int **)qp_in->idxb;
 
-    // extract output struct members
-    double **hx = qp_out->x;
-    double **hu = qp_out->u;
-    double **hpi = qp_out->pi;
-    double **hlam = qp_out->lam;
-
-    // compute bounds indeces in order [u; x]
-    for (ii = 0; ii <= N; ii++) {
-        for (jj = 0; jj < nb[ii]; jj++) {
-            if (hidxb[ii][jj] < nx[ii]) {  // state constraint
-                hidxb_rev[ii][jj] = hidxb[ii][jj]+nu[ii];
-            } else  {  // input constraint
-                hidxb_rev[ii][jj] = hidxb[ii][jj]-nx[ii];
+    if (!args->qp_in_hpipm) {
+        // compute bounds indeces in order [u; x]
+        for (ii = 0; ii <= N; ii++) {
+            for (jj = 0; jj < nb[ii]; jj++) {
+                if (hidxb[ii][jj] < nx[ii]) {  // state constraint
+                    hidxb_rev[ii][jj] = hidxb[ii][jj]+nu[ii];
+                } else  {  // input constraint
+                    hidxb_rev[ii][jj] = hidxb[ii][jj]-nx[ii];
+                }
             }
         }
-    }
 
-    //
-    for (ii = 0; ii <= N; ii++) {
-        hlam_lb[ii] = hlam[ii];
-        hlam_ub[ii] = hlam[ii] + nb[ii];
-        hlam_lg[ii] = hlam[ii] + 2 * nb[ii];
-        hlam_ug[ii] = hlam[ii] + 2 * nb[ii] + ng[ii];
+        // ocp qp structure
+        d_cvt_colmaj_to_ocp_qp(hA, hB, hb, hQ, hS, hR, hq, hr, hidxb_rev, hd_lb, hd_ub, hC, hD,
+            hd_lg, hd_ug, NULL, NULL, NULL, NULL, NULL, qp);
     }
 
     // extract dense qp size
     int nvd = qpd->nv;
-    //  int ned = qpd->ne;
     int nbd = qpd->nb;
-    int ngd = qpd->ng;
-
-    // ocp qp structure
-    d_cvt_colmaj_to_ocp_qp(hA, hB, hb, hQ, hS, hR, hq, hr, hidxb_rev, hd_lb, hd_ub, hC, hD,
-        hd_lg, hd_ug, NULL, NULL, NULL, NULL, NULL, qp);
 
     // dense qp structure
-    d_cond_qp_ocp2dense(qp, qpd, cond_workspace);
+    d_cond_qp_ocp2dense(qp, qpd, memory->cond_workspace);
 
 #if 0
     d_print_strmat(nvd, nvd, qpd->Hg, 0, 0);
@@ -532,8 +493,8 @@ int ocp_qp_condensing_qpoases(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *
     dtrtr_l_libstr(nvd, qpd->Hg, 0, 0, qpd->Hg, 0, 0);
 
     // dense qp row-major
-    d_cvt_dense_qp_to_rowmaj(qpd, H, g, A, b, idxb, d_lb0, d_ub0, C, d_lg, d_ug,
-        NULL, NULL, NULL, NULL, NULL);
+    d_cvt_dense_qp_to_rowmaj(qpd, memory->H, memory->g, memory->A, memory->b, idxb, d_lb0, d_ub0,
+        memory->C, memory->d_lg, memory->d_ug, NULL, NULL, NULL, NULL, NULL);
 
     // reorder bounds
     for (ii = 0; ii < nvd; ii++) {
@@ -544,6 +505,141 @@ int ocp_qp_condensing_qpoases(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *
         d_lb[idxb[ii]] = d_lb0[ii];
         d_ub[idxb[ii]] = d_ub0[ii];
     }
+}
+
+
+
+// Copy the bounds of the first stage into the HPIPM QP and into the bounds of the dense QP on x0,
+// which are the last nx[0] dense variables. The rest of the condensed QP is unchanged.
+static void ocp_qp_condensing_qpoases_update_x0_bounds(const ocp_qp_in *qp_in,
+                                                       const ocp_qp_condensing_qpoases_args *args,
+                                                       ocp_qp_condensing_qpoases_memory *memory) {
+    int ii, jj;
+
+    struct d_ocp_qp *qp = memory->qp;
+    struct d_dense_qp *qpd = memory->qpd;
+    int *idxb = memory->idxb;
+
+    int nx0 = qp_in->nx[0];
+    int nu0 = qp_in->nu[0];
+    int nb0 = qp_in->nb[0];
+    int ng0 = qp_in->nc[0];
+    int nvd = qpd->nv;
+    int nbd = qpd->nb;
+    int ngd = qpd->ng;
+
+    // bounds in order [lb; lg; ub; ug]
+    double *d0 = qp->d->pa;
+    double *dd = qpd->d->pa;
+
+    if (!args->qp_in_hpipm) {
+        for (jj = 0; jj < nb0; jj++) {
+            d0[jj] = qp_in->lb[0][jj];
+            d0[nb0+ng0+jj] = qp_in->ub[0][jj];
+        }
+    }
+
+    for (ii = 0; ii < nbd; ii++) {
+        int idx = idxb[ii] - (nvd - nx0);
+        if (idx < 0) continue;
+        for (jj = 0; jj < nb0; jj++) {
+            if (qp->idxb[0][jj] == nu0 + idx) {
+                dd[ii] = d0[jj];
+                dd[nbd+ngd+ii] = d0[nb0+ng0+jj];
+                memory->d_lb0[ii] = d0[jj];
+                memory->d_ub0[ii] = d0[nb0+ng0+jj];
+                memory->d_lb[idxb[ii]] = d0[jj];
+                memory->d_ub[idxb[ii]] = d0[nb0+ng0+jj];
+            }
+        }
+    }
+}
+
+
+
+int_t ocp_qp_condensing_qpoases_prepare(const ocp_qp_in *qp_in, void *args_, void *memory_,
+                                        void *workspace_) {
+    ocp_qp_condensing_qpoases_args *args = (ocp_qp_condensing_qpoases_args *)args_;
+    ocp_qp_condensing_qpoases_memory *memory = (ocp_qp_condensing_qpoases_memory *)memory_;
+
+    ocp_qp_condensing_qpoases_condense(qp_in, args, memory);
+    memory->prepared = 1;
+
+    return ACADOS_SUCCESS;
+}
+
+
+
+int ocp_qp_condensing_qpoases(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_,
+                              void *memory_, void *workspace_) {
+    // cast structures
+    ocp_qp_condensing_qpoases_args *args =
+        (ocp_qp_condensing_qpoases_args *)args_;
+    ocp_qp_condensing_qpoases_memory *memory =
+        (ocp_qp_condensing_qpoases_memory *)memory_;
+
+    // initialize return code
+    int acados_status = ACADOS_SUCCESS;
+
+    // loop index
+    int ii;
+
+    // extract memory
+    double **hlam_lb = memory->hlam_lb;
+    double **hlam_ub = memory->hlam_ub;
+    double **hlam_lg = memory->hlam_lg;
+    double **hlam_ug = memory->hlam_ug;
+    //  struct d_strmat *sR = memory->sR;
+    struct d_ocp_qp *qp = memory->qp;
+    struct d_ocp_qp_sol *qp_sol = memory->qp_sol;
+    struct d_dense_qp *qpd = memory->qpd;
+    struct d_dense_qp_sol *qpd_sol = memory->qpd_sol;
+    struct d_cond_qp_ocp2dense_workspace *cond_workspace =
+        memory->cond_workspace;
+    double *H = memory->H;
+    //  double *R = memory->R;
+    double *C = memory->C;
+    double *g = memory->g;
+    double *d_lb = memory->d_lb;
+    double *d_ub = memory->d_ub;
+    double *d_lg = memory->d_lg;
+    double *d_ug = memory->d_ug;
+    double *prim_sol = memory->prim_sol;
+    double *dual_sol = memory->dual_sol;
+    QProblemB *QPB = memory->QPB;
+    QProblem *QP = memory->QP;
+
+    // extract ocp problem size
+    int N = qp_in->N;
+    int *nb = (int *)qp_in->nb;
+    int *ng = (int *)qp_in->nc;
+
+    // extract output struct members
+    double **hx = qp_out->x;
+    double **hu = qp_out->u;
+    double **hpi = qp_out->pi;
+    double **hlam = qp_out->lam;
+
+    //
+    for (ii = 0; ii <= N; ii++) {
+        hlam_lb[ii] = hlam[ii];
+        hlam_ub[ii] = hlam[ii] + nb[ii];
+        hlam_lg[ii] = hlam[ii] + 2 * nb[ii];
+        hlam_ug[ii] = hlam[ii] + 2 * nb[ii] + ng[ii];
+    }
+
+    // dense qp, only the bounds on x0 are new after ocp_qp_condensing_qpoases_prepare
+    if (memory->prepared)
+        ocp_qp_condensing_qpoases_update_x0_bounds(qp_in, args, memory);
+    else
+        ocp_qp_condensing_qpoases_condense(qp_in, args, memory);
+    memory->prepared = 0;
+
+    // extract dense qp size
+    int nvd = qpd->nv;
+    //  int ned = qpd->ne;
+    int nbd = qpd->nb;
+    int ngd = qpd->ng;
 
 // cholesky factorization of H
 //  dpotrf_l_libstr(nvd, qpd->Hg, 0, 0, sR, 0, 0);
@@ -562,35 +658,55 @@ int ocp_qp_condensing_qpoases(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *
 
     // cold start the dual solution with no active constraints
     int warm_start = args->warm_start;
-    if (!warm_start) {
+    int hotstart = memory->first_run ? 0 : args->hotstart;
+    if (!warm_start && hotstart != 2) {
         for (ii = 0; ii < 2 * nvd + 2 * ngd; ii++)
             dual_sol[ii] = 0;
     }
 
+    // the qpOASES object lives in memory, construct it only once
+    if (memory->first_run) {
+        if (ngd > 0) {  // QProblem
+            QProblemCON(QP, nvd, ngd, HST_POSDEF);
+            QProblem_setPrintLevel(QP, args->print_level);
+            if (args->print_level != PL_NONE) QProblem_printProperties(QP);
+        } else {  // QProblemB
+            QProblemBCON(QPB, nvd, HST_POSDEF);
+            QProblemB_setPrintLevel(QPB, args->print_level);
+            if (args->print_level != PL_NONE) QProblemB_printProperties(QPB);
+        }
+    }
+
     // solve dense qp
     int nwsr = args->nwsr;  // max number of working set recalculations
     double cputime = args->cputime;
     int return_flag = 0;
     if (ngd > 0) {  // QProblem
-        QProblemCON(QP, nvd, ngd, HST_POSDEF);
-        QProblem_setPrintLevel(QP, PL_MEDIUM);
-        QProblem_printProperties(QP);
-        return_flag =
-            QProblem_initW(QP, H, g, C, d_lb, d_ub, d_lg, d_ug, &nwsr, &cputime,
-                NULL, dual_sol, NULL, NULL, NULL);  // NULL or 0
-        //            NULL, NULL, NULL, NULL);
-        //            NULL, NULL, NULL, R);  // to provide Cholesky factor
+        if (hotstart == 1) {
+            return_flag = QProblem_hotstart(QP, g, d_lb, d_ub, d_lg, d_ug, &nwsr,
+                &cputime);
+        } else {
+            // hotstart == 2: the previous primal and dual solution define the
+            // initial guess of the working set
+            return_flag =
+                QProblem_initW(QP, H, g, C, d_lb, d_ub, d_lg, d_ug, &nwsr, &cputime,
+                    hotstart == 2 ? prim_sol : NULL, dual_sol, NULL, NULL, NULL);
+            //            NULL, NULL, NULL, NULL);
+            //            NULL, NULL, NULL, R);  // to provide Cholesky factor
+        }
         QProblem_getPrimalSolution(QP, prim_sol);
         QProblem_getDualSolution(QP, dual_sol);
     } else {  // QProblemB
-        QProblemBCON(QPB, nvd, HST_POSDEF);
-        QProblemB_setPrintLevel(QPB, PL_MEDIUM);
-        QProblemB_printProperties(QPB);
-        return_flag = QProblemB_initW(QPB, H, g, d_lb, d_ub, &nwsr, &cputime,
-            NULL, dual_sol, NULL, NULL);  // NULL or 0
+        if (hotstart == 1) {
+            return_flag = QProblemB_hotstart(QPB, g, d_lb, d_ub, &nwsr, &cputime);
+        } else {
+            return_flag = QProblemB_initW(QPB, H, g, d_lb, d_ub, &nwsr, &cputime,
+                hotstart == 2 ? prim_sol : NULL, dual_sol, NULL, NULL);
+        }
         QProblemB_getPrimalSolution(QPB, prim_sol);
         QProblemB_getDualSolution(QPB, dual_sol);
     }
+    memory->first_run = 0;
 
     // save solution statistics to memory
     memory->cputime = cputime;
@@ -40,6 +40,11 @@ typedef struct ocp_qp_condensing_qpoases_args_ {
     void *scrapspace;
     int nwsr;        // maximum number of working set recalculations
     int warm_start;  // warm start with dual_sol in memory
+    int hotstart;    // reuse the qpOASES object after the first solve:
+                     // 0: re-initialize, 1: hotstart (fixed H and C),
+                     // 2: re-initialize from previous solution (varying H and C)
+    int print_level;  // qpOASES PrintLevel, 0 (PL_NONE) suppresses all output
+    int qp_in_hpipm;  // 1: data is read from memory->qp (see ocp_qp_hpipm_in.h), not qp_in
 } ocp_qp_condensing_qpoases_args;
 
 // struct of the solver memory
@@ -75,6 +80,8 @@ typedef struct ocp_qp_condensing_qpoases_memory_ {
     double inf_norm_res[5];
     double cputime;  // required cpu time
     int nwsr;        // performed number of working set recalculations
+    int first_run;   // qpOASES object not yet initialized
+    int prepared;    // condensed by ocp_qp_condensing_qpoases_prepare, x0 bounds still to update
 } ocp_qp_condensing_qpoases_memory;
 
 ocp_qp_condensing_qpoases_args *ocp_qp_condensing_qpoases_create_arguments(const ocp_qp_in *qp_in);
@@ -89,6 +96,10 @@ ocp_qp_condensing_qpoases_memory *ocp_qp_condensing_qpoases_create_memory(const
 
 int_t ocp_qp_condensing_qpoases_calculate_workspace_size(const ocp_qp_in *qp_in, void *args_);
 
+// Converts and condenses the QP, see prepare in ocp_qp_solver
+int_t ocp_qp_condensing_qpoases_prepare(const ocp_qp_in *qp_in, void *args_, void *memory_,
+                                        void *workspace_);
+
 int_t ocp_qp_condensing_qpoases(const ocp_qp_in *input, ocp_qp_out *output, void *args_,
                                 void *memory_, void *work_);
 
@@ -73,6 +73,8 @@ static void ocp_qp_hpipm_initialize_default_args(const ocp_qp_in *qp_in, ocp_qp_
     args->iter_max = 50;
     args->alpha_min = 1e-8;
     args->mu0 = 1;
+    args->warm_start = 0;
+    args->qp_in_hpipm = 0;
 
     int N = qp_in->N;
 
@@ -235,6 +237,8 @@ char *ocp_qp_hpipm_assign_memory(const ocp_qp_in *qp_in, ocp_qp_hpipm_args *args
     d_create_ocp_qp_ipm(qp, ipm_arg, ipm_workspace, c_ptr);
     c_ptr += ipm_workspace->memsize;
 
+    (*hpipm_memory)->prepared = 0;
+
     //
     for (int_t ii = 0; ii <= N; ii++) {
         (*hpipm_memory)->hidxb_rev[ii] = (int *) c_ptr;
@@ -260,26 +264,89 @@ ocp_qp_hpipm_memory *ocp_qp_hpipm_create_memory(const ocp_qp_in *qp_in, void *ar
 
 
 
-int ocp_qp_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_, void *mem_, void *work_) {
+// Copy the solution in qp_out into qp_sol and return the average complementarity of this point
+// w.r.t. the current QP data, clipped to [res_m_max, mu0], as initial barrier parameter. The data
+// is read from the HPIPM structure qp, which is also up to date when it is written directly (see
+// ocp_qp_hpipm_in.h). Slacks and multipliers are clipped to sqrt(res_m_max) so that the point is
+// strictly interior, the active constraints of the previous solution would otherwise start with
+// zero slacks.
+static double ocp_qp_hpipm_seed_solution(const ocp_qp_in *qp_in, const ocp_qp_out *qp_out,
+                                         const ocp_qp_hpipm_args *args, struct d_ocp_qp *qp,
+                                         struct d_ocp_qp_sol *qp_sol) {
+    int N = qp_in->N;
+    int ii, jj;
 
-    ocp_qp_hpipm_args *args = (ocp_qp_hpipm_args *) args_;
-    ocp_qp_hpipm_memory *memory = (ocp_qp_hpipm_memory *) mem_;
-    //
-    // initialize return code
-    int acados_status = ACADOS_SUCCESS;
+    double t_min = sqrt(args->res_m_max);
+    double complementarity = 0;
+    int n_compl = 0;
+
+    for (ii = 0; ii <= N; ii++) {
+        int nx = qp_in->nx[ii];
+        int nu = qp_in->nu[ii];
+        int nb = qp_in->nb[ii];
+        int ng = qp_in->nc[ii];
+        double *x = qp_out->x[ii];
+        double *u = qp_out->u[ii];
+        double *lam = qp_out->lam[ii];
+
+        // primal variables in order [u; x]
+        double *ux = (qp_sol->ux + ii)->pa;
+        for (jj = 0; jj < nu; jj++) ux[jj] = u[jj];
+        for (jj = 0; jj < nx; jj++) ux[nu+jj] = x[jj];
+
+        if (ii < N) {
+            double *pi = (qp_sol->pi + ii)->pa;
+            for (jj = 0; jj < qp_in->nx[ii+1]; jj++) pi[jj] = qp_out->pi[ii][jj];
+        }
+
+        // multipliers, slacks and bounds in order [lb; lg; ub; ug]
+        double *lam_hpipm = (qp_sol->lam + ii)->pa;
+        double *t_hpipm = (qp_sol->t + ii)->pa;
+        double *d = (qp->d + ii)->pa;
+        for (jj = 0; jj < nb; jj++) {
+            double val = ux[qp->idxb[ii][jj]];
+            lam_hpipm[jj] = lam[jj];
+            lam_hpipm[nb+ng+jj] = lam[nb+jj];
+            t_hpipm[jj] = val - d[jj];
+            t_hpipm[nb+ng+jj] = d[nb+ng+jj] - val;
+        }
+        if (ng > 0) {
+            // constraint values [D C]*[u; x], temporarily in the slacks of the upper bounds
+            dgemv_t_libstr(nu+nx, ng, 1.0, qp->DCt + ii, 0, 0, qp_sol->ux + ii, 0, 0.0,
+                           qp_sol->t + ii, 2*nb+ng, qp_sol->t + ii, 2*nb+ng);
+        }
+        for (jj = 0; jj < ng; jj++) {
+            double val = t_hpipm[2*nb+ng+jj];
+            lam_hpipm[nb+jj] = lam[2*nb+jj];
+            lam_hpipm[2*nb+ng+jj] = lam[2*nb+ng+jj];
+            t_hpipm[nb+jj] = val - d[nb+jj];
+            t_hpipm[2*nb+ng+jj] = d[2*nb+ng+jj] - val;
+        }
+
+        for (jj = 0; jj < 2*(nb+ng); jj++) {
+            t_hpipm[jj] = fmax(t_hpipm[jj], t_min);
+            lam_hpipm[jj] = fmax(lam_hpipm[jj], t_min);
+            complementarity += lam_hpipm[jj]*t_hpipm[jj];
+        }
+        n_compl += 2*(nb+ng);
+    }
+
+    double mu0 = (n_compl > 0) ? complementarity/n_compl : args->mu0;
+    if (mu0 < args->res_m_max) mu0 = args->res_m_max;
+    if (mu0 > args->mu0) mu0 = args->mu0;
+
+    return mu0;
+}
+
+
+
+// Convert qp_in into the HPIPM QP, unless the data was written there directly
+static void ocp_qp_hpipm_convert(const ocp_qp_in *qp_in, const ocp_qp_hpipm_args *args,
+                                 ocp_qp_hpipm_memory *memory) {
+    if (args->qp_in_hpipm) return;
 
-    // loop index
     int ii, jj;
 
-    // extract memory
-    double **hlam_lb = memory->hlam_lb;
-    double **hlam_ub = memory->hlam_ub;
-    double **hlam_lg = memory->hlam_lg;
-    double **hlam_ug = memory->hlam_ug;
-    struct d_ocp_qp *qp = memory->qp;
-    struct d_ocp_qp_sol *qp_sol = memory->qp_sol;
-    struct d_ocp_qp_ipm_arg *ipm_arg = memory->ipm_arg;
-    struct d_ocp_qp_ipm_workspace *ipm_workspace = memory->ipm_workspace;
     int **hidxb_rev = (int **) memory->hidxb_rev;
 
     // extract problem size
@@ -287,7 +354,6 @@ int ocp_qp_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_, void *
     int *nx = (int *)qp_in->nx;
     int *nu = (int *)qp_in->nu;
     int *nb = (int *)qp_in->nb;
-    int *ng = (int *)qp_in->nc;
 
     // extract input data
     double **hA = (double **)qp_in->A;
@@ -306,12 +372,6 @@ int ocp_qp_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_, void *
     double **hd_ug = (double **)qp_in->uc;
     int **hidxb = (int **)qp_in->idxb;
 
-    // extract output struct members
-    double **hx = qp_out->x;
-    double **hu = qp_out->u;
-    double **hpi = qp_out->pi;
-    double **hlam = qp_out->lam;
-
     // compute bounds indeces in order [u; x]
     for (ii = 0; ii <= N; ii++) {
         for (jj = 0; jj < nb[ii]; jj++) {
@@ -323,6 +383,59 @@ int ocp_qp_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_, void *
         }
     }
 
+    // ocp qp structure
+    d_cvt_colmaj_to_ocp_qp(hA, hB, hb, hQ, hS, hR, hq, hr, hidxb_rev, hd_lb, hd_ub,
+                           hC, hD, hd_lg, hd_ug, NULL, NULL, NULL, NULL, NULL, memory->qp);
+}
+
+
+
+int_t ocp_qp_hpipm_prepare(const ocp_qp_in *qp_in, void *args_, void *mem_, void *work_) {
+    ocp_qp_hpipm_args *args = (ocp_qp_hpipm_args *) args_;
+    ocp_qp_hpipm_memory *memory = (ocp_qp_hpipm_memory *) mem_;
+
+    ocp_qp_hpipm_convert(qp_in, args, memory);
+    memory->prepared = 1;
+
+    return ACADOS_SUCCESS;
+}
+
+
+
+int ocp_qp_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_, void *mem_, void *work_) {
+
+    ocp_qp_hpipm_args *args = (ocp_qp_hpipm_args *) args_;
+    ocp_qp_hpipm_memory *memory = (ocp_qp_hpipm_memory *) mem_;
+    //
+    // initialize return code
+    int acados_status = ACADOS_SUCCESS;
+
+    // loop index
+    int ii, jj;
+
+    // extract memory
+    double **hlam_lb = memory->hlam_lb;
+    double **hlam_ub = memory->hlam_ub;
+    double **hlam_lg = memory->hlam_lg;
+    double **hlam_ug = memory->hlam_ug;
+    struct d_ocp_qp *qp = memory->qp;
+    struct d_ocp_qp_sol *qp_sol = memory->qp_sol;
+    struct d_ocp_qp_ipm_arg *ipm_arg = memory->ipm_arg;
+    struct d_ocp_qp_ipm_workspace *ipm_workspace = memory->ipm_workspace;
+
+    // extract problem size
+    int N = qp_in->N;
+    int *nx = (int *)qp_in->nx;
+    int *nu = (int *)qp_in->nu;
+    int *nb = (int *)qp_in->nb;
+    int *ng = (int *)qp_in->nc;
+
+    // extract output struct members
+    double **hx = qp_out->x;
+    double **hu = qp_out->u;
+    double **hpi = qp_out->pi;
+    double **hlam = qp_out->lam;
+
     //
     for (ii = 0; ii <= N; ii++) {
         hlam_lb[ii] = hlam[ii];
@@ -331,12 +444,29 @@ int ocp_qp_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_, void *
         hlam_ug[ii] = hlam[ii] + 2 * nb[ii] + ng[ii];
     }
 
-    // ocp qp structure
-    d_cvt_colmaj_to_ocp_qp(hA, hB, hb, hQ, hS, hR, hq, hr, hidxb_rev, hd_lb, hd_ub,
-                           hC, hD, hd_lg, hd_ug, NULL, NULL, NULL, NULL, NULL, qp);
+    // ocp qp structure, only the bounds of the first stage are new after ocp_qp_hpipm_prepare
+    if (memory->prepared) {
+        if (!args->qp_in_hpipm) {
+            double *d0 = qp->d->pa;  // [lb; lg; ub; ug]
+            for (jj = 0; jj < nb[0]; jj++) {
+                d0[jj] = qp_in->lb[0][jj];
+                d0[nb[0]+ng[0]+jj] = qp_in->ub[0][jj];
+            }
+        }
+    } else {
+        ocp_qp_hpipm_convert(qp_in, args, memory);
+    }
+    memory->prepared = 0;
 
     // ocp qp sol structure
-
+    if (args->warm_start) {
+        if (args->warm_start == 2) ocp_qp_out_shift(qp_in, qp_out);
+        ipm_arg->mu0 = ocp_qp_hpipm_seed_solution(qp_in, qp_out, args, qp, qp_sol);
+        ipm_arg->warm_start = 1;
+    } else {
+        ipm_arg->mu0 = args->mu0;
+        ipm_arg->warm_start = 0;
+    }
 
     // ipm structure
 
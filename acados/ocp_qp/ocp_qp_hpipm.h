@@ -37,6 +37,9 @@ typedef struct ocp_qp_hpipm_args_ {
     double mu0;
     void *scrapspace;
     int iter_max;
+    int warm_start;  // 0: cold start, 1: start from the solution in qp_out,
+                     // 2: start from the solution in qp_out shifted by one stage
+    int qp_in_hpipm;  // 1: data is read from memory->qp (see ocp_qp_hpipm_in.h), not qp_in
 } ocp_qp_hpipm_args;
 
 // struct of the solver memory
@@ -52,6 +55,7 @@ typedef struct ocp_qp_hpipm_memory_ {
     int **hidxb_rev;
     double inf_norm_res[5];
     int iter;
+    int prepared;  // converted by ocp_qp_hpipm_prepare, first stage bounds still to update
 } ocp_qp_hpipm_memory;
 
 ocp_qp_hpipm_args *ocp_qp_hpipm_create_arguments(const ocp_qp_in *qp_in);
@@ -65,6 +69,9 @@ ocp_qp_hpipm_memory *ocp_qp_hpipm_create_memory(const ocp_qp_in *qp_in, void *ar
 
 int_t ocp_qp_hpipm_calculate_workspace_size(const ocp_qp_in *qp_in, ocp_qp_hpipm_args *args);
 
+// Converts the QP into the HPIPM structure, see prepare in ocp_qp_solver
+int_t ocp_qp_hpipm_prepare(const ocp_qp_in *qp_in, void *args_, void *mem_, void *work_);
+
 int_t ocp_qp_hpipm(const ocp_qp_in *qp_in, ocp_qp_out *qp_out, void *args_, void *mem_,
                    void *workspace_);
 
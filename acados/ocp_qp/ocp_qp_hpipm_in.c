@@ -0,0 +1,120 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "acados/ocp_qp/ocp_qp_hpipm_in.h"
+
+#include <stdlib.h>
+
+#include "blasfeo/include/blasfeo_target.h"
+#include "blasfeo/include/blasfeo_common.h"
+#include "blasfeo/include/blasfeo_d_aux.h"
+
+#include "hpipm/include/hpipm_d_ocp_qp.h"
+
+#include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/ocp_qp/ocp_qp_condensing_hpipm.h"
+#include "acados/ocp_qp/ocp_qp_condensing_qpoases.h"
+#include "acados/ocp_qp/ocp_qp_hpipm.h"
+#include "acados/utils/types.h"
+
+// The layout follows d_cvt_colmaj_to_ocp_qp: BAbt = [B'; A'; b'], RSQrq = [R; S'; Q] with the
+// gradient [r' q'] in the last row, DCt = [D'; C'], d = [lb; lg; ub; ug] and the bound indices in
+// [u; x] order.
+
+struct d_ocp_qp *ocp_qp_hpipm_in_attach(ocp_qp_solver *solver) {
+    if (solver->fun == &ocp_qp_hpipm) {
+        ((ocp_qp_hpipm_args *) solver->args)->qp_in_hpipm = 1;
+        return ((ocp_qp_hpipm_memory *) solver->mem)->qp;
+    } else if (solver->fun == &ocp_qp_condensing_hpipm) {
+        ((ocp_qp_condensing_hpipm_args *) solver->args)->qp_in_hpipm = 1;
+        return ((ocp_qp_condensing_hpipm_memory *) solver->mem)->qp;
+    } else if (solver->fun == &ocp_qp_condensing_qpoases) {
+        ((ocp_qp_condensing_qpoases_args *) solver->args)->qp_in_hpipm = 1;
+        return ((ocp_qp_condensing_qpoases_memory *) solver->mem)->qp;
+    }
+    return NULL;
+}
+
+
+
+void ocp_qp_hpipm_in_set_objective(struct d_ocp_qp *qp, int_t stage, const real_t *hess,
+                                   const real_t *q, const real_t *r) {
+    int nx = qp->nx[stage];
+    int nu = qp->nu[stage];
+    int nz = nx + nu;
+    struct d_strmat *RSQrq = qp->RSQrq + stage;
+
+    d_cvt_mat2strmat(nu, nu, (real_t *) hess + nx*nz + nx, nz, RSQrq, 0, 0);
+    d_cvt_mat2strmat(nx, nu, (real_t *) hess + nx*nz, nz, RSQrq, nu, 0);
+    d_cvt_mat2strmat(nx, nx, (real_t *) hess, nz, RSQrq, nu, nu);
+    d_cvt_tran_mat2strmat(nu, 1, (real_t *) r, nu, RSQrq, nz, 0);
+    d_cvt_tran_mat2strmat(nx, 1, (real_t *) q, nx, RSQrq, nz, nu);
+    d_cvt_vec2strvec(nu, (real_t *) r, qp->rq + stage, 0);
+    d_cvt_vec2strvec(nx, (real_t *) q, qp->rq + stage, nu);
+}
+
+
+
+void ocp_qp_hpipm_in_set_dynamics(struct d_ocp_qp *qp, int_t stage, const real_t *jac,
+                                  const real_t *b) {
+    int nx = qp->nx[stage];
+    int nu = qp->nu[stage];
+    int nx1 = qp->nx[stage+1];
+    struct d_strmat *BAbt = qp->BAbt + stage;
+
+    d_cvt_tran_mat2strmat(nx1, nu, (real_t *) jac + nx*nx1, nx1, BAbt, 0, 0);
+    d_cvt_tran_mat2strmat(nx1, nx, (real_t *) jac, nx1, BAbt, nu, 0);
+    d_cvt_tran_mat2strmat(nx1, 1, (real_t *) b, nx1, BAbt, nu+nx, 0);
+    d_cvt_vec2strvec(nx1, (real_t *) b, qp->b + stage, 0);
+}
+
+
+
+void ocp_qp_hpipm_in_set_bounds(struct d_ocp_qp *qp, int_t stage, const int_t *idxb,
+                                const real_t *lb, const real_t *ub) {
+    int nx = qp->nx[stage];
+    int nu = qp->nu[stage];
+    int nb = qp->nb[stage];
+    int ng = qp->ng[stage];
+
+    for (int_t jj = 0; jj < nb; jj++) {
+        if (idxb[jj] < nx)  // state constraint
+            qp->idxb[stage][jj] = idxb[jj] + nu;
+        else  // input constraint
+            qp->idxb[stage][jj] = idxb[jj] - nx;
+    }
+    d_cvt_vec2strvec(nb, (real_t *) lb, qp->d + stage, 0);
+    d_cvt_vec2strvec(nb, (real_t *) ub, qp->d + stage, nb+ng);
+}
+
+
+
+void ocp_qp_hpipm_in_set_constraints(struct d_ocp_qp *qp, int_t stage, const real_t *jac,
+                                     const real_t *lc, const real_t *uc) {
+    int nx = qp->nx[stage];
+    int nu = qp->nu[stage];
+    int nb = qp->nb[stage];
+    int ng = qp->ng[stage];
+    struct d_strmat *DCt = qp->DCt + stage;
+
+    d_cvt_tran_mat2strmat(ng, nu, (real_t *) jac + nx*ng, ng, DCt, 0, 0);
+    d_cvt_tran_mat2strmat(ng, nx, (real_t *) jac, ng, DCt, nu, 0);
+    d_cvt_vec2strvec(ng, (real_t *) lc, qp->d + stage, nb);
+    d_cvt_vec2strvec(ng, (real_t *) uc, qp->d + stage, 2*nb+ng);
+}
@@ -0,0 +1,62 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef ACADOS_OCP_QP_OCP_QP_HPIPM_IN_H_
+#define ACADOS_OCP_QP_OCP_QP_HPIPM_IN_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/utils/types.h"
+
+// QP data stored in the panel-major HPIPM structure (struct d_ocp_qp) instead of the column-major
+// arrays of ocp_qp_in. The HPIPM based solvers (hpipm, condensing_hpipm, condensing_qpoases) keep
+// such a structure in their memory; once it is attached, the solver reads the data from there and
+// qp_in only provides the dimensions. The setters below fill one stage at a time and take the
+// matrices in the layout used by the ocp_nlp module.
+
+struct d_ocp_qp;
+
+// Returns the QP structure of the solver and switches the solver to read from it, or NULL if the
+// solver does not support it. Must be called after the solver has been initialized.
+struct d_ocp_qp *ocp_qp_hpipm_in_attach(ocp_qp_solver *solver);
+
+// hess: (nx+nu) x (nx+nu) Hessian in [x; u] order, q, r: gradient
+void ocp_qp_hpipm_in_set_objective(struct d_ocp_qp *qp, int_t stage, const real_t *hess,
+                                   const real_t *q, const real_t *r);
+
+// jac: nx[stage+1] x (nx+nu) Jacobian [A B] of the dynamics, b: constant term
+void ocp_qp_hpipm_in_set_dynamics(struct d_ocp_qp *qp, int_t stage, const real_t *jac,
+                                  const real_t *b);
+
+// idxb: indices of the bounds in [x; u], as in ocp_qp_in
+void ocp_qp_hpipm_in_set_bounds(struct d_ocp_qp *qp, int_t stage, const int_t *idxb,
+                                const real_t *lb, const real_t *ub);
+
+// jac: nc x (nx+nu) Jacobian [Cx Cu] of the general constraints
+void ocp_qp_hpipm_in_set_constraints(struct d_ocp_qp *qp, int_t stage, const real_t *jac,
+                                     const real_t *lc, const real_t *uc);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // ACADOS_OCP_QP_OCP_QP_HPIPM_IN_H_
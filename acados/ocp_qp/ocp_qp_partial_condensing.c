@@ -0,0 +1,607 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "acados/ocp_qp/ocp_qp_partial_condensing.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/utils/types.h"
+
+// Stages [*start, *end) of block jj. The first N % N2 blocks get one stage more than the rest.
+static void block_range(int_t N, int_t N2, int_t jj, int_t *start, int_t *end) {
+    int_t len = N / N2;
+    int_t rem = N % N2;
+    *start = jj*len + (jj < rem ? jj : rem);
+    *end = *start + len + (jj < rem ? 1 : 0);
+}
+
+// Dimensions of the partially condensed QP. In every block, the bounds on the first state and
+// all bounds on the controls stay box constraints, while the bounds on the eliminated states
+// become general constraints.
+static void compute_dimensions(const ocp_qp_in *qp_in, int_t N2, int_t *block_start,
+                               int_t *nx2, int_t *nu2, int_t *nb2, int_t *nc2) {
+    int_t N = qp_in->N;
+    int_t start, end;
+
+    for (int_t jj = 0; jj < N2; jj++) {
+        block_range(N, N2, jj, &start, &end);
+        block_start[jj] = start;
+        nx2[jj] = qp_in->nx[start];
+        nu2[jj] = 0;
+        nb2[jj] = 0;
+        nc2[jj] = 0;
+        for (int_t kk = start; kk < end; kk++) {
+            nu2[jj] += qp_in->nu[kk];
+            nc2[jj] += qp_in->nc[kk];
+            for (int_t ii = 0; ii < qp_in->nb[kk]; ii++) {
+                if (qp_in->idxb[kk][ii] >= qp_in->nx[kk] || kk == start)
+                    nb2[jj]++;
+                else
+                    nc2[jj]++;
+            }
+        }
+    }
+    block_start[N2] = N;
+    nx2[N2] = qp_in->nx[N];
+    nu2[N2] = qp_in->nu[N];
+    nb2[N2] = qp_in->nb[N];
+    nc2[N2] = qp_in->nc[N];
+}
+
+
+
+ocp_qp_partial_condensing_args *ocp_qp_partial_condensing_create_arguments(
+    const ocp_qp_in *qp_in) {
+    ocp_qp_partial_condensing_args *args =
+        (ocp_qp_partial_condensing_args *) malloc(sizeof(ocp_qp_partial_condensing_args));
+    args->N2 = qp_in->N;
+    return args;
+}
+
+
+
+int_t ocp_qp_partial_condensing_calculate_memory_size(const ocp_qp_in *qp_in,
+                                                      ocp_qp_partial_condensing_args *args) {
+    int_t N2 = args->N2;
+    assert(N2 >= 1 && N2 <= qp_in->N);
+
+    // the dimensions of the condensed QP are only needed temporarily here, assign_memory keeps
+    // them inside the memory block
+    int_t block_start[N2+1], nx2[N2+1], nu2[N2+1], nb2[N2+1], nc2[N2+1];
+    compute_dimensions(qp_in, N2, block_start, nx2, nu2, nb2, nc2);
+
+    int_t size = sizeof(ocp_qp_partial_condensing_memory);
+    size += 5*(N2+1)*sizeof(int_t);  // block_start, nx2, nu2, nb2, nc2
+    size += ocp_qp_in_calculate_size(N2, nx2, nu2, nb2, nc2);
+    size += ocp_qp_out_calculate_size(N2, nx2, nu2, nb2, nc2);
+    size += 8;  // alignment of the condensed QP
+
+    return size;
+}
+
+
+
+char *ocp_qp_partial_condensing_assign_memory(const ocp_qp_in *qp_in,
+                                              ocp_qp_partial_condensing_args *args, void **mem_,
+                                              void *raw_memory) {
+    int_t N2 = args->N2;
+    assert(N2 >= 1 && N2 <= qp_in->N);
+
+    ocp_qp_partial_condensing_memory **mem = (ocp_qp_partial_condensing_memory **) mem_;
+
+    char *c_ptr = (char *) raw_memory;
+
+    *mem = (ocp_qp_partial_condensing_memory *) c_ptr;
+    c_ptr += sizeof(ocp_qp_partial_condensing_memory);
+
+    (*mem)->N2 = N2;
+
+    (*mem)->block_start = (int_t *) c_ptr;
+    c_ptr += (N2+1)*sizeof(int_t);
+
+    int_t *nx2 = (int_t *) c_ptr;
+    c_ptr += (N2+1)*sizeof(int_t);
+
+    int_t *nu2 = (int_t *) c_ptr;
+    c_ptr += (N2+1)*sizeof(int_t);
+
+    int_t *nb2 = (int_t *) c_ptr;
+    c_ptr += (N2+1)*sizeof(int_t);
+
+    int_t *nc2 = (int_t *) c_ptr;
+    c_ptr += (N2+1)*sizeof(int_t);
+
+    compute_dimensions(qp_in, N2, (*mem)->block_start, nx2, nu2, nb2, nc2);
+
+    // align data
+    size_t l_ptr = (size_t) c_ptr;
+    l_ptr = (l_ptr+7)/8*8;
+    c_ptr = (char *) l_ptr;
+
+    c_ptr = assign_ocp_qp_in(N2, nx2, nu2, nb2, nc2, &(*mem)->pcond_qp_in, c_ptr);
+    c_ptr = assign_ocp_qp_out(N2, nx2, nu2, nb2, nc2, &(*mem)->pcond_qp_out, c_ptr);
+
+    return c_ptr;
+}
+
+
+
+ocp_qp_partial_condensing_memory *ocp_qp_partial_condensing_create_memory(
+    const ocp_qp_in *qp_in, ocp_qp_partial_condensing_args *args) {
+    ocp_qp_partial_condensing_memory *mem;
+
+    int_t memory_size = ocp_qp_partial_condensing_calculate_memory_size(qp_in, args);
+    void *raw_memory = malloc(memory_size);
+    char *ptr_end = ocp_qp_partial_condensing_assign_memory(qp_in, args, (void **) &mem,
+                                                            raw_memory);
+    assert((char *) raw_memory + memory_size >= ptr_end); (void) ptr_end;
+
+    return mem;
+}
+
+
+
+static void max_dimensions(const ocp_qp_in *qp_in, int_t N2, int_t *nx_max, int_t *nz_max,
+                           int_t *nw_max) {
+    int_t N = qp_in->N;
+    int_t start, end;
+
+    *nx_max = 0;
+    *nz_max = 0;
+    for (int_t kk = 0; kk <= N; kk++) {
+        if (qp_in->nx[kk] > *nx_max) *nx_max = qp_in->nx[kk];
+        if (qp_in->nx[kk] + qp_in->nu[kk] > *nz_max) *nz_max = qp_in->nx[kk] + qp_in->nu[kk];
+    }
+
+    *nw_max = 0;
+    for (int_t jj = 0; jj < N2; jj++) {
+        block_range(N, N2, jj, &start, &end);
+        int_t nw = qp_in->nx[start];
+        for (int_t kk = start; kk < end; kk++) nw += qp_in->nu[kk];
+        if (nw > *nw_max) *nw_max = nw;
+    }
+}
+
+
+
+int_t ocp_qp_partial_condensing_calculate_workspace_size(const ocp_qp_in *qp_in,
+                                                         ocp_qp_partial_condensing_args *args) {
+    int_t nx_max, nz_max, nw_max;
+    max_dimensions(qp_in, args->N2, &nx_max, &nz_max, &nw_max);
+
+    int_t size = sizeof(ocp_qp_partial_condensing_workspace);
+    size += 2*nx_max*nw_max*sizeof(real_t);  // G, G_next
+    size += 2*nx_max*sizeof(real_t);  // gamma, gamma_next
+    size += nz_max*nw_max*sizeof(real_t);  // M
+    size += nz_max*sizeof(real_t);  // c
+    size += nz_max*nz_max*sizeof(real_t);  // H
+    size += nz_max*nw_max*sizeof(real_t);  // HM
+    size += nw_max*nw_max*sizeof(real_t);  // Htil
+    size += nw_max*sizeof(real_t);  // gtil
+    size += nz_max*sizeof(real_t);  // tmp
+    size += nw_max*sizeof(real_t);  // row
+    size += 8;  // alignment
+
+    return size;
+}
+
+
+
+static void ocp_qp_partial_condensing_cast_workspace(ocp_qp_partial_condensing_workspace *work,
+                                                     const ocp_qp_in *qp_in,
+                                                     ocp_qp_partial_condensing_args *args) {
+    int_t nx_max, nz_max, nw_max;
+    max_dimensions(qp_in, args->N2, &nx_max, &nz_max, &nw_max);
+
+    char *c_ptr = (char *) work;
+    c_ptr += sizeof(ocp_qp_partial_condensing_workspace);
+
+    // align data
+    size_t l_ptr = (size_t) c_ptr;
+    l_ptr = (l_ptr+7)/8*8;
+    c_ptr = (char *) l_ptr;
+
+    work->G = (real_t *) c_ptr;
+    c_ptr += nx_max*nw_max*sizeof(real_t);
+    work->G_next = (real_t *) c_ptr;
+    c_ptr += nx_max*nw_max*sizeof(real_t);
+    work->gamma = (real_t *) c_ptr;
+    c_ptr += nx_max*sizeof(real_t);
+    work->gamma_next = (real_t *) c_ptr;
+    c_ptr += nx_max*sizeof(real_t);
+    work->M = (real_t *) c_ptr;
+    c_ptr += nz_max*nw_max*sizeof(real_t);
+    work->c = (real_t *) c_ptr;
+    c_ptr += nz_max*sizeof(real_t);
+    work->H = (real_t *) c_ptr;
+    c_ptr += nz_max*nz_max*sizeof(real_t);
+    work->HM = (real_t *) c_ptr;
+    c_ptr += nz_max*nw_max*sizeof(real_t);
+    work->Htil = (real_t *) c_ptr;
+    c_ptr += nw_max*nw_max*sizeof(real_t);
+    work->gtil = (real_t *) c_ptr;
+    c_ptr += nw_max*sizeof(real_t);
+    work->tmp = (real_t *) c_ptr;
+    c_ptr += nz_max*sizeof(real_t);
+    work->row = (real_t *) c_ptr;
+    c_ptr += nw_max*sizeof(real_t);
+}
+
+
+
+// Condense stages [start, end) into stage jj of pcond_qp_in. The block variables are
+// w = [x_start; u_start; ...; u_end-1] and the state at stage kk is x_kk = G*w + gamma.
+static void condense_block(const ocp_qp_in *qp_in, ocp_qp_in *pcond_qp_in, int_t jj,
+                           int_t start, int_t end, ocp_qp_partial_condensing_workspace *work) {
+    int_t nxs = qp_in->nx[start];
+    int_t nw = nxs + pcond_qp_in->nu[jj];
+    int_t nc2 = pcond_qp_in->nc[jj];
+
+    real_t *G = work->G;
+    real_t *G_next = work->G_next;
+    real_t *gamma = work->gamma;
+    real_t *gamma_next = work->gamma_next;
+    real_t *M = work->M;
+    real_t *c = work->c;
+    real_t *H = work->H;
+    real_t *HM = work->HM;
+    real_t *Htil = work->Htil;
+    real_t *gtil = work->gtil;
+    real_t *tmp = work->tmp;
+    real_t *row = work->row;
+    real_t *swap;
+
+    int_t *idxb2 = (int_t *) pcond_qp_in->idxb[jj];
+    real_t *lb2 = (real_t *) pcond_qp_in->lb[jj];
+    real_t *ub2 = (real_t *) pcond_qp_in->ub[jj];
+    real_t *Cx2 = (real_t *) pcond_qp_in->Cx[jj];
+    real_t *Cu2 = (real_t *) pcond_qp_in->Cu[jj];
+    real_t *lc2 = (real_t *) pcond_qp_in->lc[jj];
+    real_t *uc2 = (real_t *) pcond_qp_in->uc[jj];
+
+    // G = [I 0], gamma = 0
+    for (int_t ii = 0; ii < nxs*nw; ii++) G[ii] = 0.0;
+    for (int_t ii = 0; ii < nxs; ii++) {
+        G[ii*(nxs+1)] = 1.0;
+        gamma[ii] = 0.0;
+    }
+    for (int_t ii = 0; ii < nw*nw; ii++) Htil[ii] = 0.0;
+    for (int_t ii = 0; ii < nw; ii++) gtil[ii] = 0.0;
+
+    // bounds on the first state of the block stay box constraints
+    int_t ib = 0;
+    int_t ic = 0;
+    for (int_t ii = 0; ii < qp_in->nb[start]; ii++) {
+        if (qp_in->idxb[start][ii] < nxs) {
+            idxb2[ib] = qp_in->idxb[start][ii];
+            lb2[ib] = qp_in->lb[start][ii];
+            ub2[ib] = qp_in->ub[start][ii];
+            ib++;
+        }
+    }
+
+    int_t u_offset = nxs;
+    for (int_t kk = start; kk < end; kk++) {
+        int_t nx = qp_in->nx[kk];
+        int_t nu = qp_in->nu[kk];
+        int_t nz = nx + nu;
+        const real_t *Q = qp_in->Q[kk];
+        const real_t *S = qp_in->S[kk];
+        const real_t *R = qp_in->R[kk];
+
+        // stage variables [x_kk; u_kk] = M*w + c
+        for (int_t col = 0; col < nw; col++) {
+            for (int_t ii = 0; ii < nx; ii++) M[ii+col*nz] = G[ii+col*nx];
+            for (int_t ii = 0; ii < nu; ii++) M[nx+ii+col*nz] = (col == u_offset+ii) ? 1.0 : 0.0;
+        }
+        for (int_t ii = 0; ii < nx; ii++) c[ii] = gamma[ii];
+        for (int_t ii = 0; ii < nu; ii++) c[nx+ii] = 0.0;
+
+        // H = [Q S'; S R]
+        for (int_t col = 0; col < nx; col++) {
+            for (int_t ii = 0; ii < nx; ii++) H[ii+col*nz] = Q[ii+col*nx];
+            for (int_t ii = 0; ii < nu; ii++) {
+                H[nx+ii+col*nz] = S[ii+col*nu];
+                H[col+(nx+ii)*nz] = S[ii+col*nu];
+            }
+        }
+        for (int_t col = 0; col < nu; col++)
+            for (int_t ii = 0; ii < nu; ii++) H[nx+ii+(nx+col)*nz] = R[ii+col*nu];
+
+        // Htil += M'*H*M, gtil += M'*(H*c + [q; r])
+        for (int_t col = 0; col < nw; col++) {
+            for (int_t ii = 0; ii < nz; ii++) {
+                real_t sum = 0.0;
+                for (int_t ll = 0; ll < nz; ll++) sum += H[ii+ll*nz]*M[ll+col*nz];
+                HM[ii+col*nz] = sum;
+            }
+        }
+        for (int_t col = 0; col < nw; col++) {
+            for (int_t ii = 0; ii < nw; ii++) {
+                real_t sum = 0.0;
+                for (int_t ll = 0; ll < nz; ll++) sum += M[ll+ii*nz]*HM[ll+col*nz];
+                Htil[ii+col*nw] += sum;
+            }
+        }
+        for (int_t ii = 0; ii < nz; ii++) {
+            real_t sum = (ii < nx) ? qp_in->q[kk][ii] : qp_in->r[kk][ii-nx];
+            for (int_t ll = 0; ll < nx; ll++) sum += H[ii+ll*nz]*c[ll];
+            tmp[ii] = sum;
+        }
+        for (int_t ii = 0; ii < nw; ii++) {
+            real_t sum = 0.0;
+            for (int_t ll = 0; ll < nz; ll++) sum += M[ll+ii*nz]*tmp[ll];
+            gtil[ii] += sum;
+        }
+
+        // general constraints
+        for (int_t rr = 0; rr < qp_in->nc[kk]; rr++) {
+            int_t nc = qp_in->nc[kk];
+            real_t cst = 0.0;
+            for (int_t col = 0; col < nw; col++) {
+                real_t sum = 0.0;
+                for (int_t ll = 0; ll < nx; ll++) sum += qp_in->Cx[kk][rr+ll*nc]*G[ll+col*nx];
+                row[col] = sum;
+            }
+            for (int_t ii = 0; ii < nu; ii++) row[u_offset+ii] += qp_in->Cu[kk][rr+ii*nc];
+            for (int_t ll = 0; ll < nx; ll++) cst += qp_in->Cx[kk][rr+ll*nc]*gamma[ll];
+
+            for (int_t col = 0; col < nxs; col++) Cx2[ic+col*nc2] = row[col];
+            for (int_t col = nxs; col < nw; col++) Cu2[ic+(col-nxs)*nc2] = row[col];
+            lc2[ic] = qp_in->lc[kk][rr] - cst;
+            uc2[ic] = qp_in->uc[kk][rr] - cst;
+            ic++;
+        }
+
+        // bounds on the controls stay box constraints, bounds on the eliminated states become
+        // general constraints
+        for (int_t ii = 0; ii < qp_in->nb[kk]; ii++) {
+            int_t idx = qp_in->idxb[kk][ii];
+            if (idx >= nx) {
+                idxb2[ib] = u_offset + idx - nx;
+                lb2[ib] = qp_in->lb[kk][ii];
+                ub2[ib] = qp_in->ub[kk][ii];
+                ib++;
+            } else if (kk > start) {
+                for (int_t col = 0; col < nxs; col++) Cx2[ic+col*nc2] = G[idx+col*nx];
+                for (int_t col = nxs; col < nw; col++) Cu2[ic+(col-nxs)*nc2] = G[idx+col*nx];
+                lc2[ic] = qp_in->lb[kk][ii] - gamma[idx];
+                uc2[ic] = qp_in->ub[kk][ii] - gamma[idx];
+                ic++;
+            }
+        }
+
+        // x_kk+1 = [A B]*M*w + A*gamma + b
+        int_t nx_next = qp_in->nx[kk+1];
+        const real_t *A = qp_in->A[kk];
+        const real_t *B = qp_in->B[kk];
+        for (int_t col = 0; col < nw; col++) {
+            for (int_t ii = 0; ii < nx_next; ii++) {
+                real_t sum = 0.0;
+                for (int_t ll = 0; ll < nx; ll++) sum += A[ii+ll*nx_next]*M[ll+col*nz];
+                for (int_t ll = 0; ll < nu; ll++) sum += B[ii+ll*nx_next]*M[nx+ll+col*nz];
+                G_next[ii+col*nx_next] = sum;
+            }
+        }
+        for (int_t ii = 0; ii < nx_next; ii++) {
+            real_t sum = qp_in->b[kk][ii];
+            for (int_t ll = 0; ll < nx; ll++) sum += A[ii+ll*nx_next]*gamma[ll];
+            gamma_next[ii] = sum;
+        }
+        swap = G; G = G_next; G_next = swap;
+        swap = gamma; gamma = gamma_next; gamma_next = swap;
+
+        u_offset += nu;
+    }
+    assert(ib == pcond_qp_in->nb[jj]);
+    assert(ic == nc2);
+
+    // dynamics of the block
+    int_t nx_end = qp_in->nx[end];
+    memcpy((real_t *) pcond_qp_in->A[jj], G, nx_end*nxs*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->B[jj], G+nx_end*nxs, nx_end*(nw-nxs)*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->b[jj], gamma, nx_end*sizeof(real_t));
+
+    // objective of the block
+    int_t nuw = nw - nxs;
+    real_t *Q2 = (real_t *) pcond_qp_in->Q[jj];
+    real_t *S2 = (real_t *) pcond_qp_in->S[jj];
+    real_t *R2 = (real_t *) pcond_qp_in->R[jj];
+    for (int_t col = 0; col < nxs; col++) {
+        for (int_t ii = 0; ii < nxs; ii++) Q2[ii+col*nxs] = Htil[ii+col*nw];
+        for (int_t ii = 0; ii < nuw; ii++) S2[ii+col*nuw] = Htil[nxs+ii+col*nw];
+    }
+    for (int_t col = 0; col < nuw; col++)
+        for (int_t ii = 0; ii < nuw; ii++) R2[ii+col*nuw] = Htil[nxs+ii+(nxs+col)*nw];
+    memcpy((real_t *) pcond_qp_in->q[jj], gtil, nxs*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->r[jj], gtil+nxs, nuw*sizeof(real_t));
+}
+
+
+
+int_t ocp_qp_partial_condensing(const ocp_qp_in *qp_in, ocp_qp_in *pcond_qp_in, void *args_,
+                                void *mem_, void *work_) {
+    ocp_qp_partial_condensing_args *args = (ocp_qp_partial_condensing_args *) args_;
+    ocp_qp_partial_condensing_memory *mem = (ocp_qp_partial_condensing_memory *) mem_;
+    ocp_qp_partial_condensing_workspace *work = (ocp_qp_partial_condensing_workspace *) work_;
+
+    int_t N = qp_in->N;
+    int_t N2 = mem->N2;
+    assert(args->N2 == N2);
+    assert(pcond_qp_in->N == N2);
+
+    ocp_qp_partial_condensing_cast_workspace(work, qp_in, args);
+
+    for (int_t jj = 0; jj < N2; jj++)
+        condense_block(qp_in, pcond_qp_in, jj, mem->block_start[jj], mem->block_start[jj+1],
+                       work);
+
+    // the terminal stage is not condensed
+    int_t nx = qp_in->nx[N];
+    int_t nu = qp_in->nu[N];
+    int_t nb = qp_in->nb[N];
+    int_t nc = qp_in->nc[N];
+    ocp_qp_in_copy_objective(qp_in->Q[N], qp_in->S[N], qp_in->R[N], qp_in->q[N], qp_in->r[N],
+                             pcond_qp_in, N2);
+    memcpy((int_t *) pcond_qp_in->idxb[N2], qp_in->idxb[N], nb*sizeof(int_t));
+    memcpy((real_t *) pcond_qp_in->lb[N2], qp_in->lb[N], nb*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->ub[N2], qp_in->ub[N], nb*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->Cx[N2], qp_in->Cx[N], nc*nx*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->Cu[N2], qp_in->Cu[N], nc*nu*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->lc[N2], qp_in->lc[N], nc*sizeof(real_t));
+    memcpy((real_t *) pcond_qp_in->uc[N2], qp_in->uc[N], nc*sizeof(real_t));
+
+    return ACADOS_SUCCESS;
+}
+
+
+
+int_t ocp_qp_partial_expansion(const ocp_qp_in *qp_in, const ocp_qp_out *pcond_qp_out,
+                               ocp_qp_out *qp_out, void *args_, void *mem_, void *work_) {
+    ocp_qp_partial_condensing_memory *mem = (ocp_qp_partial_condensing_memory *) mem_;
+    const ocp_qp_in *pcond_qp_in = mem->pcond_qp_in;
+    (void) args_;
+    (void) work_;
+
+    int_t N = qp_in->N;
+    int_t N2 = mem->N2;
+
+    for (int_t jj = 0; jj < N2; jj++) {
+        int_t start = mem->block_start[jj];
+        int_t end = mem->block_start[jj+1];
+        int_t nb2 = pcond_qp_in->nb[jj];
+        int_t nc2 = pcond_qp_in->nc[jj];
+        const real_t *lam2 = pcond_qp_out->lam[jj];
+
+        // primal variables: split the controls and simulate the eliminated states
+        memcpy(qp_out->x[start], pcond_qp_out->x[jj], qp_in->nx[start]*sizeof(real_t));
+
+        // multipliers of the inequalities, in the same order as in condense_block
+        int_t ib = 0;
+        int_t ic = 0;
+        for (int_t ii = 0; ii < qp_in->nb[start]; ii++) {
+            if (qp_in->idxb[start][ii] < qp_in->nx[start]) {
+                qp_out->lam[start][ii] = lam2[ib];
+                qp_out->lam[start][qp_in->nb[start]+ii] = lam2[nb2+ib];
+                ib++;
+            }
+        }
+
+        int_t u_offset = 0;
+        for (int_t kk = start; kk < end; kk++) {
+            int_t nx = qp_in->nx[kk];
+            int_t nu = qp_in->nu[kk];
+            int_t nb = qp_in->nb[kk];
+            int_t nc = qp_in->nc[kk];
+            real_t *lam = qp_out->lam[kk];
+
+            memcpy(qp_out->u[kk], pcond_qp_out->u[jj]+u_offset, nu*sizeof(real_t));
+
+            for (int_t rr = 0; rr < nc; rr++) {
+                lam[2*nb+rr] = lam2[2*nb2+ic];
+                lam[2*nb+nc+rr] = lam2[2*nb2+nc2+ic];
+                ic++;
+            }
+            for (int_t ii = 0; ii < nb; ii++) {
+                if (qp_in->idxb[kk][ii] >= nx) {
+                    lam[ii] = lam2[ib];
+                    lam[nb+ii] = lam2[nb2+ib];
+                    ib++;
+                } else if (kk > start) {
+                    lam[ii] = lam2[2*nb2+ic];
+                    lam[nb+ii] = lam2[2*nb2+nc2+ic];
+                    ic++;
+                }
+            }
+
+            if (kk < end-1) {
+                int_t nx_next = qp_in->nx[kk+1];
+                for (int_t ii = 0; ii < nx_next; ii++) {
+                    real_t sum = qp_in->b[kk][ii];
+                    for (int_t ll = 0; ll < nx; ll++)
+                        sum += qp_in->A[kk][ii+ll*nx_next]*qp_out->x[kk][ll];
+                    for (int_t ll = 0; ll < nu; ll++)
+                        sum += qp_in->B[kk][ii+ll*nx_next]*qp_out->u[kk][ll];
+                    qp_out->x[kk+1][ii] = sum;
+                }
+            }
+            u_offset += nu;
+        }
+
+        // multipliers of the dynamics: the last one of the block is the one of the condensed QP,
+        // the others follow from stationarity w.r.t. the eliminated states
+        memcpy(qp_out->pi[end-1], pcond_qp_out->pi[jj], qp_in->nx[end]*sizeof(real_t));
+        for (int_t kk = end-1; kk > start; kk--) {
+            int_t nx = qp_in->nx[kk];
+            int_t nu = qp_in->nu[kk];
+            int_t nb = qp_in->nb[kk];
+            int_t nc = qp_in->nc[kk];
+            int_t nx_next = qp_in->nx[kk+1];
+            const real_t *x = qp_out->x[kk];
+            const real_t *u = qp_out->u[kk];
+            const real_t *lam = qp_out->lam[kk];
+            real_t *pi = qp_out->pi[kk-1];
+
+            for (int_t ii = 0; ii < nx; ii++) {
+                real_t sum = qp_in->q[kk][ii];
+                for (int_t ll = 0; ll < nx; ll++) sum += qp_in->Q[kk][ii+ll*nx]*x[ll];
+                for (int_t ll = 0; ll < nu; ll++) sum += qp_in->S[kk][ll+ii*nu]*u[ll];
+                for (int_t ll = 0; ll < nx_next; ll++)
+                    sum += qp_in->A[kk][ll+ii*nx_next]*qp_out->pi[kk][ll];
+                for (int_t ll = 0; ll < nc; ll++)
+                    sum += qp_in->Cx[kk][ll+ii*nc]*(lam[2*nb+nc+ll] - lam[2*nb+ll]);
+                pi[ii] = sum;
+            }
+            for (int_t ii = 0; ii < nb; ii++) {
+                int_t idx = qp_in->idxb[kk][ii];
+                if (idx < nx) pi[idx] += lam[nb+ii] - lam[ii];
+            }
+        }
+    }
+
+    // the terminal stage is not condensed
+    memcpy(qp_out->x[N], pcond_qp_out->x[N2], qp_in->nx[N]*sizeof(real_t));
+    memcpy(qp_out->u[N], pcond_qp_out->u[N2], qp_in->nu[N]*sizeof(real_t));
+    memcpy(qp_out->lam[N], pcond_qp_out->lam[N2],
+           2*(qp_in->nb[N]+qp_in->nc[N])*sizeof(real_t));
+
+    return ACADOS_SUCCESS;
+}
+
+
+
+void ocp_qp_partial_condensing_initialize(const ocp_qp_in *qp_in, void *args_, void **mem,
+                                          void **work) {
+    ocp_qp_partial_condensing_args *args = (ocp_qp_partial_condensing_args *) args_;
+
+    *mem = ocp_qp_partial_condensing_create_memory(qp_in, args);
+
+    int_t work_space_size = ocp_qp_partial_condensing_calculate_workspace_size(qp_in, args);
+    *work = (void *) malloc(work_space_size);
+}
+
+
+
+void ocp_qp_partial_condensing_destroy(void *mem, void *work) {
+    free(mem);
+    free(work);
+}
@@ -0,0 +1,96 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef ACADOS_OCP_QP_OCP_QP_PARTIAL_CONDENSING_H_
+#define ACADOS_OCP_QP_OCP_QP_PARTIAL_CONDENSING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "acados/ocp_qp/ocp_qp_common.h"
+#include "acados/utils/types.h"
+
+// Partial (block) condensing: the N stages of an ocp_qp_in are grouped into N2 blocks and the
+// states inside each block are eliminated, which gives an equivalent ocp_qp_in of horizon N2
+// that can be passed to any sparse QP solver. The terminal stage is kept as it is.
+
+// struct of arguments to the partial condensing
+typedef struct ocp_qp_partial_condensing_args_ {
+    int_t N2;  // horizon length of the partially condensed problem, 1 <= N2 <= N
+} ocp_qp_partial_condensing_args;
+
+// struct of the partial condensing memory
+typedef struct ocp_qp_partial_condensing_memory_ {
+    int_t N2;
+    int_t *block_start;  // first stage of each block, block_start[N2] = N
+    ocp_qp_in *pcond_qp_in;  // partially condensed QP
+    ocp_qp_out *pcond_qp_out;  // solution of the partially condensed QP
+} ocp_qp_partial_condensing_memory;
+
+// struct of the partial condensing workspace
+typedef struct ocp_qp_partial_condensing_workspace_ {
+    real_t *G;  // sensitivity of the current state w.r.t. the block variables
+    real_t *G_next;
+    real_t *gamma;  // constant part of the current state
+    real_t *gamma_next;
+    real_t *M;  // sensitivity of the current stage variables w.r.t. the block variables
+    real_t *c;
+    real_t *H;  // stage Hessian [Q S'; S R]
+    real_t *HM;
+    real_t *Htil;  // Hessian of the block
+    real_t *gtil;  // gradient of the block
+    real_t *tmp;
+    real_t *row;
+} ocp_qp_partial_condensing_workspace;
+
+ocp_qp_partial_condensing_args *ocp_qp_partial_condensing_create_arguments(
+    const ocp_qp_in *qp_in);
+
+int_t ocp_qp_partial_condensing_calculate_memory_size(const ocp_qp_in *qp_in,
+                                                      ocp_qp_partial_condensing_args *args);
+
+char *ocp_qp_partial_condensing_assign_memory(const ocp_qp_in *qp_in,
+                                              ocp_qp_partial_condensing_args *args, void **mem_,
+                                              void *raw_memory);
+
+ocp_qp_partial_condensing_memory *ocp_qp_partial_condensing_create_memory(
+    const ocp_qp_in *qp_in, ocp_qp_partial_condensing_args *args);
+
+int_t ocp_qp_partial_condensing_calculate_workspace_size(const ocp_qp_in *qp_in,
+                                                         ocp_qp_partial_condensing_args *args);
+
+// Fill pcond_qp_in (usually mem->pcond_qp_in) with the partially condensed QP of qp_in.
+int_t ocp_qp_partial_condensing(const ocp_qp_in *qp_in, ocp_qp_in *pcond_qp_in, void *args_,
+                                void *mem_, void *work_);
+
+// Recover the primal and dual solution of qp_in from the solution of the condensed QP.
+int_t ocp_qp_partial_expansion(const ocp_qp_in *qp_in, const ocp_qp_out *pcond_qp_out,
+                               ocp_qp_out *qp_out, void *args_, void *mem_, void *work_);
+
+void ocp_qp_partial_condensing_initialize(const ocp_qp_in *qp_in, void *args_, void **mem,
+                                          void **work);
+
+void ocp_qp_partial_condensing_destroy(void *mem, void *work);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // ACADOS_OCP_QP_OCP_QP_PARTIAL_CONDENSING_H_
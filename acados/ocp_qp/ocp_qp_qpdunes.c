@@ -263,8 +263,10 @@ static int_t update_memory(const ocp_qp_in *in, const ocp_qp_qpdunes_args *args,
     return (int_t)value;
 }
 
-static void fill_in_qp_out(const ocp_qp_in *in, ocp_qp_out *out,
-                           ocp_qp_qpdunes_memory *mem) {
+// The multipliers are taken from the dual solution y of the stage QPs, which holds a nonnegative
+// pair (lower, upper) for each of the nx+nu variables in the order [x; u], followed by one pair
+// for each general constraint.
+static void fill_in_qp_out(const ocp_qp_in *in, ocp_qp_out *out, ocp_qp_qpdunes_memory *mem) {
     int ii, kk, nn;
 
     for (kk = 0; kk < in->N + 1; kk++) {
@@ -281,7 +283,29 @@ static void fill_in_qp_out(const ocp_qp_in *in, ocp_qp_out *out,
             out->pi[kk][ii] = mem->qpData.lambda.data[nn++];
         }
     }
-    // TODO(dimitris): fill-in multipliers for inequalities
+
+    for (kk = 0; kk < in->N + 1; kk++) {
+        int_t nx = in->nx[kk];
+        int_t nu = in->nu[kk];
+        int_t nb = in->nb[kk];
+        int_t nc = in->nc[kk];
+        const real_t *y = mem->qpData.intervals[kk]->y.data;
+        real_t *lam = out->lam[kk];
+
+        for (ii = 0; ii < nb; ii++) {
+#ifdef FLIP_BOUNDS
+            int_t idx = (in->idxb[kk][ii] < nu) ? in->idxb[kk][ii] + nx : in->idxb[kk][ii] - nu;
+#else
+            int_t idx = in->idxb[kk][ii];
+#endif
+            lam[ii] = y[2*idx];
+            lam[nb+ii] = y[2*idx+1];
+        }
+        for (ii = 0; ii < nc; ii++) {
+            lam[2*nb+ii] = y[2*(nx+nu)+2*ii];
+            lam[2*nb+nc+ii] = y[2*(nx+nu)+2*ii+1];
+        }
+    }
 }
 
 static qpdunes_stage_qp_solver_t define_stage_qp_solver(const ocp_qp_in *in) {
@@ -112,14 +112,10 @@ void vde_adj_fun(const int_t nx, const int_t nu, const real_t* in, real_t* out,
     vde_adj(casadi_arg, casadi_res, casadi_iw, casadi_w, casadi_mem);
 }
 
-void discrete_model_fun(const int_t nx, const int_t nu, const real_t *in, real_t *out,
-                        casadi_function_t discrete_model) {
-
-    const double *x = in;
-    const double *u = in + nx;
-
-    double *x_out = out;
-    double *jac_out = out + nx;
+void discrete_model_fun(const int_t nx, const int_t nu, const real_t *x, const real_t *u,
+                        real_t *xn, real_t *jac, casadi_function_t discrete_model) {
+    (void)nx;
+    (void)nu;
 
     int casadi_mem = 0;
     int *casadi_iw = NULL;
@@ -131,8 +127,37 @@ void discrete_model_fun(const int_t nx, const int_t nu, const real_t *in, real_t
     casadi_arg[0] = x;
     casadi_arg[1] = u;
 
-    casadi_res[0] = x_out;
-    casadi_res[1] = jac_out;
+    casadi_res[0] = xn;
+    casadi_res[1] = jac;
 
     discrete_model(casadi_arg, casadi_res, casadi_iw, casadi_w, casadi_mem);
 }
+
+void impl_ode_fun(const int_t nx, const int_t nz, const int_t nu, const real_t *xdot,
+                  const real_t *x, const real_t *z, const real_t *u, real_t *res,
+                  real_t *jac_xdot, real_t *jac_x, real_t *jac_z, real_t *jac_u,
+                  casadi_function_t impl_ode) {
+    (void)nx;
+    (void)nz;
+    (void)nu;
+
+    int casadi_mem = 0;
+    int *casadi_iw = NULL;
+    double *casadi_w = NULL;
+
+    const double *casadi_arg[4];
+    double *casadi_res[5];
+
+    casadi_arg[0] = xdot;
+    casadi_arg[1] = x;
+    casadi_arg[2] = z;
+    casadi_arg[3] = u;
+
+    casadi_res[0] = res;
+    casadi_res[1] = jac_xdot;
+    casadi_res[2] = jac_x;
+    casadi_res[3] = jac_z;
+    casadi_res[4] = jac_u;
+
+    impl_ode(casadi_arg, casadi_res, casadi_iw, casadi_w, casadi_mem);
+}
@@ -36,8 +36,17 @@ void vde_hess_fun(const int_t nx, const int_t nu, const real_t* in, real_t* out,
 void vde_adj_fun(const int_t nx, const int_t nu, const real_t* in, real_t* out,
                  casadi_function_t vde_adj);
 
-void discrete_model_fun(const int_t nx, const int_t nu, const real_t *in, real_t *out,
-    casadi_function_t discrete_model);
+// xn = f(x, u) and its Jacobian jac = df/d(x,u), which is skipped if jac is NULL
+void discrete_model_fun(const int_t nx, const int_t nu, const real_t *x, const real_t *u,
+                        real_t *xn, real_t *jac, casadi_function_t discrete_model);
+
+// Residual res = f(xdot, x, z, u) of an implicit model with nx + nz equations and
+// its Jacobians with respect to xdot, x, z and u, column-major with nx + nz rows.
+// Jacobians that are NULL are not evaluated.
+void impl_ode_fun(const int_t nx, const int_t nz, const int_t nu, const real_t *xdot,
+                  const real_t *x, const real_t *z, const real_t *u, real_t *res,
+                  real_t *jac_xdot, real_t *jac_x, real_t *jac_z, real_t *jac_u,
+                  casadi_function_t impl_ode);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -19,6 +19,7 @@
 
 #include "acados/sim/sim_collocation.h"
 
+#include <assert.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -37,19 +38,13 @@
 #endif
 
 void get_Gauss_nodes(const int_t num_stages, real_t *nodes) {
-    //    if ( num_stages == 1 ) {         // GL2
-    //        nodes[0] = 1.0/2.0;
-    //    } else if ( num_stages == 2 ) {  // GL4
-    //        memcpy(nodes,
-    //                ((real_t[]) {1.0/2.0+sqrt(3.0)/6.0,
-    //                1.0/2.0-sqrt(3.0)/6.0}), sizeof(*nodes) * (num_stages));
-    //    } else if ( num_stages == 3 ) {  // GL6
-    //        memcpy(nodes,
-    //                ((real_t[]) {1.0/2.0-sqrt(15.0)/10.0, 1.0/2.0,
-    //                1.0/2.0+sqrt(15.0)/10.0}), sizeof(*nodes) * (num_stages));
-    //    } else {
-    //        // throw error somehow?
-    //    }
+    const collocation_table *table = get_Gauss_table(num_stages);
+    if (table != NULL) {
+        memcpy(nodes, table->c, num_stages * sizeof(real_t));
+        return;
+    }
+
+    // Newton iteration for the roots of the Legendre polynomial
     uint N = num_stages - 1;
     uint N1 = N + 1;
     uint N2 = N + 2;
@@ -115,102 +110,29 @@ void get_Gauss_nodes(const int_t num_stages, real_t *nodes) {
     free(der_lgvm);
 }
 
-void read_Gauss_simplified(const int_t num_stages, Newton_scheme *scheme) {
-    real_t *D;
-    D = (real_t *) calloc(2 * num_stages, sizeof(real_t));
-    real_t *T;
-    T = (real_t *) calloc(num_stages*num_stages, sizeof(real_t));
-    char simplified[MAX_STR_LEN];
-    int_t *perm;
-    real_t *T_inv;
-
-    snprintf(simplified, sizeof(simplified), "simplified/GL%d_simpl_%s.txt",
-             2 * num_stages, "D");
-    read_matrix(simplified, D, num_stages, 2);
-
-    snprintf(simplified, sizeof(simplified), "simplified/GL%d_simpl_%s.txt",
-             2 * num_stages, "T");
-    read_matrix(simplified, T, num_stages, num_stages);
-
-    //    print_matrix("stdout", D, num_stages, 2);
-    //    print_matrix("stdout", T, num_stages, num_stages);
+static void copy_simplified(const collocation_table *table,
+                            const int_t num_stages, Newton_scheme *scheme) {
+    assert(table != NULL && table->eig != NULL);
 
     scheme->single = false;
     scheme->low_tria = 0;
-    for (int_t i = 0; i < num_stages; i++) {
-        scheme->eig[i] = D[i];
-    }
-    for (int_t i = 0; i < num_stages * num_stages; i++) {
-        scheme->transf2[i] = T[i];
-    }
-    // transf1_T:
-    for (int_t i = 0; i < num_stages; i++) {
-        if ((i + 1) < num_stages) {  // complex conjugate pair of eigenvalues
-            for (int_t i1 = i; i1 < i + 2; i1++) {
-                for (int_t i2 = 0; i2 < num_stages; i2++) {
-                    scheme->transf1_T[i2 * num_stages + i1] = 0.0;
-                    for (int_t i3 = 0; i3 < 2; i3++) {
-                        scheme->transf1_T[i2 * num_stages + i1] +=
-                            D[(i1 - i) * num_stages + (i + i3)] *
-                            T[(i + i3) * num_stages + i2];
-                    }
-                }
-            }
-            i++;
-        } else {  // real eigenvalue
-            for (int_t i2 = 0; i2 < num_stages; i2++) {
-                scheme->transf1_T[i2 * num_stages + i] =
-                    D[i] * T[i * num_stages + i2];
-            }
-        }
-    }
-
-    int_zeros(&perm, num_stages, 1);
-    d_zeros(&T_inv, num_stages, num_stages);
-    for (int_t i = 0; i < num_stages; i++) {
-        T_inv[i * (num_stages + 1)] = 1.0;
-    }
-    LU_system_solve(T, T_inv, perm, num_stages, num_stages);
-
-    // transf1:
-    for (int_t i = 0; i < num_stages; i++) {
-        if ((i + 1) < num_stages) {  // complex conjugate pair of eigenvalues
-            for (int_t i1 = i; i1 < i + 2; i1++) {
-                for (int_t i2 = 0; i2 < num_stages; i2++) {
-                    scheme->transf1[i2 * num_stages + i1] = 0.0;
-                    for (int_t i3 = 0; i3 < 2; i3++) {
-                        scheme->transf1[i2 * num_stages + i1] +=
-                            D[i3 * num_stages + i1] *
-                            T_inv[i2 * num_stages + i + i3];
-                    }
-                }
-            }
-            i++;
-        } else {  // real eigenvalue
-            for (int_t i2 = 0; i2 < num_stages; i2++) {
-                scheme->transf1[i2 * num_stages + i] =
-                    D[i] * T_inv[i2 * num_stages + i];
-            }
-        }
-    }
-    // transf2_T:
-    for (int_t i = 0; i < num_stages; i++) {
-        for (int_t i2 = 0; i2 < num_stages; i2++) {
-            scheme->transf2_T[i2 * num_stages + i] = T_inv[i * num_stages + i2];
-        }
-    }
+    memcpy(scheme->eig, table->eig, num_stages * sizeof(real_t));
+    memcpy(scheme->transf1, table->transf1,
+           num_stages * num_stages * sizeof(real_t));
+    memcpy(scheme->transf2, table->transf2,
+           num_stages * num_stages * sizeof(real_t));
+    memcpy(scheme->transf1_T, table->transf1_T,
+           num_stages * num_stages * sizeof(real_t));
+    memcpy(scheme->transf2_T, table->transf2_T,
+           num_stages * num_stages * sizeof(real_t));
+}
 
-    //    print_matrix("stdout", scheme->transf1, num_stages, num_stages);
-    //    print_matrix("stdout", T_inv, 1, 1);
-    //    print_matrix("stdout", scheme->transf2, num_stages, num_stages);
-    //    print_matrix("stdout", T_inv, 1, 1);
-    //        print_matrix("stdout", scheme->transf1_T, num_stages, num_stages);
-    //        print_matrix("stdout", T_inv, 1, 1);
-    //        print_matrix("stdout", scheme->transf2_T, num_stages, num_stages);
-    //        print_matrix("stdout", T_inv, 1, 1);
+void get_Gauss_simplified(const int_t num_stages, Newton_scheme *scheme) {
+    copy_simplified(get_Gauss_table(num_stages), num_stages, scheme);
+}
 
-    free(perm);
-    free(T_inv);
+void get_Radau_simplified(const int_t num_stages, Newton_scheme *scheme) {
+    copy_simplified(get_Radau_table(num_stages), num_stages, scheme);
 }
 
 void create_Butcher_table(const int_t num_stages, const real_t *nodes,
@@ -218,10 +140,12 @@ void create_Butcher_table(const int_t num_stages, const real_t *nodes,
     int_t i, j, k;
     real_t *can_vm;
     real_t *rhs;
+    real_t *rhs_perm;
     int_t *perm;
 
     d_zeros(&can_vm, num_stages, num_stages);
     d_zeros(&rhs, num_stages, num_stages);
+    d_zeros(&rhs_perm, num_stages, num_stages);
     int_zeros(&perm, num_stages, 1);
 
     for (j = 0; j < num_stages; j++) {
@@ -233,7 +157,7 @@ void create_Butcher_table(const int_t num_stages, const real_t *nodes,
     for (i = 0; i < num_stages; i++) rhs[i * (num_stages + 1)] = 1.0;
     //        print_matrix("stdout", rhs, num_stages, num_stages);
 
-    LU_system_solve(can_vm, rhs, perm, num_stages, num_stages);
+    LU_system_solve(can_vm, rhs, perm, rhs_perm, num_stages, num_stages);
     //        print_matrix("stdout", rhs, num_stages, num_stages);
 
     for (k = 0; k < num_stages; k++) {
@@ -256,12 +180,13 @@ void create_Butcher_table(const int_t num_stages, const real_t *nodes,
 
     free(can_vm);
     free(rhs);
+    free(rhs_perm);
     free(perm);
 }
 
 // TODO(rien): replace these LU codes with blasfeo
 real_t LU_system_solve(real_t *const A, real_t *const b, int *const perm,
-                       int dim, int dim2) {
+                       real_t *const bPerm, int dim, int dim2) {
     real_t det;
     real_t swap;
     real_t valueMax;
@@ -272,8 +197,6 @@ real_t LU_system_solve(real_t *const A, real_t *const b, int *const perm,
     int intSwap;
     int DIM = dim;
     int DIM_RHS = dim2;
-    real_t *bPerm;
-    bPerm = (real_t *) calloc(DIM*DIM_RHS, sizeof(real_t));
     real_t tmp_var;
 
     for (i = 0; i < DIM; ++i) {
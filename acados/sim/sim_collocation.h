@@ -42,12 +42,41 @@ typedef struct {
     real_t *transf2_T;
 } Newton_scheme;
 
+#define GAUSS_MAX_STAGES 15
+#define RADAU_MAX_STAGES 15
+
+// Tabulated collocation method, the simplified Newton data is NULL for one
+// stage
+typedef struct {
+    const real_t *c;  // nodes
+    const real_t *A;  // Butcher table
+    const real_t *b;  // weights
+    const real_t *eig;
+    const real_t *transf1;
+    const real_t *transf2;
+    const real_t *transf1_T;
+    const real_t *transf2_T;
+} collocation_table;
+
+// Gauss-Legendre methods, returns NULL for more than GAUSS_MAX_STAGES stages
+const collocation_table *get_Gauss_table(const int_t num_stages);
+
+// Radau IIA methods, returns NULL for more than RADAU_MAX_STAGES stages
+const collocation_table *get_Radau_table(const int_t num_stages);
+
+// Solves A*X = b in place by LU factorization with partial pivoting, bPerm is a
+// scratch array of dim*dim2 elements
 real_t LU_system_solve(real_t *const A, real_t *const b, int *const perm,
-                       int dim, int dim2);
+                       real_t *const bPerm, int dim, int dim2);
 
 void get_Gauss_nodes(const int_t num_stages, real_t *nodes);
 
-void read_Gauss_simplified(const int_t num_stages, Newton_scheme *scheme);
+// Fills the eigenvalues and transformations of a simplified Newton scheme with
+// at most GAUSS_MAX_STAGES stages
+void get_Gauss_simplified(const int_t num_stages, Newton_scheme *scheme);
+
+// Same for the Radau IIA methods, at most RADAU_MAX_STAGES stages
+void get_Radau_simplified(const int_t num_stages, Newton_scheme *scheme);
 
 void create_Butcher_table(const int_t num_stages, const real_t *nodes,
                           real_t *b, real_t *A);
@@ -0,0 +1,5266 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "acados/sim/sim_collocation.h"
+
+#include <stdlib.h>
+
+#include "acados/utils/types.h"
+
+// Gauss-Legendre collocation methods GL2 to GL30, i.e. with 1 to GAUSS_MAX_STAGES stages, computed
+// with 80 digits and rounded to double: nodes c (in the order of get_Gauss_nodes), Butcher table A
+// (column-major) and weights b, and for the simplified Newton schemes the eigenvalues and
+// transformations of the inverse of A as they are stored in Newton_scheme.
+
+static const real_t GL2_c[1] = {
+    5.00000000000000000e-01,
+};
+
+static const real_t GL2_A[1] = {
+    5.00000000000000000e-01,
+};
+
+static const real_t GL2_b[1] = {
+    1.00000000000000000e+00,
+};
+
+static const real_t GL4_c[2] = {
+    7.88675134594812866e-01, 2.11324865405187107e-01,
+};
+
+static const real_t GL4_A[4] = {
+    2.50000000000000000e-01, -3.86751345948128794e-02, 5.38675134594812866e-01,
+    2.50000000000000000e-01,
+};
+
+static const real_t GL4_b[2] = {
+    5.00000000000000000e-01, 5.00000000000000000e-01,
+};
+
+static const real_t GL4_eig[2] = {
+    3.00000000000000000e+00, -1.73205080756887719e+00,
+};
+
+static const real_t GL4_transf1[4] = {
+    3.00000000000000000e+00, -1.73205080756887719e+00, -6.46410161513775439e+00,
+    -1.11961524227066320e+01,
+};
+
+static const real_t GL4_transf2[4] = {
+    1.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    -2.67949192431122696e-01,
+};
+
+static const real_t GL4_transf1_T[4] = {
+    3.00000000000000000e+00, 1.73205080756887719e+00, 4.64101615137754608e-01,
+    -8.03847577293368087e-01,
+};
+
+static const real_t GL4_transf2_T[4] = {
+    1.00000000000000000e+00, 0.00000000000000000e+00, -0.00000000000000000e+00,
+    -3.73205080756887719e+00,
+};
+
+static const real_t GL6_c[3] = {
+    8.87298334620741702e-01, 5.00000000000000000e-01, 1.12701665379258312e-01,
+};
+
+static const real_t GL6_A[9] = {
+    1.38888888888888895e-01, -2.24854172030868153e-02, 9.78944401530832536e-03,
+    4.80421111969383363e-01, 2.22222222222222210e-01, -3.59766675249389017e-02,
+    2.67988333762469444e-01, 3.00263194980864567e-01, 1.38888888888888895e-01,
+};
+
+static const real_t GL6_b[3] = {
+    2.77777777777777790e-01, 4.44444444444444420e-01, 2.77777777777777790e-01,
+};
+
+static const real_t GL6_eig[3] = {
+    3.67781464537391445e+00, -3.50876191956744332e+00, 4.64437070925217110e+00,
+};
+
+static const real_t GL6_transf1[9] = {
+    2.99218228148735621e+00, -1.04397933948310984e+00, 2.00781771851264379e+00,
+    -1.44549112989258770e+01, -6.76243437561170868e+00, 5.29093350398265549e+00,
+    -1.76636892894242266e+01, 2.56067835028297424e+01, 2.78276670843674481e+01,
+};
+
+static const real_t GL6_transf2[9] = {
+    1.00000000000000000e+00, 5.30650907420613938e-02, -8.22412305736306692e-02,
+    0.00000000000000000e+00, -3.16205051132291581e-01, 6.01207386193085003e-02,
+    1.00000000000000000e+00, 1.18832578741277811e-01, 7.21518520552001663e-02,
+};
+
+static const real_t GL6_transf1_T[9] = {
+    3.67781464537391445e+00, 3.50876191956744332e+00, 4.64437070925217110e+00,
+    1.30465181007711006e+00, -9.76750798341413540e-01, 5.51902548010892890e-01,
+    -5.13417360500969200e-01, -6.74519650703311602e-02, 3.35099948303467732e-01,
+};
+
+static const real_t GL6_transf2_T[9] = {
+    5.67687886216141635e-01, -1.13921429515573536e+00, -5.99169808493780121e+00,
+    2.57735201273432468e-01, -2.92555964619231368e+00, 1.24621327358623146e+00,
+    4.32312113783858365e-01, 1.13921429515573536e+00, 5.99169808493780121e+00,
+};
+
+static const real_t GL8_c[4] = {
+    9.30568155797026342e-01, 6.69990521792428129e-01, 3.30009478207571871e-01,
+    6.94318442029737137e-02,
+};
+
+static const real_t GL8_A[16] = {
+    8.69637112843634624e-02, -1.41906949311411436e-02, 6.73550059453815585e-03,
+    -3.55514968579568333e-03, 3.52676757516271866e-01, 1.63036288715636524e-01,
+    -2.78804286024708949e-02, 1.26274626894047250e-02, 3.13445114741868369e-01,
+    3.53953006033743967e-01, 1.63036288715636524e-01, -2.66041800849987943e-02,
+    1.77482572254522603e-01, 1.67191921974188779e-01, 1.88118117499868065e-01,
+    8.69637112843634624e-02,
+};
+
+static const real_t GL8_b[4] = {
+    1.73927422568726925e-01, 3.26072577431273047e-01, 3.26072577431273047e-01,
+    1.73927422568726925e-01,
+};
+
+static const real_t GL8_eig[4] = {
+    4.20757879435925553e+00, -5.31483608371350513e+00, 5.79242120564074447e+00,
+    -1.73446825786900760e+00,
+};
+
+static const real_t GL8_transf1[16] = {
+    3.02393896812125007e+00, 1.22129208062059791e-01, 4.71467381940458008e+00,
+    2.05063875663483663e-01, -1.30803301962049083e+01, -6.70136167552206885e+00,
+    -4.20472529760042291e-01, -1.03125264956195348e+01, 4.18505985326866004e+00,
+    4.30944309331304609e+01, 7.70772402478818108e+00, -7.12472270839727884e+01,
+    6.01987213053069041e+01, 9.85633842852264941e+00, -7.57625909038618346e+01,
+    -1.60856419144191932e+02,
+};
+
+static const real_t GL8_transf2[16] = {
+    1.00000000000000000e+00, 9.70016309989343434e-02, -1.22342821183987496e-01,
+    4.92446542761679623e-02, 0.00000000000000000e+00, -3.65963412813924027e-01,
+    3.93473546069532179e-02, 6.03406122926110344e-03, 1.00000000000000000e+00,
+    1.83509160946948746e-01, 2.85251849116396894e-02, -1.23417597413638322e-02,
+    0.00000000000000000e+00, -1.11990785949906843e-01, -1.20409336376008369e-02,
+    -2.34969182156032873e-02,
+};
+
+static const real_t GL8_transf1_T[16] = {
+    4.20757879435925553e+00, 5.31483608371350513e+00, 5.79242120564074447e+00,
+    1.73446825786900760e+00, 2.35317755735176259e+00, -1.02427212665501033e+00,
+    1.25720681870236217e+00, -3.30406988681956448e-01, -7.23891800119537909e-01,
+    -4.84674945753615471e-01, 1.86114503166530998e-01, -2.02701315590690379e-02,
+    1.75130716715343582e-01, 2.87116053549078432e-01, -3.07340120380911082e-02,
+    -1.57510437856907937e-01,
+};
+
+static const real_t GL8_transf2_T[16] = {
+    2.62764938774174894e-01, -4.22619655363706714e-01, -4.60120429198881720e+00,
+    4.37216072134607359e+00, 3.60939595053996976e-01, -2.12652366285590189e+00,
+    4.43004997518278820e+00, 7.86524925890716364e+00, 7.37235061225825161e-01,
+    4.22619655363706714e-01, 4.60120429198881720e+00, -4.37216072134607359e+00,
+    2.56157940742097634e-01, -1.65379998763055802e+00, -1.09223038252013893e+01,
+    -2.90793412898977799e+01,
+};
+
+static const real_t GL10_c[5] = {
+    9.53089922969332037e-01, 7.69234655052841498e-01, 5.00000000000000000e-01,
+    2.30765344947158446e-01, 4.69100770306680043e-02,
+};
+
+static const real_t GL10_A[25] = {
+    5.92317212640472712e-02, -9.68756314195073909e-03, 4.68715452386994115e-03,
+    -2.76899439876960316e-03, 1.58811296786599853e-03, 2.58884699608759261e-01,
+    1.19657167624841618e-01, -2.06903164309582832e-02, 1.03182806706833569e-02,
+    -5.59379366081218504e-03, 2.73190043625801515e-01, 3.09036559064086669e-01,
+    1.42222222222222222e-01, -2.45921146196422004e-02, 1.12544008186429550e-02,
+    2.44908128910495432e-01, 2.28996054578999880e-01, 2.60004651680641519e-01,
+    1.19657167624841618e-01, -1.95703643590760361e-02, 1.16875329560228544e-01,
+    1.21232436926864140e-01, 1.13776288004224596e-01, 1.28151005670045282e-01,
+    5.92317212640472712e-02,
+};
+
+static const real_t GL10_b[5] = {
+    1.18463442528094542e-01, 2.39314335249683235e-01, 2.84444444444444444e-01,
+    2.39314335249683235e-01, 1.18463442528094542e-01,
+};
+
+static const real_t GL10_eig[5] = {
+    4.64934860636329006e+00, -7.14204584067595238e+00, 6.70391279830706655e+00,
+    -3.48532283236639540e+00, 7.29347719065928679e+00,
+};
+
+static const real_t GL10_transf1[25] = {
+    2.58721475229851050e+00, 1.38471188467842388e+00, 5.26179705184432311e+00,
+    1.71161911227633246e+00, 3.33428832852754375e+00, -9.69399992489671014e+00,
+    -9.22422609510280367e+00, -7.32708629223869323e+00, -1.40366993839045779e+01,
+    -2.06451496152195624e+00, 7.83988406163076679e+00, 3.91926092441408116e+01,
+    -3.02777198471613893e+01, -2.81370422936769948e+01, 3.78532790071004754e+01,
+    7.54986262401809398e+01, -5.30010494061314574e+01, -2.74320051207381482e+02,
+    4.70557426705466355e+01, 1.82628034727201310e+02, -2.85828218578338742e+01,
+    -9.99703100431617457e+01, -3.06613389630367806e+02, 3.44457913704157079e+02,
+    3.57617126514107781e+02,
+};
+
+static const real_t GL10_transf2[25] = {
+    1.00000000000000000e+00, 1.43799136021355967e-01, -1.59569068255928648e-01,
+    5.49099241644181724e-02, -1.96447301190789195e-02, 0.00000000000000000e+00,
+    -4.14952230267105204e-01, 1.29621874929143430e-02, 3.23012371205678508e-02,
+    -2.02631454277281096e-02, 1.00000000000000000e+00, 2.33510552626602058e-01,
+    -7.99940725744555884e-04, -6.02513367052966414e-03, -4.81398532290504364e-03,
+    0.00000000000000000e+00, -1.86363046692957390e-01, -3.73198758372949579e-02,
+    -1.58927442461757884e-02, 1.09904999819775626e-02, 1.00000000000000000e+00,
+    2.52792841278078273e-01, 4.40830961898878992e-02, -2.85769161215479418e-03,
+    9.32362597124108440e-03,
+};
+
+static const real_t GL10_transf1_T[25] = {
+    4.64934860636329006e+00, 7.14204584067595238e+00, 6.70391279830706655e+00,
+    3.48532283236639540e+00, 7.29347719065928679e+00, 3.63218016291552548e+00,
+    -9.02237552185583769e-01, 2.21496976404156243e+00, -4.35501953188423496e-01,
+    1.84373882182361704e+00, -8.34468762384221296e-01, -1.07938387188219131e+00,
+    1.24709082487597100e-01, -2.52977244932849565e-01, 3.21519056554586735e-01,
+    2.45984631637122808e-02, 5.42348907280637116e-01, 1.49993736647814901e-02,
+    -1.27543107502115449e-01, -2.08425085911893571e-02, 5.33851149195949531e-02,
+    -2.34513989993113570e-01, -7.05779783433943542e-02, 5.69010605283753051e-02,
+    6.80016533554853864e-02,
+};
+
+static const real_t GL10_transf2_T[25] = {
+    2.94551442504771242e-02, 2.86526481500097019e-01, -3.35234673993812482e+00,
+    1.00454765264804795e+01, 8.00136239143266259e+00, 3.43076419990524961e-01,
+    -1.54383795180202910e+00, 3.28002833188080789e+00, 4.03157646896433430e+00,
+    -9.21079847552797304e+00, 5.13384540941416390e-01, -3.46328577694205234e-03,
+    -1.83767141156565295e+00, -3.50853895820929651e+01, -5.70338221038049582e+01,
+    5.22221884432547911e-01, -2.09560751691843139e+00, -5.15250145131908521e+00,
+    -1.12215312140380661e+01, 2.17300904250171705e+01, 4.57160314808106483e-01,
+    -2.83063195723154970e-01, 5.19001815150377777e+00, 2.50399130556124838e+01,
+    4.90324597123723009e+01,
+};
+
+static const real_t GL12_c[6] = {
+    9.66234757101576025e-01, 8.30604693233132241e-01, 6.19309593041598494e-01,
+    3.80690406958401562e-01, 1.69395306766867731e-01, 3.37652428984239888e-02,
+};
+
+static const real_t GL12_A[36] = {
+    4.28311230947925892e-02, -7.01124524079369069e-03, 3.41432357674129874e-03,
+    -2.07562578486633403e-03, 1.35556105548506178e-03, -8.12780171264762064e-04,
+    1.95144512521266716e-01, 9.01903932620346516e-02, -1.56513758091757008e-02,
+    7.98999189966233606e-03, -4.88719292803767129e-03, 2.85443331509933505e-03,
+    2.24631916579867780e-01, 2.54257069579585104e-01, 1.16978483643172759e-01,
+    -2.04825277456560963e-02, 1.03631562402464236e-02, -5.66885804948351162e-03,
+    2.39625825335829046e-01, 2.23593811046099100e-01, 2.54439495032001639e-01,
+    1.16978483643172759e-01, -2.03001022932395858e-02, 9.32505070647775096e-03,
+    1.77526353208969978e-01, 1.85267979452106962e-01, 1.72390794624406957e-01,
+    1.96032162333244997e-01, 9.01903932620346516e-02, -1.47637259971974133e-02,
+    8.64750263608499298e-02, 8.43066851341001122e-02, 8.77378719744515007e-02,
+    8.22479226128438740e-02, 9.26734914303788682e-02, 4.28311230947925892e-02,
+};
+
+static const real_t GL12_b[6] = {
+    8.56622461895851783e-02, 1.80380786524069303e-01, 2.33956967286345519e-01,
+    2.33956967286345519e-01, 1.80380786524069303e-01, 8.56622461895851783e-02,
+};
+
+static const real_t GL12_eig[6] = {
+    5.03186449562164295e+00, -8.98534590730788452e+00, 7.47141671265162977e+00,
+    -5.25254462289425117e+00, 8.49671879172672817e+00, -1.73501934646273126e+00,
+};
+
+static const real_t GL12_transf1[36] = {
+    1.58762362616635122e+00, 2.37601554125381442e+00, 4.91316947565140616e+00,
+    4.13015344753076086e+00, 8.82480633695359096e+00, 2.21357788930765320e+00,
+    -4.91263872667363888e+00, -1.13485707455126335e+01, -7.96497144279142866e+00,
+    -1.93498354090594695e+01, -1.29690437682237079e+01, -1.00482882484141047e+01,
+    2.71306463443037604e-01, 3.49931497687394781e+01, -2.72575898165788431e+01,
+    8.03819655911238584e+00, 4.69653829500371458e+01, -2.57186467764910134e+01,
+    5.89005278561057324e+01, -6.36803917547241909e+01, -1.26139484469698715e+02,
+    1.57808281682695963e+02, 4.79819937252400450e+01, -3.30521887755116666e+02,
+    -1.51638353614950404e+02, -7.40252511896354832e+01, 3.93344797506301973e+02,
+    7.00391792191221498e+02, -2.20134838153054886e+02, -1.50258848189565515e+03,
+    -1.21144559499899572e+02, 1.05078260772188543e+02, 9.69794944679318519e+02,
+    3.47624270586092905e+02, -8.79339060000888821e+02, -2.12486607027249738e+03,
+};
+
+static const real_t GL12_transf2[36] = {
+    1.00000000000000000e+00, 1.95585981306650142e-01, -1.96856871131711908e-01,
+    5.18826484373123842e-02, -1.10306022538207253e-02, 2.22944446426754034e-03,
+    0.00000000000000000e+00, -4.59832326896114807e-01, -2.17170223529041008e-02,
+    6.07607904120793380e-02, -3.49196256682736336e-02, 1.76792866580374429e-02,
+    1.00000000000000000e+00, 2.79626858230358710e-01, -2.32764618279343617e-02,
+    -8.15538435427811369e-03, -6.46601034177900300e-03, 5.84212416253491323e-03,
+    0.00000000000000000e+00, -2.42740687081349965e-01, -6.79238694320996178e-02,
+    -5.95812293714113785e-03, 7.15762803921588409e-03, -2.16467337592726175e-03,
+    1.00000000000000000e+00, 3.04101382122127395e-01, 4.57048588555361568e-02,
+    9.24326116379319538e-04, 2.94148941111868406e-03, -2.35681976437158557e-03,
+    0.00000000000000000e+00, -7.66480816616970650e-02, -2.71821600302465279e-02,
+    -8.47533450924404554e-03, 1.68123065728675619e-03, -3.17778271074450674e-03,
+};
+
+static const real_t GL12_transf1_T[36] = {
+    5.03186449562164295e+00, 8.98534590730788452e+00, 7.47141671265162977e+00,
+    5.25254462289425117e+00, 8.49671879172672817e+00, 1.73501934646273126e+00,
+    5.11591467170211800e+00, -5.56406262987139577e-01, 3.36421507257537034e+00,
+    -3.44864275685453914e-01, 2.71684983261945012e+00, -1.23635414536799451e-01,
+    -7.95422142649245600e-01, -1.87810419507696302e+00, 1.82865009239119580e-01,
+    -6.29748187677276139e-01, 4.35502906642175558e-01, -1.51660355587015128e-01,
+    -2.84890262843437381e-01, 7.71923606796948603e-01, -2.96369683666275301e-02,
+    -8.73521395262887301e-02, 2.25586084240055849e-02, -7.04088102965050172e-02,
+    2.58260419736821234e-01, -2.74824601417093473e-01, -8.59060184018064360e-02,
+    1.95146139028515506e-02, 2.20760406388585337e-02, 1.93884851547016443e-02,
+    -1.47636243572211584e-01, 1.08992104535072576e-01, 5.50189876063983396e-02,
+    1.45128410178683720e-02, -1.45117202986525078e-02, -3.10898539617175881e-02,
+};
+
+static const real_t GL12_transf2_T[36] = {
+    -1.25976859313230355e-01, 7.28398463746511182e-01, -2.95183750519764132e+00,
+    8.18972045031168605e+00, -9.22918706657815613e-01, -1.46502417871198602e+01,
+    2.47238351726418032e-01, -9.54647843672729479e-01, 1.68324658379489223e+00,
+    1.96886847491620864e+00, -1.63593425627634090e+01, -5.27820837263994935e+00,
+    1.80005857266740121e-01, 5.05042564499641466e-01, -2.94772794221744183e+00,
+    -2.12361616305370688e+01, -8.87165543215558472e+00, 6.49771750107976942e+01,
+    6.79341340526739890e-01, -2.23479394132713383e+00, -9.96447699260340714e-01,
+    6.19218508063725359e+00, 8.75058976496104037e+01, 9.22073829228857562e+01,
+    9.45971002046490206e-01, -1.23344102824615276e+00, 5.89956544741508271e+00,
+    1.30464411802253828e+01, 9.79457413881340067e+00, -5.03269332236778340e+01,
+    4.53687590885616998e-01, -1.43447518905884808e+00, -1.82220772147695476e+00,
+    -3.62358773371112193e+01, -1.74843341610996589e+02, -2.60357477667464366e+02,
+};
+
+static const real_t GL14_c[7] = {
+    9.74553956171379299e-01, 8.70765592799697230e-01, 7.02922575688698537e-01,
+    5.00000000000000000e-01, 2.97077424311301408e-01, 1.29234407200302770e-01,
+    2.54460438286207360e-02,
+};
+
+static const real_t GL14_A[49] = {
+    3.23712415422174257e-02, -5.30105829429122939e-03, 2.58854729708498212e-03,
+    -1.59044553324985401e-03, 1.07671561562791671e-03, -7.43850190171923566e-04,
+    4.58109523749452988e-04, 1.51303713027822195e-01, 6.99263478723191612e-02,
+    -1.21528263131926578e-02, 6.25692652075604538e-03, -3.95358015881043783e-03,
+    2.64584386673003729e-03, -1.60681903704610577e-03, 1.83281821380135934e-01,
+    2.07505031831407255e-01, 9.54575126262797308e-02, -1.67868555134113098e-02,
+    8.71256259847518269e-03, -5.39709193189613808e-03, 3.17505877368563783e-03,
+    2.14113325399960031e-01, 1.99629969053291362e-01, 2.27354836052186537e-01,
+    1.04489795918367351e-01, -1.83752442154518358e-02, 9.34962278344333292e-03,
+    -5.13373356322534540e-03, 1.87739966478873838e-01, 1.96312117184455598e-01,
+    1.82202462654084296e-01, 2.07701880765970792e-01, 9.54575126262797308e-02,
+    -1.65900065788477727e-02, 7.63320387242354473e-03, 1.41459514781684448e-01,
+    1.37206851877908292e-01, 1.43806275903448771e-01, 1.33595769223882277e-01,
+    1.52005522057830994e-01, 6.99263478723191612e-02, -1.14510172831838695e-02,
+    6.42843735606853928e-02, 6.54863332746067756e-02, 6.36657674688069358e-02,
+    6.63329286176846944e-02, 6.21539357873498663e-02, 7.00435413787260791e-02,
+    3.23712415422174257e-02,
+};
+
+static const real_t GL14_b[7] = {
+    6.47424830844348514e-02, 1.39852695744638322e-01, 1.90915025252559462e-01,
+    2.08979591836734702e-01, 1.90915025252559462e-01, 1.39852695744638322e-01,
+    6.47424830844348514e-02,
+};
+
+static const real_t GL14_eig[7] = {
+    5.37135375788653135e+00, -1.08413882614334973e+01, 8.14027832727627576e+00,
+    -7.03434809541950656e+00, 9.51658105630925810e+00, -3.47857212226107304e+00,
+    9.94357371705587134e+00,
+};
+
+static const real_t GL14_transf1[49] = {
+    2.05082605286137032e-01, 2.77683795742257544e+00, 3.01140326116571533e+00,
+    6.70729765244949583e+00, 9.91429155408733997e+00, 6.85296886468365507e+00,
+    7.03169770591477050e+00, 6.29463373018643857e-01, -1.15614132193107846e+01,
+    -2.39846972726381225e+00, -2.52742599760467819e+01, -1.78729872717338516e+01,
+    -2.44976706718302637e+01, -1.41196310706157657e+01, -1.00646406590972202e+01,
+    2.92298077738910855e+01, -2.78649099733718906e+01, 2.73649153476710438e+01,
+    2.60961843398387394e+01, 2.97069317480588513e-01, 3.72676391396122852e+01,
+    5.56944381824038999e+01, -4.94504245575536316e+01, -1.94569192676763407e+01,
+    1.08659725668831953e+02, -1.65260200871719746e+02, -2.05584470836703503e+02,
+    1.05593103601586563e+02, -1.61831406668296495e+02, -2.42550541670176756e+01,
+    6.33159521028944368e+02, 2.31803647609653552e+02, -1.35169190832998720e+03,
+    -2.37062337427906357e+02, 9.04492990065354320e+02, 1.11853698518576543e+01,
+    2.76977351535623086e+02, 1.23984348225381518e+03, -1.47832198536783585e+03,
+    -4.70038932368408496e+03, 1.92785695008520634e+03, 3.42143026203860973e+03,
+    2.09054183952254107e+02, 9.54693043425157413e+01, -5.31060502660645852e+01,
+    -2.05983127608519226e+03, -4.58462980363013776e+03, 4.32428943397568946e+03,
+    4.46903413071613704e+03,
+};
+
+static const real_t GL14_transf2[49] = {
+    1.00000000000000000e+00, 2.52257958709008745e-01, -2.32081740783999485e-01,
+    4.06017435482875291e-02, 4.40761668713018570e-03, -8.52074576434909414e-03,
+    5.83088969873587788e-03, 0.00000000000000000e+00, -4.98144412003037607e-01,
+    -6.66400782560356286e-02, 9.18235868942392092e-02, -4.54022261924332468e-02,
+    2.17106135034726179e-02, -1.06200552039340378e-02, 1.00000000000000000e+00,
+    3.24843125611896932e-01, -4.08229234042744929e-02, -1.62563958792371205e-02,
+    -4.38398782639567736e-03, 5.69033704685702104e-03, -3.29174045882299265e-03,
+    0.00000000000000000e+00, -2.87021608683226348e-01, -1.03186633727581994e-01,
+    3.34547932331398425e-03, 4.70051801227816275e-03, 3.92333301811545183e-04,
+    -1.37709916332938768e-03, 1.00000000000000000e+00, 3.48335565654790402e-01,
+    4.41577562008440561e-02, -1.02452959439528510e-03, -1.01053520306535263e-03,
+    -2.79659899217276514e-04, -3.98283206636927331e-04, 0.00000000000000000e+00,
+    -1.33889642459990077e-01, -5.91853082685433324e-02, -1.29258642026573306e-02,
+    9.75125162670214293e-04, -2.20987515087231988e-03, 1.87043689330897199e-03,
+    1.00000000000000000e+00, 3.54415356160631079e-01, 6.86342317241678129e-02,
+    7.31993726218199952e-03, 2.82792217144325073e-03, -1.46260881897014366e-03,
+    1.57342671822199333e-03,
+};
+
+static const real_t GL14_transf1_T[49] = {
+    5.37135375788653135e+00, 1.08413882614334973e+01, 8.14027832727627576e+00,
+    7.03434809541950656e+00, 9.51658105630925810e+00, 3.47857212226107304e+00,
+    9.94357371705587134e+00, 6.75554371525684338e+00, 5.91166130183308561e-02,
+    4.66332336156830518e+00, -5.13761586658727995e-02, 3.78070842306997212e+00,
+    -6.24612471919655243e-02, 3.52415522043984719e+00, -5.24122168350989237e-01,
+    -2.87403569499511358e+00, 3.93540741790491533e-01, -1.12713057169554554e+00,
+    6.26111229540457837e-01, -4.09635843778386022e-01, 6.82469542662757278e-01,
+    -7.77408829293084191e-01, 9.33396234425129867e-01, -1.55864853161596345e-01,
+    -8.71200145615734362e-02, 3.52135319418457673e-02, -1.26573934492929613e-01,
+    7.27863357707308339e-02, 5.15898030541334429e-01, -1.96086734462389028e-01,
+    -6.87519610174057438e-02, 7.42502848537094761e-03, -1.30088833768052664e-02,
+    5.76463806465127727e-03, 2.81196525778426784e-02, -2.81141130166399855e-01,
+    2.42386723196262657e-02, 4.35611183230597970e-02, 4.32215138416590094e-02,
+    5.02580399440144456e-03, -2.20032731267316428e-02, -1.45435586106456485e-02,
+    1.46455913118833048e-01, 6.17086570497514704e-03, -1.71086886392053938e-02,
+    -3.43652187008973570e-02, -1.02967440528402877e-02, 1.64147074465141422e-02,
+    1.56454845610256889e-02,
+};
+
+static const real_t GL14_transf2_T[49] = {
+    -1.98126741793006905e-01, 8.79331609755777843e-01, -2.53405072822447508e+00,
+    5.70586855214953026e+00, -4.14172496454337313e+00, -2.01024380735878871e+01,
+    6.00354517281652678e-01, 1.17078310797992552e-01, -3.77602727137287653e-01,
+    3.27139122509155666e-01, 2.31023915838405891e+00, -1.28751718276167946e+01,
+    1.09914591441215492e+01, 1.89855268067461900e+01, -1.95840630843639452e-01,
+    1.36733432936394861e+00, -3.62277568955061025e+00, -7.97205607714515807e+00,
+    3.04416702697502224e+01, 1.77039982622223590e+02, 1.21449119553522451e+02,
+    6.54730252405520741e-01, -1.92327015257256462e+00, 2.31079331703639090e-01,
+    6.45942387618361735e+00, 5.47820277101349191e+01, -2.86183237759197375e+01,
+    -1.48092711919207744e+02, 6.86807360954574730e-01, -8.26690438118829141e-01,
+    2.40891442958432211e+00, -8.35304320695603764e+00, -1.17262512265806578e+02,
+    -5.01022112068857041e+02, -5.71488906802172664e+02, 9.71155265654640498e-01,
+    -2.87638730985875934e+00, 9.11740450252629397e-01, -2.46560327373980321e+01,
+    -6.77731256389016039e+01, 1.94413726223091778e+01, 2.45500357824753678e+02,
+    7.07160011682071654e-01, -1.41997550100089720e+00, 3.74791198819076321e+00,
+    1.06192307319516654e+01, 9.09625669605997302e+01, 3.44084567520221356e+02,
+    4.49439432731368584e+02,
+};
+
+static const real_t GL16_c[8] = {
+    9.80144928248768088e-01, 8.98333238706813364e-01, 7.62766204958164495e-01,
+    5.91717321247824946e-01, 4.08282678752175110e-01, 2.37233795041835505e-01,
+    1.01666761293186636e-01, 1.98550717512318842e-02,
+};
+
+static const real_t GL16_A[64] = {
+    2.53071340725940647e-02, -4.14505362236619081e-03, 2.02673214627524870e-03,
+    -1.25125282539310500e-03, 8.59236584264852737e-04, -6.18805695250515412e-04,
+    4.42802304342237833e-04, -2.77508327116919205e-04, 1.20296460532657315e-01,
+    5.55952586133436205e-02, -9.66900777048593230e-03, 4.99702707833882872e-03,
+    -3.19781431036077028e-03, 2.22571477528489981e-03, -1.56493491094894239e-03,
+    9.72757664059263507e-04, 1.50572491791913177e-01, 1.70493119174725316e-01,
+    7.84266614694718173e-02, -1.38178113356099783e-02, 7.24120656122227008e-03,
+    -4.64346586210448008e-03, 3.13975298546366900e-03, -1.91767525463695234e-03,
+    1.85824907302235748e-01, 1.73192182830820440e-01, 1.97316995051059429e-01,
+    9.06709458445904976e-02, -1.60210413210250119e-02, 8.37173272022616322e-03,
+    -5.21535208914715356e-03, 3.07849136832677971e-03, 1.78263400320854221e-01,
+    1.86557243778328136e-01, 1.72970158968954818e-01, 1.97362933010205993e-01,
+    9.06709458445904976e-02, -1.59751033618784309e-02, 8.14970885836055134e-03,
+    -4.48301561305475185e-03, 1.58770998193580593e-01, 1.53713569953479984e-01,
+    1.61496788801048119e-01, 1.49612116377721371e-01, 1.70671134274553632e-01,
+    7.84266614694718173e-02, -1.36397962357816694e-02, 6.28083114703047434e-03,
+    1.10217759562627970e-01, 1.12755452137636172e-01, 1.08964802451402332e-01,
+    1.14388331537047999e-01, 1.06193490148348405e-01, 1.20859524997173173e-01,
+    5.55952586133436205e-02, -9.10594330597007569e-03, 5.08917764723050489e-02,
+    5.01714658408458913e-02, 5.12330738404386463e-02, 4.97550315609232782e-02,
+    5.18655209705812317e-02, 4.85875359989128841e-02, 5.47593217675543184e-02,
+    2.53071340725940647e-02,
+};
+
+static const real_t GL16_b[8] = {
+    5.06142681451881293e-02, 1.11190517226687241e-01, 1.56853322938943635e-01,
+    1.81341891689180995e-01, 1.81341891689180995e-01, 1.56853322938943635e-01,
+    1.11190517226687241e-01, 5.06142681451881293e-02,
+};
+
+static const real_t GL16_eig[8] = {
+    5.67796789779526101e+00, -1.27078225972097538e+01, 8.73657843440480519e+00,
+    -8.82888500094307815e+00, 1.04096815812737642e+01, -5.23235030528505529e+00,
+    1.11757720865261696e+01, -1.73522889070557285e+00,
+};
+
+static const real_t GL16_transf1[64] = {
+    -1.20379403474739144e+00, 2.43092212990680734e+00, -5.75247395634724268e-01,
+    8.30247387095547396e+00, 7.96318094150529099e+00, 1.33784222580605423e+01,
+    1.95084717851866465e+01, 7.15408900552391902e+00, 5.76490338206350028e+00,
+    -9.30426947051916109e+00, 8.86184687283171968e+00, -2.81403143612243518e+01,
+    -1.23638428330834227e+01, -4.36464674444411855e+01, -4.50844404144066431e+01,
+    -2.30983818386076933e+01, -1.90647138224609556e+01, 2.02443871915828879e+01,
+    -3.99342763535223426e+01, 3.38769032560946357e+01, 5.93631263835429301e+00,
+    3.92734008456895296e+01, 8.47945223806574830e+01, 1.94056483802391320e+01,
+    5.73280560311913021e+01, -2.78176275720282895e+01, 3.22649731442981960e+01,
+    5.80609648841814874e+01, -1.47402828313015846e+02, -1.11591891276008454e+02,
+    2.93694282644887146e+01, -1.78910141514418996e+02, -1.38311004993919198e+02,
+    -2.28429674209990594e+01, 4.28470678598643019e+02, -1.21149964149468641e+01,
+    -7.60156505569159094e+02, 6.39783579866776108e+02, 4.97993557736496655e+02,
+    -1.25639406714276288e+03, 1.15406493953760858e+02, 2.54401182689339919e+02,
+    -5.04386365964123726e+01, -1.78687753242949134e+03, -1.93195429609212681e+02,
+    4.88502464989077362e+03, 9.83744076350099448e+01, -7.99252109192586340e+03,
+    3.63972055775678200e+02, -2.10303598901580926e+02, -3.85811198974146237e+03,
+    -1.32149453557703009e+03, 8.96697475032630973e+03, 1.12681169160383233e+04,
+    -5.43759731705683316e+03, -2.50754980131158700e+04, 3.32021843582664955e+00,
+    -3.11830736197783040e+02, -3.50946024309117865e+03, 1.42584085726542071e+03,
+    1.36617476421668034e+04, 6.92653055448367377e+03, -1.02070139350697136e+04,
+    -2.73395511245326343e+04,
+};
+
+static const real_t GL16_transf2[64] = {
+    1.00000000000000000e+00, 3.12617962920228809e-01, -2.61955444649673685e-01,
+    1.91256982668981321e-02, 2.54421262877065311e-02, -2.11567389336034008e-02,
+    1.36702054615317654e-02, -7.83586167816548683e-03, 0.00000000000000000e+00,
+    -5.27989159210782599e-01, -1.22212882936491962e-01, 1.24001358184278418e-01,
+    -5.10415978813475099e-02, 1.95030765025830423e-02, -8.26991545040981976e-03,
+    3.77697617849940539e-03, 1.00000000000000000e+00, 3.69751525508518641e-01,
+    -5.33139315780897932e-02, -2.95845612697467758e-02, -5.92225101828579574e-04,
+    4.23784982815221534e-03, -2.25943209338528564e-03, 9.65676522411962812e-04,
+    0.00000000000000000e+00, -3.21632149476704265e-01, -1.42637890432435188e-01,
+    1.10562483567385288e-02, 4.85823800381665182e-03, 1.39311470713044121e-03,
+    -2.73203486530520937e-03, 1.97340113598163313e-03, 1.00000000000000000e+00,
+    3.89107954148134150e-01, 4.29067007283448279e-02, -7.08252451111880330e-03,
+    -3.31515289576113413e-03, 4.85676447834554911e-04, -9.14267028016083126e-04,
+    8.58651732375030076e-04, 0.00000000000000000e+00, -1.78170003063710197e-01,
+    -9.36286710453201332e-02, -1.66616370121087029e-02, 5.99034895333305675e-04,
+    -6.81384129533973873e-04, 9.90745045207354477e-04, -5.43923441768829393e-04,
+    1.00000000000000000e+00, 3.96097651051805333e-01, 8.24140099203738569e-02,
+    9.59154136230446451e-03, 1.50480746128751636e-03, -5.28961659916742989e-04,
+    5.83507234415142390e-04, -4.63476960533785694e-04, 0.00000000000000000e+00,
+    -5.73441414923531248e-02, -3.19297461428923804e-02, -8.66494817348818086e-03,
+    -8.61641102004621451e-04, -8.03335443005059359e-04, 5.32807232438884055e-04,
+    -5.40526650314093748e-04,
+};
+
+static const real_t GL16_transf1_T[64] = {
+    5.67796789779526101e+00, 1.27078225972097538e+01, 8.73657843440480519e+00,
+    8.82888500094307815e+00, 1.04096815812737642e+01, 5.23235030528505529e+00,
+    1.11757720865261696e+01, 1.73522889070557285e+00, 8.48462732623577054e+00,
+    9.74788117108629670e-01, 6.07001646418195850e+00, 4.54529196708544914e-01,
+    4.98273777334599188e+00, 1.81256123448038931e-01, 4.52620228319358908e+00,
+    4.64550318296600290e-02, 6.56850300769722950e-02, -4.02280414499166383e+00,
+    7.93552186526616743e-01, -1.71686968833211129e+00, 9.36543097812491454e-01,
+    -7.50141763804879513e-01, 9.76445609586846786e-01, -2.13832394660874919e-01,
+    -1.46719216083650794e+00, 9.47121711676847999e-01, -3.56082185264107620e-01,
+    -1.64604908295043428e-01, 1.34526965545423653e-02, -2.10500585206758545e-01,
+    1.22228548630706618e-01, -8.01939662501969519e-02, 7.93087147267531933e-01,
+    3.35014731375155930e-02, -4.80668456958572368e-02, 3.72156900546340777e-02,
+    -3.76440464555846815e-02, -1.11102787497110340e-02, 1.83125297550711420e-02,
+    -7.01831919461149041e-03, -3.67968920781670594e-01, -1.58118242813801130e-01,
+    2.47246578745035916e-02, 4.95865446909902752e-02, 8.62097763166531396e-03,
+    -4.55176251288517009e-03, -4.51758408410994627e-03, -9.89576337441618568e-03,
+    1.82711606204574800e-01, 1.26762231427645561e-01, 4.38111594327471668e-03,
+    -4.38169030062062967e-02, -1.47011537816552820e-02, 5.52957508568122872e-03,
+    5.59660135975799996e-03, 6.96705080688260567e-03, -9.24889142904454231e-02,
+    -7.81311906101442716e-02, -8.98622300999689025e-03, 2.57666207715329318e-02,
+    1.17842891098239918e-02, -1.16930317937798578e-03, -4.24177541846014906e-03,
+    -6.84504126269837223e-03,
+};
+
+static const real_t GL16_transf2_T[64] = {
+    -1.94741165601229338e-01, 7.79287888287410246e-01, -1.88672145128801971e+00,
+    3.50495579648798516e+00, -2.55533984778693757e+00, -1.33053029895212411e+01,
+    2.44627552527528742e+01, 2.05522187615559950e+01, -7.71650275523294051e-03,
+    1.05457229905080413e-01, -6.57230609420037859e-01, 2.94519609864233756e+00,
+    -9.74217781395618587e+00, 1.50264591544289665e+01, 1.77113990250654076e+01,
+    -8.92164011997203588e+00, -5.07705454280376611e-01, 2.11223832452459703e+00,
+    -4.20013459943153844e+00, -1.49554433813789900e+00, 2.49572475067868531e+01,
+    9.94022040721092424e+01, -1.42855855711758153e+02, -2.80335085347371603e+02,
+    4.37242202933728896e-01, -1.08642132279541892e+00, -3.66917338960160155e-01,
+    5.13438713401837799e+00, 2.38342359455659860e+01, -1.04075858834604347e+02,
+    -2.95625166849820062e+02, -1.20093395929955378e+02, 9.49881018432545410e-02,
+    7.34276584954210443e-01, -1.05862801815826191e+00, -7.00262207804096182e+00,
+    -8.29574571373993166e+01, -2.03119745828036002e+02, 2.53314279307038277e+02,
+    7.80707383284409843e+02, 1.33293541914859381e+00, -3.82379372704325782e+00,
+    3.24066475504700247e+00, -1.42398268272201829e+01, 1.97624780433543492e+01,
+    3.67180394131741082e+02, 1.20979166023276002e+03, 1.05780998042811893e+03,
+    1.60745851803835138e+00, -3.62580279776621772e+00, 7.14548406887781962e+00,
+    4.99321061969087587e+00, 6.05555494783994064e+01, 1.17022844745448012e+02,
+    -1.34921178848032980e+02, -5.20924516698594175e+02, 8.89728010704770478e-01,
+    -2.62979410977127293e+00, 2.84586143385806745e+00, -1.52334690499823875e+01,
+    -1.03018952004519960e+02, -6.96995215233693330e+02, -2.26468622880516932e+03,
+    -2.52720565318578883e+03,
+};
+
+static const real_t GL18_c[9] = {
+    9.84080119753813043e-01, 9.18015553663317885e-01, 8.06685716350295179e-01,
+    6.62126711701904513e-01, 5.00000000000000000e-01, 3.37873288298095542e-01,
+    1.93314283649704793e-01, 8.19844463366821014e-02, 1.59198802461869536e-02,
+};
+
+static const real_t GL18_A[81] = {
+    2.03185970903936031e-02, -3.32833304574119831e-03, 1.62854078450287232e-03,
+    -1.00789284653560250e-03, 6.96821310952462701e-04, -5.10573474928686065e-04,
+    3.82532112918055700e-04, -2.80274237640940733e-04, 1.77778462744798661e-04,
+    9.77219489135774944e-02, 4.51620401737143490e-02, -7.85743161241945695e-03,
+    4.06860757492492550e-03, -2.61929192528838513e-03, 1.85268620082252385e-03,
+    -1.36167198307300392e-03, 9.87172103665947057e-04, -6.22964091648914526e-04,
+    1.25083344609367680e-01, 1.41640812213802786e-01, 6.51526741007338595e-02,
+    -1.14898678396777327e-02, 6.04823779069206102e-03, -3.93283991503873102e-03,
+    2.77082889275901984e-03, -1.96440573995350842e-03, 1.22660978881256066e-03,
+    1.60046989811746393e-01, 1.49138771718266727e-01, 1.69944372506609986e-01,
+    7.80867692600007157e-02, -1.38269067352520640e-02, 7.30042826218022661e-03,
+    -4.71358646779919486e-03, 3.20336015198485584e-03, -1.96219418839121930e-03,
+    1.62288308050560048e-01, 1.69907953631646513e-01, 1.57455501875987752e-01,
+    1.79738635376542444e-01, 8.25598387503149456e-02, -1.46189578759125579e-02,
+    7.66417562464213886e-03, -4.78827613101664041e-03, 2.83136945006983972e-03,
+    1.58135732708392651e-01, 1.52970178368016574e-01, 1.60887124987800612e-01,
+    1.48873110257821184e-01, 1.70000445255253485e-01, 7.80867692600007157e-02,
+    -1.37708339866085723e-02, 7.03476680173468170e-03, -3.87345129174498058e-03,
+    1.29078738412655158e-01, 1.32269753941421236e-01, 1.27534519308708710e-01,
+    1.34238188116506452e-01, 1.24257110410775667e-01, 1.41795216041145478e-01,
+    6.51526741007338595e-02, -1.13354640123350479e-02, 5.22200359210005412e-03,
+    9.09470444390776123e-02, 8.93369082437627526e-02, 9.16857523305017047e-02,
+    8.84713941466061804e-02, 9.29433722727170814e-02, 8.62554727725037829e-02,
+    9.81815119598481584e-02, 4.51620401737143490e-02, -7.39786856614878686e-03,
+    4.04594157180424088e-02, 4.09174684184281448e-02, 4.02546620678691514e-02,
+    4.11477676557158931e-02, 3.99403728698347407e-02, 4.16450870273228080e-02,
+    3.90086533962843360e-02, 4.39655272265284044e-02, 2.03185970903936031e-02,
+};
+
+static const real_t GL18_b[9] = {
+    4.06371941807872061e-02, 9.03240803474286980e-02, 1.30305348201467719e-01,
+    1.56173538520001431e-01, 1.65119677500629891e-01, 1.56173538520001431e-01,
+    1.30305348201467719e-01, 9.03240803474286980e-02, 4.06371941807872061e-02,
+};
+
+static const real_t GL18_eig[9] = {
+    5.95852159636014278e+00, -1.45829273766843635e+01, 9.27687977436078093e+00,
+    -1.06345433508713025e+01, 1.12088436390155621e+01, -6.99631383577218724e+00,
+    1.22587358085485452e+01, -3.47569676696172492e+00, 1.25940383634299362e+01,
+};
+
+static const real_t GL18_transf1[81] = {
+    -2.23542857240978288e+00, 1.41163251370871223e+00, -5.17615208655575465e+00,
+    7.75475604972175780e+00, 1.20760679541691140e+00, 1.96506170087982852e+01,
+    2.12363007806392083e+01, 2.06574628471349158e+01, 1.68830332227740456e+01,
+    9.19552753307477033e+00, -4.91124791965698559e+00, 2.31839228639245505e+01,
+    -2.41169756706349574e+01, 8.83311714405106763e+00, -6.12620629823386835e+01,
+    -5.01124511034572819e+01, -6.48326002620559052e+01, -4.41222715002672032e+01,
+    -2.39885352924091109e+01, 8.48076349207271285e+00, -5.86412024984324347e+01,
+    2.55595321574462027e+01, -3.28581359697125137e+01, 7.22072702255809133e+01,
+    7.90002393978035400e+01, 8.28238062207808809e+01, 7.53388371702954061e+01,
+    5.53310161390317248e+01, -4.02358262058988014e+00, 6.57132527987330377e+01,
+    4.11976995474580505e+01, -5.77867631725486461e+01, -9.23905123510012771e+01,
+    -8.16917735871047057e+01, -2.33623541062134251e+02, -1.57637195252237508e+01,
+    -1.09665318383721583e+02, -4.29572509120984733e+01, 2.25388839809544436e+02,
+    -6.89168340574222213e+01, -2.63742357110626983e+02, 6.63325719050774637e+02,
+    -4.10876742264956647e+02, -6.30160337065334829e+02, 5.91634595467879535e+02,
+    1.13235851361879170e+02, 2.13796244266926834e+02, -5.06899602633043912e+02,
+    -1.15618239561950440e+03, 2.44545614715706824e+03, 2.48319220292831051e+03,
+    -5.72703701890120192e+03, -2.68457196195174538e+03, 3.64185517194513977e+03,
+    2.45919878812356529e+02, -3.67407653096008005e+02, -3.71387270827023121e+03,
+    1.67950389434173803e+03, 1.45968778786270905e+04, -2.78353210316263176e+03,
+    -3.03127593631848868e+04, 2.37710711336912118e+03, 1.92202037786090150e+04,
+    -5.03219361756453793e+02, -3.26100013841576526e+02, 3.08977858467566989e+02,
+    7.83313472457983971e+03, 2.02703670483111273e+04, -2.97518216304097150e+04,
+    -7.40454853388795018e+04, 3.68057964508424702e+04, 5.39258795537419574e+04,
+    -3.74868117482885225e+02, 1.56814447941330002e+02, 4.38900581777070329e+03,
+    4.82375545430627881e+03, 4.61273000124165810e+03, -3.35930780159071946e+04,
+    -6.43681183655825298e+04, 5.33435167187238403e+04, 5.58050980937804779e+04,
+};
+
+static const real_t GL18_transf2[81] = {
+    1.00000000000000000e+00, 3.74664969494595823e-01, -2.82936277652199586e-01,
+    -1.40603234995756686e-02, 5.12341900875049744e-02, -3.36810802684795810e-02,
+    1.94963141814371334e-02, -1.14910460349816560e-02, 6.41579041421255075e-03,
+    0.00000000000000000e+00, -5.48103923994669784e-01, -1.87297147311624029e-01,
+    1.54283042802511788e-01, -4.96344255885374924e-02, 1.12965653401599486e-02,
+    -1.10033868015421460e-03, -1.08739476372913635e-03, 1.08183081698114635e-03,
+    1.00000000000000000e+00, 4.14036821961684509e-01, -6.01160448087160806e-02,
+    -4.77312078842865029e-02, 3.80048491941612854e-03, 2.98028271995448828e-03,
+    -9.83154099410362943e-04, -1.54227782089711270e-04, 3.45360882510485005e-04,
+    0.00000000000000000e+00, -3.47903114524366397e-01, -1.85408128038528242e-01,
+    1.60859207222232431e-02, 8.04135660262417749e-03, 8.33057031832313698e-04,
+    -2.89667505269514385e-03, 2.30265689228269883e-03, -1.38728902667539745e-03,
+    1.00000000000000000e+00, 4.27672620724975361e-01, 4.36255271676432368e-02,
+    -1.63255420102107821e-02, -5.03009131300060763e-03, 6.42071275823832659e-04,
+    -6.99041385540100026e-04, 8.21228714328902255e-04, -5.69290476836378074e-04,
+    0.00000000000000000e+00, -2.12751788433177963e-01, -1.29519789975716282e-01,
+    -2.11837138380220960e-02, 1.24152136509504208e-03, 5.35768940823078458e-04,
+    2.09051744100802270e-04, -5.53540394103969131e-06, -1.14118451888390145e-04,
+    1.00000000000000000e+00, 4.33214010677844319e-01, 9.27258499554124704e-02,
+    8.39332696687686633e-03, -2.52404608962858348e-04, -2.68216554157763454e-04,
+    -2.97628808556305057e-05, -1.49836265343522114e-05, -3.79177483554851344e-05,
+    0.00000000000000000e+00, -1.01759567759645800e-01, -6.53272977320649290e-02,
+    -1.78080338682394708e-02, -2.20020487308048929e-03, -7.22135244710974842e-04,
+    4.25943721899710932e-04, -4.40733525996737441e-04, 3.52350347755374274e-04,
+    1.00000000000000000e+00, 4.34753940742774736e-01, 1.07410214805320273e-01,
+    1.69810702546352617e-02, 2.60918316543687183e-03, -7.35023267246560534e-05,
+    4.21023667431174101e-04, -3.55716616363148570e-04, 3.02535678629255427e-04,
+};
+
+static const real_t GL18_transf1_T[81] = {
+    5.95852159636014278e+00, 1.45829273766843635e+01, 9.27687977436078093e+00,
+    1.06345433508713025e+01, 1.12088436390155621e+01, 6.99631383577218724e+00,
+    1.22587358085485452e+01, 3.47569676696172492e+00, 1.25940383634299362e+01,
+    1.02254090306231600e+01, 2.19782297255537529e+00, 7.54076057280948397e+00,
+    1.17563716544029995e+00, 6.28219381539457533e+00, 6.07430343090684444e-01,
+    5.66434150613104581e+00, 2.58276879157913530e-01, 5.47530780836685071e+00,
+    1.04545877632118556e+00, -5.24205328642438850e+00, 1.41404145502908096e+00,
+    -2.35931559760392950e+00, 1.39515281130515034e+00, -1.14654919468010141e+00,
+    1.36375957474819853e+00, -4.78543147079971476e-01, 1.35272836588245382e+00,
+    -2.33367714986694663e+00, 7.14258166003922224e-01, -6.13863098286709374e-01,
+    -3.58372446834931135e-01, -3.47825374966397663e-02, -3.51663551546557707e-01,
+    1.64786903583494432e-01, -1.89131323057605855e-01, 2.13860250238975452e-01,
+    1.02909525184950534e+00, 4.51396676457095858e-01, -5.02595137087273394e-02,
+    1.15015120055170200e-01, -6.50675801214155164e-02, -2.12760785924961567e-02,
+    4.55308354588360512e-03, -2.78490121471132480e-02, 3.28601528827275266e-02,
+    -3.65426436129997312e-01, -4.23857918979477943e-01, 1.87885433678538112e-02,
+    3.94221157127028557e-02, 3.44846888235505978e-03, 1.04974824349250498e-02,
+    -7.78072741548225806e-04, -9.78470459308514694e-03, -9.25691122571679881e-04,
+    1.32215368161961305e-01, 2.77756942031909926e-01, 2.16842140413740364e-02,
+    -3.73275011000093679e-02, -9.29803719736452608e-03, -2.54748460534217486e-03,
+    -1.84530651042495090e-03, 5.11808480731304732e-03, 5.30238821954017413e-03,
+    -5.26122470949579382e-02, -1.74052354993723318e-01, -2.59184571354755186e-02,
+    1.97213291167680528e-02, 9.24375167396172814e-03, 5.68352833913879970e-03,
+    1.34817577225992014e-03, -5.45491439946687705e-03, -4.47990871298698228e-03,
+    2.24523655029106976e-02, 1.00007117961079417e-01, 1.79570566801844772e-02,
+    -9.19695823600472605e-03, -5.58267943617592622e-03, -5.26207072320718314e-03,
+    -1.68948662407611221e-03, 4.18757922981371176e-03, 3.81014594296315333e-03,
+};
+
+static const real_t GL18_transf2_T[81] = {
+    -1.36624750954311813e-01, 5.09385847517033752e-01, -1.07432457212324062e+00,
+    1.56494869658493085e+00, -1.08801063623353775e-01, -9.84445610615877342e+00,
+    2.74945193613507577e+01, 7.08014454533065152e+00, -1.82155413100470476e+01,
+    -9.74665104294274720e-02, 4.22435139436657558e-01, -1.20600951191948558e+00,
+    3.15480111399244523e+00, -7.47566123594050591e+00, 1.17873627999873030e+01,
+    5.62940411727340084e+00, -3.74003478072016478e+01, -1.82631658457956050e+01,
+    -6.55205634948182292e-01, 2.36775291081231742e+00, -4.09643439054793301e+00,
+    8.61118605948889337e-01, 1.41789975499790994e+01, 3.81263983207322283e+01,
+    -2.62680663165547912e+02, -4.03885716896026452e+02, -5.31355464996365612e+01,
+    8.48284488180057750e-02, 1.14585434909723546e-01, -1.94075781844186079e+00,
+    5.42804304005686955e+00, 8.82520115071446298e+00, -8.09243601431516026e+01,
+    -1.20081862934853277e+02, 3.81377644801384349e+02, 4.59064177306005774e+02,
+    -7.09940052518174269e-01, 3.02209733795083135e+00, -5.00317044416848944e+00,
+    -7.61669612626554842e-03, -4.35146940650772649e+01, 5.74932130529435597e+01,
+    1.04869791690626357e+03, 2.49366502597179215e+03, 1.64234319094968851e+03,
+    1.31000610497285574e+00, -3.57918469164286313e+00, 3.31912200959080339e+00,
+    -8.24739858317903973e+00, 3.20178668256808905e+01, 2.57424660187965287e+02,
+    4.06240624731745299e+02, -1.09782586890495668e+03, -1.97190096836080556e+03,
+    1.16121288765138386e+00, -2.39581088611187942e+00, 4.19182620878515255e+00,
+    -1.16676952760460240e+00, -1.75328561814388664e+01, -3.74948100978101195e+02,
+    -2.33964685574719078e+03, -6.37871710702715245e+03, -6.00206468553145442e+03,
+    2.01435834103540135e+00, -5.96796550278449178e+00, 7.94480968864703829e+00,
+    -1.93885309096289760e+01, -5.63760602564608249e+01, -3.25300905948141917e+02,
+    -4.69444483416510877e+02, 1.19386780604072692e+03, 2.64971530534786552e+03,
+    1.34055755076928440e+00, -3.50342521016830322e+00, 5.98210319805450919e+00,
+    -1.25168107880295221e+00, 4.69773537601603834e+01, 2.89172945710584202e+02,
+    1.52613508264512438e+03, 4.28185765340605667e+03, 4.43107258239144903e+03,
+};
+
+static const real_t GL20_c[10] = {
+    9.86953264258585872e-01, 9.32531683344492213e-01, 8.39704784149512218e-01,
+    7.16697697064623607e-01, 5.74437169490815580e-01, 4.25562830509184420e-01,
+    2.83302302935376393e-01, 1.60295215850487810e-01, 6.74683166555077457e-02,
+    1.30467357414141404e-02,
+};
+
+static const real_t GL20_A[100] = {
+    1.66678360771720345e-02, -2.73048042385026172e-03, 1.33655417682945863e-03,
+    -8.28320024764640219e-04, 5.74740863059631482e-04, -4.24726034358327326e-04,
+    3.24562105530182873e-04, -2.49838753970020859e-04, 1.86135539000451374e-04,
+    -1.19093958462027525e-04, 8.08463548676253280e-02, 3.73628372876451467e-02,
+    -6.50189553657047614e-03, 3.37030550065473868e-03, -2.17662512835813940e-03,
+    1.55179916885143628e-03, -1.16229795133242653e-03, 8.84246091931209055e-04,
+    -6.54328115142468613e-04, 4.17243835667835742e-04, 1.05151177527702505e-01,
+    1.19074554849880679e-01, 5.47715906289955104e-02, -9.66410929076711930e-03,
+    5.09910169489681455e-03, -3.33810079767527575e-03, 2.39281424177035639e-03,
+    -1.77613374657410077e-03, 1.29624965549819953e-03, -8.20986353138291073e-04,
+    1.37978710163823681e-01, 1.28561075193254243e-01, 1.46510972546527590e-01,
+    6.73166798274990874e-02, -1.19328858954177771e-02, 6.33145505482068417e-03,
+    -4.14845352723169480e-03, 2.94087333141394933e-03, -2.09411395745032290e-03,
+    1.31081462770308394e-03, 1.45214543387097661e-01, 1.52066158170335836e-01,
+    1.40883965959669288e-01, 1.60858631904573335e-01, 7.38810561786882175e-02,
+    -1.31122091695853749e-02, 6.94886598383539014e-03, -4.50274329686185283e-03,
+    3.06851861086753549e-03, -1.88262038693525662e-03, 1.49644732744311698e-01,
+    1.44693593746508892e-01, 1.52264855654238279e-01, 1.40813246373541034e-01,
+    1.60874321526961822e-01, 7.38810561786882175e-02, -1.30965195471968998e-02,
+    6.87814639770714491e-03, -4.30404581295939191e-03, 2.54756897027876364e-03,
+    1.33322545027295097e-01, 1.36727473612448497e-01, 1.31692486323584240e-01,
+    1.38781813182229874e-01, 1.28301904600177485e-01, 1.46566245550415947e-01,
+    6.73166798274990874e-02, -1.18776128915294259e-02, 6.07228446174392245e-03,
+    -3.34535050882549473e-03, 1.10364167611129313e-01, 1.08246931602492824e-01,
+    1.11319315004565128e-01, 1.07150367016220660e-01, 1.12881282055666304e-01,
+    1.04444079563094205e-01, 1.19207290548758144e-01, 5.47715906289955104e-02,
+    -9.53137359188965978e-03, 4.39200373028852259e-03, 7.43084307396224553e-02,
+    7.53800026904327680e-02, 7.38414284833590895e-02, 7.58879725266227295e-02,
+    7.31738754064388541e-02, 7.69022997036484385e-02, 7.13553690746355634e-02,
+    8.12275701118607696e-02, 3.73628372876451467e-02, -6.12068029233503019e-03,
+    3.34547661128060947e-02, 3.31495366153436166e-02, 3.35855109083140896e-02,
+    3.30111100488138867e-02, 3.37603981887023979e-02, 3.27609312912844342e-02,
+    3.41639921791087112e-02, 3.19991179775146115e-02, 3.60661525781943298e-02,
+    1.66678360771720345e-02,
+};
+
+static const real_t GL20_b[10] = {
+    3.33356721543440690e-02, 7.47256745752902934e-02, 1.09543181257991021e-01,
+    1.34633359654998175e-01, 1.47762112357376435e-01, 1.47762112357376435e-01,
+    1.34633359654998175e-01, 1.09543181257991021e-01, 7.47256745752902934e-02,
+    3.33356721543440690e-02,
+};
+
+static const real_t GL20_eig[10] = {
+    6.21783246729819616e+00, -1.64653989181471765e+01, 9.77243913371799877e+00,
+    -1.24499709649431338e+01, 1.19350566571755721e+01, -8.76989437788386361e+00,
+    1.32305819309537398e+01, -5.22313584160017985e+00, 1.38440898108544914e+01,
+    -1.73533039090244290e+00,
+};
+
+static const real_t GL20_transf1[100] = {
+    -2.58036099633636651e+00, 1.06163956376494114e-02, -9.35726430748586502e+00,
+    4.43553554106660997e+00, -1.05593863026361188e+01, 2.20532062152614117e+01,
+    1.33721329995506313e+01, 3.87872727867818980e+01, 4.79552505587179141e+01,
+    2.12505305478260915e+01, 9.98005851722034798e+00, 5.30330409365809330e-01,
+    3.56203685719213254e+01, -1.12324612113389986e+01, 4.59548363393773371e+01,
+    -6.58007392871451202e+01, -2.42701343228970288e+01, -1.20234661222830084e+02,
+    -1.31646407301898847e+02, -6.66611995322298867e+01, -2.32823696884913502e+01,
+    -3.98985401645596216e+00, -7.41476571770718351e+01, 9.40843304980507833e-01,
+    -9.52429239552234179e+01, 7.89678651334659065e+01, 2.62127143220146799e+01,
+    1.72428149048627120e+02, 2.13242536883430347e+02, 1.00273028992254666e+02,
+    4.59363572633068813e+01, 1.79400513025015762e+01, 8.53291898914149129e+01,
+    5.78147681412537366e+01, 5.55939078760178020e+01, -7.74236756985389292e+01,
+    -5.35936246513254844e+01, -2.96405371688973446e+02, -1.73929024832675452e+02,
+    -1.88215933479995982e+02, -7.63252350459926845e+01, -6.49061391246305277e+01,
+    9.98629104410783270e+01, -9.24927566994539490e+01, -1.37900255597962030e+02,
+    4.78538027919383694e+02, -5.22163498216619701e+02, 4.84909895338126873e+01,
+    6.74733169896310869e+02, -4.08010159874835836e+02, 6.75012451822677519e+01,
+    1.90454743814962740e+02, -4.35272734982722795e+02, -6.44080166526790777e+02,
+    2.27944753610097086e+03, 5.41086462773801486e+02, -3.73234583092186722e+03,
+    1.45279800276188257e+03, 1.78277331856477849e+03, -5.17504616541309042e+03,
+    1.72901768407645164e+02, -3.50438591756806375e+02, -2.06675268338959177e+03,
+    2.31961495579577377e+03, 6.31693750861667377e+03, -9.06201784985137419e+03,
+    -9.50683101139760765e+03, 2.27308025478195486e+04, 5.12325421138339789e+03,
+    -3.49924252469853600e+04, -6.58522771419197056e+02, -3.42774802042372286e+01,
+    6.13632898095335713e+03, 5.64931733034625995e+03, -1.77098487174061702e+04,
+    -3.53493766675931256e+04, 2.42621934154310838e+04, 9.81432279228074622e+04,
+    -1.20738037534632840e+04, -1.58035345138115750e+05, -9.36913616850546020e+01,
+    8.10481773605044395e+02, 1.28545099848316750e+04, -5.55520236943742384e+03,
+    -7.82309586987020157e+04, -2.32579494626802189e+04, 1.56813298151047638e+05,
+    1.76352776718776091e+05, -9.12905060707617813e+04, -3.79679680412846094e+05,
+    3.66068228736168521e+02, 3.60783611319887825e+02, 4.98382365331231904e+03,
+    -9.42274986531665672e+03, -6.84562311149595917e+04, 1.29791193376873962e+04,
+    1.83232670421682327e+05, 1.14725788532740291e+05, -1.20204005506054644e+05,
+    -3.50100491633218189e+05,
+};
+
+static const real_t GL20_transf2[100] = {
+    1.00000000000000000e+00, 4.35874359082504270e-01, -2.91943550330821422e-01,
+    -5.91789316424870329e-02, 7.97838957875997290e-02, -4.38595008939937636e-02,
+    2.18277964767746475e-02, -1.14763429768717264e-02, 6.49260505177524233e-03,
+    -3.56117365043275187e-03, 0.00000000000000000e+00, -5.58107831692340350e-01,
+    -2.59233873262577241e-01, 1.78707079221422011e-01, -3.87429516082982567e-02,
+    -3.22542907550762113e-03, 9.37829070662063273e-03, -7.99387215429904312e-03,
+    5.75259211862764151e-03, -3.53876513744557459e-03, 1.00000000000000000e+00,
+    4.57034325319412627e-01, -6.06605452942290124e-02, -7.00741969458185399e-02,
+    7.74274701880586433e-03, 2.71859022354518790e-03, -2.60420250581672142e-04,
+    -1.01344304472678255e-03, 1.11251823739539788e-03, -7.78249186244275490e-04,
+    0.00000000000000000e+00, -3.66847562134519523e-01, -2.30261932788276613e-01,
+    1.72452277526288847e-02, 1.45167394079447915e-02, -9.53061807800280932e-04,
+    -2.37995097053578112e-03, 1.85863463330249905e-03, -1.09797176295457831e-03,
+    5.81423436175069011e-04, 1.00000000000000000e+00, 4.64376841915096428e-01,
+    4.72356507440975515e-02, -2.80540598621690646e-02, -6.92509659738149014e-03,
+    7.27324743468388203e-04, -2.45355539773012906e-04, 4.72948736637238403e-04,
+    -3.67560007226998308e-04, 2.07857181267221569e-04, 0.00000000000000000e+00,
+    -2.39609225121282216e-01, -1.66097886086330554e-01, -2.74579690146754575e-02,
+    3.09617888224331247e-03, 1.43916617092505273e-03, -2.33519478333491670e-04,
+    2.61373954883655944e-04, -3.59113953349053661e-04, 2.82741289421776674e-04,
+    1.00000000000000000e+00, 4.67386616526664134e-01, 1.02261786879576877e-01,
+    4.58716360897695220e-03, -2.49668114046668228e-03, -4.34996746326385994e-04,
+    -2.32182392105930997e-04, 1.60081143644501690e-04, -1.74115237223172037e-04,
+    1.47639504864160325e-04, 0.00000000000000000e+00, -1.36716724705070708e-01,
+    -9.89693984345314109e-02, -2.78441453784794152e-02, -3.35196908924111688e-03,
+    -3.32064630791928861e-04, 2.55160052436401673e-04, -1.86140921130332576e-04,
+    1.83712093025699820e-04, -1.19243004658367384e-04, 1.00000000000000000e+00,
+    4.68507786929342640e-01, 1.26105507105751163e-01, 2.10252950940051642e-02,
+    2.63028173872652260e-03, 1.01653721644508890e-04, 1.56856174442734052e-04,
+    -1.34897584154389797e-04, 1.27505331396595095e-04, -9.63676568484573469e-05,
+    0.00000000000000000e+00, -4.45333492776441367e-02, -3.28024194843088701e-02,
+    -1.08422002607410084e-02, -2.05189820888171739e-03, -4.69697859916458663e-04,
+    6.91534887531360196e-05, -1.39039360550234506e-04, 1.23969484432457099e-04,
+    -1.03888663608061547e-04,
+};
+
+static const real_t GL20_transf1_T[100] = {
+    6.21783246729819616e+00, 1.64653989181471765e+01, 9.77243913371799877e+00,
+    1.24499709649431338e+01, 1.19350566571755721e+01, 8.76989437788386361e+00,
+    1.32305819309537398e+01, 5.22313584160017985e+00, 1.38440898108544914e+01,
+    1.73533039090244290e+00, 1.18996618297225147e+01, 3.70662420433512763e+00,
+    9.03358162333877068e+00, 2.10506860789663808e+00, 7.64371151481718147e+00,
+    1.21278617772622832e+00, 6.89788694834052674e+00, 6.32381961122572944e-01,
+    6.56334395374466961e+00, 1.96492114055077133e-01, 2.45313305049945463e+00,
+    -6.41883981157267147e+00, 2.27395289083973484e+00, -3.00544275061646715e+00,
+    2.02042108523626673e+00, -1.56813601318110241e+00, 1.86991356190098190e+00,
+    -7.75295530368475760e-01, 1.80273900144162003e+00, -2.35284922413321357e-01,
+    -3.31044803142432009e+00, 1.36765962275677166e-01, -8.99498409301240587e-01,
+    -7.03893778807477499e-01, -9.40233058288712370e-02, -5.73743557743176757e-01,
+    2.06124597664320841e-01, -3.44434868070027267e-01, 3.09890873197840089e-01,
+    -1.13614560602649323e-01, 1.13400105109277582e+00, 1.07277648899767164e+00,
+    -1.05067460165501628e-01, 2.38260927857218974e-01, -1.09804582018470237e-01,
+    -2.37792953353541427e-02, -1.55247544944602731e-02, -5.73890064150477316e-02,
+    3.99745779396912249e-02, -2.38422552486421135e-02, -2.19603052247745067e-01,
+    -7.42219356197098890e-01, 3.84328493240258737e-02, 2.45326308413163670e-02,
+    -3.94067328977536647e-03, 2.35550909677201686e-02, -4.02084141715249640e-03,
+    -6.66545540078132721e-03, 2.22238422290905362e-03, -6.32613656413155267e-03,
+    -1.86957160319944880e-02, 4.17716016937608736e-01, 2.70853794331617284e-02,
+    -2.65001505592190323e-02, -8.80391108179542263e-04, -4.93881037330231275e-03,
+    -4.40464377690749816e-03, 2.16319580526931014e-03, 2.05152681570202212e-03,
+    1.22956439554350251e-03, 6.02643159537596396e-02, -2.38667123056101216e-01,
+    -3.30437576891361717e-02, 5.54605734429693738e-03, 3.35244799024560398e-03,
+    7.26722342670867855e-03, 3.09020600333366653e-03, -1.62662714878411964e-03,
+    -1.62625504240621012e-03, -2.15896527214365797e-03, -5.43487935583211457e-02,
+    1.42671986241783622e-01, 2.45417333292096834e-02, 3.12095752952775167e-03,
+    -1.23745807067057387e-03, -7.50950782051826565e-03, -3.26319912912654327e-03,
+    1.52119036237444920e-03, 1.55006724533707728e-03, 1.93750855286286281e-03,
+    3.61243985203257012e-02, -8.06395935369217248e-02, -1.48440977021548227e-02,
+    -4.00725463129381673e-03, 1.17599052942866145e-06, 5.19741883396997433e-03,
+    2.57617897684193214e-03, -8.06513153333528405e-04, -1.15384134104234070e-03,
+    -1.60547371294884065e-03,
+};
+
+static const real_t GL20_transf2_T[100] = {
+    -5.23582450584430190e-02, 1.72134461219300233e-01, -2.55257550473354633e-01,
+    -3.15250101672633967e-02, 1.91795980868689631e+00, -8.76842452631319702e+00,
+    2.20975811531883686e+01, -1.13961414661929474e+01, -4.49605411915491331e+01,
+    -1.18290527722160554e+01, -1.36942093628603934e-01, 5.41119915758026537e-01,
+    -1.31762498506634707e+00, 2.80177690952950220e+00, -5.35977222623828364e+00,
+    7.41080374035436229e+00, 2.15620107603131528e+00, -3.56908129544976802e+01,
+    1.12882628600153421e+01, 2.66995837335052499e+01, -5.85485877960895795e-01,
+    1.94785283293468647e+00, -2.93936147570989137e+00, 4.55413423193817890e-01,
+    8.49268042117915023e+00, 1.50302109285930587e+01, -1.95911754506049988e+02,
+    -4.13845839231065611e+01, 7.77565677774449682e+02, 6.62736616030033133e+02,
+    -2.92019893998055724e-01, 1.33213927705755730e+00, -3.64843630492023951e+00,
+    6.49629546609505582e+00, 1.35491946049398515e+00, -4.67595111738479901e+01,
+    -1.22262925213183973e+01, 5.25363258021544766e+02, 4.22153332012745693e+02,
+    -1.19898238536513261e+02, -1.45621844458221039e+00, 5.13109239301750808e+00,
+    -8.33924907286939288e+00, 6.12023411504142700e+00, -2.66350529843157240e+01,
+    1.02390636171250293e+02, 7.06000772001101382e+02, 4.49688957205465840e+02,
+    -3.32664292594275776e+03, -4.24356685562955681e+03, 7.77736087207294480e-01,
+    -1.74289922157277011e+00, 4.88772842986729461e-01, -1.98992511086449131e+00,
+    2.05236919717783799e+01, 1.20572659905625500e+02, -2.40507081880627027e+02,
+    -2.63137854407409168e+03, -4.39313009248343315e+03, -2.03069951554030831e+03,
+    -1.26872750971166293e-01, 1.51680328042720780e+00, -2.73715067770314491e+00,
+    4.14715057116499874e+00, -3.53967358811196675e+01, -2.81566868713145368e+02,
+    -1.20845967122337538e+03, -9.47032066347261434e+02, 5.70167467750124979e+03,
+    9.02017236844432409e+03, 2.88155119501336543e+00, -8.48883233030082351e+00,
+    1.19519791393375634e+01, -2.07658470605460082e+01, -1.03087657847780463e+01,
+    -1.35020523769142087e+00, 1.24097742726731281e+03, 7.04404018510213882e+03,
+    1.55800704126033615e+04, 1.22322188829155348e+04, 3.22093531857271564e+00,
+    -8.76788296759870178e+00, 1.42710187767557830e+01, -1.06912730992329799e+01,
+    5.16211486355693481e+01, 1.72914446139615194e+02, 6.76273072575135529e+02,
+    5.50123834531095099e+02, -3.10763688814139277e+03, -5.42751307607258423e+03,
+    1.93872749021264390e+00, -5.91417524939663686e+00, 9.03186582094129875e+00,
+    -1.49355304271729814e+01, -2.30011807337867786e+01, -3.52134559845076296e+02,
+    -2.44283795422079584e+03, -1.13464085162272386e+04, -2.78149349223962963e+04,
+    -2.59691337554936654e+04,
+};
+
+static const real_t GL22_c[11] = {
+    9.89114329073028542e-01, 9.43531299884047603e-01, 8.65076002787024678e-01,
+    7.59548064603405959e-01, 6.34771577976172452e-01, 5.00000000000000000e-01,
+    3.65228422023827493e-01, 2.40451935396594096e-01, 1.34923997212975350e-01,
+    5.64687001159523486e-02, 1.08856709269715031e-02,
+};
+
+static const real_t GL22_A[121] = {
+    1.39171417790434158e-02, -2.27995563673762244e-03, 1.11629970782065220e-03,
+    -6.92385348153570107e-04, 4.81423558707219190e-04, -3.57437503780362695e-04,
+    2.75899729894848089e-04, -2.17065390840345286e-04, 1.70372117195620980e-04,
+    -1.28498936996653744e-04, 8.27488930845835148e-05, 6.79334403622872118e-02,
+    3.13950923662261530e-02, -5.46409618470190383e-03, 2.83415399684742390e-03,
+    -1.83370769779943169e-03, 1.31299566924781446e-03, -9.92886275645834615e-04,
+    7.71530960015176710e-04, -6.00947942995045336e-04, 4.51184930916069147e-04,
+    -2.89875324978482044e-04, 8.94095017147262805e-02, 1.01250732442946967e-01,
+    4.65725527319335655e-02, -8.21993568970346561e-03, 4.34292052947799889e-03,
+    -2.85350543902863603e-03, 2.06324037554684366e-03, -1.56237108006700544e-03,
+    1.19821656507352226e-03, -8.91466711988145354e-04, 5.70136062283444303e-04,
+    1.19497261347378383e-01, 1.11334061022460226e-01, 1.26886407111282462e-01,
+    5.82984411479976206e-02, -1.03406447964894902e-02, 5.50110797962507191e-03,
+    -3.63063338386324097e-03, 2.62061890572086323e-03, -1.95573987509097946e-03,
+    1.43267781287657317e-03, -9.09279657711640609e-04, 1.29129530102473356e-01,
+    1.35239708936815750e-01, 1.25275599007453803e-01, 1.43055964841794725e-01,
+    6.57011361275616629e-02, -1.16744800519194489e-02, 6.21926257425001877e-03,
+    -4.09164865278154478e-03, 2.91066795410457792e-03, -2.07783291714634666e-03,
+    1.30248911731822934e-03, 1.38214944551591140e-01, 1.33608996624472814e-01,
+    1.40643080925998948e-01, 1.30024162091145479e-01, 1.48586604969372316e-01,
+    6.82312716944751541e-02, -1.21240615804220006e-02, 6.43838129780483371e-03,
+    -4.18053753704864060e-03, 2.85354676447749844e-03, -1.75240116264082746e-03,
+    1.30099783137805097e-01, 1.33480105172269686e-01, 1.28491604301018747e-01,
+    1.35493920907904880e-01, 1.25183009680873314e-01, 1.43076752307042782e-01,
+    6.57011361275616629e-02, -1.16536925866713888e-02, 6.12667324766953767e-03,
+    -3.83743668169242739e-03, 2.27274215264998544e-03, 1.17506161953706875e-01,
+    1.15164204483118662e-01, 1.18552622171086225e-01, 1.13976263390274377e-01,
+    1.20227515679858482e-01, 1.11095774316370174e-01, 1.26937527092484737e-01,
+    5.82984411479976206e-02, -1.02895248152872140e-02, 5.26282127353501494e-03,
+    -2.90037905138315014e-03, 9.25749694015836760e-02, 9.40365721758552736e-02,
+    9.19468888987935995e-02, 9.47074765439341326e-02, 9.10818650883202796e-02,
+    9.59986109028957563e-02, 8.88021849343891279e-02, 1.01365041153570590e-01,
+    4.65725527319335655e-02, -8.10562697907984443e-03, 3.73560374914085015e-03,
+    6.30800600574307896e-02, 6.23389998015362462e-02, 6.33911326754473536e-02,
+    6.20186537724371351e-02, 6.37830710080981439e-02, 6.14771890632044987e-02,
+    6.46238924302517392e-02, 5.99560307356048899e-02, 6.82542809171542142e-02,
+    3.13950923662261530e-02, -5.14325562983490581e-03, 2.77515346650022490e-02,
+    2.79627824950834866e-02, 2.76639114408912118e-02, 2.80513489489271801e-02,
+    2.75583838281919860e-02, 2.81917210618671948e-02, 2.73528599993796140e-02,
+    2.85266689062404037e-02, 2.67179838502661811e-02, 3.01142391948244562e-02,
+    1.39171417790434158e-02,
+};
+
+static const real_t GL22_b[11] = {
+    2.78342835580868316e-02, 6.27901847324523060e-02, 9.31451054638671311e-02,
+    1.16596882295995241e-01, 1.31402272255123326e-01, 1.36462543388950308e-01,
+    1.31402272255123326e-01, 1.16596882295995241e-01, 9.31451054638671311e-02,
+    6.27901847324523060e-02, 2.78342835580868316e-02,
+};
+
+static const real_t GL22_eig[11] = {
+    6.45944417984061214e+00, -1.83542231374171578e+01, 1.02312965678165586e+01,
+    -1.42740415177867330e+01, 1.26026749097426176e+01, -1.05523834873935360e+01,
+    1.41157847753399057e+01, -6.97802900711165908e+00, 1.49684597214638782e+01,
+    -3.47420564150680766e+00, 1.52446796915928591e+01,
+};
+
+static const real_t GL22_transf1[121] = {
+    -2.13349997294530391e+00, -1.34946893778160848e+00, -1.13485689355547219e+01,
+    -1.27465310126326736e+00, -2.48030188019786522e+01, 1.67085760173245887e+01,
+    -9.32576261470192946e+00, 5.46631677309383122e+01, 5.00464576666271839e+01,
+    6.06001547401663458e+01, 4.40018368760797003e+01, 7.90155635082476770e+00,
+    5.52243732697514744e+00, 4.02606143250145934e+01, 9.03550801073534693e+00,
+    9.02490236185019370e+01, -4.47850602820619912e+01, 4.92984917515828442e+01,
+    -1.67057996359924601e+02, -1.36108965244044100e+02, -1.90432924110022014e+02,
+    -1.28438368275535964e+02, -1.69483185719743261e+01, -1.43472543754950195e+01,
+    -7.52972472568099960e+01, -3.60723740415070537e+01, -1.66869607721343471e+02,
+    3.88353245980392074e+01, -1.04600004280758796e+02, 2.45748741612552834e+02,
+    2.10280011237789608e+02, 3.01990963740469851e+02, 2.08954879454235510e+02,
+    2.91546485578883043e+01, 3.38793582161496545e+01, 8.10656927220863537e+01,
+    9.71240320574633955e+01, 1.67437947019323531e+02, -1.25036035364392557e+01,
+    1.13191338783585522e+02, -3.49573080970640547e+02, -2.17007292378310126e+02,
+    -4.53106636016446657e+02, -2.21658806915595875e+02, -3.83534769277852021e+01,
+    -7.81321584608177773e+01, 4.71115472901777252e+01, -1.28393252861420621e+02,
+    -1.83223422022500131e+02, 2.61120686157917419e+02, -5.45315432964958632e+02,
+    3.77851769059021251e+02, 2.37153838198097532e+02, -1.25772402944520021e+01,
+    5.26963002152998001e+02, 1.00018621454837398e+01, 1.69215435250979709e+02,
+    -2.88439743016156854e+02, -3.28882700566797155e+02, 1.62551699354572156e+03,
+    -9.70239441365133786e+01, -1.07299260366089652e+03, 1.85035295142012887e+03,
+    -2.01688933574273346e+03, -3.55402589137764289e+03, 1.69965072360538170e+03,
+    1.69392372142033281e+02, -2.80482848413936210e+02, -1.06518997820669188e+03,
+    1.78118658985749698e+03, 4.52706751010704068e+02, -7.25658452348438732e+03,
+    6.46581832140277220e+03, 1.52710621673485512e+04, -2.11968292641806256e+04,
+    -1.38573592462399283e+04, 1.52178669393876262e+04, -5.92377411118069404e+02,
+    8.68225404127637148e+01, 6.48744350059266435e+03, 1.90154841210909103e+03,
+    -2.92235516645559073e+04, -1.06640893615167752e+04, 8.12326617179109016e+04,
+    2.31841981843299982e+04, -1.46541391663144779e+05, -2.31033402555245302e+04,
+    8.85908999981143716e+04, 4.25268174736665230e+02, 8.36042473965189401e+02,
+    5.26111495500936962e+03, -1.48141607647415294e+04, -6.81566868924780283e+04,
+    6.55809733518036810e+04, 2.68675181816281925e+05, -1.31108736699802888e+05,
+    -5.60923102537096362e+05, 1.21348681256235650e+05, 3.54769915315620077e+05,
+    1.01122479744864359e+03, -3.49965735664706472e+02, -1.65029594066114696e+04,
+    -1.68736158530589928e+04, 4.17165736901506625e+03, 1.71072242411783198e+05,
+    3.28779648858590052e+05, -5.14378664966322132e+05, -1.10786701104304893e+06,
+    5.83711943240023917e+05, 7.90344690093006473e+05, 2.42183834285499984e+02,
+    -5.88371693847880579e+02, -1.65344609360004360e+04, -2.42147379192872131e+03,
+    6.51680649365801437e+04, 1.17951138249523952e+05, 1.27723421991771917e+05,
+    -4.98733256002435170e+05, -8.78572761193495244e+05, 6.58927033364711213e+05,
+    7.02066437505702605e+05,
+};
+
+static const real_t GL22_transf2[121] = {
+    1.00000000000000000e+00, 4.93635880160564311e-01, -2.87073157213255936e-01,
+    -1.14721013261112365e-01, 1.07814531969922550e-01, -4.89422826601738845e-02,
+    1.91935272966321513e-02, -7.59086489439859523e-03, 3.20127599589655875e-03,
+    -1.46248975770430119e-03, 6.84947269581260404e-04, 0.00000000000000000e+00,
+    -5.58686927250559684e-01, -3.34152957470677137e-01, 1.93126493349602552e-01,
+    -1.66061675399915842e-02, -2.36128131288964802e-02, 2.17083632874776819e-02,
+    -1.49535600171468823e-02, 9.92555314098885096e-03, -6.55516771487393412e-03,
+    3.90804512354798496e-03, 1.00000000000000000e+00, 4.98016096005080233e-01,
+    -5.47008726393166042e-02, -9.56344075115516806e-02, 1.00880676002697619e-02,
+    4.06518723779359867e-03, -3.55046655389428250e-04, -1.34688989545015086e-03,
+    1.42574348709025500e-03, -1.09145791786064003e-03, 6.82999778188239214e-04,
+    0.00000000000000000e+00, -3.79448615595294525e-01, -2.75747103928421666e-01,
+    1.34486346196400139e-02, 2.42963955590967708e-02, -3.46177024378232319e-03,
+    -1.69685811758891678e-03, 1.20501177387712598e-03, -4.43135289833006653e-04,
+    8.23986252591207033e-05, 2.29347036459485867e-05, 1.00000000000000000e+00,
+    4.99208390265084068e-01, 5.42007457369169249e-02, -4.15713096951006306e-02,
+    -9.64002026893565067e-03, 1.06130858166751684e-03, 2.19988215886638490e-04,
+    1.24055859378777508e-04, -1.03571320236806516e-04, 1.46199627912267812e-05,
+    1.95178167012998362e-05, 0.00000000000000000e+00, -2.60134745239030130e-01,
+    -2.02619699045497620e-01, -3.61776379347660410e-02, 6.13911892363493486e-03,
+    2.22459486069897985e-03, -4.50589156197212274e-04, 2.70338234710212596e-04,
+    -3.65537987329579673e-04, 3.31101234054803791e-04, -2.21065752608745722e-04,
+    1.00000000000000000e+00, 4.99289465043384950e-01, 1.12411200653116577e-01,
+    -1.06947753030262071e-03, -5.42680966375438077e-03, -8.15639139217801189e-04,
+    -2.06269509551662854e-04, 1.70048354476593459e-04, -1.53245602254816182e-04,
+    1.49878438550981111e-04, -1.07352040550488150e-04, 0.00000000000000000e+00,
+    -1.64364194057815299e-01, -1.32194688529280485e-01, -3.91565035227590466e-02,
+    -4.13598352612878917e-03, 2.29947019040597860e-04, 1.78784914457712191e-04,
+    -1.06312269197388760e-05, 2.34278847650702778e-05, -5.43488736770151000e-06,
+    -8.79349293319325846e-06, 1.00000000000000000e+00, 4.99117372944488102e-01,
+    1.41914659167111851e-01, 2.24701497416960640e-02, 1.66709041899386866e-03,
+    -9.63740796027701992e-05, -3.80496197300010419e-05, -2.13584883118158564e-05,
+    3.52914203624484571e-06, -2.16844917618216708e-06, -3.34836104172367998e-06,
+    0.00000000000000000e+00, -7.98204267604563228e-02, -6.51615108206054228e-02,
+    -2.31300969529052228e-02, -4.59133944658412802e-03, -7.52825136276742972e-04,
+    2.55047167157028676e-05, -1.07097564156695014e-04, 1.00068709832874518e-04,
+    -9.44580042280202464e-05, 7.14869423708333179e-05, 1.00000000000000000e+00,
+    4.99029953606127008e-01, 1.51004044921261599e-01, 3.01234015535199531e-02,
+    4.59148048150035282e-03, 4.93796556887961106e-04, 1.58993395624714426e-04,
+    -7.53702383510581882e-05, 8.89394242337406628e-05, -8.10970121836901593e-05,
+    6.26747477523767715e-05,
+};
+
+static const real_t GL22_transf1_T[121] = {
+    6.45944417984061214e+00, 1.83542231374171578e+01, 1.02312965678165586e+01,
+    1.42740415177867330e+01, 1.26026749097426176e+01, 1.05523834873935360e+01,
+    1.41157847753399057e+01, 6.97802900711165908e+00, 1.49684597214638782e+01,
+    3.47420564150680766e+00, 1.52446796915928591e+01, 1.34428779397783735e+01,
+    5.45149607252064872e+00, 1.05116156666481118e+01, 3.22645111249969796e+00,
+    9.03640264488444167e+00, 1.98944474722536913e+00, 8.19480074301298345e+00,
+    1.16392678192568000e+00, 7.74833087016109268e+00, 5.39247549943850046e-01,
+    7.60755179923585079e+00, 4.27878490889503826e+00, -7.42744716056542842e+00,
+    3.37636475939253389e+00, -3.60205292512098607e+00, 2.82119514481633882e+00,
+    -1.98160314306163499e+00, 2.50923068590035259e+00, -1.08162315284072208e+00,
+    2.35062834813024235e+00, -4.82326740617068983e-01, 2.30200829695953280e+00,
+    -4.28572073410042620e+00, -8.58125272504931980e-01, -1.17043035425639430e+00,
+    -1.22749253412308246e+00, -1.42149392503857497e-01, -8.94611411870131379e-01,
+    2.58138702759068639e-01, -5.60187621511011424e-01, 4.16702244666222188e-01,
+    -2.68156003595012959e-01, 4.59221607904642448e-01, 1.00121525552169510e+00,
+    1.87158536496649730e+00, -2.43593747528575100e-01, 3.92581124254590019e-01,
+    -1.86272378729636062e-01, -2.43558706772354708e-02, -4.77426642120289124e-02,
+    -9.62510885389373655e-02, 4.09050331961433866e-02, -6.29334646351923238e-02,
+    6.99956492506734335e-02, 1.17254898192525076e-01, -1.05082322513448845e+00,
+    9.10055884183569030e-02, 2.26082533960630244e-02, -1.00994510405046992e-02,
+    3.92351809874907642e-02, -1.31179635125061346e-02, -2.44567094228933515e-03,
+    1.17289780679357271e-03, -1.16034561007149536e-02, 7.52777034256837951e-03,
+    -2.74460625539637626e-01, 4.92506243687656942e-01, 2.05884355935570355e-02,
+    -2.24290093343391672e-02, 7.52722954024763122e-03, -3.35722863666537566e-03,
+    -4.15922232166608414e-03, 1.08433475262842264e-03, -6.58152831044265803e-04,
+    2.49574121343186495e-04, 2.42380338937747295e-03, 2.25428209191393975e-01,
+    -2.35916114298435065e-01, -3.09808180542898680e-02, -6.89672946129530305e-03,
+    -1.28927705756768838e-03, 4.71606988974953342e-03, 2.47455098301942568e-03,
+    1.03653423905244102e-03, 5.23752895780544124e-05, -1.67728935593335071e-03,
+    -1.14899514194088991e-03, -1.61497353512243647e-01, 1.22870490421401912e-01,
+    2.09125359711261304e-02, 1.58172731584934959e-02, 2.55202134259440491e-03,
+    -5.69968071091073343e-03, -2.32666239866225876e-03, -7.38649278661206599e-04,
+    -2.94833455818824404e-04, 1.51013541768423910e-03, 1.35585303439806812e-03,
+    1.10868139988509556e-01, -6.91856032928134107e-02, -1.23431910468810128e-02,
+    -1.47364708626533947e-02, -3.30965655664516942e-03, 4.32703666895174234e-03,
+    2.15357658275186275e-03, 9.69138391388660444e-04, 2.95708187022737515e-04,
+    -1.42142447001819853e-03, -1.23629797468555983e-03, -6.73047535747003239e-02,
+    3.78154743511155897e-02, 6.66060237435639729e-03, 9.98381894519474039e-03,
+    2.57874729629117968e-03, -2.58006032713683792e-03, -1.45399705084259885e-03,
+    -8.73232706602361844e-04, -2.98480145864780922e-04, 1.05841652266747003e-03,
+    9.55456454236363294e-04,
+};
+
+static const real_t GL22_transf2_T[121] = {
+    2.90205338667419779e-02, -1.32911063869355944e-01, 4.06379312561890860e-01,
+    -1.14501920258439616e+00, 3.13340436360125807e+00, -8.03274145504705928e+00,
+    1.64875689429445984e+01, -1.43157990678374905e+01, -3.32748282963760289e+01,
+    3.42187887658318743e+01, 3.26556138874297019e+01, -1.26453540100815581e-01,
+    4.77279146231674278e-01, -1.06641958696728878e+00, 1.99141287038811332e+00,
+    -3.19237306142840760e+00, 3.37191646424328084e+00, 3.42655967637207404e+00,
+    -2.72365276594270824e+01, 3.48805321760394591e+01, 4.30522411979999902e+01,
+    1.70242668334569514e+00, -3.17468651684043424e-01, 9.17378942308108236e-01,
+    -8.28362401971103002e-01, -1.80575654853049961e+00, 7.50484766368684930e+00,
+    5.65245216995692878e+00, -1.17768303549595856e+02, 1.27200567979690888e+02,
+    8.60123721635944662e+02, 2.33468081741556801e+02, -4.36422409658047911e+02,
+    -5.67495407596827373e-01, 2.16299204837802206e+00, -4.68136692564250545e+00,
+    6.97356269948786522e+00, -2.07879280835163005e+00, -2.42588377700106115e+01,
+    9.78927107110818184e+00, 3.63318038520169353e+02, -2.47937202764338537e+02,
+    -1.32349626183221494e+03, -8.45541455018776560e+02, -1.80953179554485111e+00,
+    5.95886805847934919e+00, -9.30049109255072004e+00, 8.29856789112746540e+00,
+    -1.87450842539837517e+01, 7.96124036067806742e+01, 3.04535917192053773e+02,
+    -9.46639869806632419e+02, -5.74058379700858222e+03, -6.48695124784338350e+03,
+    -1.56700486437757377e+03, -1.89348486649586339e-01, 1.43582221642515018e+00,
+    -4.70590763122802080e+00, 5.95635988268473771e+00, 5.02396269520783623e+00,
+    5.89618215495621598e+01, -3.20805286857255282e+02, -1.63881052555012343e+03,
+    3.97069012736569050e+02, 8.14267176733907854e+03, 8.04714100143934411e+03,
+    -2.06930917800007697e+00, 7.50810825958218064e+00, -1.28710436768302809e+01,
+    1.62820885898364374e+01, -4.16789193473493143e+01, -1.13160496664194014e+02,
+    -6.16734088734990920e+01, 3.97213002321903377e+03, 1.89855796712881311e+04,
+    3.31937466289170552e+04, 2.13072327208148745e+04, 2.84953822280155977e+00,
+    -8.12326065897135763e+00, 1.10467981742145209e+01, -1.67157687829452151e+01,
+    6.16437996562292145e+00, 7.51439427647889318e+01, 1.05135517206158693e+03,
+    3.60602244342067161e+03, 9.72803839906996899e+01, -2.00308904276429384e+04,
+    -2.47985339523484690e+04, 2.28091576202649726e+00, -5.82631681606950735e+00,
+    8.88677664274026036e+00, -7.08980436223359867e+00, 1.52187411275343791e+01,
+    -7.55630204281763014e+01, -1.13982294684589715e+03, -8.94964165867756310e+03,
+    -3.73435646392585841e+04, -7.88184505134308711e+04, -6.53896712106233535e+04,
+    4.57792761737138054e+00, -1.40745775304804184e+01, 2.22377892903823522e+01,
+    -3.19163149194202198e+01, 2.69204692649022848e+00, -2.54972618042042484e+02,
+    -1.19032545031616428e+03, -3.62069556948817490e+03, -5.60548102048142255e+02,
+    2.07022261193038539e+04, 2.88439743823063327e+04, 2.88637332933573187e+00,
+    -8.42512738043077469e+00, 1.37067412160499522e+01, -1.45400763676154092e+01,
+    3.45670104465105794e+01, 1.11491402770679770e+02, 9.98241173133993811e+02,
+    5.81126673635330735e+03, 2.32717198716394632e+04, 5.18439682618498118e+04,
+    4.60532101499566706e+04,
+};
+
+static const real_t GL24_c[12] = {
+    9.90780317123359677e-01, 9.52058628185237454e-01, 8.84951337097152346e-01,
+    7.93658977143308686e-01, 6.83915749499090064e-01, 5.62616704255734512e-01,
+    4.37383295744265543e-01, 3.16084250500909880e-01, 2.06341022856691286e-01,
+    1.15048662902847654e-01, 4.79413718147625734e-02, 9.21968287664037475e-03,
+};
+
+static const real_t GL24_A[144] = {
+    1.17938340966279569e-02, -1.93215503936855037e-03, 9.46159946801215681e-04,
+    -5.87157929441285481e-04, 4.08780829862264382e-04, -3.04349193692679879e-04,
+    2.36257179789026438e-04, -1.88000196714650092e-04, 1.51074627300977151e-04,
+    -1.20308349110379278e-04, 9.15875660363567453e-05, -5.92710487056506938e-05,
+    5.78495651553385323e-02, 2.67348314988296067e-02, -4.65339475702450031e-03,
+    2.41461456827053896e-03, -1.56401052723059643e-03, 1.12275870416866192e-03,
+    -8.53608723970616153e-04, 6.70629185517022269e-04, -5.34534766345622515e-04,
+    4.23460056141347174e-04, -3.21341337251878495e-04, 2.07615108480287521e-04,
+    7.68285946304165662e-02, 8.70048679342290548e-02, 4.00195821358365553e-02,
+    -7.06468960072847811e-03, 3.73560368818852450e-03, -2.45976665588796412e-03,
+    1.78717327876101316e-03, -1.36729574370243203e-03, 1.07205559231517492e-03,
+    -8.40553839984532086e-04, 6.33880729666708100e-04, -4.08237882558168137e-04,
+    1.04112394124448240e-01, 9.69963361380686145e-02, 1.10550041407546706e-01,
+    5.07918566807664812e-02, -9.01252279942133493e-03, 4.80193492467387382e-03,
+    -3.18192887322027483e-03, 2.31791162580606905e-03, -1.76593366081374110e-03,
+    1.36062625076553267e-03, -1.01552961889071281e-03, 6.50624788775465120e-04,
+    1.14723023070228830e-01, 1.20161146582434666e-01, 1.11297463371011651e-01,
+    1.27104015290874228e-01, 5.83731341345887014e-02, -1.03795246551256822e-02,
+    5.54513518951393718e-03, -3.67597498519267292e-03, 2.66388699069817917e-03,
+    -1.99435710192794307e-03, 1.46425936525797326e-03, -9.30499836629974171e-04,
+    1.26180881927588057e-01, 1.21957721734388486e-01, 1.28401921174483485e-01,
+    1.18684843210514285e-01, 1.35648942888475177e-01, 6.22867614533506933e-02,
+    -1.10819177291206373e-02, 5.91690882965931111e-03, -3.90204370620793328e-03,
+    2.78156916561874811e-03, -1.98873604147400181e-03, 1.24774475192659592e-03,
+    1.23325778154774801e-01, 1.26562258948175382e-01, 1.21791953741082648e-01,
+    1.28475566612909320e-01, 1.18656614077042075e-01, 1.35655440635822022e-01,
+    6.22867614533506933e-02, -1.10754199817737920e-02, 5.88867969618710879e-03,
+    -3.82839826778209099e-03, 2.61580117231290923e-03, -1.60735902088665660e-03,
+    1.17676768105807378e-01, 1.15282008903919431e-01, 1.18740625371105343e-01,
+    1.14082381278479222e-01, 1.20422243254370079e-01, 1.11201133079663464e-01,
+    1.27125792924303094e-01, 5.83731341345887014e-02, -1.03577470216968150e-02,
+    5.44880489816575598e-03, -3.41487831325726311e-03, 2.02324519894856846e-03,
+    1.00933088572757498e-01, 1.02599242980423680e-01, 1.00223087110767425e-01,
+    1.03349647022346697e-01, 9.92658017357268968e-02, 1.04765642234753237e-01,
+    9.67817784368590894e-02, 1.10596236160954292e-01, 5.07918566807664812e-02,
+    -8.96632804601375268e-03, 4.58737722346434437e-03, -2.52868076291527539e-03,
+    8.04474021542312817e-02, 7.94052835420064052e-02, 8.08797181116576447e-02,
+    7.89671086793579391e-02, 8.14064600153755480e-02, 7.82519909929120933e-02,
+    8.24989309275610816e-02, 7.63035605834845865e-02, 8.71038538724015904e-02,
+    4.00195821358365553e-02, -6.96570366255593564e-03, 3.21056964125654258e-03,
+    5.32620478891789248e-02, 5.37910043349110953e-02, 5.30462029415178712e-02,
+    5.40041977640048354e-02, 5.27990338121421959e-02, 5.43232717216298316e-02,
+    5.23469042934905510e-02, 5.50336735248898104e-02, 5.10550484293886761e-02,
+    5.81230577546837171e-02, 2.67348314988296067e-02, -4.37990215767931641e-03,
+    2.36469392419615641e-02, 2.34960806272195566e-02, 2.37079765423662929e-02,
+    2.34365935659549378e-02, 2.37756683899705626e-02, 2.33514110134668863e-02,
+    2.38920173869485927e-02, 2.31788873633936507e-02, 2.41748261226971996e-02,
+    2.26415082464546981e-02, 2.55198232326244653e-02, 1.17938340966279569e-02,
+};
+
+static const real_t GL24_b[12] = {
+    2.35876681932559139e-02, 5.34696629976592133e-02, 8.00391642716731105e-02,
+    1.01583713361532962e-01, 1.16746268269177403e-01, 1.24573522906701387e-01,
+    1.24573522906701387e-01, 1.16746268269177403e-01, 1.01583713361532962e-01,
+    8.00391642716731105e-02, 5.34696629976592133e-02, 2.35876681932559139e-02,
+};
+
+static const real_t GL24_eig[12] = {
+    6.68604661560506663e+00, -2.02485936144816385e+01, 1.06594171817516585e+01,
+    -1.61058137285140646e+01, 1.32220084999127039e+01, -1.23430699860744593e+01,
+    1.49311424807035404e+01, -8.74033918670913046e+00, 1.65068440228241613e+01,
+    -1.73538714401953764e+00, 1.59945411992028692e+01, -5.21813307389159675e+00,
+};
+
+static const real_t GL24_transf1[144] = {
+    -1.03709004900325397e+00, -2.24973398503570632e+00, -9.75516112239595401e+00,
+    -7.84962778366770397e+00, -3.60708902342263755e+01, 1.58462952851260441e+00,
+    -4.70152781874570636e+01, 5.63995390492145035e+01, 1.26675094801756657e+02,
+    6.30804061943083667e+01, 2.19397777649677721e+01, 1.12185180841790753e+02,
+    3.59280782888395533e+00, 8.63541533662710314e+00, 3.26102951573995625e+01,
+    3.13578950442016939e+01, 1.23377600119726210e+02, 8.01482875065285150e+00,
+    1.70540124117389212e+02, -1.66366040958928380e+02, -3.78183430901409224e+02,
+    -2.01055164620266879e+02, -4.23879025956673345e+01, -3.52288090890881392e+02,
+    -6.62565564811791585e+00, -2.00323519439438158e+01, -5.41076856160862931e+01,
+    -7.48999808237081197e+01, -2.15010641287645342e+02, -5.74880599501244376e+01,
+    -3.13700257171560281e+02, 2.32917417404689388e+02, 6.15973848402343719e+02,
+    3.34516249066486751e+02, 3.85306736750886003e+01, 5.69104009987436143e+02,
+    7.93613732215327605e+00, 4.04309310808755029e+01, 4.38617099141436597e+01,
+    1.40111967491272338e+02, 2.34399768899576628e+02, 1.24100944697471817e+02,
+    3.94470965398610417e+02, -2.96020717401121146e+02, -7.28735663316540922e+02,
+    -4.68110331451993147e+02, -7.58000216063339138e+00, -7.87249887484058945e+02,
+    4.01752048251951932e-01, -7.72604869003678374e+01, 5.97997324103360626e+01,
+    -1.66983452840892681e+02, -2.34216019293756204e+02, 7.54689230313407311e+00,
+    -7.22483146067785015e+02, 3.88070376216142051e+02, 1.12708606274807448e+03,
+    2.90700897369204029e+02, -1.79495185441402811e+02, 5.86086742098048489e+02,
+    -4.44437963217751744e+01, 1.37814923739360950e+02, -2.13036675952218019e+02,
+    -1.34622486973593738e+02, 1.13676911694113414e+03, -6.75677481438401912e+01,
+    4.23672163341654709e+02, 1.26647756369236299e+03, 7.15288872892269069e+02,
+    -2.68371324343828155e+03, -2.06730838709992440e+03, -1.70739950310835638e+03,
+    1.90980413031037074e+02, -1.95456716841384463e+02, -5.95967416115602532e+02,
+    1.13148680375900881e+03, -1.40112204409200604e+03, -4.57523804034354725e+03,
+    8.09936216945970864e+03, 5.58464804196865407e+03, 9.82128281839606461e+03,
+    -1.87516220211394502e+04, -1.60657112546365115e+04, 5.49643861548156019e+03,
+    -5.04122183402997962e+02, 6.10560726182407265e+01, 4.78697063762105245e+03,
+    3.03796009083824913e+02, -2.06283340529522611e+04, 3.75201323275557479e+03,
+    5.11400582950059179e+04, -2.86198800150991119e+04, 3.16831051971577690e+04,
+    -1.44351279540879652e+05, -6.65279586018654663e+04, 8.53480522878436313e+04,
+    5.86493814737145726e+02, 6.53830226057454297e+02, -2.14353031265449044e+03,
+    -1.32593821944491610e+04, -3.75593080039443203e+03, 7.86203510656487633e+04,
+    2.59877138999190502e+04, -2.58392036685289553e+05, 2.58275626394088249e+04,
+    -7.84535023285575095e+05, -4.64485237587109077e+04, 5.46730837520605652e+05,
+    7.15566375634316159e+02, -1.06593461168177055e+03, -2.77168164723912487e+04,
+    1.67508356574544109e+03, 1.83452046771900961e+05, 9.74800840421073663e+04,
+    -5.13231791542327905e+05, -6.14483958231877768e+05, -3.52785608440546610e+05,
+    -2.77057118932795804e+06, 7.09506126714249491e+05, 1.71835627349424339e+06,
+    -9.50195171866955661e+02, -9.78523230012172007e+02, -1.59164340072412233e+04,
+    3.44563771725295155e+04, 3.17406779499386495e+05, -1.12218312105075180e+05,
+    -1.39695601410832629e+06, -4.13605494341689628e+05, -1.35824909798335191e+06,
+    -5.48192434541484527e+06, 2.45473873198089795e+06, 2.67970830559339747e+06,
+    -7.75407915629870445e+02, -7.32315605577234585e+00, 4.83115946164148500e+03,
+    2.48556416564345527e+04, 1.69565293758872780e+05, -1.80827954083125136e+05,
+    -1.14418661439894210e+06, 5.77586888679899712e+04, -1.44091065888930275e+06,
+    -4.49607345177816413e+06, 2.41136674559712643e+06, 1.74732231519527943e+06,
+};
+
+static const real_t GL24_transf2[144] = {
+    1.00000000000000000e+00, 5.45789128606581686e-01, -2.68108235294006680e-01,
+    -1.77461437857232507e-01, 1.31193344362273201e-01, -4.61807500113691205e-02,
+    1.05339911384039770e-02, 8.54350395214194871e-05, -2.49063284034054932e-03,
+    2.58981996271287094e-03, -2.09021352032569448e-03, 1.36475617211044087e-03,
+    0.00000000000000000e+00, -5.51541901374892674e-01, -4.07651258889503376e-01,
+    1.94116344172082123e-01, 1.71479421976238298e-02, -4.81648461497291291e-02,
+    3.37526017864212338e-02, -2.01303722520036719e-02, 1.20836979286697514e-02,
+    -7.58903797571792819e-03, 4.89307620716647896e-03, -2.88846633812075981e-03,
+    1.00000000000000000e+00, 5.36366127528257963e-01, -4.24115113813516853e-02,
+    -1.23109234254970709e-01, 9.66739261898248020e-03, 7.45543738397310037e-03,
+    -1.29216029567098237e-03, -1.21689185835499830e-03, 1.33800836061682841e-03,
+    -9.75878918184778978e-04, 6.44683474353969794e-04, -3.77819402621299252e-04,
+    0.00000000000000000e+00, -3.86739730888771505e-01, -3.20381704470445283e-01,
+    3.90390571073804486e-03, 3.70324445481080428e-02, -5.98911378829965896e-03,
+    -1.37173286737824981e-03, 7.22615249971104924e-04, 1.49685415348803298e-04,
+    -4.51848877663537740e-04, 4.53465427818275390e-04, -3.19036436485536218e-04,
+    1.00000000000000000e+00, 5.32039974296542928e-01, 6.46459997566935923e-02,
+    -5.61259465990951376e-02, -1.37311109206222064e-02, 1.81717495242949049e-03,
+    6.31581865059794179e-04, -1.35063577972172635e-04, 6.53892352545232123e-05,
+    -1.24989974213768486e-04, 1.39778879512765557e-04, -1.04195245863819932e-04,
+    0.00000000000000000e+00, -2.75431278771633425e-01, -2.38358556697705670e-01,
+    -4.78072548270374112e-02, 1.01725052312820249e-02, 3.17112790051586298e-03,
+    -5.98081595830019419e-04, 1.35042257453247373e-04, -2.39673782950740110e-04,
+    2.33205171615962897e-04, -1.69914484710007361e-04, 1.01770729278892724e-04,
+    1.00000000000000000e+00, 5.29198013002025403e-01, 1.23885033025702945e-01,
+    -7.90082897243097465e-03, -9.26189882495516079e-03, -1.29039343345302687e-03,
+    -5.93808084455995383e-05, 1.30703279041993612e-04, -8.28746313205821220e-05,
+    8.36132717626925369e-05, -6.88143061584495940e-05, 4.34680804748008323e-05,
+    0.00000000000000000e+00, -1.86179580134094164e-01, -1.64522839405792737e-01,
+    -5.20388112102253136e-02, -4.58619876665805528e-03, 9.89322724552821331e-04,
+    2.12582408233905399e-04, 6.19281208651046618e-05, -5.58904252179338773e-05,
+    5.57703937682614223e-05, -6.06686709264995814e-05, 4.70979812516775071e-05,
+    1.00000000000000000e+00, 5.26503159182153402e-01, 1.71406856280181347e-01,
+    3.63557133824541079e-02, 5.46879878149228449e-03, 5.95940852257504684e-04,
+    9.37397632216644349e-05, -2.65666365861804767e-05, 3.28618177658827228e-05,
+    -3.16182978546490680e-05, 2.86737551462113580e-05, -2.09117457666505216e-05,
+    0.00000000000000000e+00, -3.54674934937444231e-02, -3.18089754216866749e-02,
+    -1.29852142731603972e-02, -3.17641017499295346e-03, -6.04601230057448969e-04,
+    -6.01655398890114650e-05, -4.21342655177688705e-05, 2.71038665902585991e-05,
+    -3.02417933301894347e-05, 2.79167928396805165e-05, -2.14727669523336090e-05,
+    1.00000000000000000e+00, 5.27389451264292042e-01, 1.56638968905865372e-01,
+    2.20816418220493027e-02, -2.57291024572877248e-04, -6.22122831131693434e-04,
+    -1.70143026113796794e-04, 1.34709673389469017e-05, -3.64974214775508921e-05,
+    3.61345476948710266e-05, -3.57065548921233050e-05, 2.80709784528877062e-05,
+    0.00000000000000000e+00, -1.08075731509827813e-01, -9.65027588062153385e-02,
+    -3.66459304091746665e-02, -7.33752972359118932e-03, -8.82398031339640251e-04,
+    1.07809768232010959e-05, -3.93453669194603609e-05, 4.93604393569644471e-05,
+    -4.33684132567996054e-05, 3.85747670739358171e-05, -2.61827172896754109e-05,
+};
+
+static const real_t GL24_transf1_T[144] = {
+    6.68604661560506663e+00, 2.02485936144816385e+01, 1.06594171817516585e+01,
+    1.61058137285140646e+01, 1.32220084999127039e+01, 1.23430699860744593e+01,
+    1.49311424807035404e+01, 8.74033918670913046e+00, 1.65068440228241613e+01,
+    1.73538714401953764e+00, 1.59945411992028692e+01, 5.21813307389159675e+00,
+    1.48171193784527873e+01, 7.36382740130474378e+00, 1.19461083825945256e+01,
+    4.51619280795276001e+00, 1.04343046126744827e+01, 2.92525192907112297e+00,
+    9.52880361264952214e+00, 1.84549629259048809e+00, 8.75245535838360667e+00,
+    3.28230430748611191e-01, 8.99930585534817418e+00, 1.02336659819581421e+00,
+    6.46178051848206003e+00, -8.15439002100947441e+00, 4.70792606110239831e+00,
+    -4.09815414760395136e+00, 3.79682630536783572e+00, -2.35364876336736684e+00,
+    3.28773049970053766e+00, -1.37371674769649221e+00, 2.88458712807081996e+00,
+    -2.27608541026198125e-01, 3.00893267901401673e+00, -7.26154367254775113e-01,
+    -5.11709841305510071e+00, -2.29547361142731043e+00, -1.37514826504055399e+00,
+    -1.94116103556158182e+00, -1.52009450826663589e-01, -1.32487441658789029e+00,
+    3.36868457747453276e-01, -8.46054829781532125e-01, 6.22652464054652577e-01,
+    -1.51253668994438789e-01, 5.44409071360452801e-01, -4.70909898195202126e-01,
+    5.29943103178980635e-01, 2.77113265581142976e+00, -4.93388882817833330e-01,
+    5.50445500460111981e-01, -3.07112809309133539e-01, -3.49831124463738236e-02,
+    -9.82057981990077239e-02, -1.49429324472889119e-01, 9.57849098601195881e-02,
+    -4.29420242124888621e-02, 3.41729546386178445e-02, -1.18703000269294104e-01,
+    6.66503748870277746e-01, -1.25712764638271701e+00, 1.75930168421426031e-01,
+    5.62354233524038002e-02, -1.51147509440094779e-02, 6.43581976697097935e-02,
+    -2.79140643887622539e-02, 3.49324226701436561e-03, 1.08863198969436237e-02,
+    -8.94587010696221673e-03, -5.34609890183038953e-03, -1.73598713875087463e-02,
+    -6.13011961204930955e-01, 4.38969974642060168e-01, 8.31919839002200588e-03,
+    -3.54331659247636849e-02, 1.57329437829243461e-02, -1.12180781337395283e-04,
+    -2.74466566461241184e-03, 2.65508981923598484e-03, 1.65175815467286905e-03,
+    -8.30468402518605583e-04, -2.77761621266417675e-03, -7.15392173890063506e-04,
+    4.08182949695906239e-01, -1.32862667870672913e-01, -2.46096645967012195e-02,
+    -1.18963761870731610e-02, -3.45264781079960637e-03, 1.18430680414084778e-04,
+    1.41027650051462586e-03, 2.06704858784122246e-03, -3.65412063636893082e-04,
+    -7.41607148509565895e-04, 4.20771302522738862e-04, -5.59017791982390128e-04,
+    -2.61330375990661112e-01, 3.03603554130384354e-02, 1.18515838910033030e-02,
+    2.31452727115157783e-02, 3.82288730112630192e-03, -2.36186488829845083e-03,
+    -7.48911654589244137e-04, -1.55886028995143268e-03, 4.95409198533942690e-04,
+    5.04427274300859371e-04, -8.41328852637755992e-04, 5.99049178781952719e-04,
+    1.70983002891903546e-01, 1.69955028639773601e-03, -3.12490665072097558e-03,
+    -2.05337697679897832e-02, -4.53108625582865181e-03, 1.54068076205167589e-03,
+    7.60989515855614411e-04, 1.56352405127527369e-03, -4.69437091596581406e-04,
+    -5.54066553084659537e-04, 8.04257663397680385e-04, -5.05102994143217295e-04,
+    -1.13053176677068767e-01, -9.60854852574693184e-03, -4.31479609442022910e-04,
+    1.52168291244128024e-02, 3.94542390944945930e-03, -5.21310268692869909e-04,
+    -4.97211448058120778e-04, -1.50731294644137820e-03, 4.24866760350924239e-04,
+    5.10578211073599926e-04, -7.72398231189833973e-04, 4.30664146176406356e-04,
+    6.76122044353823226e-02, 8.32197252763840906e-03, 1.11100678674432973e-03,
+    -9.48583139431585093e-03, -2.63383366048513092e-03, 5.95242356544694774e-05,
+    2.37375771783010042e-04, 1.08315243576722871e-03, -3.07923361899446323e-04,
+    -3.90737589583074524e-04, 5.85607324420256968e-04, -2.72302449315282933e-04,
+};
+
+static const real_t GL24_transf2_T[144] = {
+    8.49333022773768875e-02, -3.31714159893673366e-01, 7.94635029637632884e-01,
+    -1.68373291129094249e+00, 3.44638692530077373e+00, -6.79052600698834752e+00,
+    1.15120446360698399e+01, -1.01315048183257836e+01, -2.04918363562270898e+01,
+    5.79887371389728727e+01, 2.96028383829320951e+01, -1.10755065045192342e+01,
+    -7.92626933901828118e-02, 2.86966308654324820e-01, -5.89602553440029098e-01,
+    9.47900600935849380e-01, -1.11814934018569079e+00, 4.73107971677754063e-02,
+    5.63053158772511075e+00, -2.15512483587673493e+01, 3.57310340475590777e+01,
+    1.61912961554326529e+01, -5.67012776842108721e+01, -3.46372975922442734e+01,
+    6.01583994084492549e-02, -4.22061827076011031e-01, 1.68775951114979517e+00,
+    -4.79619059668488745e+00, 8.91863980780612131e+00, -2.75164849508844456e-01,
+    -6.58842795732658431e+01, 1.23675364214199860e+02, 5.11243756535447915e+02,
+    -8.64359387670284264e+02, -1.94254223685559055e+03, -9.35131109766992608e+02,
+    -6.45506943885177931e-01, 2.30408900004823414e+00, -4.47653372646779246e+00,
+    5.89764093690196933e+00, -2.18975399749023669e+00, -1.30452011037217943e+01,
+    6.60138055531866463e+00, 2.15367158333380132e+02, -4.71450305034184055e+02,
+    -1.14885528146223032e+03, 2.97404041131766064e+02, 9.18867703907540431e+02,
+    -1.51751209383233410e+00, 4.68367689811740462e+00, -6.52038562546478051e+00,
+    4.79088934542711442e+00, -9.75006841834385618e+00, 4.84892394087432663e+01,
+    1.15984048329623334e+02, -9.75201137667898024e+02, -3.11785447345027342e+03,
+    3.73625406173916826e+03, 1.70609297551539748e+04, 1.36746229500757727e+04,
+    -1.29678697835411993e+00, 4.97850084551909955e+00, -1.04348470251203533e+01,
+    1.38583504302562606e+01, -8.53114597182744205e+00, 4.01556486257971414e+01,
+    -2.37758039148403185e+02, -6.26603942966261457e+02, 3.03557928386762887e+03,
+    1.08604475192144200e+04, 7.43956093289003365e+03, -9.10688113476812418e+02,
+    -3.99202471999450959e+00, 1.33645825937097023e+01, -2.24488802893604884e+01,
+    2.83204209175017958e+01, -4.73699427373554727e+01, -1.58470374312380127e+01,
+    2.40939428952740400e+02, 3.38662458538536657e+03, 8.84120470041748013e+03,
+    -7.65816756190978049e+03, -5.76051527672475495e+04, -5.87602123349839603e+04,
+    1.44047175107537506e+00, -3.31890584160989954e+00, 2.45839120223304786e+00,
+    -3.24761703496237963e+00, -1.73858032611248658e+00, 7.55447269287405732e+01,
+    5.15067107852368508e+02, 6.56592461349932250e+01, -1.21301440273966000e+04,
+    -4.56374280234927282e+04, -6.14215603136094869e+04, -3.05285076618826497e+04,
+    7.19283936560000026e+00, -2.13937367021348841e+01, 3.48011076677199753e+01,
+    -4.07160926522305147e+01, 6.57022817069212834e+01, 5.97647632705205609e+01,
+    7.06600952454188928e+02, 2.80772637545700400e+03, 6.48960024764213449e+03,
+    -3.68569719470004475e+03, -4.68520221935417794e+04, -5.80151958948042447e+04,
+    4.57766288055348003e+00, -1.44292621852096552e+01, 2.39239943967873359e+01,
+    -3.26390989368059863e+01, 2.45183023366874693e+01, -1.56298698771604194e+02,
+    -1.06170481698778804e+03, -8.44975496782597656e+03, -4.68456025498744202e+04,
+    -1.68231268013234483e+05, -3.37025704896012030e+05, -2.78475538421264035e+05,
+    -8.28394253458982655e-01, 4.09925319727746196e+00, -8.31423629368213568e+00,
+    1.40847058972774395e+01, -2.09472972843288439e+01, -8.53412743915286285e+01,
+    -1.00915219479935672e+03, -5.33269368257034603e+03, -1.27037023947885627e+04,
+    8.41398134540196770e+03, 8.93091846041080134e+04, 1.04046991895983956e+05,
+    6.74370762163345638e+00, -2.06881609220777918e+01, 3.28686651309150477e+01,
+    -4.46248509986026605e+01, 2.98089799133353175e+01, -1.34591020946955098e+02,
+    1.44141784586001140e+01, 3.59631115975725925e+03, 3.00378248997494047e+04,
+    1.10178937044072227e+05, 1.96675570521220070e+05, 1.43189688051870180e+05,
+};
+
+static const real_t GL26_c[13] = {
+    9.92091527359294068e-01, 9.58799199611488961e-01, 9.00789045366654939e-01,
+    8.21174669720170058e-01, 7.24246375518223462e-01, 6.15229157977567387e-01,
+    5.00000000000000000e-01, 3.84770842022432613e-01, 2.75753624481776594e-01,
+    1.78825330279829886e-01, 9.92109546333450470e-02, 4.12008003885110177e-02,
+    7.90847264070592554e-03,
+};
+
+static const real_t GL26_A[169] = {
+    1.01210011913289693e-02, -1.65812593487157196e-03, 8.12054663011731767e-04,
+    -5.04106061862193253e-04, 3.51249484406879230e-04, -2.61973376814827259e-04,
+    2.04062801555263487e-04, -1.63447833221850425e-04, 1.32996200941124551e-04,
+    -1.08591577934743388e-04, 8.74442385102884221e-05, -6.70516615041579070e-05,
+    4.35604600183718817e-05, 4.98338215041899540e-02, 2.30303749594321129e-02,
+    -4.00882562439936873e-03, 2.08069323826147760e-03, -1.34868880796416282e-03,
+    9.69743466943309772e-04, -7.39679166273148384e-04, 5.84799095209111424e-04,
+    -4.71841291130799777e-04, 3.83103892798337031e-04, -3.07359452503456630e-04,
+    2.35139088196600372e-04, -1.52576299212045329e-04, 6.66511393538308100e-02,
+    7.54800749353418537e-02, 3.47183775549468124e-02, -6.12961830229046423e-03,
+    3.24285781214416185e-03, -2.13818708226584317e-03, 1.55806165539771561e-03,
+    -1.19902884864579989e-03, 9.51119931434866788e-04, -7.63750235756611279e-04,
+    6.08355059029741692e-04, -4.63345539787940897e-04, 2.99962625259445482e-04,
+    9.12912607650189917e-02, 8.50493136252994525e-02, 9.69360224482815613e-02,
+    4.45364951904864345e-02, -7.90443901671291672e-03, 4.21555651003493580e-03,
+    -2.80008434310647118e-03, 2.05038906740336079e-03, -1.57902463820694373e-03,
+    1.24460812210767414e-03, -9.79733532987650969e-04, 7.40852231417186155e-04,
+    -4.77846825328057069e-04, 1.02104959077291335e-01, 1.06950518494670591e-01,
+    9.90552776098906906e-02, 1.13128940611046086e-01, 5.19540118842221274e-02,
+    -9.24203332466230765e-03, 4.94575200721657140e-03, -3.29262769907881373e-03,
+    2.40894627535956883e-03, -1.84200989476170497e-03, 1.42329508753345638e-03,
+    -1.06442244601130708e-03, 6.82707775014527118e-04, 1.14605876315424585e-01,
+    1.10759555143680979e-01, 1.16625593468056302e-01, 1.07786939245760868e-01,
+    1.23204897164698998e-01, 5.65707950657243080e-02, -1.00724350036075754e-02,
+    5.39400389969417124e-03, -3.58522008285720294e-03, 2.60442900234894364e-03,
+    -1.95372076841097151e-03, 1.43647464828385919e-03, -9.13582925476946945e-04,
+    1.15103582270203189e-01, 1.18143023016248266e-01, 1.13666714185757120e-01,
+    1.19931003415288270e-01, 1.10741351700687440e-01, 1.26627232707686471e-01,
+    5.81378883077184744e-02, -1.03514560922495225e-02, 5.53442491474951878e-03,
+    -3.65522679985131682e-03, 2.60906242967983435e-03, -1.86724640081131397e-03,
+    1.17219434523376615e-03, 1.14055173056925571e-01, 1.11705115483164766e-01,
+    1.15095310899859596e-01, 1.10537161129099670e-01, 1.16726810214305823e-01,
+    1.07747586231754441e-01, 1.23214025135056193e-01, 5.65707950657243080e-02,
+    -1.00633070332503752e-02, 5.35465088568774870e-03, -3.48400333660768427e-03,
+    2.38203498776763754e-03, -1.46428618397597202e-03, 1.03225315993429725e-01,
+    1.04972446214455561e-01, 1.02484728680910797e-01, 1.05750033663205956e-01,
+    1.01499077493084677e-01, 1.07200651467523070e-01, 9.89622717612276825e-02,
+    1.13150057093106562e-01, 5.19540118842221274e-02, -9.22091684260183467e-03,
+    4.85274615855356244e-03, -3.04249472622634531e-03, 1.80306469115291924e-03,
+    8.95508372063009289e-02, 8.83321381495556779e-02, 9.00527239139605196e-02,
+    8.78283822588651897e-02, 9.06520150191798130e-02, 8.70226013135695087e-02,
+    9.18730747240793372e-02, 8.48574338709379289e-02, 9.69774293976857910e-02,
+    4.45364951904864345e-02, -7.86303206730868537e-03, 4.02367675567341047e-03,
+    -2.21827038404612742e-03, 6.91367924846341686e-02, 6.99001006496815652e-02,
+    6.88284000508638805e-02, 7.02005053456502270e-02, 6.84856351784587508e-02,
+    7.06357839585394220e-02, 6.78786934544959031e-02, 7.15749421921594575e-02,
+    6.61938972977494516e-02, 7.55663734121840847e-02, 3.47183775549468124e-02,
+    -6.04331982544823419e-03, 2.78561575606280521e-03, 4.62133262180762713e-02,
+    4.58256108306676208e-02, 4.63681093713676773e-02, 4.56776460260658879e-02,
+    4.65325912099950265e-02, 4.54759508236551105e-02, 4.68004290851373739e-02,
+    4.50910064519209133e-02, 4.74094387268283873e-02, 4.39800566806027443e-02,
+    5.00695755432635919e-02, 2.30303749594321129e-02, -3.77307158532573126e-03,
+    2.01984419226395664e-02, 2.03090540441620976e-02, 2.01545581441476516e-02,
+    2.03505939605926819e-02, 2.01090061817168139e-02, 2.04054502158797918e-02,
+    2.00379395811026775e-02, 2.05039757594727666e-02, 1.98907528982510615e-02,
+    2.07461084445201317e-02, 1.94299477196462067e-02, 2.19001283175295110e-02,
+    1.01210011913289693e-02,
+};
+
+static const real_t GL26_b[13] = {
+    2.02420023826579386e-02, 4.60607499188642258e-02, 6.94367551098936248e-02,
+    8.90729903809728690e-02, 1.03908023768444255e-01, 1.13141590131448616e-01,
+    1.16275776615436949e-01, 1.13141590131448616e-01, 1.03908023768444255e-01,
+    8.90729903809728690e-02, 6.94367551098936248e-02, 4.60607499188642258e-02,
+    2.02420023826579386e-02,
+};
+
+static const real_t GL26_eig[13] = {
+    6.89973444125744617e+00, -2.21478571044323935e+01, 1.10613619666880734e+01,
+    -1.79444955503115757e+01, 1.38007456522933190e+01, -1.41412886243058971e+01,
+    1.56887605541251922e+01, -1.05098068132239231e+01, 1.69411835429543700e+01,
+    -6.96773690132198631e+00, 1.76605041682898083e+01, -3.47333280061526128e+00,
+    1.78954193487835838e+01,
+};
+
+static const real_t GL26_transf1[169] = {
+    3.58933694307046025e-01, -2.41235833012041034e+00, -4.28434886149456062e+00,
+    -1.29740388858974462e+01, -3.74456574873549357e+01, -2.13569005053760890e+01,
+    -9.03417442305437959e+01, 3.10522620610564601e+01, -5.24605011968278205e+01,
+    1.53420761144491763e+02, 1.26523924200761712e+02, 1.79716519660710986e+02,
+    1.21376712729169668e+02, -1.62477200248261444e+00, 8.97749403728401418e+00,
+    1.20229352734431743e+01, 4.78349025325677886e+01, 1.22358766429972931e+02,
+    8.53455284109795826e+01, 3.07661348597136737e+02, -7.58608672548377996e+01,
+    2.02105191160871215e+02, -4.77535876512148491e+02, -3.72432517132372141e+02,
+    -5.75640630673985811e+02, -3.75290327935145342e+02, 4.82263868397809947e+00,
+    -1.96502498332393323e+01, -1.01740385516853049e+01, -1.00637210478962032e+02,
+    -1.98642839645434350e+02, -1.94635007561339847e+02, -5.43126629897927387e+02,
+    5.92971374016336341e+01, -3.94809815853163059e+02, 7.66724594412443139e+02,
+    5.91449004143183970e+02, 9.72774237209681132e+02, 6.25883742247371401e+02,
+    -1.29436147837315207e+01, 3.62900959424690868e+01, -2.48831117031626547e+01,
+    1.63055043607960300e+02, 2.01459498839338011e+02, 3.11376665727761178e+02,
+    6.97427404593981123e+02, -2.65594138451734629e+01, 5.75042453232979938e+02,
+    -1.01746728827500783e+03, -7.06025982991631395e+02, -1.33038888383337598e+03,
+    -7.94225321947879479e+02, 3.36254513259323673e+01, -6.13198290967016604e+01,
+    1.24272763703859695e+02, -1.79820083753578501e+02, -1.77884930032103796e+02,
+    -2.69584546688932733e+02, -9.74021641305400180e+02, 6.16031531269626456e+01,
+    -8.96130479924121460e+02, 9.93735212172573029e+02, 8.84117473541605705e+02,
+    1.29836344957980782e+03, 1.06448166118429754e+03, -8.54931748657738240e+01,
+    9.30441238220957700e+01, -2.22244316029013390e+02, -3.38557698991436524e+01,
+    7.36939131023101481e+02, 2.01285892357467418e+02, 1.14861859847606752e+03,
+    1.02699689496409178e+03, -5.99704659091369876e+02, -9.72116908840456972e+02,
+    -9.72336560841186724e+02, -3.41297809566939304e+03, -6.13456172448573867e+01,
+    2.06102791849272535e+02, -1.04043594502786547e+02, -3.26247839312032227e+02,
+    6.63923271360123522e+02, -1.44996489951421222e+03, -2.96173067427276055e+03,
+    5.17692583638152882e+03, 6.08647615613335574e+02, -6.84856454876661155e+03,
+    9.57382798795318922e+03, -5.40423352726357643e+03, -1.07400958233680249e+04,
+    8.70053304178278267e+03, -4.23090955193897685e+02, -2.46765724700346318e+01,
+    3.15847742382222759e+03, 1.15489150829341423e+01, -1.15308828991956234e+04,
+    6.97299259346736835e+03, 1.74796529557833455e+04, -3.23646943869164716e+04,
+    1.34456778815802900e+04, 6.83973791763875488e+04, -7.98741150358613231e+04,
+    -6.86045391193106043e+04, 5.76891474201926176e+04, 5.24547668275659589e+02,
+    5.46658837196892023e+02, -4.10606036979327655e+03, -9.12826977933610760e+03,
+    2.55430070812050326e+04, 4.90270282134376102e+04, -1.16112175308447462e+05,
+    -1.44706859710780293e+05, 3.31682355511324946e+05, 2.44020787666367629e+05,
+    -6.17558992108224425e+05, -2.06503637858652888e+05, 3.80084728112756915e+05,
+    3.30805934494109579e+02, -1.19744172378341818e+03, -2.04541004403779298e+04,
+    1.41299062499094234e+04, 1.74949848267371795e+05, -5.01651671687021371e+04,
+    -7.19701823340430507e+05, 8.73967513554489560e+04, 1.82186259913325007e+06,
+    -8.14444974481766549e+04, -3.09810955479749106e+06, 3.66179272775885329e+04,
+    1.84106031729997671e+06, -1.69471697185595281e+03, -1.60022022146893562e+02,
+    2.06459575761195374e+04, 4.16991576248779165e+04, 6.93110825432261190e+04,
+    -4.19852773038543062e+05, -1.13580127645750763e+06, 1.61311460554957064e+06,
+    4.52204221414596494e+06, -3.08603479466645746e+06, -9.44323368561271951e+06,
+    2.80609847659196844e+06, 5.96880043087853864e+06, -6.18006426246150909e+02,
+    1.58399043590306496e+03, 5.85772392486644385e+04, 4.20198497282990047e+03,
+    -3.83341275394583587e+05, -4.97759045524425106e+05, -1.15032123904500859e+04,
+    3.25097956534922542e+06, 5.21800879761610646e+06, -8.18257484862417448e+06,
+    -1.60607248287431113e+07, 8.57070575891094469e+06, 1.11795155726898983e+07,
+    3.35502578572761934e+02, 8.71730990984463233e+02, 3.22430564211426899e+04,
+    -1.87536591294394893e+04, -3.94903126541675767e+05, -1.87709897041119490e+05,
+    8.17432530997919384e+05, 2.26575274915917916e+06, 2.46946704775108537e+06,
+    -7.07749478724625520e+06, -1.18391524510287289e+07, 8.20219779661990982e+06,
+    8.91470490255900845e+06,
+};
+
+static const real_t GL26_transf2[169] = {
+    1.00000000000000000e+00, 5.91072586892031793e-01, -2.36587208777833430e-01,
+    -2.42979902064907327e-01, 1.45696336827598472e-01, -3.35187072915572731e-02,
+    -4.29989364013654268e-03, 1.07504385120299872e-02, -9.41639424884343525e-03,
+    7.10883076311568957e-03, -5.18286845921590335e-03, 3.66733252220287657e-03,
+    -2.27227143293768502e-03, 0.00000000000000000e+00, -5.39039490914602903e-01,
+    -4.75678144518103918e-01, 1.79753442163934934e-01, 6.11473276355549225e-02,
+    -7.39322041514162420e-02, 4.28139729947891456e-02, -2.16835966868878099e-02,
+    1.11384077865604881e-02, -6.11024684171239570e-03, 3.60747463492309701e-03,
+    -2.23053552608504452e-03, 1.28627596227658797e-03, 1.00000000000000000e+00,
+    5.71680467329839792e-01, -2.43727431439143029e-02, -1.51002607277037210e-01,
+    5.43215200523691245e-03, 1.30675832473372121e-02, -2.87411444825832422e-03,
+    -8.39808054897351144e-04, 1.03321204016451704e-03, -6.30507731083163828e-04,
+    3.26709047796443187e-04, -1.60907380957926835e-04, 7.55905346480065173e-05,
+    0.00000000000000000e+00, -3.89780609367774422e-01, -3.62835947489558774e-01,
+    -1.17605474733524194e-02, 5.19918893187137493e-02, -7.66463323929291677e-03,
+    -1.91296021297191160e-03, 6.76318081432614312e-04, 4.85490289470516285e-04,
+    -7.82501320336669091e-04, 7.19859762508690622e-04, -5.58386111877337489e-04,
+    3.58416386298873334e-04, 1.00000000000000000e+00, 5.62747543121072114e-01,
+    7.84348765027357703e-02, -7.09293196597090142e-02, -1.96554664183118399e-02,
+    3.03635787635630474e-03, 1.02761754646976873e-03, -3.07692200070518293e-04,
+    1.23141452135850494e-04, -1.64041359187214989e-04, 1.75321209433902279e-04,
+    -1.47895021127976260e-04, 9.83155466166510546e-05, 0.00000000000000000e+00,
+    -2.86433478317285328e-01, -2.72652350496332796e-01, -6.25831019675403277e-02,
+    1.48423209066001760e-02, 4.60235074508926270e-03, -8.17168280689650728e-04,
+    -5.50643803672214911e-05, -7.44538717062831929e-05, 1.01211501932448205e-04,
+    -6.03436835791749422e-05, 2.46765729481771213e-05, -7.34888932847399233e-06,
+    1.00000000000000000e+00, 5.57223408561285050e-01, 1.36993806645195060e-01,
+    -1.52871951750499207e-02, -1.41957274038592152e-02, -1.82065156384977802e-03,
+    1.68355157493354834e-04, 1.00707285115876651e-04, -2.20471790262989810e-05,
+    1.99731584276526496e-05, -1.55569106021979391e-05, 6.03013879015045801e-06,
+    -6.01798334012794215e-07, 0.00000000000000000e+00, -2.03264799898236065e-01,
+    -1.95559159429864293e-01, -6.66698184635445140e-02, -4.86169826547541185e-03,
+    2.03708012050525305e-03, 3.37023582841237284e-04, 5.43644151846633047e-05,
+    -7.57911813475033457e-05, 6.27451352401575294e-05, -6.42673753185354191e-05,
+    5.74981514218428217e-05, -3.96556132298922051e-05, 1.00000000000000000e+00,
+    5.53719190148186491e-01, 1.71252163240413091e-01, 2.05271838320768181e-02,
+    -3.14794027386362026e-03, -1.43561441357335285e-03, -2.62328923376298098e-04,
+    1.71912666877114399e-05, -3.20561296530230447e-05, 3.48674903501049044e-05,
+    -3.32116294857044179e-05, 3.03369963937674671e-05, -2.16302085998850507e-05,
+    0.00000000000000000e+00, -1.30799291546790153e-01, -1.26506785786323267e-01,
+    -5.13360255114748143e-02, -1.02278780885894389e-02, -8.40798890068764700e-04,
+    7.69237739114571041e-05, 2.11579925081264129e-05, 1.34808810728822567e-05,
+    -6.29818144030506454e-06, 4.67379970758642541e-06, -1.96419383039095064e-06,
+    -1.34876281122895358e-07, 1.00000000000000000e+00, 5.51748298866697739e-01,
+    1.89456656206092228e-01, 4.05107953784962574e-02, 5.27544040359240879e-03,
+    3.30262385120730232e-04, -2.02339585411935868e-05, -1.42151906093759886e-05,
+    1.71133039801926097e-07, -2.79720488781052299e-06, 1.37245810165154424e-06,
+    -6.61462776038742341e-07, -1.15047261984813343e-07, 0.00000000000000000e+00,
+    -6.41126389161711246e-02, -6.21611424100518006e-02, -2.73631128576550219e-02,
+    -7.05274674636926450e-03, -1.26553136672770926e-03, -1.43907177311357548e-04,
+    -4.17272517104477008e-05, 2.12453148579000103e-05, -2.35988274015227234e-05,
+    2.30019138192788994e-05, -2.09092161768176704e-05, 1.52595517970352704e-05,
+    1.00000000000000000e+00, 5.51110240302442045e-01, 1.95183967213521020e-01,
+    4.69319375872900985e-02, 8.30573049387952310e-03, 1.15775947125783805e-03,
+    1.69903807668049278e-04, -1.23114090884504635e-06, 2.32613865791815483e-05,
+    -2.02462314187340486e-05, 2.04668380591685947e-05, -1.85004745032754429e-05,
+    1.36153371374444393e-05,
+};
+
+static const real_t GL26_transf1_T[169] = {
+    6.89973444125744617e+00, 2.21478571044323935e+01, 1.10613619666880734e+01,
+    1.79444955503115757e+01, 1.38007456522933190e+01, 1.41412886243058971e+01,
+    1.56887605541251922e+01, 1.05098068132239231e+01, 1.69411835429543700e+01,
+    6.96773690132198631e+00, 1.76605041682898083e+01, 3.47333280061526128e+00,
+    1.78954193487835838e+01, 1.60168135034846948e+01, 9.37176185217055391e+00,
+    1.33179809888185172e+01, 5.94701319438715093e+00, 1.18168741976154799e+01,
+    4.00497984933558193e+00, 1.08784184109305535e+01, 2.66733760109965568e+00,
+    1.02920334819338208e+01, 1.64227482878307263e+00, 9.96683766366366442e+00,
+    7.84143937318273587e-01, 9.86234885762109137e+00, 8.90286265972312307e+00,
+    -8.52195256943296719e+00, 6.24131231118352048e+00, -4.45081633060309301e+00,
+    4.93811536334735024e+00, -2.65363551386284380e+00, 4.20455201601892092e+00,
+    -1.62830238401198235e+00, 3.78268032917482211e+00, -9.49934660193870517e-01,
+    3.56180640149448990e+00, -4.39751096342867298e-01, 3.49289894344518403e+00,
+    -5.65765034988728566e+00, -4.14123313434946461e+00, -1.45925740520015457e+00,
+    -2.83975328689741069e+00, -9.38717919864980321e-02, -1.86672545361916153e+00,
+    4.60849767679026134e-01, -1.20663228606736816e+00, 7.05450708242688740e-01,
+    -7.26665014288701117e-01, 8.10482268058099087e-01, -3.42538894312856779e-01,
+    8.39866703975494677e-01, -3.49016241615753564e-01, 3.64876197117479295e+00,
+    -8.72881226943954869e-01, 6.72578334572865977e-01, -4.81149636511117140e-01,
+    -7.31185279449951819e-02, -1.71617858576448040e-01, -2.25468372561198643e-01,
+    1.79353296183055802e-02, -1.95206379563112181e-01, 1.17663473845805139e-01,
+    -1.06231703120658258e-01, 1.48634530185953434e-01, 1.40616971383530531e+00,
+    -1.25248011472030996e+00, 2.82083245385888026e-01, 1.49709906833440820e-01,
+    -2.31791674756657122e-02, 1.06453885131858592e-01, -4.99730849673018646e-02,
+    1.28245660299202216e-02, -1.84625418243342734e-02, -2.42471118448920296e-02,
+    1.02282118353168045e-02, -2.12028108021469451e-02, 2.07185912431849667e-02,
+    -9.77905880204211431e-01, 2.00171614133211107e-01, 2.53548578372424531e-03,
+    -7.27344792714127303e-02, 2.57377008985231574e-02, 3.25430472311037319e-03,
+    -9.00768993196693433e-04, 7.05686247355459539e-03, -4.98014705761528828e-03,
+    -5.24659147042380136e-04, 1.42495610041742026e-04, -2.61175257664146782e-03,
+    3.04049988717481311e-03, 5.54420371791408684e-01, 8.84881171035713093e-02,
+    -2.14256076806226582e-02, -7.58893280087917076e-03, -3.46770049667632918e-03,
+    -5.11109371659403209e-03, 1.00861298113429630e-03, 1.91132440374935497e-03,
+    1.43817079135630146e-04, 4.78225657761057409e-04, -1.06114800964491544e-04,
+    -7.86298390574183292e-04, -2.20317828412246480e-05, -3.11662483738842366e-01,
+    -1.31700898436681924e-01, 2.71685402547681889e-03, 2.39106526804060728e-02,
+    2.75231754917651785e-03, 7.13859870022319335e-04, 4.50657761470744835e-04,
+    -1.42078128861822424e-03, -6.37000008642460425e-04, 5.02340307950729978e-06,
+    -7.07697531925888370e-05, 3.75797373604985579e-04, 4.16272267468620197e-04,
+    1.84377918376395250e-01, 1.15286287342731830e-01, 7.06731722458819184e-03,
+    -1.99696735185141139e-02, -3.69515413552548794e-03, -9.22962011333529645e-04,
+    -3.46085149762614085e-04, 1.19430743924357850e-03, 6.34580624936152346e-04,
+    1.36248851401877386e-04, 3.25665326890287171e-05, -4.26482813178217417e-04,
+    -3.62314801470763374e-04, -1.15658248734700056e-01, -8.98988130412419900e-02,
+    -9.30367326971709430e-03, 1.38252584527925448e-02, 3.27290086499663468e-03,
+    1.64647999576853182e-03, 4.31369053590947621e-04, -1.17177558785429292e-03,
+    -5.95210117569851520e-04, -1.52230197631347889e-04, -5.56549997204066433e-05,
+    4.10992398625954400e-04, 3.66262649812465891e-04, 7.47052026090782306e-02,
+    6.58334538644096690e-02, 8.24010231605126417e-03, -9.06391268225861975e-03,
+    -2.39002011014665880e-03, -1.75087107304047686e-03, -5.09689059974251821e-04,
+    9.65450323703534214e-04, 5.27630609882123389e-04, 1.78104441053533920e-04,
+    6.09429002686952856e-05, -3.71564779802762519e-04, -3.31073749387592704e-04,
+    -4.41663256750936956e-02, -4.14509804413063510e-02, -5.59546698410181079e-03,
+    5.32100739628096290e-03, 1.46075061758462041e-03, 1.28888836851334156e-03,
+    4.07331364141895707e-04, -6.28472204821772427e-04, -3.65501551521949593e-04,
+    -1.52998566478805326e-04, -5.50332944291632805e-05, 2.69091780689102776e-04,
+    2.43652167649634888e-04,
+};
+
+static const real_t GL26_transf2_T[169] = {
+    1.03886994942132049e-01, -3.90316883327371689e-01, 8.70574857248244460e-01,
+    -1.65954114374917938e+00, 2.95485838844295889e+00, -4.92555498596549857e+00,
+    6.92466527015387179e+00, -4.40909221992916223e+00, -1.57731784702146136e+01,
+    5.35243008679088632e+01, -1.51429821318988740e+01, -7.31157679262101681e+01,
+    -3.15759598488787709e+01, -1.61577249214915342e-02, 4.82354042369958144e-02,
+    -5.34632599753150708e-02, -6.74205901943758373e-02, 5.97697243202132578e-01,
+    -2.32564953096487770e+00, 7.14852184769277343e+00, -1.77294529171758235e+01,
+    2.85977288018506925e+01, -1.73820552782610438e+00, -7.18008251994227749e+01,
+    -5.12587035176293249e+00, 2.49851854131336637e+01, 4.17279712860369634e-01,
+    -1.63242722546572727e+00, 3.81076244590149171e+00, -7.20404928827950553e+00,
+    1.03551640637226754e+01, -4.16510428236696395e+00, -3.49323990005073242e+01,
+    7.81571882588528979e+01, 2.66414475483324509e+02, -1.07976799699819685e+03,
+    -1.16999621722344841e+03, 1.28846720286394043e+03, 1.55994954114246434e+03,
+    -4.95975536444892728e-01, 1.67626911630144004e+00, -2.91600625875240738e+00,
+    3.05405548719406505e+00, 5.42257972273488820e-01, -9.81763958974544160e+00,
+    3.35211821523216136e+00, 1.27835996713356593e+02, -3.93043498854845836e+02,
+    -4.74262191526879860e+02, 1.87175555536308798e+03, 2.47011887357349860e+03,
+    8.35236067504649668e+02, -5.50060847558630606e-01, 1.23386596831949213e+00,
+    2.80980626153141608e-02, -4.15682314697107191e+00, 3.47643669524376353e+00,
+    1.87581470302321485e+01, 5.60195692106495216e+01, -6.60137565725476406e+02,
+    -8.72850524355688776e+02, 8.00088482873033900e+03, 1.76566526587434309e+04,
+    4.47847045738761881e+03, -7.15992711613791835e+03, -2.11115184974019598e+00,
+    7.44843690207510978e+00, -1.40744326170402019e+01, 1.83029117563856616e+01,
+    -1.59718364174571956e+01, 3.38061634728858564e+01, -1.57204678074417302e+02,
+    -1.71164900413244084e+02, 2.65810253640542896e+03, 4.56335157758223158e+03,
+    -1.23301273669844886e+04, -3.14785674003700769e+04, -2.09380348134596861e+04,
+    -4.88989425188937687e+00, 1.57717745277739407e+01, -2.56431808040445439e+01,
+    3.14669611898219230e+01, -4.46689040763017857e+01, 2.02664050902220687e+01,
+    2.09826690860111142e+02, 1.72291758348814392e+03, -8.43580124624513132e+02,
+    -3.42399993638339947e+04, -9.75140091132221278e+04, -9.63216174777178967e+04,
+    -3.08141573779039936e+04, -1.29644287662016344e+00, 5.73005342414730912e+00,
+    -1.33986198718658365e+01, 1.93866346681603332e+01, -2.59968528339963605e+01,
+    7.90370209923830345e+01, 1.79356781633797084e+02, -9.08750145058508679e+02,
+    -9.78870977871346076e+03, -1.73665106496711851e+04, 3.74957095021742789e+04,
+    1.42691831263402506e+05, 1.23776629855857362e+05, -5.83436340522901453e+00,
+    2.01197555462396771e+01, -3.58538852220441555e+01, 5.01600082202467021e+01,
+    -6.58780957640715030e+01, -1.00915541337201660e+01, -5.44565753688849441e+02,
+    -7.41430425177896723e+02, 1.16786866630608547e+04, 9.36721982488740759e+04,
+    2.92387220154333801e+05, 4.33354041333708388e+05, 2.71640547172467632e+05,
+    6.65646834320816883e+00, -1.99128185165867571e+01, 3.05116908735704691e+01,
+    -3.94285054721563029e+01, 3.15629644158367775e+01, -6.15324307375916604e+01,
+    3.41147185857789111e+02, 3.73240080203308980e+03, 1.92073241437066754e+04,
+    3.37189390263127862e+04, -6.19058030191943617e+04, -3.04764887907347118e+05,
+    -3.06045614208202227e+05, 4.97059418458698854e+00, -1.41313452197548841e+01,
+    2.18131084069563315e+01, -2.42250687885835561e+01, 3.42770695075482621e+01,
+    -1.64143320285763927e+01, -1.79460487630932619e+02, -3.61878003413486385e+03,
+    -3.14521161695550290e+04, -1.69285698647187703e+05, -5.44882615652754903e+05,
+    -9.67440054058698472e+05, -7.33350522293697228e+05, 1.11537612745094972e+01,
+    -3.53740464932080414e+01, 5.93719416009444814e+01, -8.00957094075363187e+01,
+    8.02592670006771982e+01, -1.96483095863987472e+02, -6.43437000053173051e+02,
+    -4.59634480061072190e+03, -1.78787254084211127e+04, -3.12203795120845607e+04,
+    5.17278445991658664e+04, 2.95034866324794828e+05, 3.20207584070149111e+05,
+    6.78255761228753151e+00, -2.09713067137851255e+01, 3.49745222533673186e+01,
+    -4.43814870424853112e+01, 5.94834711854156382e+01, -3.42800668982519685e+00,
+    4.86187714979374846e+02, 3.22368234551116939e+03, 2.12392188584612668e+04,
+    1.02878858629547583e+05, 3.33537891152255121e+05, 6.24713808310382534e+05,
+    4.98155686033977952e+05,
+};
+
+static const real_t GL28_c[14] = {
+    9.93141904348406213e-01, 9.64217441831786704e-01, 9.13600657534882510e-01,
+    8.43646452405842684e-01, 7.57624318179077050e-01, 6.59556184463944928e-01,
+    5.54027474353671834e-01, 4.45972525646328166e-01, 3.40443815536055128e-01,
+    2.42375681820922950e-01, 1.56353547594157261e-01, 8.63993424651175040e-02,
+    3.57825581682132410e-02, 6.85809565159383079e-03,
+};
+
+static const real_t GL28_A[196] = {
+    8.77986508293796507e-03, -1.43842342431763776e-03, 7.04507137925617592e-04,
+    -4.37442780714134471e-04, 3.04968367469301649e-04, -2.27717100773967216e-04,
+    1.77770345416483367e-04, -1.42965263485369805e-04, 1.17184468566671406e-04,
+    -9.69793854288979120e-05, 8.01673175675880235e-05, -6.51217733284800173e-05,
+    5.02217676032972962e-05, -3.27274204462017600e-05, 4.33621598103094488e-02,
+    2.00395217899400520e-02, -3.48834718976076845e-03, 1.81086918831643373e-03,
+    -1.17435441190528555e-03, 8.45283684013857441e-04, -6.46090308141373843e-04,
+    5.12797239918080469e-04, -4.16706606795931350e-04, 3.42844909038254853e-04,
+    -2.82277859465565769e-04, 2.28683634142081110e-04, -1.76059960671760515e-04,
+    1.14628208600992288e-04, 5.83215855720463569e-02, 6.60475722727306563e-02,
+    3.03796426719757963e-02, -5.36404920973559789e-03, 2.83882297009718744e-03,
+    -1.87343439820994700e-03, 1.36767921796329467e-03, -1.05631852469745204e-03,
+    8.43606984771863447e-04, -6.86129552116775533e-04, 5.60545874372256965e-04,
+    -4.51771845981418770e-04, 3.46681281269539286e-04, -2.25331048392672087e-04,
+    8.05596828758725764e-02, 7.50501718401270501e-02, 8.55408153342871180e-02,
+    3.93007917895483866e-02, -6.97628789782296383e-03, 3.72286809792073646e-03,
+    -2.47659113448428590e-03, 1.81927648653469999e-03, -1.40979076807348693e-03,
+    1.12473016941185434e-03, -9.07277121182312727e-04, 7.25153252625853261e-04,
+    -5.53593219336437369e-04, 3.58848231298344454e-04, 9.11580309804894406e-02,
+    9.54874252258583467e-02, 8.84347940334680033e-02, 1.01002934103882266e-01,
+    4.63845993694844555e-02, -8.25355476177443495e-03, 4.42145437638479574e-03,
+    -2.95118084701215776e-03, 2.17096714651606511e-03, -1.67859385926087158e-03,
+    1.32745819947615727e-03, -1.04760430312298282e-03, 7.93568026138729665e-04,
+    -5.12348412842921017e-04, 1.03929753423350715e-01, 1.00435371425422817e-01,
+    1.05762747183607245e-01, 9.77397444333899384e-02, 1.11727351863716629e-01,
+    5.12996159303239010e-02, -9.13812660915150343e-03, 4.90242083631428887e-03,
+    -3.27298200285945032e-03, 2.40100771220400858e-03, -1.84021037875169201e-03,
+    1.42453006383964215e-03, -1.06673647746380307e-03, 6.84693691039925476e-04,
+    1.06542287846916689e-01, 1.09366996695742541e-01, 1.05209153841035311e-01,
+    1.11023210512301337e-01, 1.02502102824992072e-01, 1.17218296491110499e-01,
+    5.38159633657894487e-02, -9.58944502746706187e-03, 5.14289425654003776e-03,
+    -3.42399508689323348e-03, 2.49119959912946646e-03, -1.87121355051888421e-03,
+    1.37711257617749352e-03, -8.76302005740451869e-04, 1.08508228737319343e-01,
+    1.06254814155401403e-01, 1.09503140282097775e-01, 1.05140727132449430e-01,
+    1.11055921818472125e-01, 1.02489032475038863e-01, 1.17221371759045956e-01,
+    5.38159633657894487e-02, -9.58636975953160858e-03, 5.12982390658682681e-03,
+    -3.39128378072244474e-03, 2.42277289054359081e-03, -1.73506996416364118e-03,
+    1.08963888466220979e-03, 1.01914538169607882e-01, 1.03665968338111605e-01,
+    1.01174701796808153e-01, 1.04439442239399494e-01, 1.00198224148443787e-01,
+    1.05872213863507258e-01, 9.76968110243335158e-02, 1.11737358469799306e-01,
+    5.12996159303239010e-02, -9.12812000306882122e-03, 4.85948742725785844e-03,
+    -3.16351532295943566e-03, 2.16386043522498028e-03, -1.33052156270291517e-03,
+    9.32815471518118333e-02, 9.19756307128301726e-02, 9.38168030420918897e-02,
+    9.14417405394927496e-02, 9.44477925982297739e-02, 9.05982315924528381e-02,
+    9.57203795859810636e-02, 8.83477443625841075e-02, 1.01022753500743342e-01,
+    4.63845993694844555e-02, -8.23373536491335892e-03, 4.33440470550090513e-03,
+    -2.71822648688944306e-03, 1.61116775847946342e-03, 7.82427353477984228e-02,
+    7.91551767984332022e-02, 7.78764303264709162e-02, 7.95088607002790854e-02,
+    7.74768534096849093e-02, 8.00113743471702610e-02, 7.67823070925620632e-02,
+    8.10781747135810582e-02, 7.48787154811760280e-02, 8.55778714769197257e-02,
+    3.93007917895483866e-02, -6.93923175519035092e-03, 3.55141173896972220e-03,
+    -1.95809929677580449e-03, 6.09846163923442666e-02, 6.04126040626820557e-02,
+    6.12110571899330130e-02, 6.01987394695793349e-02, 6.14454148960683691e-02,
+    5.99156783591797276e-02, 6.18156038686490453e-02, 5.93916061259882958e-02,
+    6.26327197421615439e-02, 5.79204623738544047e-02, 6.61233345536871853e-02,
+    3.03796426719757963e-02, -5.28828692877905768e-03, 2.43769977190523655e-03,
+    3.99644153712791148e-02, 4.02551035405518676e-02, 3.98503599457380245e-02,
+    4.03613214393456696e-02, 3.97361986708418477e-02, 4.04957501866760397e-02,
+    3.95662463399620232e-02, 4.07251338880214794e-02, 3.92337598958662492e-02,
+    4.12533979917853871e-02, 3.82681743915636724e-02, 4.35673907696408763e-02,
+    2.00395217899400520e-02, -3.28311623042934096e-03, 1.75924575863221321e-02,
+    1.75095083982726336e-02, 1.76248519392044126e-02, 1.74795628483083443e-02,
+    1.76567095513048278e-02, 1.74425456973092592e-02, 1.77026954293613009e-02,
+    1.73819598204594493e-02, 1.77874472666498980e-02, 1.72547617984066294e-02,
+    1.79971729465900655e-02, 1.68552230279503147e-02, 1.89981535901935679e-02,
+    8.77986508293796507e-03,
+};
+
+static const real_t GL28_b[14] = {
+    1.75597301658759301e-02, 4.00790435798801040e-02, 6.07592853439515926e-02,
+    7.86015835790967732e-02, 9.27691987389689110e-02, 1.02599231860647802e-01,
+    1.07631926731578897e-01, 1.07631926731578897e-01, 1.02599231860647802e-01,
+    9.27691987389689110e-02, 7.86015835790967732e-02, 6.07592853439515926e-02,
+    4.00790435798801040e-02, 1.75597301658759301e-02,
+};
+
+static const real_t GL28_eig[14] = {
+    7.10217376676125234e+00, -2.40514760645090497e+01, 1.14407047676550384e+01,
+    -1.97894151949783179e+01, 1.43447919243436353e+01, -1.59464347083699369e+01,
+    1.63976939399769499e+01, -1.22860821429415932e+01, 1.78220011107500902e+01,
+    -8.72320835660489458e+00, 1.87262917032191041e+01, -5.21510664876333330e+00,
+    1.91663427872939316e+01, -1.73542205772850644e+00,
+};
+
+static const real_t GL28_transf1[196] = {
+    1.60713342985948704e+00, -1.79394409577848313e+00, 3.84396553243691175e+00,
+    -1.43433697147292225e+01, -2.35375121597364334e+01, -4.52159464579221222e+01,
+    -1.19235448919231530e+02, -2.77101163018346135e+01, -1.72294856966567465e+02,
+    1.44875156893415522e+02, 3.06733383760590748e+01, 3.30137935412196441e+02,
+    3.52353369796574952e+02, 1.90077704338829250e+02, -6.13988658951758737e+00,
+    6.49973973613041789e+00, -1.69726838787605736e+01, 5.07720224502294357e+01,
+    6.97326045188777357e+01, 1.63387147844675411e+02, 3.93185172365194433e+02,
+    1.24206093051267644e+02, 5.93109922879470332e+02, -4.35316198798107052e+02,
+    -5.13504328027198085e+01, -1.05806615004743048e+03, -1.10264863640139151e+03,
+    -6.17096459753617410e+02, 1.41396760932732786e+01, -1.35032931493782069e+01,
+    4.70892480052923830e+01, -9.93258547772785363e+01, -8.77456572347309844e+01,
+    -3.27087094684225178e+02, -6.69914795382875809e+02, -3.07298630828575313e+02,
+    -1.07906790717297781e+03, 6.59060309477686133e+02, 7.86217278269658504e+00,
+    1.79582325084461877e+03, 1.85418105415445143e+03, 1.06932467410801951e+03,
+    -2.83887004428871776e+01, 2.28761170638235818e+01, -1.09374191909271758e+02,
+    1.45187285835755688e+02, 2.99704126992129076e+01, 4.82102081329918462e+02,
+    8.41930309792784897e+02, 5.03825364191601068e+02, 1.50424051697011328e+03,
+    -8.13584572321809333e+02, 1.03703969786802546e+02, -2.43249866295324773e+03,
+    -2.41539958266174881e+03, -1.47166601273657443e+03, 5.49047798841201526e+01,
+    -3.35879342477974063e+01, 2.12490736713239698e+02, -1.40274286040755499e+02,
+    4.72971375655689314e+01, -4.96076734080236122e+02, -1.05681216624762465e+03,
+    -6.03921509025148225e+02, -1.98323437804379842e+03, 7.93007776281805377e+02,
+    -2.19547851255844535e+02, 2.66703495444524651e+03, 3.01132819935924363e+03,
+    1.65231389577063692e+03, -1.05484605721904259e+02, 3.91502590685061733e+01,
+    -2.79257246441732605e+02, -2.87385226074104061e+01, 2.78264175840189353e+02,
+    4.63512265516289119e+02, 1.32566705789097819e+03, 1.37573564107036555e+03,
+    1.26427305798512725e+03, -3.77239310203013417e+02, -4.05592386680613856e+02,
+    -4.03771089274214955e+03, -2.14051793517884562e+03, -2.80582639461177541e+03,
+    1.98286142387428782e+02, -1.38779940660904852e+01, -1.22408040852897429e+02,
+    4.14119714176504488e+02, -8.71247466588939233e+02, -2.15173801589728100e+03,
+    2.62071365381103442e+03, -1.60643911763624897e+03, -2.84682136447291032e+03,
+    7.13401826896173679e+03, -8.46661746692500310e+03, -1.51160355354340879e+02,
+    9.54896775422080827e+03, -6.20281459067299420e+03, -3.35003346702745375e+02,
+    -1.20136689939950102e+02, 1.96922032749430832e+03, 7.27388241038048875e+01,
+    -6.39790268246752930e+03, 6.13641048736971607e+03, 2.03030845098808072e+03,
+    -2.12041472209044150e+04, 3.41662443557087172e+04, 2.83789036106727544e+04,
+    -6.53981215152485747e+04, 8.22659178302876353e+03, 3.39045660593192297e+04,
+    -7.53983216822580725e+04, 3.78714929182361800e+02, 5.10943186108148893e+02,
+    -3.38796201051560274e+03, -6.03814044447212655e+03, 2.67675005809114919e+04,
+    2.39815520133933460e+04, -1.13783324030972974e+05, -3.79471698047076570e+04,
+    2.64739181143110036e+05, -4.79472442259606833e+04, -3.44346342313607107e+05,
+    3.06315529688266397e+05, 1.69694262569115206e+05, -5.66757030248320312e+05,
+    1.94252867376700721e+02, -1.07622796567349724e+03, -1.18656600664049165e+04,
+    1.52624055168729446e+04, 9.14244816467429919e+04, -9.75306714825733652e+04,
+    -3.37997176221592177e+05, 4.15966829351789085e+05, 7.18718241445301799e+05,
+    -1.21233623310224595e+06, -8.60049477357132826e+05, 2.45306250168689573e+06,
+    3.99510201162403391e+05, -3.48844691780604981e+06, -1.63284936644683103e+03,
+    4.82197138319381111e+02, 3.76062333748092497e+04, 2.17700279063888665e+04,
+    -2.27154114708157460e+05, -3.17622008138443052e+05, 6.76581590705586714e+05,
+    1.73342132502104295e+06, -1.18574079829420196e+06, -5.39629940800188761e+06,
+    1.23034294245610153e+06, 1.09728246547091734e+07, -5.29932328266146244e+05,
+    -1.54546939178780708e+07, 8.40130732939009476e+02, 2.03081088060200955e+03,
+    4.89072082280715767e+04, -5.63972156036906163e+04, -8.11245872005192447e+05,
+    1.36261981818872475e+05, 4.27407009483427275e+06, 1.50666554571154783e+06,
+    -1.09263716407139320e+07, -1.00698023188118264e+07, 1.45061600711773802e+07,
+    2.81012646660211235e+07, -7.09244026909475587e+06, -4.51377962789583281e+07,
+    2.08035442067428221e+03, -1.00273961316090251e+02, -2.49166004577962703e+04,
+    -8.44026360709557339e+04, -6.31093626324647805e+05, 9.27093189835192519e+05,
+    6.58166723600440193e+06, -1.91410328005905612e+06, -2.30586332137178220e+07,
+    -7.20849539769752882e+06, 3.63140306559044793e+07, 3.97330862933369502e+07,
+    -1.91830362277261205e+07, -7.71667779381814450e+07, 8.21446626666312909e+02,
+    -7.53375522242433931e+02, -4.06661038795641944e+04, -3.50051548196246731e+04,
+    -1.01112235834458872e+05, 7.37246136393545778e+05, 3.87557878074734565e+06,
+    -2.87552315270733368e+06, -1.77005813569773398e+07, -8.98247050436758786e+05,
+    3.15327569267028943e+07, 2.54715459488909543e+07, -1.75669442843652107e+07,
+    -5.80486395468192175e+07,
+};
+
+static const real_t GL28_transf2[196] = {
+    1.00000000000000000e+00, 6.29302896849774362e-01, -1.95370224343071996e-01,
+    -3.06519942805183798e-01, 1.47845689264538976e-01, -1.01720828447574123e-02,
+    -2.42522094263921996e-02, 2.27627044569033397e-02, -1.60003645435743275e-02,
+    1.07269929006603097e-02, -7.29252130806019947e-03, 5.06850223220675026e-03,
+    -3.50556291210146450e-03, 2.15051277283772636e-03, 0.00000000000000000e+00,
+    -5.23672028241742193e-01, -5.35308201820757001e-01, 1.49980461968492240e-01,
+    1.12398624162162064e-01, -9.71260776052411678e-02, 4.61026357080964524e-02,
+    -1.81201348050856782e-02, 6.51748386757744057e-03, -2.09848505217744008e-03,
+    4.66789671260237722e-04, 1.02297752443878838e-04, -2.51640535943222551e-04,
+    2.11578460256356057e-04, 1.00000000000000000e+00, 6.03800292263026117e-01,
+    -1.47281801121173909e-03, -1.77797074549758183e-01, -3.40113233849456166e-03,
+    2.07548321244332215e-02, -4.68211128434368930e-03, -5.39371555922904576e-04,
+    7.34881569144700823e-04, -2.45282085202735642e-04, -4.92322410286203673e-05,
+    1.56792456032554735e-04, -1.65425386498231636e-04, 1.20097819562544686e-04,
+    0.00000000000000000e+00, -3.89587140313166769e-01, -4.02070160959714040e-01,
+    -3.34517443357690084e-02, 6.81125700548521618e-02, -7.54667994718955480e-03,
+    -3.73851831583432237e-03, 1.19709613185622053e-03, 5.11632020996519773e-04,
+    -8.64056788422159789e-04, 7.55216419680960192e-04, -5.70920512382228160e-04,
+    4.04609125632379501e-04, -2.49331162323083565e-04, 1.00000000000000000e+00,
+    5.91264140132564231e-01, 9.52391387522183164e-02, -8.52034737443490703e-02,
+    -2.77379952549935728e-02, 4.62793469717955302e-03, 1.52345302660359034e-03,
+    -4.41415699967706641e-04, 9.69199744578313192e-05, -1.26648299111318461e-04,
+    1.42167817181512002e-04, -1.21222457295090303e-04, 8.97258068005711611e-05,
+    -5.59007514357310727e-05, 0.00000000000000000e+00, -2.93952598926142117e-01,
+    -3.04951311579701734e-01, -8.05182071474018352e-02, 1.96685275480048653e-02,
+    6.84868296967965952e-03, -1.20686043593451649e-03, -2.53338951838274411e-04,
+    7.78903517081292829e-05, -5.22633959548910393e-06, 2.85798012662473409e-05,
+    -5.10223048402734874e-05, 5.37461573927872495e-05, -3.95929672348230473e-05,
+    1.00000000000000000e+00, 5.83420446724439046e-01, 1.51795232903424143e-01,
+    -2.26612741756418191e-02, -2.03684927687537362e-02, -2.43882311354090596e-03,
+    4.82260661485872405e-04, 1.03512191737244877e-04, 8.68479703843247544e-06,
+    -1.91746270476653475e-05, 1.74031156979887390e-05, -2.12535305914589983e-05,
+    2.19482398567240251e-05, -1.64210354166157232e-05, 0.00000000000000000e+00,
+    -2.16488378308579865e-01, -2.24979146629302490e-01, -8.31066355784565308e-02,
+    -5.20330433866045446e-03, 3.48528664412738878e-03, 5.34790428993674833e-04,
+    -9.17731591312400119e-06, -6.71973873866910174e-05, 4.37224492284515900e-05,
+    -4.19546426344718127e-05, 3.86847572177319621e-05, -3.03259926973514161e-05,
+    1.93336758385521171e-05, 1.00000000000000000e+00, 5.78316017698138451e-01,
+    1.86263295742610052e-01, 1.83743325977039143e-02, -7.00978206495399790e-03,
+    -2.52974924166544978e-03, -3.27340742201084303e-04, 2.28434898131377065e-05,
+    -1.20083602892494346e-05, 2.07243300150731473e-05, -1.84167347632889231e-05,
+    1.70284726583944965e-05, -1.40976451530315419e-05, 9.29456690151007733e-06,
+    0.00000000000000000e+00, -1.49078110889825921e-01, -1.54961666623207067e-01,
+    -6.71750796032560271e-02, -1.33200390529843848e-02, -5.91983418137714259e-04,
+    2.44956636654615099e-04, 6.69134195780190719e-05, -4.25695115029740862e-06,
+    9.53185055731415972e-06, -1.12029644066098036e-05, 1.16248963223387999e-05,
+    -1.14904223257217099e-05, 8.65643738517013019e-06, 1.00000000000000000e+00,
+    5.75190823630419845e-01, 2.06352684832557504e-01, 4.32755878672413455e-02,
+    4.07382382716214853e-03, -3.18301947014910068e-04, -1.83949975420719087e-04,
+    -2.68905323217264952e-05, -1.20448023454255153e-05, 7.02831468864501223e-06,
+    -7.97955411298705109e-06, 8.08916542627557469e-06, -7.61798131637521796e-06,
+    5.70644286457718664e-06, 0.00000000000000000e+00, -8.74378756787930617e-02,
+    -9.08668032626332445e-02, -4.27825561492410425e-02, -1.14344276598629009e-02,
+    -1.91969140120088594e-03, -1.91154446590052800e-04, -2.09395647575171129e-05,
+    1.21857226761182743e-05, -1.03322761358416895e-05, 1.07879194919513816e-05,
+    -9.92485816553503282e-06, 8.54749523613324504e-06, -5.86012869765647873e-06,
+    1.00000000000000000e+00, 5.73698840655178399e-01, 2.15661409447833435e-01,
+    5.50531356797583915e-02, 1.00595653885701825e-02, 1.39210734851029513e-03,
+    1.67711429526343876e-04, 8.53017759337998535e-06, 9.32819172751973440e-06,
+    -7.65805895998135913e-06, 7.76566934062676054e-06, -7.43640749541370894e-06,
+    6.57407353711157067e-06, -4.68254230252950993e-06, 0.00000000000000000e+00,
+    -2.88296221359687771e-02, -2.99535373413964377e-02, -1.46209725513984073e-02,
+    -4.34698793595870818e-03, -9.21607007027957061e-04, -1.46042619961494124e-04,
+    -2.94188823745140638e-05, 3.48809453116262256e-06, -7.50177303791165079e-06,
+    6.94564731622821116e-06, -6.98091162956192598e-06, 6.33286640738962390e-06,
+    -4.65291542002478883e-06,
+};
+
+static const real_t GL28_transf1_T[196] = {
+    7.10217376676125234e+00, 2.40514760645090497e+01, 1.14407047676550384e+01,
+    1.97894151949783179e+01, 1.43447919243436353e+01, 1.59464347083699369e+01,
+    1.63976939399769499e+01, 1.22860821429415932e+01, 1.78220011107500902e+01,
+    8.72320835660489458e+00, 1.87262917032191041e+01, 5.21510664876333330e+00,
+    1.91663427872939316e+01, 1.73542205772850644e+00, 1.70645037782624982e+01,
+    1.14164538195433956e+01, 1.46176025566866397e+01, 7.49170322484433893e+00,
+    1.31690569886589710e+01, 5.21186613880888228e+00, 1.22265439226034065e+01,
+    3.61804136326210068e+00, 1.16071881324817934e+01, 2.38790086047586358e+00,
+    1.12271889951243082e+01, 1.36229432275177409e+00, 1.10457401988410080e+01,
+    4.43051202280133505e-01, 1.14873991210916913e+01, -8.50079414260867772e+00,
+    7.93988327670078498e+00, -4.62911221455413990e+00, 6.22907180779175462e+00,
+    -2.85573840387287037e+00, 5.25320404663437923e+00, -1.82417048894607947e+00,
+    4.67134756885775015e+00, -1.13691345673177624e+00, 4.33810063976373694e+00,
+    -6.25447005374656251e-01, 4.18542252887738009e+00, -1.99836197420624029e-01,
+    -5.78420938795933637e+00, -6.30706976515420159e+00, -1.37213338081973935e+00,
+    -3.90121165962628735e+00, 6.17522310170855945e-02, -2.51370855864125220e+00,
+    6.49462313118351231e-01, -1.64117545058238568e+00, 9.13449591716292697e-01,
+    -1.03691121164062605e+00, 1.03350687505524852e+00, -5.75471820244445764e-01,
+    1.08054082822479125e+00, -1.84690145797944488e-01, -1.65332704289664489e+00,
+    4.35418161653146640e+00, -1.38681927977295683e+00, 7.11949384984248423e-01,
+    -7.11538660685348878e-01, -1.60181195140479599e-01, -2.70068085921150725e-01,
+    -3.35571167306728535e-01, -8.73486777042926932e-03, -2.98537540284508074e-01,
+    1.35919373048717207e-01, -1.92879002091025875e-01, 2.00348937277276262e-01,
+    -6.58582692063290065e-02, 2.26378163082874817e+00, -9.34459887503247377e-01,
+    3.86794289656434254e-01, 3.24386652960704736e-01, -4.28253155438308580e-02,
+    1.72041990639024117e-01, -8.28115929910317738e-02, 2.71870825784221344e-02,
+    -3.99211990948104001e-02, -3.26178588606069256e-02, 4.05078028047274174e-03,
+    -3.76086797592409816e-02, 2.82809837668126472e-02, -1.52479420125391230e-02,
+    -1.28107984481818460e+00, -2.55872504625739572e-01, 2.04164382725941854e-02,
+    -1.35427528514901863e-01, 4.10987378168847020e-02, 6.98148238479943256e-03,
+    1.33748358646090218e-03, 1.46944238779920314e-02, -7.97067485097284999e-03,
+    1.51015595271840894e-03, -2.44781007317591013e-03, -4.53893266706918881e-03,
+    3.46786033169863440e-03, -2.50805280160329479e-03, 5.97480671004553821e-01,
+    4.18784295345847102e-01, -2.98606231129899466e-02, 3.02177575854903997e-03,
+    -2.29216331359933211e-03, -1.06731011892358084e-02, 1.81011449632391885e-03,
+    1.12127247294582311e-03, -1.76583000008836939e-04, 1.39179955927552410e-03,
+    -3.94357888922354201e-04, -5.32357391687533006e-04, 2.14546485177666870e-04,
+    -5.49048925657123115e-04, -2.70392476561853112e-01, -3.38544081893599025e-01,
+    -1.71733541877040091e-03, 2.03963073928415187e-02, 1.48223458984635679e-04,
+    2.66284893279574754e-03, 9.68003264990987102e-04, -9.95180062124069367e-04,
+    -1.76878738565357496e-04, -1.80618816953312302e-04, -2.89104325576266348e-04,
+    1.65378468652853763e-04, 1.72734004046421011e-04, 8.30423651414064726e-05,
+    1.26656630579479568e-01, 2.43096207506874690e-01, 1.42929786165263469e-02,
+    -1.47394076427930856e-02, -1.73340201520066255e-03, -2.09455958672799536e-03,
+    -8.51597268452169726e-04, 4.81366297786444319e-04, 2.86200714112713099e-04,
+    3.50659299992480528e-04, 1.85498193014472764e-04, -1.56831806215627397e-04,
+    -1.33758240710245535e-04, -1.57071517995631144e-04, -6.30197341331282523e-02,
+    -1.72080680332912545e-01, -1.55085428257899956e-02, 7.66593083456071356e-03,
+    1.58362182093651398e-03, 2.67704111671986577e-03, 8.00829150502507781e-04,
+    -4.74143280272571052e-04, -2.30497274677239096e-04, -3.60312258686791391e-04,
+    -2.05687608650216488e-04, 1.60403501568319229e-04, 1.36785850997446094e-04,
+    1.46599371209227687e-04, 3.35369716459926054e-02, 1.22631496534636897e-01,
+    1.30919992621256649e-02, -3.42890201609480577e-03, -9.25287073649733996e-04,
+    -2.66497034687847474e-03, -8.23792994639489535e-04, 3.73218186324495685e-04,
+    2.02075065888592887e-04, 3.55721830163001525e-04, 2.03239265215145957e-04,
+    -1.43669928723368822e-04, -1.30413907138105857e-04, -1.46703850857789100e-04,
+    -1.88447906249595565e-02, -8.61011572860687080e-02, -9.89956098681779757e-03,
+    1.35534189545583376e-03, 4.30038439108194187e-04, 2.20178416433367994e-03,
+    7.32488157037670517e-04, -2.27618468904448515e-04, -1.51014899523633654e-04,
+    -3.27759015459375158e-04, -1.87232639556346805e-04, 1.20334304110523564e-04,
+    1.15010750869126436e-04, 1.32786680615600851e-04, 1.01845411277116746e-02,
+    5.32256734723719968e-02, 6.30812158911221461e-03, -4.75858602179887941e-04,
+    -1.70517980839280015e-04, -1.45937055956959420e-03, -5.06802242416642956e-04,
+    1.15277509134610937e-04, 9.01358747059105033e-05, 2.35353480359916633e-04,
+    1.37421709803582756e-04, -7.99787712868761219e-05, -8.16724388336290895e-05,
+    -9.73055590985373689e-05,
+};
+
+static const real_t GL28_transf2_T[196] = {
+    8.67544878922357904e-02, -3.17904765273767320e-01, 6.76080221385383817e-01,
+    -1.19543438301083649e+00, 1.90452426470338931e+00, -2.68842880810671492e+00,
+    2.76993014535116355e+00, 8.11259471332808402e-01, -1.52631884188715876e+01,
+    4.33516706590473362e+01, -3.68799535491201098e+01, -6.81766018849483117e+01,
+    2.73276873733844603e+01, 3.80876174058904979e+01, 4.12027926745323347e-02,
+    -1.61406796607810876e-01, 3.88252132870269162e-01, -8.27330417252267303e-01,
+    1.72041489271598746e+00, -3.59191747464697597e+00, 7.42630584061829069e+00,
+    -1.41681554813562212e+01, 2.02530915051324953e+01, -4.72479237525659101e+00,
+    -5.69994757974069728e+01, 5.50624337068207268e+01, 7.84263066119340095e+01,
+    2.29067749526084761e+01, 6.27402627995404361e-01, -2.29455233229426137e+00,
+    4.79288723267242833e+00, -7.89359812603501432e+00, 9.96532717535195900e+00,
+    -5.02608130061117997e+00, -1.83644499533910555e+01, 4.03624469934022727e+01,
+    1.54505158127870686e+02, -8.37850039531627772e+02, -1.09913080014219688e+00,
+    3.20682602676488523e+03, 2.65107565046813988e+03, 4.35364602385840954e+02,
+    -1.68472017594305856e-01, 4.68867414096545532e-01, -3.91358700197533327e-01,
+    -9.63437575438215621e-01, 4.97641641335304374e+00, -1.12057547915554476e+01,
+    4.43136941744892443e+00, 7.61743322321718068e+01, -2.60523611180015791e+02,
+    -1.15216397356402908e+02, 1.90095603306866315e+03, 6.17444138406015099e+02,
+    -2.79173354781805256e+03, -2.30663621496664109e+03, 8.33349767869264735e-01,
+    -3.48897182965712860e+00, 8.60140855150543260e+00, -1.57759011340770332e+01,
+    1.86694965525099832e+01, -7.38971615463123133e+00, 4.74168567901679125e+01,
+    -4.12184705139051744e+02, 3.37774764578434938e+00, 6.23118770381675404e+03,
+    3.92655935793742310e+03, -3.00178040672939023e+04, -5.18120303571016630e+04,
+    -2.87067527662995999e+04, -2.22568504051832106e+00, 7.51147084823513644e+00,
+    -1.32400174097554419e+01, 1.60708294094135589e+01, -1.38283515936446388e+01,
+    2.40974313999254726e+01, -9.72902369290099358e+01, -3.04267920525349567e+01,
+    1.67554992588628784e+03, 1.27890066416703434e+02, -1.77770013711943866e+04,
+    -2.38703337514279701e+04, 7.03224077209509505e+03, 1.94827348622708523e+04,
+    -3.84615021497168597e+00, 1.17221215508130179e+01, -1.71724843557278355e+01,
+    1.81398093661612272e+01, -2.36033673346613000e+01, 1.15176534996551005e+01,
+    1.49370406077966663e+02, 6.99823130351027430e+02, -3.33362267365775324e+03,
+    -2.53743694867376762e+04, -2.43015647683192510e+04, 1.22844029052541198e+05,
+    3.13079847226711223e+05, 2.35521412665573764e+05, -4.57163269734589228e+00,
+    1.63574855278997440e+01, -3.16069555950106675e+01, 4.43167530008540211e+01,
+    -5.45146422552437215e+01, 9.25277958970857384e+01, 1.39493981287537743e+01,
+    -7.68770462604383169e+02, -4.81191636431715870e+03, 6.35548156306945839e+03,
+    8.75031763202597213e+04, 1.83924482824272796e+05, 1.17847146515934975e+05,
+    1.10456200669738428e+03, -1.10089311305596613e+01, 3.64925058286514172e+01,
+    -6.34470973637101991e+01, 8.61165513348511382e+01, -1.07342737551887851e+02,
+    6.55865548436392203e+01, -2.86925048278489612e+02, 9.17803288922036245e+02,
+    1.30459736124716183e+04, 5.93939155756544860e+04, 6.58866612476171722e+04,
+    -2.71485682624886977e+05, -8.84058392022971879e+05, -7.81331094754879945e+05,
+    2.74054280181638177e+00, -6.56404778976240166e+00, 5.92515166484582068e+00,
+    -3.49971654069862836e+00, -8.04428683741872241e+00, 1.09351285458282170e+01,
+    2.59853607982669473e+02, 2.04158291227856125e+03, 3.69517998574667217e+03,
+    -3.89535792365345915e+04, -2.70539559730447654e+05, -6.97903025417348137e+05,
+    -8.37185502234044019e+05, -4.32833604797879816e+05, -3.03623626274646741e+00,
+    1.20578730595097383e+01, -2.43950241786312283e+01, 3.87108765767410503e+01,
+    -4.76886892489403564e+01, 3.56254899804587595e+01, -4.17496684865521729e+02,
+    -3.35449325027862506e+03, -2.12924278526625094e+04, -7.64771418855460361e+04,
+    -9.04664802833764261e+04, 3.31053139269150968e+05, 1.25125882949982141e+06,
+    1.21113916135626473e+06, 1.67840832810001217e+01, -5.31436267178173907e+01,
+    8.91046996649667449e+01, -1.19116873136979862e+02, 1.29141070341041996e+02,
+    -2.05695832582670448e+02, -1.24341227261396654e+02, -4.94889667244578675e+02,
+    1.04277585076795804e+04, 1.09697428787144236e+05, 5.60764110605409485e+05,
+    1.59282694974735286e+06, 2.47024532499583531e+06, 1.69749389498152747e+06,
+    1.73438107245209103e+01, -5.41710715117490196e+01, 9.09442298925060157e+01,
+    -1.18102303634630530e+02, 1.48095446142924175e+02, -9.76254720604039647e+01,
+    5.23228990083916642e+02, 2.10787782967987778e+03, 1.14374571964938605e+04,
+    3.70209064616850519e+04, 4.49928035304903387e+04, -1.55532331054391194e+05,
+    -6.31146657684300561e+05, -6.37096178720450494e+05, 1.14876655645120831e+01,
+    -3.71018164517705031e+01, 6.40263669655397081e+01, -8.74774793574158878e+01,
+    9.96184833405969670e+01, -1.55232942728852720e+02, -2.76254657385574149e+02,
+    -3.74303354572130274e+03, -2.85348238218803344e+04, -1.78656933048560750e+05,
+    -8.02271595830266015e+05, -2.36913797383726621e+06, -4.08330815315852454e+06,
+    -3.08636190872474387e+06,
+};
+
+static const real_t GL30_c[15] = {
+    9.93996259010242689e-01, 9.68636696200352976e-01, 9.24103291705213659e-01,
+    8.62208865680085035e-01, 7.85486086304269415e-01, 6.97075673538781637e-01,
+    6.00597046998717299e-01, 5.00000000000000000e-01, 3.99402953001282757e-01,
+    3.02924326461218307e-01, 2.14513913695730585e-01, 1.37791134319914965e-01,
+    7.58967082947863969e-02, 3.13633037996470451e-02, 6.00374098975728614e-03,
+};
+
+static const real_t GL30_A[225] = {
+    7.68831049902931728e-03, -1.25960175291970635e-03, 6.16955204475074220e-04,
+    -3.83141108095506433e-04, 2.67213256874500164e-04, -1.99682100849790260e-04,
+    1.56114201767673807e-04, -1.25879932237048752e-04, 1.03654988413980892e-04,
+    -8.64724368757241224e-05, 7.25131747848474316e-05, -6.05313101682632119e-05,
+    4.95161011043642995e-05, -3.83635400718622979e-05, 2.50623437545121007e-05,
+    3.80651002670184604e-02, 1.75915118720270311e-02, -3.06229400235151538e-03,
+    1.58989189606864373e-03, -1.03139150959344534e-03, 7.42914188874776722e-04,
+    -5.68634048293621534e-04, 4.52462939123332748e-04, -3.69322551827174937e-04,
+    3.06254025292725866e-04, -2.55738444847295485e-04, 2.12853647458382931e-04,
+    -1.73768948419062937e-04, 1.34457272941865605e-04, -8.77790602645868738e-05,
+    5.14298388766974632e-02, 5.82431240992573665e-02, 2.67898051167929849e-02,
+    -4.73047487554089860e-03, 2.50411534340687358e-03, -1.65353759767747919e-03,
+    1.20863973412445964e-03, -9.35668501520191980e-04, 7.50415696790054519e-04,
+    -6.14961686883209514e-04, 5.09364129493923936e-04, -4.21563716075716371e-04,
+    3.42837152366744897e-04, -2.64629686030523950e-04, 1.72538127706577051e-04,
+    7.15241886168801327e-02, 6.66317969114065545e-02, 7.59465967849754231e-02,
+    3.48926694815385810e-02, -6.19446743736372634e-03, 3.30703958696479568e-03,
+    -2.20218558160831593e-03, 1.62101901071763036e-03, -1.26102326903392557e-03,
+    1.01321847710032819e-03, -8.28185709088390815e-04, 6.79266000451239399e-04,
+    -5.49070190929407619e-04, 4.22194068522064410e-04, -2.74715621754918142e-04,
+    8.16898987693397000e-02, 8.55716965539155827e-02, 7.92491951236394820e-02,
+    9.05140123702367350e-02, 4.15673014542484801e-02, -7.39773717004929554e-03,
+    3.96575402799720454e-03, -2.65139778085178102e-03, 1.95702490455273168e-03,
+    -1.52302038826284086e-03, 1.21948195415413582e-03, -9.86609667339780061e-04,
+    7.90333943391873786e-04, -6.04288995041522728e-04, 3.92046730691602012e-04,
+    9.42892512537179955e-02, 9.11150400556635515e-02, 9.59530872793661199e-02,
+    8.86695319896552009e-02, 1.01363273373189913e-01, 4.65402500038905528e-02,
+    -8.29283528898673399e-03, 4.45400167219675482e-03, -2.98169114149615623e-03,
+    2.19973318684740142e-03, -1.70522856069432044e-03, 1.35144263633254201e-03,
+    -1.06833441025736735e-03, 8.10228194455859803e-04, -5.23450351172725079e-04,
+    9.82084351107024300e-02, 1.00819284468707498e-01, 9.69776508164696682e-02,
+    1.02346650691069213e-01, 9.44828731081216594e-02, 1.08055186069151821e-01,
+    4.96078713317778947e-02, -8.84395744970946363e-03, 4.75195482617315427e-03,
+    -3.17822423571163110e-03, 2.33558196615176556e-03, -1.79283158915975586e-03,
+    1.38957805663066656e-03, -1.04148556214203559e-03, 6.68820975529917138e-04,
+    1.02118319242737912e-01, 9.99865162263192386e-02, 1.03057947567124511e-01,
+    9.89363117180420276e-02, 1.04519517706730153e-01, 9.64423279813736711e-02,
+    1.10317896556901690e-01, 5.06445604813903216e-02, -9.02877559412104680e-03,
+    4.84679298140696432e-03, -3.23039674394951177e-03, 2.35280924473860436e-03,
+    -1.76882660434387923e-03, 1.30260473646139378e-03, -8.29198279957270106e-04,
+    9.85469216880258680e-02, 1.00257228225697825e-01, 9.78261646069251284e-02,
+    1.01008574252715547e-01, 9.68801606974040164e-02, 1.02393966899267413e-01,
+    9.44637878373826290e-02, 1.08059700113265253e-01, 4.96078713317778947e-02,
+    -8.83944340559603310e-03, 4.73286955543412470e-03, -3.13090802751342422e-03,
+    2.23809184708612151e-03, -1.60354180515170940e-03, 1.00730755285335471e-03,
+    9.36039503589538302e-02, 9.22702718133252414e-02, 9.41488344180384795e-02,
+    9.17290573714485691e-02, 9.47857285684754192e-02, 9.08807668209336977e-02,
+    9.60621911492772623e-02, 8.86264983355843500e-02, 1.01373335296767841e-01,
+    4.65402500038905528e-02, -8.28277336540880586e-03, 4.41096801812590738e-03,
+    -2.87258727158500905e-03, 1.96545995211755637e-03, -1.20875124593688554e-03,
+    8.27425561778053625e-02, 8.37388919035384899e-02, 8.23442689651050913e-02,
+    8.41212125758367402e-02, 8.19151209543428349e-02, 8.46576232967598125e-02,
+    8.11775780039442341e-02, 8.57860006893487459e-02, 7.91688488804997564e-02,
+    9.05323400785462695e-02, 4.15673014542484801e-02, -7.37940946173976358e-03,
+    3.88540778485748977e-03, -2.43709364541861264e-03, 1.44470413915726145e-03,
+    7.00600545848320821e-02, 6.93631448945550982e-02, 7.03344091540065580e-02,
+    6.91060729626259140e-02, 7.06135246721655424e-02, 6.87721204859768342e-02,
+    7.10463622321110821e-02, 6.81643199523595256e-02, 7.19875245446854745e-02,
+    6.64782993761123681e-02, 7.59798064004408857e-02, 3.48926694815385810e-02,
+    -6.16125782189826457e-03, 3.15354205167060189e-03, -1.73884965380298093e-03,
+    5.34070721058793885e-02, 5.38442399196164892e-02, 5.32367730812192200e-02,
+    5.40011739496616822e-02, 5.30702461040920420e-02, 5.41945719204691770e-02,
+    5.28291945367959162e-02, 5.45152787351061568e-02, 5.23709704994615097e-02,
+    5.52331478312634433e-02, 5.10754948901790962e-02, 5.83100851091268649e-02,
+    2.67898051167929849e-02, -4.66351386567139935e-03, 2.14977135688850657e-03,
+    3.52708028043186503e-02, 3.50485664711121941e-02, 3.53567926924731255e-02,
+    3.49701700965956777e-02, 3.54387621889013585e-02, 3.48767697187613371e-02,
+    3.55523462958812347e-02, 3.47305608049307268e-02, 3.57516577923476866e-02,
+    3.44401095551792880e-02, 3.62144152536475056e-02, 3.35931318479854163e-02,
+    3.82453177464055771e-02, 1.75915118720270311e-02, -2.88207652296439566e-03,
+    1.53515586543041226e-02, 1.54149845381304964e-02, 1.53271048969542707e-02,
+    1.54371523082268980e-02, 1.53041078232737868e-02, 1.54630934349343583e-02,
+    1.52729660096446538e-02, 1.55025009302956832e-02, 1.52205067962909602e-02,
+    1.55763030989084245e-02, 1.51094077411841332e-02, 1.57597621061541411e-02,
+    1.47596657935835599e-02, 1.66362227509783411e-02, 7.68831049902931728e-03,
+};
+
+static const real_t GL30_b[15] = {
+    1.53766209980586346e-02, 3.51830237440540622e-02, 5.35796102335859697e-02,
+    6.97853389630771620e-02, 8.31346029084969601e-02, 9.30805000077811057e-02,
+    9.92157426635557893e-02, 1.01289120962780643e-01, 9.92157426635557893e-02,
+    9.30805000077811057e-02, 8.31346029084969601e-02, 6.97853389630771620e-02,
+    5.35796102335859697e-02, 3.51830237440540622e-02, 1.53766209980586346e-02,
+};
+
+static const real_t GL30_eig[15] = {
+    7.29471372497660475e+00, -2.59590021415208376e+01, 1.18003034273292950e+01,
+    -2.16399982755071463e+01, 1.48587939858843079e+01, -1.77579652422430314e+01,
+    1.70649181045966820e+01, -1.40687872510340917e+01, 1.86471986412179405e+01,
+    -1.04845177904752340e+01, 1.97191344567925597e+01, -6.96134242286553295e+00,
+    2.03418279928801375e+01, -3.47277783890091207e+00, 2.05462193326449558e+01,
+};
+
+static const real_t GL30_transf1[225] = {
+    2.30732610028182039e+00, -6.02669273878843170e-01, 1.20580184164911550e+01,
+    -1.06431593438066585e+01, 6.00219540863252465e+00, -5.94731080810138906e+01,
+    -1.07937861732170362e+02, -1.10957059322909771e+02, -3.03706392179155444e+02,
+    4.33262738338704096e+01, -2.11300247443429726e+02, 4.39762081248764275e+02,
+    3.37323720791475637e+02, 5.42616804218711763e+02, 3.49037668157595078e+02,
+    -8.55886075579556760e+00, 2.03092920839012958e+00, -4.53157389249669436e+01,
+    3.60296849497298055e+01, -3.45607296931428962e+01, 2.06416321073190204e+02,
+    3.41170124406360628e+02, 4.01870052598508778e+02, 1.01546251954576508e+03,
+    -8.27320243094728767e+01, 7.51674239376841911e+02, -1.39894909346059580e+03,
+    -1.04152521782642975e+03, -1.76906202921854219e+03, -1.11645032036066095e+03,
+    1.86700462612431330e+01, -3.57957819160770230e+00, 9.99725979773914020e+01,
+    -6.42415469304641391e+01, 1.14566561763577880e+02, -3.88341885380512508e+02,
+    -5.38790056920013399e+02, -8.03010646119221633e+02, -1.80022389586231589e+03,
+    -9.54530221741930873e+00, -1.43249625351230884e+03, 2.35012080331479820e+03,
+    1.71651571438090923e+03, 3.08991431137412292e+03, 1.92026991505065166e+03,
+    -3.45840579046516510e+01, 4.13697703644631432e+00, -1.81968221274189176e+02,
+    7.78887844573763743e+01, -2.69199959795732923e+02, 5.38913897531062389e+02,
+    6.05533520629128816e+02, 1.19702285862699136e+03, 2.46159973716646982e+03,
+    1.85014647636199868e+02, 2.11949197633786480e+03, -3.13130271840974865e+03,
+    -2.19988004622810558e+03, -4.26631269679338857e+03, -2.58414320092410208e+03,
+    6.00501688176951163e+01, -7.39140369452368051e-01, 2.83693142938941207e+02,
+    -3.86199049311135099e+01, 4.26251958872563421e+02, -5.54434315709917541e+02,
+    -6.74073615748592829e+02, -1.45777096235124168e+03, -3.07229887975688507e+03,
+    -4.41510844282264088e+02, -2.74548203784757652e+03, 3.51836570063760428e+03,
+    2.62389609328784218e+03, 5.02683126400309538e+03, 3.17294794506099970e+03,
+    -1.00902465820112198e+02, -1.47781685793699324e+01, -3.26646190951047458e+02,
+    -1.15527121416386152e+02, -2.77273581925629628e+02, 5.28961689076816356e+02,
+    8.41029824374159944e+02, 2.09234714451415994e+03, 2.87730142505011236e+03,
+    1.07997013125956596e+03, 2.42172199823676374e+03, -4.32118329559938502e+03,
+    -2.53143057304237936e+03, -6.61483390586978112e+03, -2.97408615679967261e+03,
+    1.62336839916465124e+02, 6.39519762901934214e+01, 1.88828661549462744e+01,
+    3.52564525308789030e+02, -8.88054520999196626e+01, -1.60302456783967637e+03,
+    1.58476549473675982e+03, -2.81920751988794473e+03, -2.37173666944300976e+03,
+    3.02436425869090499e+03, -8.82297337210718797e+03, 5.06692135933436384e+03,
+    2.30453892645360884e+03, -7.14877951403674842e+02, 7.28074331548893224e+03,
+    -2.30825112069118774e+02, -1.96817447250820237e+02, 1.16773825926217910e+03,
+    9.30650788042608355e+01, -4.15017860894781552e+03, 4.50241470136381395e+03,
+    -2.88734485956998378e+03, -1.09879256209195828e+04, 2.88916853969741242e+04,
+    6.90914070924945372e+03, -2.31607941384807127e+04, 2.74534618945049842e+04,
+    -2.54195792739353456e+04, -5.51244654068701275e+04, 2.57224472168711727e+04,
+    2.05769799343927872e+02, 4.91752016164330712e+02, -2.11304191320547397e+03,
+    -4.04986757261653156e+03, 2.02807485288014395e+04, 1.09999409429345069e+04,
+    -7.28654598267594411e+04, 5.84460906004835215e+03, 1.10849886333690127e+05,
+    -1.22568462827714277e+05, -2.81922484414129667e+03, 2.98098594952260086e+05,
+    -2.84640369851278840e+05, -2.84233145982519607e+05, 2.31169099112803669e+05,
+    2.32850382144071602e+02, -8.97243638647711919e+02, -7.09680180035264766e+03,
+    1.19716846837671019e+04, 3.38790852681551551e+04, -8.27810910786296154e+04,
+    -3.74581591452204448e+04, 3.53440829635620525e+05, -2.38806630283359496e+05,
+    -9.15223639250285574e+05, 1.15564122133686044e+06, 1.44155256647705520e+06,
+    -2.45291348923330987e+06, -1.20468802225109912e+06, 1.54645243225559429e+06,
+    -1.39058431408907904e+03, 6.44973272340404037e+02, 3.45693721802241707e+04,
+    6.14807121579241993e+03, -2.76651837132488727e+05, -1.14837842822567924e+05,
+    1.29521728735136101e+06, 6.00365422406261787e+05, -4.07892211692513525e+06,
+    -1.65452359500591503e+06, 9.06351959932282381e+06, 2.63165493952793675e+06,
+    -1.45526070906124543e+07, -2.16644170218204195e+06, 8.51633881764215976e+06,
+    1.67783593201413214e+03, 1.52846285074793832e+03, 6.27194717502855201e+03,
+    -7.21592826720442390e+04, -4.44074961209496425e+05, 6.49702900064356974e+05,
+    3.55082781804626994e+06, -2.66797397940062825e+06, -1.41033384431893211e+07,
+    6.28055835755111929e+06, 3.48387670760445967e+07, -8.97009392697909102e+06,
+    -5.84169500461744964e+07, 6.94196460184517130e+06, 3.45667386884411052e+07,
+    1.79090701291833034e+03, -2.11854065461101027e+03, -1.09578015675000395e+05,
+    -3.63857532269388903e+04, 7.25584856276314356e+05, 1.32935231184517872e+06,
+    5.42264544366090442e+05, -9.79165104385506548e+06, -1.81241855110823698e+07,
+    3.29399236052695289e+07, 7.26120342874790728e+07, -5.90551320551643595e+07,
+    -1.50320140220625162e+08, 5.20460605478630289e+07, 9.46723204394161999e+07,
+    -1.12126649396086736e+03, -2.25223007836394754e+03, -1.02681165778834446e+05,
+    7.70295647420031601e+04, 1.85229575944730616e+06, 5.33860981362034217e+05,
+    -7.44280076684284117e+06, -1.15822926959245447e+07, -2.04128453476387635e+06,
+    5.66033779669370353e+07, 8.08049110620257258e+07, -1.23880089006893307e+08,
+    -2.28280396262549520e+08, 1.21159987014781311e+08, 1.55210964811171591e+08,
+    -1.18537531741621660e+03, -5.78789136659758356e+02, -2.79277655110746527e+04,
+    7.02843961628460529e+04, 1.21039281550257583e+06, -2.07593326045944879e+05,
+    -7.42414205213672202e+06, -5.56071612894047145e+06, 9.04834986210636608e+06,
+    3.86769875646316111e+07, 4.16461607064988613e+07, -9.81077271094667464e+07,
+    -1.58670953076269686e+08, 1.03056498530061364e+08, 1.14219472460095555e+08,
+};
+
+static const real_t GL30_transf2[225] = {
+    1.00000000000000000e+00, 6.61226197234677793e-01, -1.47888921305707383e-01,
+    -3.63860000142996576e-01, 1.35529207266727625e-01, 2.30975986814300586e-02,
+    -4.70735695467705689e-02, 3.38085520316113997e-02, -2.04353202582355890e-02,
+    1.21669049631648232e-02, -7.52062814270603158e-03, 4.88780949270393485e-03,
+    -3.30824523371065242e-03, 2.25290182227147300e-03, -1.37130808515031140e-03,
+    0.00000000000000000e+00, -5.07534580353150688e-01, -5.85121781812595998e-01,
+    1.06452279469614969e-01, 1.66814201646984378e-01, -1.13764250009795759e-01,
+    4.13091742879474338e-02, -8.69823889432963689e-03, -1.61666737294817648e-03,
+    3.88127116951360361e-03, -3.78746680931375205e-03, 3.15559095971256181e-03,
+    -2.48197066474497999e-03, 1.84883705542707058e-03, -1.17799609630916328e-03,
+    1.00000000000000000e+00, 6.32788455202111022e-01, 2.52332845534664861e-02,
+    -2.02119789699934105e-01, -1.72461227542546336e-02, 3.00256132545531386e-02,
+    -6.11352871781913661e-03, -6.91951450180067055e-04, 6.57128688137237067e-04,
+    2.89605801565152635e-05, -3.43973549040823244e-04, 4.06653608143358789e-04,
+    -3.66628826419219001e-04, 2.90191861949699523e-04, -1.89655378907686151e-04,
+    0.00000000000000000e+00, -3.87057277991920745e-01, -4.37404257831649768e-01,
+    -6.06504822126475718e-02, 8.41200092230828395e-02, -4.74959199831556135e-03,
+    -7.08862816961622517e-03, 2.24728059663291185e-03, 3.02750469697058984e-04,
+    -7.56244275626753617e-04, 6.09888203742348024e-04, -4.08885388523050591e-04,
+    2.62528469846554232e-04, -1.66476203943842835e-04, 9.62001217279789003e-05,
+    1.00000000000000000e+00, 6.17595983036903773e-01, 1.14608034375893425e-01,
+    -9.82353111658128691e-02, -3.81435445890486793e-02, 6.37412685921502371e-03,
+    2.28793288718953831e-03, -5.99731105173443896e-04, 2.31512543752831114e-05,
+    -4.87896267471314850e-05, 7.73900636351863294e-05, -6.39502836444686806e-05,
+    4.17284611486969104e-05, -2.45402610114922105e-05, 1.30035405581634630e-05,
+    0.00000000000000000e+00, -2.98688927948771776e-01, -3.34848266170840569e-01,
+    -1.01424638485912336e-01, 2.40903731984752900e-02, 1.02049210854261128e-02,
+    -1.80086062374937793e-03, -4.61840005550310736e-04, 2.01284547987954336e-04,
+    -6.38259675520418292e-05, 7.14502005329480236e-05, -8.71366360515086905e-05,
+    8.49197875980722957e-05, -7.03235812040238300e-05, 4.69051527066425910e-05,
+    1.00000000000000000e+00, 6.07837233341134486e-01, 1.68186140957884783e-01,
+    -2.95173843129039534e-02, -2.78481733800904525e-02, -3.23962071164135860e-03,
+    9.15887905495967047e-04, 1.45629071466712307e-04, 7.04534980515220700e-06,
+    -3.43277019487887256e-05, 2.81842386903037314e-05, -2.85592528402516911e-05,
+    2.82364172001753351e-05, -2.42174373767067029e-05, 1.64848420453215821e-05,
+    0.00000000000000000e+00, -2.26557002082126563e-01, -2.52532287958818991e-01,
+    -1.01291670012605944e-01, -5.90127104166116891e-03, 5.43803708599502680e-03,
+    8.08012542056812835e-04, -1.15604783432342057e-04, -5.35749831415129150e-05,
+    2.08458972196324091e-05, -1.52078923168411327e-05, 1.41355278873585555e-05,
+    -9.89184427820487249e-06, 5.51843516493958447e-06, -2.59821702534669968e-06,
+    1.00000000000000000e+00, 6.01306834621278763e-01, 2.01904666732344973e-01,
+    1.61021293127539683e-02, -1.18282668029567623e-02, -3.93249392636378821e-03,
+    -3.67132390057316573e-04, 5.08647295754905969e-05, 9.38200783144443930e-06,
+    7.09930411148377454e-06, -5.26067918114409053e-06, 4.10987433934503507e-06,
+    -3.03000577022945759e-06, 1.65880015445454692e-06, -6.79632506858558620e-07,
+    0.00000000000000000e+00, -1.63740029507034784e-01, -1.81717858108454505e-01,
+    -8.41133611855313934e-02, -1.67389804493796417e-02, -9.99964700779950937e-05,
+    5.30073399131241992e-04, 1.01501750508943027e-04, -1.16986201839915157e-05,
+    1.06286619683373644e-05, -1.34615859477807356e-05, 1.30621733768282373e-05,
+    -1.26489498134832351e-05, 1.10865676757724428e-05, -7.69338198798971045e-06,
+    1.00000000000000000e+00, 5.97070753776828722e-01, 2.22771774880550305e-01,
+    4.52133646854300797e-02, 1.94208658438291769e-03, -1.35681568550884623e-03,
+    -4.00611279893557648e-04, -4.88850582609947737e-05, -1.17952911578738673e-05,
+    7.63190826711331285e-06, -7.48205611574994778e-06, 7.67103568033732468e-06,
+    -7.33217528666137794e-06, 6.48487338372824426e-06, -4.57271627590157523e-06,
+    0.00000000000000000e+00, -1.06513600910918105e-01, -1.17840659568720155e-01,
+    -5.90521324842660164e-02, -1.62628680849508135e-02, -2.52186707977558730e-03,
+    -1.65603608007701782e-04, 1.50869540285984282e-05, 8.93069831147567699e-06,
+    -8.38074388221165830e-07, 1.99991308580294958e-06, -1.50389075748791188e-06,
+    1.07789709211280522e-06, -5.95738941632038180e-07, 2.12665925169481498e-07,
+    1.00000000000000000e+00, 5.94672953176449748e-01, 2.34218447796909507e-01,
+    6.14574446468114793e-02, 1.07771977635504577e-02, 1.22318039683272373e-03,
+    6.87173375195049930e-05, -6.98711784697998168e-06, -1.90208233649164360e-06,
+    -1.29231920381793502e-06, 5.25534565576947927e-07, -5.57756832172258108e-07,
+    3.69381041172884726e-07, -2.08206495005878145e-07, 6.69526505421347210e-08,
+    0.00000000000000000e+00, -5.25134024988811454e-02, -5.79893162066336051e-02,
+    -3.02763965418841770e-02, -9.52516173895491015e-03, -2.04868976256159961e-03,
+    -3.22256175002654769e-04, -4.82024797791128588e-05, 5.37142864776661944e-07,
+    -6.04754003452149984e-06, 5.51837405007287794e-06, -5.56224158555245464e-06,
+    5.34878212032134300e-06, -4.73751183070941708e-06, 3.37627579654749420e-06,
+    1.00000000000000000e+00, 5.93895448846657126e-01, 2.37872497263681010e-01,
+    6.66829760839001556e-02, 1.37908763508565509e-02, 2.23665303443841383e-03,
+    3.13667810917245737e-04, 3.41877282061008440e-05, 9.87906613117607280e-06,
+    -4.30145712117696722e-06, 5.13809205047051298e-06, -4.98509161705258752e-06,
+    4.82484635417511153e-06, -4.27195826617182566e-06, 3.05585081632676173e-06,
+};
+
+static const real_t GL30_transf1_T[225] = {
+    7.29471372497660475e+00, 2.59590021415208376e+01, 1.18003034273292950e+01,
+    2.16399982755071463e+01, 1.48587939858843079e+01, 1.77579652422430314e+01,
+    1.70649181045966820e+01, 1.40687872510340917e+01, 1.86471986412179405e+01,
+    1.04845177904752340e+01, 1.97191344567925597e+01, 6.96134242286553295e+00,
+    2.03418279928801375e+01, 3.47277783890091207e+00, 2.05462193326449558e+01,
+    1.79985470745652094e+01, 1.34624528008423123e+01, 1.58430146049635372e+01,
+    9.12614775527370448e+00, 1.44808390792121759e+01, 6.52909075426281316e+00,
+    1.35600748704166083e+01, 4.68535603257915678e+00, 1.29294232418844146e+01,
+    3.25111934938458225e+00, 1.25151961225771107e+01, 2.05605794987940182e+00,
+    1.22791023059768030e+01, 9.96948452231812277e-01, 1.22023061526630396e+01,
+    1.41103702431029383e+01, -8.10734471745317542e+00, 9.76318779937543013e+00,
+    -4.61545472859684747e+00, 7.64916104400567765e+00, -2.94023591263416373e+00,
+    6.42290575508395989e+00, -1.94326777707476039e+00, 5.67018054333208976e+00,
+    -1.27165592646976289e+00, 5.21319576464208190e+00, -7.72925203419686291e-01,
+    4.96581539005952344e+00, -3.66220060729199715e-01, 4.88738050198357676e+00,
+    -5.41764948773461619e+00, -8.66890361882377469e+00, -1.07259851663683858e+00,
+    -5.08956599367552087e+00, 3.41436954187842423e-01, -3.25150704959839798e+00,
+    9.21339209747689902e-01, -2.14380785354820880e+00, 1.18214763560787417e+00,
+    -1.39965549316301296e+00, 1.30265053249938889e+00, -8.49711226752394411e-01,
+    1.35529996683982290e+00, -4.02449198894312576e-01, 1.37008305237333072e+00,
+    -3.34168344940635942e+00, 4.73506482795087624e+00, -2.02386633596833043e+00,
+    6.19435566480861399e-01, -9.94563080871253780e-01, -3.19397846629060567e-01,
+    -3.92203071298033612e-01, -4.92494733653379313e-01, -4.50639023401206359e-02,
+    -4.36148767217133471e-01, 1.51507660001413802e-01, -3.07170152691482790e-01,
+    2.52306673750385402e-01, -1.56332388139473338e-01, 2.83350370294084997e-01,
+    3.12169677974822957e+00, -2.30287022322895163e-01, 4.57092509648278578e-01,
+    5.93707592313435506e-01, -8.65067960938621233e-02, 2.64824343266141626e-01,
+    -1.31790448960212414e-01, 4.72221229561387845e-02, -7.22815806307711695e-02,
+    -4.30949565728619283e-02, -9.19965064836429300e-03, -5.91742946197957240e-02,
+    3.19963696428412284e-02, -3.74262609857037992e-02, 4.59547638165975422e-02,
+    -1.41573315766175289e+00, -9.20644292027906541e-01, 8.12564074842492545e-02,
+    -2.15944714195854870e-01, 6.59755437869443961e-02, 1.38704156817134484e-02,
+    4.26179554991472712e-03, 2.66740999459044691e-02, -1.24035545884730730e-02,
+    6.03517789301024048e-03, -6.74688427132521130e-03, -6.05435211063532017e-03,
+    2.51696036294865241e-03, -6.31663963466147158e-03, 6.44468764069633729e-03,
+    4.72421310611944256e-01, 8.14185111944727313e-01, -5.67963853048222000e-02,
+    1.15447647379866517e-02, -7.09942172659171655e-04, -1.75123896172737492e-02,
+    4.11156728153939423e-03, 7.60382622582624626e-05, -1.15712192749385564e-04,
+    2.42601546631354735e-03, -1.06899648988779787e-03, -4.28039548831355037e-05,
+    2.52657541477226802e-05, -1.00479126051377776e-03, 7.02428562207400376e-04,
+    -1.07102739365555019e-01, -5.42273648020368815e-01, 1.20279826866890737e-03,
+    1.77928110832678427e-02, -3.23040428769355787e-03, 3.40196480160546164e-03,
+    8.73963357238841869e-04, -8.15133172247264849e-04, 2.97602555129478519e-04,
+    -1.19780666379894145e-04, -2.94762581320620392e-04, 9.39945800696810857e-05,
+    -4.05572095543287080e-05, 4.32095837695668348e-06, 2.02977459532847828e-04,
+    -1.19998379759423263e-02, 3.44153474065083065e-01, 1.67068684537034703e-02,
+    -8.29720501293186412e-03, 4.08464300857872941e-04, -1.81478139876309797e-03,
+    -8.79075915515014922e-04, -1.27215606664550160e-04, 2.09457384852725606e-05,
+    2.72627551270790902e-04, 1.56328748073355199e-04, 3.66022252411467446e-05,
+    -5.28637194420792180e-06, -1.27505956654097742e-04, -8.83786814616695237e-05,
+    4.34580296808717917e-02, -2.22856488178882151e-01, -1.72569719268936099e-02,
+    -2.46721147154951349e-04, -1.18887165505675058e-04, 2.43595387009781133e-03,
+    6.94918326632712187e-04, 1.36996621035827894e-04, 4.30413076790049445e-05,
+    -3.06176551658783342e-04, -1.61461750365984278e-04, -1.26485996079833412e-05,
+    -8.47375337057970101e-06, 1.14078880519867849e-04, 1.05568366220286630e-04,
+    -4.62608214894438680e-02, 1.49901789772674654e-01, 1.36469150684287860e-02,
+    3.97501172737761872e-03, 5.97145264316645491e-04, -2.43037223790240490e-03,
+    -6.86231045375672224e-04, -1.60572426494975885e-04, -6.03129459554164164e-05,
+    2.86662992271225338e-04, 1.61735282532880862e-04, 2.37452820536156391e-05,
+    7.97063577101784595e-06, -1.15083127154416305e-04, -1.02424785757292166e-04,
+    4.02967798893693052e-02, -1.03984010579675448e-01, -1.00074470317033908e-02,
+    -4.83593156896129899e-03, -8.87968028988764127e-04, 2.00281819193565786e-03,
+    6.21018399758640452e-04, 2.28448633809717050e-04, 7.61170198687881094e-05,
+    -2.67635629178031840e-04, -1.52087761093255499e-04, -2.97865851849639786e-05,
+    -1.10612464091915940e-05, 1.10086784156864797e-04, 9.91323514391942055e-05,
+    -3.15596912372058946e-02, 7.19698202724505520e-02, 7.02689678940584313e-03,
+    4.31528167219040557e-03, 8.84165028001518871e-04, -1.48070870753784652e-03,
+    -4.90906275830858851e-04, -2.46538330062907266e-04, -8.53053400457469017e-05,
+    2.24125149429656352e-04, 1.32023232956348703e-04, 3.33959679018695280e-05,
+    1.22170253888085212e-05, -9.70927056762972885e-05, -8.77725915166719875e-05,
+    2.05763032768753948e-02, -4.41909338108170888e-02, -4.31976148603284600e-03,
+    -2.96895144636681770e-03, -6.39723141205818767e-04, 9.27870422202410313e-04,
+    3.17866242032242212e-04, 1.87583374847020783e-04, 6.79881579635793781e-05,
+    -1.50585641261956116e-04, -9.16504474040471514e-05, -2.76386558263661332e-05,
+    -1.03631164632721441e-05, 6.89121331909518998e-05, 6.27861811200917892e-05,
+};
+
+static const real_t GL30_transf2_T[225] = {
+    4.46661418295799320e-02, -1.58379980870011816e-01, 3.15115377377073014e-01,
+    -4.94679115646725454e-01, 6.28864054260174776e-01, -4.84715316891283443e-01,
+    -6.54573068788931622e-01, 4.71113079962514547e+00, -1.54925440845375384e+01,
+    3.43704071905603428e+01, -3.69789836003601025e+01, -3.77371650558525715e+01,
+    9.36060793711605044e+01, 6.91617768636661623e+01, 8.77178808221376194e+00,
+    7.63318779217044135e-02, -2.85200644278224835e-01, 6.30662523300684952e-01,
+    -1.19324753707460718e+00, 2.13655306423460356e+00, -3.75078386351158199e+00,
+    6.43752645630658904e+00, -1.02157802956969803e+01, 1.22802668443993070e+01,
+    -6.88466329503391372e-01, -4.31770531383831582e+01, 7.52385525930829004e+01,
+    4.26856723901544584e+01, -6.26288271031659178e+01, -4.81283137741954832e+01,
+    6.13306544723970393e-01, -2.16352661341955743e+00, 4.23002266878806754e+00,
+    -6.30874393707736125e+00, 6.88583905646438499e+00, -2.22952372890705464e+00,
+    -1.21913167319809208e+01, 1.93662998509972226e+01, 1.03211201836412030e+02,
+    -5.64264937783532901e+02, 4.52457994211058576e+02, 2.69208044403167150e+03,
+    -8.32322077356575051e+02, -4.73813125258167292e+03, -3.04592358032251877e+03,
+    2.22773358546786759e-01, -9.14300831341000264e-01, 2.31317241082533487e+00,
+    -4.96872167929192710e+00, 9.35481371780110926e+00, -1.38787965982162245e+01,
+    7.52052290850673444e+00, 4.34015766913807113e+01, -1.53926325204219523e+02,
+    -2.02543602602759911e+01, 1.35075013353843951e+03, -1.17816178128725164e+03,
+    -4.60981379678921985e+03, -2.16126539033944618e+03, 3.70381589274893258e+02,
+    2.13625187715237885e+00, -7.79488505487989691e+00, 1.60380826743089564e+01,
+    -2.53110702285922358e+01, 3.01778353473976964e+01, -2.52051877366529951e+01,
+    5.06350303220901665e+01, -2.64153495546526244e+02, 1.97733899650461865e+02,
+    3.68087859758729564e+03, -3.86367066773941951e+03, -3.38273379996966396e+04,
+    -2.39219929129143093e+04, 3.36534553607345297e+04, 4.04220047569898961e+04,
+    -1.44948651406877427e+00, 4.57607954359875180e+00, -6.96814094039355059e+00,
+    6.01938436273609234e+00, -1.24756858075469657e+00, 5.47614035179582626e+00,
+    -4.73692185253208606e+01, -1.26802950055966814e+01, 9.76613086763713795e+02,
+    -1.17211241358506754e+03, -1.23461414447251100e+04, 3.29758980942093194e+03,
+    6.08761649183487971e+04, 7.61487017731201486e+04, 3.43378628127670963e+04,
+    -5.74310510461967905e-01, 3.43899910019111466e-01, 4.29931771117613692e+00,
+    -1.33034523128638789e+01, 1.84119431845416841e+01, -3.08390517362445387e+01,
+    1.36374910128135923e+02, 2.15304431564977165e+02, -2.71019276904873686e+03,
+    -1.14725415288236272e+04, 2.79190047521813212e+04, 2.00615983034836274e+05,
+    3.00547272390373575e+05, 7.34715302071386686e+04, -9.90710747841943084e+04,
+    -6.97553372251857962e+00, 2.38330066851398890e+01, -4.35117505612917057e+01,
+    5.91775133137622262e+01, -7.02457078001974367e+01, 9.71864662020597052e+01,
+    -5.27736445845422537e+01, -4.66386848752778860e+02, -1.89186471444553831e+03,
+    1.12532672270029707e+04, 5.81984603991618860e+04, 9.05070883592137034e+03,
+    -3.26008913468957529e+05, -6.18147552995930309e+05, -4.07533511745203636e+05,
+    -1.33674649637552960e+01, 4.32715698700109428e+01, -7.31335236256604446e+01,
+    9.60620775950818597e+01, -1.15069440987959268e+02, 9.24970623426446252e+01,
+    -1.65926768305086483e+02, 1.01893802605823794e+03, 7.32472718533255556e+03,
+    1.12371485857053376e+04, -1.28295575703828537e+05, -7.18543243411205709e+05,
+    -1.49313833641338698e+06, -1.37994721095948713e+06, -5.17397009126849414e+05,
+    -5.19247701786976013e+00, 1.98930427541270873e+01, -4.16317242438133945e+01,
+    6.39334214275298223e+01, -8.83756577686634728e+01, 1.09923064927667909e+02,
+    6.88951798711708960e+01, 9.43423991417283219e+02, -2.45464378984745508e+03,
+    -4.27628605417785075e+04, -1.60862813692644093e+05, -6.71962092177081213e+04,
+    9.26953613037384697e+05, 2.25960465667906636e+06, 1.78323457895714301e+06,
+    -1.65285094525421883e+01, 5.61643571977126541e+01, -1.02005757016182727e+02,
+    1.45419519223816565e+02, -1.79808505296367997e+02, 1.77989224963117465e+02,
+    -4.78508563111785691e+02, -1.48140182772291791e+03, -4.87248316761836668e+03,
+    2.91629792821990159e+04, 3.66803660526122199e+05, 1.71375812154996092e+06,
+    4.21433862214704975e+06, 5.61570789378183614e+06, 3.43968000848715985e+06,
+    1.64663143771099918e+01, -5.11163293325978003e+01, 8.31691575112010355e+01,
+    -1.07458451321344214e+02, 1.14947090081084738e+02, -1.56301959388942038e+02,
+    8.80291882508016386e+01, 8.69252985896774476e+02, 1.33971179998632961e+04,
+    8.33995049293291813e+04, 2.62947688387241098e+05, 1.50106141503456922e+05,
+    -1.50704778070290573e+06, -4.29974366254613735e+06, -3.76096308424714068e+06,
+    1.16881336546578343e+01, -3.53245557141371407e+01, 5.67957563245987842e+01,
+    -7.02914515277027192e+01, 8.43436937095655281e+01, -6.69767911594931320e+01,
+    1.15912009233655453e+02, -7.64695482338753891e+02, -1.12786783102506361e+04,
+    -1.07345577304930950e+05, -6.77475534975577961e+05, -2.84704712399961473e+06,
+    -7.60486012889362965e+06, -1.18924514852902107e+07, -8.41974469720788859e+06,
+    2.86703385731532236e+01, -9.29973630754200968e+01, 1.61595769880285388e+02,
+    -2.21731266899988952e+02, 2.61517213508573946e+02, -3.36618194998298009e+02,
+    -1.53546325622201305e+01, -2.84045676483290799e+03, -1.58983494592346597e+04,
+    -7.75483582287600584e+04, -2.22161141467941110e+05, -1.44785294503430021e+05,
+    1.26026386779364222e+06, 3.92590798990204604e+06, 3.62880837269054493e+06,
+    1.69879267083956904e+01, -5.43384796144361033e+01, 9.34609858855941411e+01,
+    -1.25772199697015509e+02, 1.54429770932097796e+02, -1.44751017627573077e+02,
+    3.54359271533760420e+02, 1.25193091733436040e+03, 1.12511745041828472e+04,
+    7.52670068988558924e+04, 4.14496637058231689e+05, 1.68238925754674408e+06,
+    4.60777327968049329e+06, 7.55423478637570795e+06, 5.55914791966702230e+06,
+};
+
+static const collocation_table Gauss_tables[GAUSS_MAX_STAGES] = {
+    {GL2_c, GL2_A, GL2_b, NULL, NULL, NULL, NULL, NULL},
+    {GL4_c, GL4_A, GL4_b, GL4_eig, GL4_transf1, GL4_transf2, GL4_transf1_T,
+     GL4_transf2_T},
+    {GL6_c, GL6_A, GL6_b, GL6_eig, GL6_transf1, GL6_transf2, GL6_transf1_T,
+     GL6_transf2_T},
+    {GL8_c, GL8_A, GL8_b, GL8_eig, GL8_transf1, GL8_transf2, GL8_transf1_T,
+     GL8_transf2_T},
+    {GL10_c, GL10_A, GL10_b, GL10_eig, GL10_transf1, GL10_transf2, GL10_transf1_T,
+     GL10_transf2_T},
+    {GL12_c, GL12_A, GL12_b, GL12_eig, GL12_transf1, GL12_transf2, GL12_transf1_T,
+     GL12_transf2_T},
+    {GL14_c, GL14_A, GL14_b, GL14_eig, GL14_transf1, GL14_transf2, GL14_transf1_T,
+     GL14_transf2_T},
+    {GL16_c, GL16_A, GL16_b, GL16_eig, GL16_transf1, GL16_transf2, GL16_transf1_T,
+     GL16_transf2_T},
+    {GL18_c, GL18_A, GL18_b, GL18_eig, GL18_transf1, GL18_transf2, GL18_transf1_T,
+     GL18_transf2_T},
+    {GL20_c, GL20_A, GL20_b, GL20_eig, GL20_transf1, GL20_transf2, GL20_transf1_T,
+     GL20_transf2_T},
+    {GL22_c, GL22_A, GL22_b, GL22_eig, GL22_transf1, GL22_transf2, GL22_transf1_T,
+     GL22_transf2_T},
+    {GL24_c, GL24_A, GL24_b, GL24_eig, GL24_transf1, GL24_transf2, GL24_transf1_T,
+     GL24_transf2_T},
+    {GL26_c, GL26_A, GL26_b, GL26_eig, GL26_transf1, GL26_transf2, GL26_transf1_T,
+     GL26_transf2_T},
+    {GL28_c, GL28_A, GL28_b, GL28_eig, GL28_transf1, GL28_transf2, GL28_transf1_T,
+     GL28_transf2_T},
+    {GL30_c, GL30_A, GL30_b, GL30_eig, GL30_transf1, GL30_transf2, GL30_transf1_T,
+     GL30_transf2_T},
+};
+
+const collocation_table *get_Gauss_table(const int_t num_stages) {
+    if (num_stages < 1 || num_stages > GAUSS_MAX_STAGES) return NULL;
+    return &Gauss_tables[num_stages - 1];
+}
+
+// Radau IIA collocation methods of order 1 to 29, i.e. with 1 to RADAU_MAX_STAGES stages, in the
+// same format. The nodes are in increasing order with c_s = 1.
+
+static const real_t RadauIIA1_c[1] = {
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA1_A[1] = {
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA1_b[1] = {
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA3_c[2] = {
+    3.33333333333333315e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA3_A[4] = {
+    4.16666666666666685e-01, 7.50000000000000000e-01, -8.33333333333333287e-02,
+    2.50000000000000000e-01,
+};
+
+static const real_t RadauIIA3_b[2] = {
+    7.50000000000000000e-01, 2.50000000000000000e-01,
+};
+
+static const real_t RadauIIA3_eig[2] = {
+    2.00000000000000000e+00, -1.41421356237309515e+00,
+};
+
+static const real_t RadauIIA3_transf1[4] = {
+    -4.50000000000000000e+00, -6.36396103067892760e+00, 2.50000000000000000e+00,
+    -7.07106781186547573e-01,
+};
+
+static const real_t RadauIIA3_transf2[4] = {
+    1.11111111111111105e-01, 1.00000000000000000e+00, -3.14269680527354434e-01,
+    0.00000000000000000e+00,
+};
+
+static const real_t RadauIIA3_transf1_T[4] = {
+    6.66666666666666630e-01, -4.71404520791031678e-01, 2.00000000000000000e+00,
+    1.41421356237309515e+00,
+};
+
+static const real_t RadauIIA3_transf2_T[4] = {
+    0.00000000000000000e+00, 1.00000000000000000e+00, -3.18198051533946380e+00,
+    3.53553390593273786e-01,
+};
+
+static const real_t RadauIIA5_c[3] = {
+    1.55051025721682195e-01, 6.44948974278317766e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA5_A[9] = {
+    1.96815477223660412e-01, 3.94424314739087289e-01, 3.76403062700467250e-01,
+    -6.55354258501983922e-02, 2.92073411665228488e-01, 5.12485826188421645e-01,
+    2.37709743482201509e-02, -4.15487521259979287e-02, 1.11111111111111105e-01,
+};
+
+static const real_t RadauIIA5_b[3] = {
+    3.76403062700467250e-01, 5.12485826188421645e-01, 1.11111111111111105e-01,
+};
+
+static const real_t RadauIIA5_eig[3] = {
+    2.68108287362775233e+00, -3.05043019924741055e+00, 3.63783425274449579e+00,
+};
+
+static const real_t RadauIIA5_transf1[9] = {
+    -9.66951297750594740e+00, 1.40951325949957447e+01, 1.52014856249277557e+01,
+    -8.72402843682233531e+00, -5.89597572525540503e+00, 1.19205578940052792e+00,
+    3.09604323948243954e+00, 1.44123619754534471e-01, 1.90395676051756024e+00,
+};
+
+static const real_t RadauIIA5_transf2[9] = {
+    -1.41255295020954214e-01, 2.04129352293799943e-01, 1.00000000000000000e+00,
+    3.00291941051474241e-02, -3.82942112757261921e-01, 0.00000000000000000e+00,
+    9.44387624889752447e-02, 2.50213122965333323e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA5_transf1_T[9] = {
+    -4.70319112847319865e-01, -3.50378659711366891e-01, 3.43552564969196172e-01,
+    1.71542589575799176e+00, -4.04017199314501529e-01, 9.10233869209459923e-01,
+    2.68108287362775233e+00, 3.05043019924741055e+00, 3.63783425274449579e+00,
+};
+
+static const real_t RadauIIA5_transf2_T[9] = {
+    -4.17871859155190517e+00, -3.27682820761062366e-01, 4.76623554500550439e-01,
+    5.02872634945786823e-01, -2.57192694985560522e+00, 5.96039204828224922e-01,
+    4.17871859155190517e+00, 3.27682820761062366e-01, 5.23376445499449505e-01,
+};
+
+static const real_t RadauIIA7_c[4] = {
+    8.85879595127039426e-02, 4.09466864440734712e-01, 7.87659461760847002e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA7_A[16] = {
+    1.12999479323156182e-01, 2.34383995747400264e-01, 2.16681784623250329e-01,
+    2.20462211176768369e-01, -4.03092207235222072e-02, 2.06892573935358898e-01,
+    4.06123263867373296e-01, 3.88193468843171907e-01, 2.58023774203363920e-02,
+    -4.78571280485407188e-02, 1.89036518170056345e-01, 3.28844319980059752e-01,
+    -9.90467650726642446e-03, 1.60474228065162726e-02, -2.41821048998329402e-02,
+    6.25000000000000000e-02,
+};
+
+static const real_t RadauIIA7_b[4] = {
+    2.20462211176768369e-01, 3.88193468843171907e-01, 3.28844319980059752e-01,
+    6.25000000000000000e-02,
+};
+
+static const real_t RadauIIA7_eig[4] = {
+    3.21280689687153398e+00, -4.77308743327664242e+00, 4.78719310312846602e+00,
+    -1.56747641689520822e+00,
+};
+
+static const real_t RadauIIA7_transf1[16] = {
+    2.97532239536347518e+01, 7.67939291781205924e+00, -3.66767122100802041e+01,
+    -8.31936162416933200e+01, -2.48939173790507473e+00, 2.37244717186528966e+01,
+    9.08462940753321924e+00, -3.15390899483488418e+01, -7.73071405466356243e+00,
+    -8.22056117116956031e+00, -4.44103535851912756e+00, -6.52165323530393604e+00,
+    3.06996183087685859e+00, 1.76004823520506704e+00, 5.43003816912314186e+00,
+    1.11089395125120771e+00,
+};
+
+static const real_t RadauIIA7_transf2[16] = {
+    6.43812193421983425e-02, -1.95002019845278762e-01, 2.92099820613238914e-01,
+    1.00000000000000000e+00, 4.52162360011401504e-02, -2.95537866977988138e-02,
+    -4.33878120578213677e-01, 0.00000000000000000e+00, -1.17808992732970925e-02,
+    4.63444790155447123e-02, 3.36847607459173248e-01, 1.00000000000000000e+00,
+    -3.54503299285072321e-02, -3.22073076055841429e-02, -1.26066621174752730e-01,
+    0.00000000000000000e+00,
+};
+
+static const real_t RadauIIA7_transf1_T[16] = {
+    -8.97662230549912780e-03, 4.52568223856308016e-01, -8.29883615689515439e-04,
+    -1.88173856718089560e-01, -4.85441026369789363e-01, -1.02571230011842074e+00,
+    2.72344165434740382e-01, -8.15387229296281879e-02, 3.00939852314671130e+00,
+    2.51364836068329275e-04, 1.81016099888296589e+00, -7.55045786426568749e-02,
+    3.21280689687153398e+00, 4.77308743327664242e+00, 4.78719310312846602e+00,
+    1.56747641689520822e+00,
+};
+
+static const real_t RadauIIA7_transf2_T[16] = {
+    1.78033088812207740e+00, -3.66224962733316728e+00, 4.34991295864900929e-01,
+    4.41731725920769189e-02, 5.03518214018221499e+00, 1.94354477108076540e+00,
+    -1.91244288266284923e+00, 6.13448213184372038e-01, -1.78033088812207740e+00,
+    3.66224962733316728e+00, -4.34991295864900929e-01, 9.55826827407923130e-01,
+    -1.79613065674963970e+01, -5.38908698039802569e+00, -1.50474227338339861e+00,
+    5.45022919619391977e-01,
+};
+
+static const real_t RadauIIA9_c[5] = {
+    5.71041961145176830e-02, 2.76843013638123803e-01, 5.83590432368916834e-01,
+    8.60240135656219485e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA9_A[25] = {
+    7.29988643179033253e-02, 1.53775231479182456e-01, 1.40063045684809873e-01,
+    1.44894308109534770e-01, 1.43713560791225936e-01, -2.67353311079455702e-02,
+    1.46214867847493518e-01, 2.98967129491283456e-01, 2.76500068760159201e-01,
+    2.81356015149462069e-01, 1.86769297639843533e-02, -3.64445689051280872e-02,
+    1.67585070135248954e-01, 3.25797922910421034e-01, 3.11826522975741260e-01,
+    -1.28791060933064402e-02, 2.12330631193047188e-02, -3.39691016866177434e-02,
+    1.28756753254909762e-01, 2.23103901083570755e-01, 5.04283923388201480e-03,
+    -7.93557990272877704e-03, 1.09442887441922529e-02, -1.57089173788053267e-02,
+    4.00000000000000008e-02,
+};
+
+static const real_t RadauIIA9_b[5] = {
+    1.43713560791225936e-01, 2.81356015149462069e-01, 3.11826522975741260e-01,
+    2.23103901083570755e-01, 4.00000000000000008e-02,
+};
+
+static const real_t RadauIIA9_eig[5] = {
+    3.65569432546357209e+00, -6.54373689936007708e+00, 5.70095329867178968e+00,
+    -3.21026560030854968e+00, 6.28670475172927645e+00,
+};
+
+static const real_t RadauIIA9_transf1[25] = {
+    -4.98960522793980843e+00, -4.86727109598757863e+01, -1.60725193620001477e+02,
+    1.55166651382373146e+02, 1.74127223071535582e+02, 4.28694216960173691e+01,
+    -1.54915950627014087e+01, -1.30204749002632440e+02, 4.85437968758466953e-01,
+    8.03650711899584138e+01, -4.26562403227413167e+00, 2.36872074228261660e+01,
+    -7.12808723689966772e+00, -1.03631985439635752e+01, 2.01708254733242711e+01,
+    -3.90753699738410454e+00, -1.12039462718377152e+01, -8.33000601779388639e+00,
+    -1.34704888437134329e+01, -5.98173929591010989e+00, 1.94694829075259168e+00,
+    3.42975330709998172e+00, 6.39114268223361748e+00, 4.26615708059077825e+00,
+    4.66190902701379084e+00,
+};
+
+static const real_t RadauIIA9_transf2[25] = {
+    -1.02420478179088264e-02, 5.01728645173710602e-02, -2.30539534043417954e-01,
+    3.77893902248861269e-01, 1.00000000000000000e+00, -4.76738772902957214e-02,
+    9.43318191816114315e-02, -1.02703045380125896e-01, -4.66744130332494345e-01,
+    0.00000000000000000e+00, -1.14785152552295145e-02, -7.66883074918016296e-03,
+    1.93984639988289513e-02, 4.07601171280199071e-01, 1.00000000000000000e+00,
+    1.40198588928754104e-02, -2.47085784265185272e-02, -8.18003537037511746e-02,
+    -1.99682427886802516e-01, 0.00000000000000000e+00, 1.35768673449479429e-02,
+    1.61790040171908749e-03, 7.91578533474472101e-02, 4.12256082680461433e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA9_transf1_T[25] = {
+    2.74523513871016700e-01, -2.41302388914041099e-01, -1.10445950133133006e-01,
+    4.30774781357708691e-02, 8.53537564510822855e-02, -4.33865949854067512e-01,
+    6.73166320981787636e-01, 3.56014533986840839e-02, -1.65481435234832941e-01,
+    1.01712621433120935e-02, -1.70720358666956645e-01, -1.88404099588514673e+00,
+    3.73190598911514348e-01, -4.04065774605654959e-01, 4.97642052776085586e-01,
+    4.43571538229492024e+00, 7.66564403489113810e-01, 2.96474887118343089e+00,
+    1.70127822858237743e-01, 2.59173227391655470e+00, 3.65569432546357209e+00,
+    6.54373689936007708e+00, 5.70095329867178968e+00, 3.21026560030854968e+00,
+    6.28670475172927645e+00,
+};
+
+static const real_t RadauIIA9_transf2_T[25] = {
+    5.34418643783491198e+00, 4.59361556775916124e+00, -3.03636032345942430e+00,
+    1.05066019023145896e+00, -2.72778611864296250e-01, -3.74805980743980482e+00,
+    3.98496573634388485e+00, 1.04441564160801881e+00, -1.18409856813794856e+00,
+    4.49917770156780361e-01, -3.30418802135190006e+01, -1.73769534790635660e+01,
+    -1.72129063254005565e-01, -9.91697779825426451e-02, 5.31228115838306647e-01,
+    8.61144397987529153e+00, -9.69999140952880801e+00, -1.91472863969687435e+00,
+    -2.41869200608494017e+00, 1.04746348793533750e+00, 2.76976937756840869e+01,
+    1.27833379113044057e+01, 3.20848938671342987e+00, -9.51490412248916173e-01,
+    7.41550496025989658e-01,
+};
+
+static const real_t RadauIIA11_c[6] = {
+    3.98098570514687430e-02, 1.98013417873608183e-01, 4.37974810247386159e-01,
+    6.95464273353636142e-01, 9.01464914201173584e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA11_A[36] = {
+    5.09500109946406099e-02, 1.08221658919058661e-01, 9.77796700926453488e-02,
+    1.02122375612933844e-01, 1.00331001384960802e-01, 1.00794192626740414e-01,
+    -1.89073065542921387e-02, 1.06975519937332605e-01, 2.23172250636895830e-01,
+    2.02975957373091070e-01, 2.10247308553338452e-01, 2.08450667155953867e-01,
+    1.36860714330882295e-02, -2.75390233553924196e-02, 1.36314679273051881e-01,
+    2.76399136380747812e-01, 2.56085372050337601e-01, 2.60463391594787486e-01,
+    -1.03700387660460459e-02, 1.74967471412281611e-02, -2.96469659881962166e-02,
+    1.31006023136042982e-01, 2.53365934704565643e-01, 2.42693594234484972e-01,
+    7.36065639663980361e-03, -1.16537218911955866e-02, 1.63585788434371590e-02,
+    -2.48763031998222861e-02, 9.24305343356996018e-02, 1.59820376610255471e-01,
+    -2.90953645256171456e-03, 4.51223712257675397e-03, -6.00340261044787597e-03,
+    7.83708405064264743e-03, -1.09952368277285543e-02, 2.77777777777777762e-02,
+};
+
+static const real_t RadauIIA11_b[6] = {
+    1.00794192626740414e-01, 2.08450667155953867e-01, 2.60463391594787486e-01,
+    2.42693594234484972e-01, 1.59820376610255471e-01, 2.77777777777777762e-02,
+};
+
+static const real_t RadauIIA11_eig[6] = {
+    4.03884753448880041e+00, -8.34560041487221582e+00, 6.47051493670157019e+00,
+    -4.90012114742138660e+00, 7.49063752880963030e+00, -1.62150238877839392e+00,
+};
+
+static const real_t RadauIIA11_transf1[36] = {
+    -6.42634508162526856e+01, 3.19394047891750503e+01, 4.24752271051331149e+02,
+    2.18741963313400703e+02, -3.70431797657007280e+02, -1.01107429721952565e+03,
+    -5.51071278836909073e+01, -5.49074498178551522e+01, 1.13085675273059621e+02,
+    3.48701766991730267e+02, -5.03024852321356590e+01, -6.70267199367052172e+02,
+    4.17648708149141328e+01, -1.77668360374814256e+01, -7.35462795613934475e+01,
+    4.61931651357230706e+01, 2.35486716182609079e+01, -1.43786736665799026e+02,
+    -1.12961654415036818e+01, 2.06926694216783318e+01, -1.17102695235390719e+01,
+    1.07436032167176485e+01, 3.46451422424107705e+01, -2.56802938085346755e+00,
+    2.07196701108770753e+00, -1.23130219167222119e+01, -5.41104193944442446e+00,
+    -2.31146286277702018e+01, -2.22999799560971326e+01, -1.31569128274798661e+01,
+    -2.01159756702218362e-01, 4.32462112992419545e+00, 4.95046848724408495e+00,
+    8.94084806030482326e+00, 1.37506912694581338e+01, 5.26844573309249764e+00,
+};
+
+static const real_t RadauIIA11_transf2[36] = {
+    -1.56418173431252180e-02, 2.03615010393983394e-02, 1.42027729481702236e-02,
+    -2.49072685455753839e-01, 4.58564605044478268e-01, 1.00000000000000000e+00,
+    2.88000140455137131e-02, -6.23379829121952014e-02, 1.35609511612194644e-01,
+    -1.85780888373938968e-01, -4.83214199213076012e-01, 0.00000000000000000e+00,
+    9.98765134559309771e-03, -1.26003292208955002e-02, -1.80030482797313360e-02,
+    6.54198114420275877e-03, 4.70290803738877605e-01, 1.00000000000000000e+00,
+    5.40141941315172257e-05, 8.23313520894317433e-03, -1.37853183541855329e-02,
+    -1.36609599116700980e-01, -2.46262134596421406e-01, 0.00000000000000000e+00,
+    -2.98538921870643813e-03, 3.76630413606063481e-03, 6.60409464267157874e-03,
+    9.16412456673178083e-02, 4.71162935824757934e-01, 1.00000000000000000e+00,
+    -5.21690163362346308e-03, 1.54000079114003274e-03, -1.47093244189490623e-02,
+    -4.63562210037225600e-02, -7.70792139650425673e-02, 0.00000000000000000e+00,
+};
+
+static const real_t RadauIIA11_transf1_T[36] = {
+    -3.03528324577770348e-01, -1.42214915871753597e-02, 6.43605711193029062e-02,
+    4.92902012215342827e-02, -1.39032500588037542e-02, -4.39187349104939312e-02,
+    6.02484894325778564e-01, -8.18446570681007207e-02, -1.21873978378083628e-01,
+    -8.47051533443126878e-03, 2.57149041449325419e-02, 1.76426588739983133e-02,
+    -1.07437996186672868e+00, 6.66236809436727917e-01, -4.89392628088803905e-02,
+    -1.77415225911503521e-01, 7.33200838568486141e-02, -9.94736622772051937e-02,
+    5.44486457527397882e-01, -2.82900179003709873e+00, 7.11733572281688431e-01,
+    -8.51877951430687452e-01, 7.61618077074748934e-01, -1.98641149984093962e-01,
+    5.88478514591251400e+00, 1.87536848098319942e+00, 4.24973796373085033e+00,
+    7.11039092588517940e-01, 3.65429489884253256e+00, 1.86619373125990945e-01,
+    4.03884753448880041e+00, 8.34560041487221582e+00, 6.47051493670157019e+00,
+    4.90012114742138660e+00, 7.49063752880963030e+00, 1.62150238877839392e+00,
+};
+
+static const real_t RadauIIA11_transf2_T[36] = {
+    -6.12023749414494755e+00, 2.74153893140119731e+00, 3.68720259142675300e+00,
+    -2.53970274771333226e+00, 1.29276632077402942e+00, -4.29309446934039884e-01,
+    -4.73839421212511258e+00, -7.92990106733968414e+00, 3.21999860806670846e+00,
+    -1.24459979981339897e-01, -3.77362789935211607e-01, 1.83660320214785650e-01,
+    2.54483239812057178e+01, -1.48296429372600507e+01, -1.06594978988315852e+01,
+    -1.94928455103481801e+00, 1.18782235401646785e+00, -1.78800572593997287e-01,
+    5.30779755830703053e+01, 4.26603945321956743e+01, -9.33413491556549291e-01,
+    1.84200604976534871e-01, -2.67276335201386273e+00, 1.24637740152980991e+00,
+    -1.93280864870607694e+01, 1.20881040058588525e+01, 6.97229530740483217e+00,
+    4.48898729874815050e+00, -2.48058867479049727e+00, 1.60811001952803712e+00,
+    -1.39162365235214480e+02, -8.68639428010275907e+01, -1.76862306659533246e+01,
+    6.28901642769938429e-01, -2.29342205161531965e+00, 1.05144588039187759e+00,
+};
+
+static const real_t RadauIIA13_c[7] = {
+    2.93164271597848927e-02, 1.48078599668484301e-01, 3.36984690281154298e-01,
+    5.58671518771550080e-01, 7.69233862030054505e-01, 9.26945671319741149e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA13_A[49] = {
+    3.75462649939213300e-02, 8.01475965156189657e-02, 7.20638469418819066e-02,
+    7.57051258198244148e-02, 7.39123421631918409e-02, 7.47055620597962267e-02,
+    7.44942355560103131e-02, -1.40393345564604009e-02, 8.10620639858915387e-02,
+    1.71068354983886617e-01, 1.54090155142171142e-01, 1.61355607615942420e-01,
+    1.58307223872468705e-01, 1.59102115733650740e-01, 1.03527896007423008e-02,
+    -2.12379921207110356e-02, 1.09614564040072110e-01, 2.27107736673202387e-01,
+    2.06867241552104203e-01, 2.14153423267200022e-01, 2.12351889502977814e-01,
+    -8.15832254027501133e-03, 1.40002912388171186e-02, -2.46198717289840552e-02,
+    1.17478187037024784e-01, 2.37007115342694225e-01, 2.19877847031860030e-01,
+    2.23554914507283237e-01, 6.38841387953468457e-03, -1.02341857300901635e-02,
+    1.47603770439508168e-02, -2.38108271530441742e-02, 1.03086793533813448e-01,
+    1.98752121680635274e-01, 1.90474936822115581e-01, -4.60232677914865565e-03,
+    7.15346515136459048e-03, -9.57525939679140098e-03, 1.27099855336612055e-02,
+    -1.88541391525804472e-02, 6.92655016055091360e-02, 1.19613744612656198e-01,
+    1.82894256147064370e-03, -2.81263937240672354e-03, 3.67267839713830571e-03,
+    -4.60884428128963304e-03, 5.85890097488879144e-03, -8.11600819772828955e-03,
+    2.04081632653061208e-02,
+};
+
+static const real_t RadauIIA13_b[7] = {
+    7.44942355560103131e-02, 1.59102115733650740e-01, 2.12351889502977814e-01,
+    2.23554914507283237e-01, 1.90474936822115581e-01, 1.19613744612656198e-01,
+    2.04081632653061208e-02,
+};
+
+static const real_t RadauIIA13_eig[7] = {
+    4.37869356150680566e+00, -1.01696932837950111e+01, 7.14105521918764019e+00,
+    -6.62304592263927638e+00, 8.51183482510294631e+00, -3.28101362432505894e+00,
+    8.93683278840521567e+00,
+};
+
+static const real_t RadauIIA13_transf1[49] = {
+    7.26837363663984206e+01, 6.75490054671989526e+01, 1.46784123695136316e+02,
+    -9.11325218750249860e+02, -2.24123865104774768e+03, 1.77388597475257643e+03,
+    2.03326624619132963e+03, -4.16194593629912859e+01, 1.14876430105522644e+02,
+    6.90875512843932938e+02, -5.07009428024814895e+02, -2.14707863721542208e+03,
+    5.94143497915855164e+02, 1.48930551131142397e+03, -6.40698746122981362e+01,
+    -4.55215343762652935e+01, 2.29854727563446971e+02, 1.90195871414434237e+02,
+    -5.44057195985152930e+02, -1.74297001860442691e+02, 3.86653374335968863e+02,
+    4.19226672130893334e+01, -7.63147319348761233e+00, -1.97719919929632297e+01,
+    3.18873581420129177e+01, -6.45630669276139599e+01, -1.15787163328964979e+02,
+    3.23789500555374588e+01, -1.88469239002782558e+01, 1.37787868429608675e+01,
+    -2.37499442933885376e+01, 2.35204495659350705e+01, 2.57628645473403779e+01,
+    2.43892978712731932e+01, 3.19283975893175800e+01, 8.57558742846075361e+00,
+    -9.98196062237953363e+00, 6.73480280392869357e+00, -3.13609080641101166e+01,
+    -2.52120521224930556e+01, -3.78277886394423746e+01, -2.45187044849620221e+01,
+    -2.75130427579853665e+00, 3.81458582369644805e+00, -2.67983156647672915e-01,
+    1.31556017356446340e+01, 1.50478898430507257e+01, 1.61624182474866451e+01,
+    1.29713975893954832e+01,
+};
+
+static const real_t RadauIIA13_transf2[49] = {
+    2.15675513513207719e-02, -3.81316481344115485e-02, 5.73965089393817171e-02,
+    -3.82146935969683507e-02, -2.49174212465263695e-01, 5.31584649083628458e-01,
+    1.00000000000000000e+00, -8.78356792514414439e-03, 2.15255605940068741e-02,
+    -5.88505292084267884e-02, 1.65736811272943846e-01, -2.73563305798662337e-01,
+    -4.86322836617572918e-01, 0.00000000000000000e+00, -4.05516145233102403e-03,
+    8.41556827655958947e-03, -8.56043106160343271e-03, -3.73712423023844567e-02,
+    5.36676137918177046e-03, 5.26574226458449313e-01, 1.00000000000000000e+00,
+    -4.42723275326828512e-03, 4.03194957022454982e-03, 6.92321266502390897e-03,
+    -8.23900729850771986e-03, -1.93211116101262015e-01, -2.75534394989625842e-01,
+    0.00000000000000000e+00, -1.23864618795287412e-03, -6.66663533939633864e-05,
+    -2.35218098294333842e-03, 3.11507115234617524e-03, 1.01717732481715145e-01,
+    5.21751945274765316e-01, 1.00000000000000000e+00, 2.76061748054385247e-03,
+    -3.18547482516620987e-03, -4.16907772529756255e-04, -2.51166049134388218e-02,
+    -9.50450203560462281e-02, -1.28071944635543888e-01, 0.00000000000000000e+00,
+    2.44358430487061134e-03, -1.81533964831931708e-03, 4.60533933116187479e-03,
+    1.78700233428530676e-02, 1.28181008077283914e-01, 5.20065149748824673e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA13_transf1_T[49] = {
+    1.83763889975591371e-01, 1.80874829804544529e-01, 3.63633981291584970e-04,
+    -5.84726340817899107e-02, -1.96007753238125818e-02, 1.94339049912894413e-02,
+    2.18379043370000511e-02, -3.85875151178585118e-01, -2.93533332351757159e-01,
+    3.33922506023929047e-02, 8.45290696827138144e-02, 9.88413331283346207e-03,
+    -2.73329687651081253e-02, -1.62233868911920674e-02, 8.49813555784558639e-01,
+    3.26016458137903975e-01, -1.06983266323610368e-01, -7.25708410347226333e-03,
+    -1.86534959238048408e-02, -1.12661879489902791e-02, 4.11571475364595901e-02,
+    -1.85282296928805912e+00, 3.37078995610134602e-01, -2.12302781195991663e-01,
+    -3.06346660024705397e-01, 1.08922894034996234e-01, -2.03567801498970552e-01,
+    1.59701410539975885e-01, 1.69099739385823811e+00, -3.73187520076802359e+00,
+    1.31797043405998782e+00, -1.34418694196981847e+00, 1.17764854438080824e+00,
+    -4.75270248111253679e-01, 1.14553223583590480e+00, 7.27340036564420878e+00,
+    3.27659416204321152e+00, 5.58517257942372414e+00, 1.51991895410618705e+00,
+    4.86127217309797732e+00, 6.21748002497128471e-01, 4.64773528238216560e+00,
+    4.37869356150680566e+00, 1.01696932837950111e+01, 7.14105521918764019e+00,
+    6.62304592263927638e+00, 8.51183482510294631e+00, 3.28101362432505894e+00,
+    8.93683278840521567e+00,
+};
+
+static const real_t RadauIIA13_transf2_T[49] = {
+    -3.00739016945129212e+00, -1.10158660787657716e+01, 1.48779945613165632e+00,
+    2.13038815955928262e+00, -1.81614108681756559e+00, 1.13432558789516102e+00,
+    -4.14699045943303535e-01, 8.44196318832108439e+00, 6.50525274057515035e-01,
+    -6.94067073036987647e+00, 3.20504752559789852e+00, -1.07128094354647851e+00,
+    3.54850749121622178e-01, -9.19854913278655428e-02, 7.46783322350226939e+01,
+    8.74085889799008129e+01, 4.02415873737999785e+00, -3.71480631515836413e+00,
+    -3.43009398598231741e+00, 2.69660480976531236e+00, -9.38692743607546176e-01,
+    -5.83565288519065746e+01, 1.00687739578001807e+01, 3.03663888425666713e+01,
+    1.02002086518486590e+00, 1.12417500378424962e-01, -1.89064083100037772e+00,
+    9.71648639383148272e-01, -2.99186248028252123e+02, -2.43040745368744780e+02,
+    -4.87771040780378726e+01, -2.03867190574193424e+00, 1.67356023986108493e+00,
+    -1.08737403205710614e+00, 9.01938249296099337e-01, 9.30765028974353044e+01,
+    -2.38816310562811438e+01, -3.92788807308138459e+01, -1.43889156854910798e+01,
+    3.51043839939936131e+00, -4.86328488556618055e+00, 2.24648272959123974e+00,
+    2.27515305962680685e+02, 1.66648022467609735e+02, 4.32651458845262127e+01,
+    3.62309006134101619e+00, 3.57267483293879806e+00, -2.74355636560336746e+00,
+    1.45145354025475037e+00,
+};
+
+static const real_t RadauIIA15_c[8] = {
+    2.24793864387124974e-02, 1.14679053160904237e-01, 2.65789822784589458e-01,
+    4.52846373669444635e-01, 6.47375282886830328e-01, 8.19759308263107611e-01,
+    9.43737439463077865e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA15_A[64] = {
+    2.88028238926167426e-02, 6.16808262129499435e-02, 5.52855632672346539e-02,
+    5.83006860575393596e-02, 5.66820089848008371e-02, 5.75430320172431106e-02,
+    5.71469715592340249e-02, 5.72544073721285990e-02, -1.08216980520156360e-02,
+    6.33079054352858051e-02, 1.34572019854444169e-01, 1.20477661477338641e-01,
+    1.27043161483410161e-01, 1.23740992239387476e-01, 1.25220694738069765e-01,
+    1.24823950664932487e-01, 8.06901020385138168e-03, -1.67661676213019632e-02,
+    8.88301818991299313e-02, 1.86414284318491386e-01, 1.68088370419365724e-01,
+    1.75951552283740126e-01, 1.72643313188067943e-01, 1.73507397817250636e-01,
+    -6.49307359653574119e-03, 1.12765759631800640e-02, -2.03224858370090397e-02,
+    1.01430904157415930e-01, 2.09202248763838111e-01, 1.90819813747222844e-01,
+    1.97414436139737304e-01, 1.95786083726246785e-01, 5.30004101729512206e-03,
+    -8.57540084808327586e-03, 1.26310222204237075e-02, -2.11961963985550575e-02,
+    9.91870057448329956e-02, 1.99456888943196881e-01, 1.85210784696857450e-01,
+    1.88258772694559290e-01, -4.22330965000984170e-03, 6.60705689842300270e-03,
+    -8.97002575404257790e-03, 1.22472742953970131e-02, -1.92753088105435677e-02,
+    8.24370247575018089e-02, 1.58621287473896644e-01, 1.52065310323392572e-01,
+    3.06941334914092884e-03, -4.72381737399189296e-03, 6.18090091700754154e-03,
+    -7.79863777790080863e-03, 1.00696465051650381e-02, -1.47247957580206573e-02,
+    5.37124874465501126e-02, 9.26790774014896457e-02, -1.22382072563045527e-03,
+    1.87207449444254641e-03, -2.41735378259889944e-03, 2.97039753971814046e-03,
+    -3.62185020403895091e-03, 4.53480003283603019e-03, -6.23253577933535405e-03,
+    1.56250000000000000e-02,
+};
+
+static const real_t RadauIIA15_b[8] = {
+    5.72544073721285990e-02, 1.24823950664932487e-01, 1.73507397817250636e-01,
+    1.95786083726246785e-01, 1.88258772694559290e-01, 1.52065310323392572e-01,
+    9.26790774014896457e-02, 1.56250000000000000e-02,
+};
+
+static const real_t RadauIIA15_eig[8] = {
+    4.68549463282119660e+00, -1.20105785998137904e+01, 7.73868814683054840e+00,
+    -8.37087930623798293e+00, 9.40637121369073981e+00, -4.96921728762329362e+00,
+    1.01694460066575143e+01, -1.64920179682222767e+00,
+};
+
+static const real_t RadauIIA15_transf1[64] = {
+    4.97498265342278287e+01, -1.21536632502541792e+02, -1.63284773259150916e+03,
+    2.47414252580232699e+02, 5.58208191128141789e+03, 3.82695431424990738e+03,
+    -4.01204500126606717e+03, -1.23225562501780551e+04, 1.79360662386069265e+02,
+    -1.53230837266843718e+01, -1.44876986777220986e+03, -1.01712778956976331e+03,
+    3.03520551613774251e+03, 5.43635692672880214e+03, -1.75636881902809932e+03,
+    -1.08959759708861075e+04, -1.08535806019356702e+01, 1.26709063825555717e+02,
+    2.55383321541302251e+02, -7.39383953119467947e+02, -4.95285773636435920e+02,
+    1.98064771704321561e+03, 2.41952450747597140e+02, -3.31951659802623772e+03,
+    -5.31984347493876086e+01, -4.91481726988979659e+01, 1.63970603193182313e+02,
+    7.74562135073048381e+01, -3.74695466689319119e+02, 2.12246572570279142e+02,
+    2.73537122253294172e+02, -4.77962980294853594e+02, 3.95418194819978197e+01,
+    7.58497765525755074e+00, 1.95595995147766750e+01, 2.14077728159210849e+01,
+    -4.94892356345937259e+01, -9.84814594919996580e+01, -2.18464175884902581e+01,
+    -9.84623450979362076e+01, -2.32442025895739732e+01, 3.02735867262943792e+00,
+    -4.50126102459614259e+01, 2.25718974381995849e+01, -8.44872823335271250e-01,
+    6.24953006598418028e+01, 8.82182146346652161e+01, 4.05417802035150103e+01,
+    1.32745145460644931e+01, -4.04623258580740153e+00, 2.69842205881504604e+01,
+    -3.10513545639969841e+01, -7.46568079166482246e+00, -7.04448860311495650e+01,
+    -7.73520868319046855e+01, -4.28163108325091741e+01, -4.74826722587955796e+00,
+    1.77939639695328466e+00, -8.99700914776576610e+00, 1.38509399155425150e+01,
+    7.58243303106192101e+00, 3.08563818797292910e+01, 3.86628433425834004e+01,
+    1.86283802343462526e+01,
+};
+
+static const real_t RadauIIA15_transf2[64] = {
+    -1.65409120093933000e-02, 3.04444425514377587e-02, -5.38894372502627603e-02,
+    9.39117125855395835e-02, -1.02923023828465937e-01, -2.31092576649769288e-01,
+    5.95531962846676532e-01, 1.00000000000000000e+00, -4.83800092365212035e-03,
+    5.89583327786194662e-03, 5.89466127911075040e-04, -3.85639731343513786e-02,
+    1.80463136138649838e-01, -3.60426013226843645e-01, -4.79491242115872185e-01,
+    0.00000000000000000e+00, -1.54110841081114017e-04, -1.36646751652255965e-03,
+    5.85789340728700737e-03, -4.13386509712951149e-03, -6.25678898560524110e-02,
+    1.45571952643548715e-02, 5.76827670296414019e-01, 1.00000000000000000e+00,
+    3.83849816701431609e-03, -5.89184506966776433e-03, 4.50577411921431609e-03,
+    1.12037738966226270e-02, -9.88452364219924613e-03, -2.49043565992456251e-01,
+    -2.92834770339039430e-01, 0.00000000000000000e+00, 1.60421047032282041e-03,
+    -1.72649334232394540e-03, 5.02690160971578596e-04, -6.41201874616051468e-03,
+    -5.68324478129830519e-03, 1.14109472062058320e-01, 5.66467357368232838e-01,
+    1.00000000000000000e+00, -4.53082028773847993e-04, 1.16748422569092568e-03,
+    -4.98589828144500478e-04, -1.53715085260598965e-03, -3.63003508067738859e-02,
+    -1.42881413059794293e-01, -1.62704864358257983e-01, 0.00000000000000000e+00,
+    -6.53271852908335619e-04, 7.81427120013093116e-04, -5.06018166597891196e-04,
+    2.96650387861003379e-03, 2.27004859542185820e-02, 1.53224579073552469e-01,
+    5.61745287897970291e-01, 1.00000000000000000e+00, -9.27916911648974394e-04,
+    7.99999912329144654e-04, -1.33032286351267336e-03, -2.35795806796572881e-03,
+    -1.57264804281421790e-02, -4.65006586004479971e-02, -5.24478940530979584e-02,
+    0.00000000000000000e+00,
+};
+
+static const real_t RadauIIA15_transf1_T[64] = {
+    -1.93951640824844770e-02, -2.21334351162778081e-01, -3.33242206124650733e-02,
+    2.84148970162316460e-02, 1.73412622388403014e-02, 3.70981264921553099e-03,
+    -5.11309059782720857e-03, -1.05137780453084494e-02, 7.18349031788362014e-02,
+    3.93280265370989424e-01, 3.87452579961000687e-02, -5.70336862603050346e-02,
+    -2.20415200731955176e-02, 2.40246944933447670e-03, 6.62731961224018260e-03,
+    9.42428692417319330e-03, -2.59578498263064672e-01, -6.44481381415456744e-01,
+    7.61511894325498425e-03, 8.39044994698664032e-02, 7.20609145301740004e-03,
+    -2.19194436867933742e-03, -2.95195356674628987e-03, -1.43631726014920788e-02,
+    9.03198455729827154e-01, 9.47242716310480848e-01, -1.25776131890760284e-01,
+    5.20984264572221245e-02, -5.26753919650750843e-02, -4.63217259330386266e-02,
+    3.40564497045853856e-02, -1.90867637312561733e-02, -2.64971195670415582e+00,
+    -3.90606011622572968e-01, -4.01451233192726353e-01, -6.00241500377960202e-01,
+    1.26925620664648464e-01, -3.69695853092735727e-01, 2.56787506016094846e-01,
+    -1.22491911364313019e-01, 3.24614193370121518e+00, -4.46432970618906477e+00,
+    2.19736722736132650e+00, -1.80541396759497874e+00, 1.78336484107076765e+00,
+    -7.76960849524757857e-01, 1.63489805349859241e+00, -2.20187685785838111e-01,
+    8.54932906694660311e+00, 4.90602980705270664e+00, 6.91517397406475531e+00,
+    2.56239784234714785e+00, 6.13691806859346922e+00, 1.28443703268153064e+00,
+    5.79913553588460129e+00, 3.93065311421878727e-01, 4.68549463282119660e+00,
+    1.20105785998137904e+01, 7.73868814683054840e+00, 8.37087930623798293e+00,
+    9.40637121369073981e+00, 4.96921728762329362e+00, 1.01694460066575143e+01,
+    1.64920179682222767e+00,
+};
+
+static const real_t RadauIIA15_transf2_T[64] = {
+    1.01850047307986209e+01, 6.16356250051120469e+00, -9.46226959748098828e+00,
+    2.05187055727704948e+00, 5.66597835002784600e-01, -8.74031572808736001e-01,
+    6.66606635366627898e-01, -2.62439822914848020e-01, 1.68854607291261893e-01,
+    1.25290652835991647e+01, 2.78769524158376347e+00, -5.22976163977036812e+00,
+    3.07121160405178539e+00, -1.59433887277997188e+00, 8.45182657062711673e-01,
+    -2.92958979031038846e-01, -1.13167875299513838e+02, -2.07552074910902533e+01,
+    6.28323631463336199e+01, 4.77489944043383208e+00, -2.14192628668472579e-01,
+    -4.13426954370049238e+00, 3.60690615825480521e+00, -1.42790969700038128e+00,
+    -9.04417337429521666e+01, -1.53884883827672667e+02, -2.75785534507166687e+01,
+    1.51739310584175389e+01, 2.53464047147123672e+00, -1.55524731107068792e+00,
+    -1.10920407701278020e-01, 2.45271568737764845e-01, 2.95920271280849704e+02,
+    1.35706554457574775e+01, -1.28132314470851639e+02, -4.04621811100017936e+01,
+    2.10842358486470149e-01, -2.81427624155484368e+00, 2.47259619608814640e+00,
+    -7.24633349434931406e-01, 5.63176417527152125e+02, 5.85113253277056060e+02,
+    1.42874480959821966e+02, 1.18868397275663562e+00, -1.03582705578781571e+01,
+    5.15720136980710109e+00, -6.18283256603664455e+00, 2.89755961075181956e+00,
+    -1.92937400712134490e+02, 1.02098954482157311e+00, 7.47622209219990310e+01,
+    3.36354111122909103e+01, -5.63247564820782087e-01, 7.82257735806407162e+00,
+    -6.74610898970957962e+00, 3.41498286935016049e+00, -1.24301254461957342e+03,
+    -1.07127685676901274e+03, -3.14296236673543888e+02, -4.15451736087709662e+01,
+    -9.77351705577934560e+00, 5.25523109156864354e+00, -5.30432098902764171e+00,
+    2.38561432970030030e+00,
+};
+
+static const real_t RadauIIA17_c[9] = {
+    1.77799151473634516e-02, 9.13236078997939627e-02, 2.14308479395630747e-01,
+    3.71932164583272329e-01, 5.45186684803426691e-01, 7.13175242855569436e-01,
+    8.55633742957854437e-01, 9.55366044710030171e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA17_A[81] = {
+    2.27883787934587759e-02, 4.89079524474993199e-02, 4.37427600915713671e-02,
+    4.62492374539471215e-02, 4.48344365869102340e-02, 4.56587557193233948e-02,
+    4.52006001877972435e-02, 4.54165166574277343e-02, 4.53572524616414618e-02,
+    -8.58963975293894517e-03, 5.07020504808280773e-02, 1.08301892902740227e-01,
+    9.65607307268000897e-02, 1.02306849685941753e-01, 9.91454704893880573e-02,
+    1.00853706718320474e-01, 1.00060402445943747e-01, 1.00276649012275981e-01,
+    6.45102917699514646e-03, -1.35238071960213160e-02, 7.29195659374289734e-02,
+    1.54298769790038592e-01, 1.38217634192368155e-01, 1.45747040496992331e-01,
+    1.41942236794574905e-01, 1.43652840987038011e-01, 1.43193348178615593e-01,
+    -5.25752869975011985e-03, 9.20937377430507131e-03, -1.68798772100160546e-02,
+    8.67193693031383939e-02, 1.81263934682140138e-01, 1.63648281233873982e-01,
+    1.71189471838763319e-01, 1.68019080980692959e-01, 1.68846983487964786e-01,
+    4.38883380936137563e-03, -7.15571331753696045e-03, 1.07045518448027812e-02,
+    -1.84516396436178731e-02, 9.04336005994356429e-02, 1.85944587344519019e-01,
+    1.69783386170001910e-01, 1.75560768418413671e-01, 1.74136501386483289e-01,
+    -3.65121555369046736e-03, 5.74724669943230907e-03, -7.90194647923877710e-03,
+    1.10366587298355127e-02, -1.80850633667824778e-02, 8.36132602315327600e-02,
+    1.67768291173279516e-01, 1.55886270450033615e-01, 1.58421887835218989e-01,
+    2.94048821375261478e-03, -4.54258297639453627e-03, 5.99140694217999321e-03,
+    -7.67328094028164875e-03, 1.01933879038555650e-02, -1.58099361463095375e-02,
+    6.70790343224930419e-02, 1.28893913516503950e-01, 1.23594689102296526e-01,
+    -2.14927416388255386e-03, 3.28816168179140583e-03, -4.24802443998731349e-03,
+    5.22822499988990271e-03, -6.40526541886632297e-03, 8.13825269404473001e-03,
+    -1.17922305360253221e-02, 4.28108260252210091e-02, 7.38270095231576967e-02,
+    8.58843324057626087e-04, -1.30907369410941123e-03, 1.67814980614956256e-03,
+    -2.03590583647778002e-03, 2.42716993842396122e-03, -2.91046920779525816e-03,
+    3.60924628864936568e-03, -4.93457477124453585e-03, 1.23456790123456783e-02,
+};
+
+static const real_t RadauIIA17_b[9] = {
+    4.53572524616414618e-02, 1.00276649012275981e-01, 1.43193348178615593e-01,
+    1.68846983487964786e-01, 1.74136501386483289e-01, 1.58421887835218989e-01,
+    1.23594689102296526e-01, 7.38270095231576967e-02, 1.23456790123456783e-02,
+};
+
+static const real_t RadauIIA17_eig[9] = {
+    4.96612926068677751e+00, -1.38646859789140358e+01, 8.28004220055088780e+00,
+    -1.01383596611087921e+01, 1.02068832208485052e+01, -6.68014072379038026e+00,
+    1.12532698572706913e+01, -3.32134053152182940e+00, 1.15873509212862782e+01,
+};
+
+static const real_t RadauIIA17_transf1[81] = {
+    -1.68103228694381670e+02, -5.05721417230321979e+00, 1.22921904712367791e+03,
+    2.49716237403566220e+03, 4.48751530220831683e+03, -1.39626802256555475e+04,
+    -2.98576715470472336e+04, 2.07769037564261998e+04, 2.43236754095494834e+04,
+    -1.24072337017462559e+02, -2.19441953426365558e+02, -9.30704882449921229e+02,
+    3.20837342115077809e+03, 1.10259898381033909e+04, -1.06746755342473789e+04,
+    -3.28809581543642271e+04, 1.24493253392899569e+04, 2.28993668672339809e+04,
+    1.76548649080592440e+02, -8.17108654716833058e+01, -1.75413075617068444e+03,
+    6.60144505681056444e+01, 6.19554238956005065e+03, 3.77780762906517225e+02,
+    -1.25267337748385944e+04, -4.98263069866752573e+02, 7.91813686242696167e+03,
+    -1.47251447293518929e+01, 1.16093827231673330e+02, 3.46989933260570425e+01,
+    -5.49080130636264698e+02, 7.03421854635456839e+02, 1.25373348979329103e+03,
+    -2.16789923308792049e+03, -1.45100465423244646e+03, 1.43484856403195909e+03,
+    -3.33609465967765715e+01, -5.73088624725932405e+01, 8.38370582574135739e+01,
+    1.72284844070664249e+01, -2.21246149953002941e+02, 2.71882259325526945e+02,
+    -9.71519597221969207e+01, -2.19847417970962141e+02, 2.79105598026737141e+02,
+    3.10155005267380766e+01, 2.31841193966516883e+01, 4.78248678230832169e+01,
+    3.43244173345935337e+01, 2.06799687925055515e+01, -9.49767743431738296e+01,
+    -5.87414973844489623e+01, -1.82658371040146051e+02, -5.55677215520538113e+01,
+    -2.18430517610374793e+01, -9.42285957434282828e+00, -6.70349757307761251e+01,
+    2.04808726035175681e+00, -6.07475471245168563e+01, 8.82702997210957676e+01,
+    8.04143886339114005e+01, 1.32772834094365805e+02, 9.29048794637023718e+01,
+    1.40514347844759087e+01, 4.07391928113470048e+00, 4.85957914047231156e+01,
+    -1.58228550444906322e+01, 4.12874377377573722e+01, -9.43489408778742700e+01,
+    -7.73380490797701299e+01, -1.26054812285730407e+02, -8.26497454266134355e+01,
+    -5.28641594024371031e+00, -1.26180296349903709e+00, -1.85480311011825840e+01,
+    8.28811359964477568e+00, -1.31522062886476956e+01, 4.22174020326628252e+01,
+    3.92849966180324728e+01, 5.49944507693111078e+01, 3.87016567120415189e+01,
+};
+
+static const real_t RadauIIA17_transf2[81] = {
+    7.70828803968072636e-03, -1.47142445205480418e-02, 2.81651811386681369e-02,
+    -5.89309499356375152e-02, 1.23980452930209956e-01, -1.74587952418098852e-01,
+    -1.96832377113703133e-01, 6.50042468474254620e-01, 1.00000000000000000e+00,
+    1.06627280044160055e-02, -1.75805296466806753e-02, 2.48956547094357980e-02,
+    -2.84881247768793283e-02, -2.52074434611793911e-03, 1.76754459209302772e-01,
+    -4.41448069378498342e-01, -4.65981869706302287e-01, 0.00000000000000000e+00,
+    1.83583170939505074e-03, -2.28564221380045960e-03, 6.91838516411885651e-04,
+    5.11039207871533379e-03, -2.03870093898084973e-03, -9.08660591313214944e-02,
+    3.27321816388114750e-02, 6.21271955340804816e-01, 1.00000000000000000e+00,
+    -1.80868705775598230e-03, 3.37163814381990275e-03, -5.15814464047443556e-03,
+    2.75497703845585138e-03, 2.04381011380387542e-02, -1.96598156340349883e-02,
+    -3.01983530906949960e-01, -3.01687104926564253e-01, 0.00000000000000000e+00,
+    -8.35609369542282912e-04, 1.26983459549373403e-03, -9.82871516430782214e-04,
+    1.90245736388098576e-04, -1.04049221300144667e-02, -1.74971694715970010e-02,
+    1.30185673344436953e-01, 6.06275632143463028e-01, 1.00000000000000000e+00,
+    -5.15753203356523440e-04, 4.10582900737881356e-04, 6.82178108169362166e-05,
+    1.54879492124584007e-03, -1.08901590076247853e-03, -5.02674189774187999e-02,
+    -1.88359234881240789e-01, -1.86215666263415902e-01, 0.00000000000000000e+00,
+    -1.61301156607846733e-04, 7.29144673612563580e-05, -1.86808311677338240e-04,
+    -3.82849799022707638e-04, 3.30782952530979174e-04, 2.30072157793044622e-02,
+    1.74749164114556155e-01, 5.98529665119590715e-01, 1.00000000000000000e+00,
+    5.56460449946091394e-04, -6.67933625457828653e-04, 5.49836926714541855e-04,
+    -1.28025800573880293e-03, -5.53293797540266481e-03, -3.26505791481201887e-02,
+    -9.06548583208089676e-02, -8.94814667817306342e-02, 0.00000000000000000e+00,
+    4.89325202758787606e-04, -5.26597835970401477e-04, 6.24693648200709203e-04,
+    2.48108652974758442e-04, 5.50806483400099068e-03, 3.57442134662215791e-02,
+    1.87902623079850756e-01, 5.96109786246712736e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA17_transf1_T[81] = {
+    -1.09555020676140258e-01, 1.59825478646666796e-01, 3.35378839328232953e-02,
+    3.63631698130542766e-03, -5.08366327599767132e-03, -1.08462208960987752e-02,
+    -3.66336009019280857e-03, 5.72626353891864549e-03, 5.66998283899563301e-03,
+    1.70675682631822395e-01, -2.91315562391107397e-01, -5.31080941347877866e-02,
+    4.74464329569387368e-03, 1.02183018702868382e-02, 1.26734455141443662e-02,
+    3.03896120031478100e-03, -7.27426355824084808e-03, -6.10187391977899240e-03,
+    -2.05298504600516518e-01, 5.14136431343349853e-01, 5.80235776610074638e-02,
+    -3.56955475928820987e-02, -1.04877593654333200e-02, -5.86942881457247056e-03,
+    -3.92840001331062460e-03, 5.56700929661200095e-03, 7.23854452000017440e-03,
+    1.02320189324115324e-01, -9.58534825333274942e-01, 1.43833139991621627e-02,
+    7.46223190432606098e-02, -8.40435201163640053e-03, 1.70792371853731757e-02,
+    -5.61392979387842725e-05, -1.56786633804890628e-02, 2.87492202862616461e-03,
+    6.50652283841963719e-01, 1.70643170514492648e+00, -2.24089349936617943e-01,
+    1.48559256561259928e-01, -9.89270456355412497e-02, -8.06218021733071527e-02,
+    2.20991609851170709e-02, -6.11650013133695214e-02, 6.38238801287659280e-02,
+    -3.31767141137666455e+00, -1.54282164414233991e+00, -5.53056522436157993e-01,
+    -1.08401689156577596e+00, 1.57201867098902576e-01, -6.29957229654254602e-01,
+    3.67350099731282576e-01, -2.91010979864699315e-01, 4.14180744838476000e-01,
+    5.14304383049584146e+00, -4.92130727357892717e+00, 3.33264149335167792e+00,
+    -2.16858574983389651e+00, 2.58705616048637221e+00, -1.05290209583895411e+00,
+    2.26759515643385567e+00, -4.39762102933469234e-01, 2.17729363265641718e+00,
+    9.68888721872417413e+00, 6.69850850025566658e+00, 8.20277038310480400e+00,
+    3.80069657045142284e+00, 7.43213143254843622e+00, 2.14932498068011846e+00,
+    7.03261426161479797e+00, 9.80961743160666311e-01, 6.90733328085361276e+00,
+    4.96612926068677751e+00, 1.38646859789140358e+01, 8.28004220055088780e+00,
+    1.01383596611087921e+01, 1.02068832208485052e+01, 6.68014072379038026e+00,
+    1.12532698572706913e+01, 3.32134053152182940e+00, 1.15873509212862782e+01,
+};
+
+static const real_t RadauIIA17_transf2_T[81] = {
+    -3.52574473730990601e+00, 1.11868348816768943e+01, 9.26571427349140109e+00,
+    -7.75838557155274255e+00, 2.89957551797280022e+00, -7.71875327460586069e-01,
+    1.02214811568256528e-01, 6.13099262763808217e-02, -4.03819631894853093e-02,
+    -1.08616902552097994e+01, -1.29557644025270005e+01, 9.41484823416591077e+00,
+    1.71687991415228325e+00, -3.44476705010041684e+00, 2.51348881821352554e+00,
+    -1.61205697421737204e+00, 9.91509060250708174e-01, -3.66822147936075149e-01,
+    -8.83545257889950904e+01, -2.34811737269146761e+02, -8.86720728112677818e+01,
+    3.41653745281779067e+01, 3.03192091233341854e+00, 2.80127892439500370e-01,
+    -3.36056033052543501e+00, 3.28455203602626433e+00, -1.38670957998449906e+00,
+    1.93403895187101114e+02, 9.99714199537909991e+01, -1.00600322475788104e+02,
+    -2.44804640850291761e+01, 5.79310925216641692e+00, 4.48843783148604736e+00,
+    -3.86742980986730078e+00, 2.11075190186929396e+00, -6.96958629916069938e-01,
+    9.34622167241701504e+02, 1.23550714197167395e+03, 4.08008151421759237e+02,
+    -8.03315388427972898e+00, -2.73811521499104735e+01, 5.68218603239493714e+00,
+    -8.12945273962248116e+00, 7.06751828683033789e+00, -2.79736523032184037e+00,
+    -7.56281076003662292e+02, -2.37223637053354111e+02, 3.04043121069377833e+02,
+    1.17574666568064885e+02, 8.71689308670400465e+00, -5.58632550155496865e+00,
+    3.32759870747212094e+00, -4.61815062776501417e+00, 2.30536669511523273e+00,
+    -2.94189946730957217e+03, -2.98812055520880676e+03, -1.01194494147898479e+03,
+    -1.42202704481668604e+02, -2.63743717356190954e+00, -3.94888524753335635e-01,
+    3.37001403034561209e+00, -3.28062436834028137e+00, 1.88446500359563740e+00,
+    9.78013853358150982e+02, 2.24357849604948314e+02, -3.42947149461267713e+02,
+    -1.70911058271369171e+02, -2.03147394361251799e+01, -1.63481310442386629e+01,
+    1.27932414410318458e+01, -1.21698745969833642e+01, 5.44316465728511467e+00,
+    2.09915757059417547e+03, 1.97623831562460236e+03, 6.83343148595001935e+02,
+    1.23828869409323161e+02, 2.40870928931661652e+01, -4.79555007262051536e+00,
+    8.01778422823404568e+00, -7.13275588079270140e+00, 3.33999176990018709e+00,
+};
+
+static const real_t RadauIIA19_c[10] = {
+    1.44124096488765490e-02, 7.43873897091960473e-02, 1.76116656162995294e-01,
+    3.09667579927637826e-01, 4.61970401081010951e-01, 6.18117234695294004e-01,
+    7.62823015185039588e-01, 8.81921021210001266e-01, 9.63742187116790494e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA19_A[100] = {
+    1.84763134199340089e-02, 3.97155060527918935e-02, 3.54665359620932458e-02,
+    3.75691078396401673e-02, 3.63435450715737310e-02, 3.70966712571939999e-02,
+    3.66366937439510515e-02, 3.68995819320343948e-02, 3.67736553764046875e-02,
+    3.68085027433792469e-02, -6.98018293353283668e-03, 4.14659401327763522e-02,
+    8.88778422954861896e-02, 7.90123914161184743e-02, 8.39962434882878806e-02,
+    8.11061938705455732e-02, 8.28205315980381912e-02, 8.18564138400400126e-02,
+    8.23141114519348738e-02, 8.21880063684607420e-02, 5.26840746209392054e-03,
+    -1.11155019218604663e-02, 6.06789412094099062e-02, 1.29132601825278942e-01,
+    1.15150720442210169e-01, 1.22042490992203406e-01, 1.18226565857156046e-01,
+    1.20298380809969269e-01, 1.19333150093591064e-01, 1.19596715857189853e-01,
+    -4.32990226672621235e-03, 7.63241753664901240e-03, -1.41598290036198983e-02,
+    7.42008791078677676e-02, 1.56469770643000855e-01, 1.40310498309043491e-01,
+    1.47868438680649167e-01, 1.44048714454310584e-01, 1.45766687074844720e-01,
+    1.45305082416459147e-01, 3.66463346822037397e-03, -6.01003253899933410e-03,
+    9.09464012475703215e-03, -1.59761801352705790e-02, 8.07054663121396509e-02,
+    1.68215242205712712e-01, 1.52025205353865656e-01, 1.58934619497337670e-01,
+    1.56034439263716462e-01, 1.56791228613469197e-01, -3.12113331304094289e-03,
+    4.93796597340477768e-03, -6.85841055717110407e-03, 9.74503465828483080e-03,
+    -1.64201439696447758e-02, 7.95554081045821287e-02, 1.63218809739636761e-01,
+    1.49149617162009585e-01, 1.54164018380173046e-01, 1.52929643862211306e-01,
+    2.62723809313672278e-03, -4.07478295795061281e-03, 5.41744635163854925e-03,
+    -7.03470085704045473e-03, 9.56614253094683654e-03, -1.54521370974890545e-02,
+    7.08628245362198789e-02, 1.41961584722892442e-01, 1.31969317961224741e-01,
+    1.34097418920589351e-01, -2.13072761762523981e-03, 3.26734369810142804e-03,
+    -4.24124334426524349e-03, 5.26447030547479416e-03, -6.54789728542778775e-03,
+    8.55832898557935991e-03, -1.31479305177910396e-02, 5.54771380758001739e-02,
+    1.06496772610231577e-01, 1.02135065939500336e-01, 1.56350377586790133e-03,
+    -2.38282746879431512e-03, 3.05423538205659879e-03, -3.70587165545599147e-03,
+    4.42306327830468103e-03, -5.32589485619823760e-03, 6.69694923969546552e-03,
+    -9.64354089079849999e-03, 3.48928785749543571e-02, 6.01483352787408124e-02,
+    -6.25740439451146109e-04, 9.51361203077312088e-04, -1.21350225738999277e-03,
+    1.45984742273987675e-03, -1.71650943038029885e-03, 2.01043292412065536e-03,
+    -2.38507304638155369e-03, 2.93851160640566872e-03, -4.00284367028498709e-03,
+    1.00000000000000002e-02,
+};
+
+static const real_t RadauIIA19_b[10] = {
+    3.68085027433792469e-02, 8.21880063684607420e-02, 1.19596715857189853e-01,
+    1.45305082416459147e-01, 1.56791228613469197e-01, 1.52929643862211306e-01,
+    1.34097418920589351e-01, 1.02135065939500336e-01, 6.01483352787408124e-02,
+    1.00000000000000002e-02,
+};
+
+static const real_t RadauIIA19_eig[10] = {
+    5.22545336734436106e+00, -1.57295290456392589e+01, 8.77643464008260921e+00,
+    -1.19218538983012134e+01, 1.09343034306000089e+01, -8.40967299600309204e+00,
+    1.22261314841621509e+01, -5.01271926367686405e+00, 1.28376770778108700e+01,
+    -1.66606258416230135e+00,
+};
+
+static const real_t RadauIIA19_transf1[100] = {
+    6.72960748067290666e+01, 1.99026783141387540e+02, 3.23321856344950993e+03,
+    -3.09136987874570514e+03, -2.96031517944139050e+04, -7.94366657174798434e+02,
+    7.17350563568181824e+04, 5.83494925055120111e+04, -4.54486339616176192e+04,
+    -1.52109478585696401e+05, -1.99897393827857883e+02, 2.73585819811981992e+02,
+    5.87352558800454244e+03, -2.95163326633400573e+02, -2.96399789162011912e+04,
+    -1.73625320427395200e+04, 5.49483283022006872e+04, 8.26469984712347359e+04,
+    -3.09706215823536331e+04, -1.61110350796139886e+05, -2.29487614865248133e+02,
+    -1.67015962238425971e+02, 1.41970048979795774e+03, 3.24318686373901755e+03,
+    -2.94583560635368440e+03, -1.61790222043986214e+04, 3.21660384443244857e+03,
+    4.13729081098948300e+04, -1.47098327050112721e+03, -6.47596426404031445e+04,
+    1.60972077709399741e+02, -8.25418109420866273e+01, -1.26366124679713084e+03,
+    4.68327087272528445e+02, 3.64399890684518641e+03, -2.70136507315398148e+03,
+    -5.53307660405066053e+03, 8.35320909297442086e+03, 3.00168966686234353e+03,
+    -1.37605905283310130e+04, -3.63903019734642399e+01, 9.87449991931742375e+01,
+    -7.04970203265096895e+00, -3.30133608700248260e+02, 8.72556975460827971e+02,
+    5.33286681166759195e+02, -1.58888552557547382e+03, 1.60967625285675666e+02,
+    7.48940569310936553e+02, -2.07228466752310078e+03, -7.87386151618527297e+00,
+    -6.11365919084985165e+01, 3.90204708084982741e+01, -3.47049568042581313e+01,
+    -2.02173270589162172e+02, 1.98266520201015510e+02, -2.35454687375933190e+02,
+    9.38742877076701916e+01, 4.19506427290971942e+02, -6.28068588566250980e+01,
+    1.57001787129195858e+01, 3.44619198067278631e+01, 5.53018492182916432e+01,
+    7.02097923309538885e+01, 1.19948202189674078e+02, -5.72729899857737266e+01,
+    2.01364597434929244e+01, -2.82103942780122679e+02, -2.28764390370503349e+02,
+    -1.88200297534930627e+02, -1.38508748136245625e+01, -1.99976869095066228e+01,
+    -7.52945330155503854e+01, -3.77663294953040705e+01, -1.49872556859988947e+02,
+    6.81910951058863191e+01, -1.37749703520083369e+01, 2.52790790168921632e+02,
+    2.81613334841145218e+02, 1.65557683869095968e+02, 9.95961477750134705e+00,
+    1.17605608140471638e+01, 6.01990000071849991e+01, 1.52960170585354653e+01,
+    1.17048624877170255e+02, -8.22652055306995464e+01, -3.48658589736229230e+00,
+    -2.32878285842493483e+02, -2.52622326811647383e+02, -1.46265031478097598e+02,
+    -3.91070280996269792e+00, -4.28064612535413413e+00, -2.42387866443058400e+01,
+    -4.07811396095354795e+00, -4.56851056033937155e+01, 3.87096763168493467e+01,
+    8.55282175963189140e+00, 1.01939160492396326e+02, 1.15781773298030359e+02,
+    6.31346640868467546e+01,
+};
+
+static const real_t RadauIIA19_transf2[100] = {
+    2.67480833131981000e-04, 5.17276890483753140e-04, -3.95853931799791496e-03,
+    1.53634703699892083e-02, -5.05982373606448932e-02, 1.42174572892352108e-01,
+    -2.47251938742592464e-01, -1.49624177350276388e-01, 6.95577526690777437e-01,
+    1.00000000000000000e+00, -1.02921737696930748e-02, 1.75037027065646361e-02,
+    -2.71793843342049667e-02, 4.21815665401220133e-02, -6.07772221162518680e-02,
+    4.65526419986650106e-02, 1.53558789643309879e-01, -5.12991670112335929e-01,
+    -4.48584242396002530e-01, 0.00000000000000000e+00, -1.79232530532903831e-03,
+    2.78060294263534659e-03, -3.20400584144858551e-03, 1.18358787071701308e-03,
+    7.16868981444818663e-03, -4.20696310023287601e-03, -1.19696783991739567e-01,
+    5.82888338702272704e-02, 6.60237210190475765e-01, 1.00000000000000000e+00,
+    8.31122757711714555e-05, -5.53840280378945535e-04, 1.87687216294381851e-03,
+    -3.94295417048203325e-03, 4.09558103221518597e-04, 3.33877533488536188e-02,
+    -3.77671360072545995e-02, -3.50430333400264249e-01, -3.04620348267571284e-01,
+    0.00000000000000000e+00, 1.34175282979609440e-04, -3.44074499249899274e-04,
+    5.57282395012597266e-04, -1.71674139167337427e-07, -1.05537634349964758e-04,
+    -1.56556864158344938e-02, -3.05207113506907636e-02, 1.50054081012946899e-01,
+    6.41717635715220114e-01, 1.00000000000000000e+00, 5.94216732012870733e-04,
+    -7.94940221439199390e-04, 6.12722989485013029e-04, -3.32166646108169521e-04,
+    3.21477289621284901e-03, 6.78372000242363966e-04, -6.78442103596214041e-02,
+    -2.30537159492631788e-01, -2.01861239572015544e-01, 0.00000000000000000e+00,
+    2.87830554252885274e-04, -3.35189951135557093e-04, 2.82908497696426344e-04,
+    -4.67383248297902564e-04, -1.03441713089379118e-03, -3.34259072009184454e-03,
+    2.06541132113150228e-02, 1.95810305782814165e-01, 6.31389672295404214e-01,
+    1.00000000000000000e+00, -1.34310948665214940e-04, 2.26037791283494326e-04,
+    -2.00864477793057648e-04, 2.92642134792191970e-04, -7.94621874191339022e-04,
+    -8.67526983148966466e-03, -5.11870985943375378e-02, -1.31639266833225993e-01,
+    -1.16056393358057064e-01, 0.00000000000000000e+00, -1.44326114693648527e-04,
+    1.83425351416818388e-04, -1.77603120529276338e-04, 2.23665250348519998e-04,
+    4.81877448685191236e-04, 6.09182334296396594e-03, 4.38488277632320747e-02,
+    2.15439775173056430e-01, 6.26672513581382984e-01, 1.00000000000000000e+00,
+    -1.83083266621755254e-04, 2.05090270300606120e-04, -2.24629019814440623e-04,
+    4.60071518746483168e-05, -9.31030633134033274e-04, -4.29023726556419099e-03,
+    -1.84209922221785644e-02, -4.28638107201083571e-02, -3.79319164307903439e-02,
+    0.00000000000000000e+00,
+};
+
+static const real_t RadauIIA19_transf1_T[100] = {
+    1.63288754873343323e-01, -4.95739265482347050e-02, -1.67210783048856379e-02,
+    -2.06384109722667006e-02, -3.53005514799617417e-03, 7.62571630537295375e-03,
+    4.19231728115187965e-03, -1.99289554165243840e-04, -1.54778387402743707e-03,
+    -2.59082019484944796e-03, -2.72621993859915202e-01, 9.96013041225149443e-02,
+    3.10065828917324600e-02, 2.82891990094941946e-02, 2.92297233614379837e-03,
+    -1.15856716153597324e-02, -5.23114040543895022e-03, 1.08335463157348895e-03,
+    2.01306220364952035e-03, 2.93848077690250916e-03, 4.06833752718472386e-01,
+    -2.04290564572271155e-01, -5.04955435663211813e-02, -2.17254436651867777e-02,
+    9.40694824896831780e-04, 1.13862617944188397e-02, 4.46575372804494664e-03,
+    -1.03765463973473290e-03, -1.90576550413648019e-03, -3.17961273262726317e-03,
+    -5.83215078104458828e-01, 4.62077962343504178e-01, 5.73950051363266711e-02,
+    -2.04945178955870527e-02, 2.79153573681994571e-03, -3.63345462144372498e-03,
+    -7.18122191362130426e-03, 1.23502020551247865e-03, 2.79469146315980063e-03,
+    9.63265264019499338e-04, 6.91598350792981376e-01, -1.11347498418761792e+00,
+    5.80328457420581229e-02, 8.90585325343311862e-02, -2.81891693308940761e-02,
+    3.42637653140051360e-02, -8.66370347567932235e-03, -1.49003941927633252e-02,
+    7.73734237987341433e-03, -1.11494326303185343e-02, 1.06754662018404330e-02,
+    2.47959773375230919e+00, -4.34966054099983013e-01, 2.42870635608892327e-01,
+    -1.76888912376739871e-01, -1.24241677995662686e-01, 2.61973856031985294e-03,
+    -1.22820458513569764e-01, 8.53526646773769826e-02, -4.49273216614646323e-02,
+    -3.70741091779255338e+00, -3.08674225761526877e+00, -6.00256723695828276e-01,
+    -1.75846837155681923e+00, 2.36824904970250577e-01, -9.98498384146266127e-01,
+    5.09106458985870702e-01, -5.22286926538620633e-01, 5.93607616969437757e-01,
+    -1.63427858305495971e-01, 7.28726321383184850e+00, -5.03413189356916568e+00,
+    4.68934737703961702e+00, -2.38061795568657608e+00, 3.57947897755584066e+00,
+    -1.25885750088642578e+00, 3.05387323316589310e+00, -6.27896892957756636e-01,
+    2.83716005464326138e+00, -1.91335611792991300e-01, 1.06907267992793891e+01,
+    8.59705086961068865e+00, 9.42616800868281146e+00, 5.19777098150330019e+00,
+    8.71432236104594971e+00, 3.18942342777577581e+00, 8.30121126988445646e+00,
+    1.74605844842854685e+00, 8.10821630960875339e+00, 5.57117933319889125e-01,
+    5.22545336734436106e+00, 1.57295290456392589e+01, 8.77643464008260921e+00,
+    1.19218538983012134e+01, 1.09343034306000089e+01, 8.40967299600309204e+00,
+    1.22261314841621509e+01, 5.01271926367686405e+00, 1.28376770778108700e+01,
+    1.66606258416230135e+00,
+};
+
+static const real_t RadauIIA19_transf2_T[100] = {
+    -1.01154273398011139e+01, -1.94665969337997140e+01, 5.19761096261702793e+00,
+    7.78781688426500818e+00, -6.34590231969741847e+00, 3.35066159229057670e+00,
+    -1.67451749040590236e+00, 8.81530496916262507e-01, -4.83921492122682817e-01,
+    1.70707498491426246e-01, 7.63873910738164064e+00, -6.24148371159378446e+00,
+    -1.63162856196989772e+01, 7.64658645521244384e+00, -2.05351687185984844e-01,
+    -1.61369023464109196e+00, 1.55441982407073787e+00, -1.17341538094361164e+00,
+    7.93941378143568799e-01, -3.05331893208660721e-01, 2.97645835771326915e+02,
+    2.51270353676186829e+02, -1.19571642698042041e+02, -7.60815885034272270e+01,
+    1.76765693628072000e+01, 3.45054042562423646e+00, -1.60468876406064065e+00,
+    -9.60833815915984490e-01, 1.57867030073268277e+00, -7.48832541047159905e-01,
+    5.20849647384269900e+01, 3.07692728267518191e+02, 2.07108157657968547e+02,
+    -4.99868697491803999e+01, -1.36041725632391461e+01, 7.32858191735540898e-01,
+    5.82000885647757737e+00, -5.60834232666699251e+00, 3.88730676368788242e+00,
+    -1.48187580070544667e+00, -1.66600183466958379e+03, -9.35872487520666823e+02,
+    5.45768116541545737e+02, 3.28787383960670411e+02, 2.65713361493184230e+01,
+    -2.03802189079094092e+01, 9.42391296327058647e+00, -1.16260159865666548e+01,
+    1.03618465841666598e+01, -4.33605016864349757e+00, -1.35398632308439596e+03,
+    -2.30768368455270502e+03, -1.05990206748851529e+03, 5.81923773840957459e+00,
+    6.92081515802490941e+01, 2.45791090114858379e+00, 2.01009936459393801e+00,
+    -2.70523840637741886e+00, 4.45802140742878883e-01, 2.05309128152691645e-01,
+    3.34784482089454514e+03, 1.47486230826772112e+03, -9.62535612614368006e+02,
+    -6.27244404973646510e+02, -1.15877174583490785e+02, -1.91818850271640180e+01,
+    9.50884988956662802e+00, -8.22186395113852164e+00, 6.44152145712179092e+00,
+    -2.32767084364174526e+00, 6.14514074450587577e+03, 7.36455920597599106e+03,
+    2.98933373568838169e+03, 4.26055370652384283e+02, -3.43438249877623250e+01,
+    -1.86413575265577280e-01, -1.91752189207988337e+01, 1.73053017327515199e+01,
+    -1.64065589681278858e+01, 7.38346386442126601e+00, -1.96937339465648733e+03,
+    -7.70793577489441418e+02, 5.31141527808247247e+02, 3.66750792632138371e+02,
+    7.79751713910625739e+01, 3.27609019171586198e+01, -1.56535565983706704e+01,
+    1.99271832567049003e+01, -1.78981168498984502e+01, 8.24184605484097688e+00,
+    -1.21042597481565626e+04, -1.26498384521913686e+04, -4.97556740420200640e+03,
+    -1.02429440118438106e+03, -1.51302540187124720e+02, -6.40703602309235176e-01,
+    -1.66915012111430023e+01, 1.54823662486710862e+01, -1.37162208724683730e+01,
+    5.98753925319567859e+00,
+};
+
+static const real_t RadauIIA21_c[11] = {
+    1.19176134324155969e-02, 6.17320718771481244e-02, 1.47111449643070241e-01,
+    2.61159676008456243e-01, 3.94639846885786849e-01, 5.36738765715660593e-01,
+    6.75944461676665109e-01, 8.00978921036898828e-01, 9.01710987790146801e-01,
+    9.69970967838513554e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA21_A[121] = {
+    1.52805207895303687e-02, 3.28839766811962891e-02, 2.93325021471551248e-02,
+    3.11145533765056909e-02, 3.00526927566632587e-02, 3.07280739296097657e-02,
+    3.02920223764012418e-02, 3.05665438183657587e-02, 3.04066299018650281e-02,
+    3.04841193815539452e-02, 3.04625489060655688e-02, -5.78249967813118746e-03,
+    3.45135117394044788e-02, 7.41624250777296046e-02, 6.57899512194309172e-02,
+    7.01128453015415348e-02, 6.75192585665734119e-02, 6.91447210076235746e-02,
+    6.81385102840799811e-02, 6.87188078502281863e-02, 6.84392469125465336e-02,
+    6.85168410666011224e-02, 4.38010324638053034e-03, -9.28542002373438334e-03,
+    5.11486756872501988e-02, 1.09299626918776108e-01, 9.71469230674752715e-02,
+    1.03340603752222857e-01, 9.97209644165623771e-02, 1.01881070303890153e-01,
+    1.00660956989009273e-01, 1.01241848695986542e-01, 1.01081554270012211e-01,
+    -3.62103754733190258e-03, 6.41324617083941038e-03, -1.20050233344301850e-02,
+    6.38105166391930712e-02, 1.35391602483927509e-01, 1.20835259976636009e-01,
+    1.28010640608532233e-01, 1.24033611496906546e-01, 1.26195274530914253e-01,
+    1.25187318775931089e-01, 1.25462688848564208e-01, 3.09297704221175385e-03,
+    -5.09545583886514275e-03, 7.77794727524922999e-03, -1.38535919071778278e-02,
+    7.14710764447952923e-02, 1.50326787665470502e-01, 1.34931803833031272e-01,
+    1.42114316222632653e-01, 1.38488756770279359e-01, 1.40118434300398637e-01,
+    1.39680666551691535e-01, -2.67283140414918165e-03, 4.24609136904159547e-03,
+    -5.94469530787080595e-03, 8.55743552487074101e-03, -1.47102388519052517e-02,
+    7.35093197692008454e-02, 1.52896700391576934e-01, 1.38293953774185158e-01,
+    1.44507737832546418e-01, 1.41903867553770574e-01, 1.42582781970503669e-01,
+    2.30509116723610170e-03, -3.58767433723539836e-03, 4.80265573640117557e-03,
+    -6.30763584929392752e-03, 8.73319149942055131e-03, -1.45128800527684464e-02,
+    6.97599304799692427e-02, 1.42891353363204465e-01, 1.30651889150379619e-01,
+    1.35003426519511971e-01, 1.33933543094842095e-01, -1.95565180312384486e-03,
+    3.00683490001800403e-03, -3.92360068765700270e-03, 4.91335754816605783e-03,
+    -6.19941303527862982e-03, 8.29664564570100835e-03, -1.32745457099877461e-02,
+    6.05263612144627469e-02, 1.21114011370774294e-01, 1.12628695370519338e-01,
+    1.14433061924488308e-01, 1.59387384961284296e-03, -2.43266974832554534e-03,
+    3.12732853960981383e-03, -3.81399695410687342e-03, 4.59164085289780113e-03,
+    -5.61282750383678645e-03, 7.25876727288385891e-03, -1.10777396821178219e-02,
+    4.65554832636077137e-02, 8.93060438956225361e-02, 8.56588096033299162e-02,
+    -1.17286255549165224e-03, 1.78277738285844670e-03, -2.27314322086095066e-03,
+    2.73343060740685465e-03, -3.21333088449077394e-03, 3.76622977446661612e-03,
+    -4.48438882026941550e-03, 5.59866720385666840e-03, -8.02620009571912256e-03,
+    2.89696649721924854e-02, 4.99230409539840325e-02, 4.69930325671768546e-04,
+    -7.13146418049630617e-04, 9.06377730494035798e-04, -1.08397111531457384e-03,
+    1.26285725074027407e-03, -1.45770580761514609e-03, 1.68784582034152441e-03,
+    -1.98772696256744458e-03, 2.43764022626174678e-03, -3.31169853952014131e-03,
+    8.26446280991735560e-03,
+};
+
+static const real_t RadauIIA21_b[11] = {
+    3.04625489060655688e-02, 6.85168410666011224e-02, 1.01081554270012211e-01,
+    1.25462688848564208e-01, 1.39680666551691535e-01, 1.42582781970503669e-01,
+    1.33933543094842095e-01, 1.14433061924488308e-01, 8.56588096033299162e-02,
+    4.99230409539840325e-02, 8.26446280991735560e-03,
+};
+
+static const real_t RadauIIA21_eig[11] = {
+    5.46703443806614864e+00, -1.76032980318069114e+01, 9.23595404404188436e+00,
+    -1.37187257141666059e+01, 1.16029782674371909e+01, -1.01548327984372744e+01,
+    1.31123697248751370e+01, -6.72050582218758930e+00, 1.39626435483485825e+01,
+    -3.34747641819011843e+00, 1.42380399544621117e+01,
+};
+
+static const real_t RadauIIA21_transf1[121] = {
+    2.00290211002557356e+02, -1.61991425901257116e+02, -6.06228651981893017e+03,
+    -3.33372887853279508e+03, 1.41917156512372276e+04, 5.46412219149293669e+04,
+    8.67186344394065818e+04, -1.98980224431256560e+05, -3.92252152422295243e+05,
+    2.48766358973614697e+05, 2.97221597328871547e+05, 4.30712973508599305e+02,
+    9.21249866093138081e+01, -3.67413393936057901e+03, -9.08079588513560702e+03,
+    -1.76773173532987166e+04, 6.90015956287891604e+04, 1.72462281103429938e+05,
+    -1.86718286228576442e+05, -4.80371270764327375e+05, 2.02022717993376369e+05,
+    3.28817376782927313e+05, -5.16565833282957243e+01, 3.94321590955107467e+02,
+    4.64048243218605421e+03, -4.68214470586089647e+03, -3.51941028731881597e+04,
+    1.70449731161196505e+04, 1.18425471850672417e+05, -3.02863952070957639e+04,
+    -2.31809321670809877e+05, 2.64141295650198554e+04, 1.43999817716200370e+05,
+    -2.34222681949336845e+02, -1.32005844549008259e+02, 2.04443078082637294e+03,
+    2.05652443106363717e+03, -9.68785735396061318e+03, -8.33766459319245041e+03,
+    2.97715833702433374e+04, 1.66010481401225661e+04, -5.69362360229999395e+04,
+    -1.59598994114934812e+04, 3.50319827007075437e+04, 1.53570905313429648e+02,
+    -5.01521034993595549e+01, -8.15311113234818322e+02, 3.96722215182383479e+02,
+    1.27888107938777944e+03, -2.73945758150164193e+03, 8.46047304490774764e+02,
+    6.70989853420081818e+03, -7.52505142122790221e+03, -6.32428234896202139e+03,
+    6.07267376408078508e+03, -6.12661122297340981e+01, 7.31723353716351426e+01,
+    -2.12613216997477679e+01, -1.65525641133183967e+02, 7.44716004982033155e+02,
+    2.74080238059274279e+02, -5.15906979248269295e+02, 4.90616261685858433e+02,
+    -7.01361549115221010e+02, -1.74145610286180568e+03, 5.42841722384946934e+02,
+    1.91213998222003987e+01, -5.51509627410557215e+01, 4.26348849073816538e+01,
+    -8.34605294283971517e+01, -2.31777714230580159e+02, 4.49743573705595452e+01,
+    -4.09957205952333311e+02, 2.46301272163276252e+02, 2.14052171417377053e+02,
+    2.72981818278058370e+02, 3.81036392521404082e+02, -3.90917584653046779e+00,
+    3.73306662089539074e+01, 2.92670833869344449e+01, 1.14769041562825194e+02,
+    2.06194253845677054e+02, 5.42372014553816726e+01, 2.46317157417138901e+02,
+    -3.27700462753918941e+02, -2.11152078246607687e+02, -5.23387153836142716e+02,
+    -2.87608221098095157e+02, -8.70552708693773769e-01, -2.49891765851846053e+01,
+    -5.55586955205769328e+01, -8.59420605734276961e+01, -2.33499346371362691e+02,
+    -2.76282283821998931e+01, -2.37902263639731046e+02, 3.21712944474897995e+02,
+    2.51107141392254533e+02, 4.94971524697609425e+02, 3.11217438233077132e+02,
+    1.80874327278271330e+00, 1.61153687607858558e+01, 5.02505855247761843e+01,
+    5.46727839541955589e+01, 1.92158569719419063e+02, -8.99625265107075123e+00,
+    1.80136896973983085e+02, -3.00441042508430826e+02, -2.35306991544056501e+02,
+    -4.28629239650821660e+02, -2.72151913042745889e+02, -8.71688100550814582e-01,
+    -6.09978565052057853e+00, -2.12213938009536101e+01, -2.02520168525147106e+01,
+    -7.86860862092653264e+01, 9.58670400225980224e+00, -6.88408753778177811e+01,
+    1.33128397797014685e+02, 1.09990020678987577e+02, 1.84409200036088407e+02,
+    1.20630022809599950e+02,
+};
+
+static const real_t RadauIIA21_transf2[121] = {
+    -5.11259748370706309e-03, 8.04911479126421518e-03, -1.06225904030455495e-02,
+    1.19397216393463713e-02, -6.30217201574266150e-03, -2.79534651747587008e-02,
+    1.44318564928180987e-01, -3.15176137710492910e-01, -9.32876100291569754e-02,
+    7.33139378191581259e-01, 1.00000000000000000e+00, 6.43637183837943768e-03,
+    -1.11144459707356747e-02, 1.78774060572484926e-02, -3.00283971937568769e-02,
+    5.30866375936921223e-02, -9.07808494722295023e-02, 1.04202229769889160e-01,
+    1.11880015991053502e-01, -5.72908950063666045e-01, -4.29462919071330884e-01,
+    0.00000000000000000e+00, 1.00957906705788272e-03, -1.72893830834904569e-03,
+    2.56905248849630162e-03, -3.06580708467736303e-03, 3.39138406177690228e-04,
+    1.21849407042037960e-02, -1.19300451107027163e-02, -1.46746120730993940e-01,
+    8.95031938995213411e-02, 6.94186158622013383e-01, 1.00000000000000000e+00,
+    7.98539440570982277e-04, -1.06330322666385547e-03, 7.93974346123777885e-04,
+    6.44780678217654959e-04, -3.47137782932433478e-03, -9.05809873564154540e-04,
+    4.83805124876390130e-02, -6.37208797301289931e-02, -3.93349105138252386e-01,
+    -3.03496949696864415e-01, 0.00000000000000000e+00, 2.05640918773932710e-04,
+    -2.24488555080825823e-04, 8.02790424560590897e-05, 2.05507342651612104e-05,
+    8.93558460276511592e-04, -4.60433696903612836e-05, -2.30034519204643240e-02,
+    -4.32630590384808777e-02, 1.73264828326344184e-01, 6.73217011929656106e-01,
+    1.00000000000000000e+00, -3.35910745584735418e-04, 5.29251286629410208e-04,
+    -6.14973617083473399e-04, 3.71299985280409788e-04, -3.64668490914597343e-04,
+    5.04107583588286109e-03, 3.12940871615460976e-03, -8.91973732111429607e-02,
+    -2.68817758996139022e-01, -2.11845239076982772e-01, 0.00000000000000000e+00,
+    -1.70745291572615369e-04, 2.40323847689753864e-04, -2.32758671582165269e-04,
+    2.43013331629739904e-04, -4.15405626796394611e-04, -2.12851590851072464e-03,
+    -8.28312534249323919e-03, 1.71086085623970950e-02, 2.17563857294214152e-01,
+    6.60860215089099756e-01, 1.00000000000000000e+00, -6.88590475555356398e-05,
+    6.08046831103593849e-05, -2.88930310841378401e-05, 7.72547945832648424e-05,
+    2.77430888053777655e-04, -5.84709214964128477e-05, -1.17350948031677057e-02,
+    -7.15569432952089246e-02, -1.69106915033290978e-01, -1.35196952926657094e-01,
+    0.00000000000000000e+00, -2.33311327871454090e-05, 1.72992579177146868e-05,
+    -1.81740475811726707e-05, -1.99423386042272339e-05, -9.71300717676953972e-05,
+    3.37343700666466984e-05, 5.05949263095778305e-03, 4.88320688077112444e-02,
+    2.39902429982306709e-01, 6.54199931653111411e-01, 1.00000000000000000e+00,
+    1.17484617425067794e-04, -1.50368993401634750e-04, 1.49413255275062252e-04,
+    -1.59757567122740325e-04, -6.87432286927805084e-05, -1.65655897150098993e-03,
+    -9.49710337953621996e-03, -3.84495344300158498e-02, -8.18696639519187613e-02,
+    -6.60014707688556940e-02, 0.00000000000000000e+00, 1.04189262125141364e-04,
+    -1.28473700229439687e-04, 1.34958381328757299e-04, -9.18789255461788322e-05,
+    2.85442843619711857e-04, 1.27618687547306872e-03, 9.98654665043010280e-03,
+    5.87408794283547711e-02, 2.46770353295201056e-01, 6.52086034871120157e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA21_transf1_T[121] = {
+    -1.41252118225919043e-01, -5.48107107257419929e-02, -1.63051768996406413e-03,
+    2.12254118831998149e-02, 5.79716456804114846e-03, -1.80931593415200134e-03,
+    -1.77610776187447027e-03, -2.05040001657582184e-03, -7.19041277016602164e-04,
+    1.56229541870569273e-03, 1.48345087696368861e-03, 2.39655692641064622e-01,
+    8.09279076808117753e-02, -1.38122944330554645e-03, -3.35394501653045879e-02,
+    -7.97919414997066111e-03, 3.86124743476565571e-03, 2.74257691775319076e-03,
+    2.41239130355641726e-03, 7.44900031394954941e-04, -2.04163979765926724e-03,
+    -1.82921367696435057e-03, -3.72775374416296323e-01, -8.92562301563528115e-02,
+    1.28353344419263968e-02, 4.25772370079253379e-02, 7.17643024188118275e-03,
+    -6.32030526070685630e-03, -2.85784197483454324e-03, -1.94311211358011589e-03,
+    -7.53915096804931985e-04, 2.02536682910306725e-03, 1.92154282554837970e-03,
+    5.93873694602406799e-01, 4.60121968560306058e-02, -3.71612226122404812e-02,
+    -3.61038017747330811e-02, -3.53203954552624034e-03, 4.51687493025617129e-03,
+    2.66728935561410564e-03, 2.64616593968192019e-03, 2.56336923119501920e-04,
+    -2.29739447208740901e-03, -1.30817581289954365e-03, -9.68954094512969211e-01,
+    1.79287463685020521e-01, 5.07551470247663630e-02, -2.74089393276540708e-02,
+    1.40710869473691814e-02, 4.84269618483584158e-03, -7.31142806276791068e-03,
+    8.46040443806922796e-04, -1.12607623295851397e-03, -1.28497782333937701e-03,
+    4.06414661217273723e-03, 1.44521979206656837e+00, -9.88375208874590627e-01,
+    1.24966109578012199e-01, 1.58795840999478050e-01, -5.17255224555097232e-02,
+    5.80239306475693606e-02, -2.75169333893258081e-02, -1.50713958965803460e-02,
+    6.01631307700950784e-03, -2.30170174276066591e-02, 1.81703997223457148e-02,
+    -1.04530834170353026e+00, 3.11015988862871184e+00, -7.73904329114528777e-01,
+    2.83175173331663477e-01, -2.98687174979706149e-01, -1.97285746715735566e-01,
+    -2.97456290196424743e-02, -2.09541693905731158e-01, 1.02435221745671060e-01,
+    -1.15668136960143067e-01, 1.42188850215923562e-01, -3.69253606421378144e+00,
+    -4.93648758427714363e+00, -4.81171155929843941e-01, -2.60169289675987514e+00,
+    4.03804077212619073e-01, -1.47428431376606994e+00, 7.05233254981713964e-01,
+    -8.23302593415586315e-01, 8.10533680285370539e-01, -3.73392945061016834e-01,
+    8.36354988261156729e-01, 9.57508041638600993e+00, -4.77428256189261191e+00,
+    6.22289586895551583e+00, -2.40508449067249552e+00, 4.74018743343820681e+00,
+    -1.35961125402940586e+00, 3.98926174266512223e+00, -7.55253223306200705e-01,
+    3.62372888566980000e+00, -3.40049208151447235e-01, 3.51352614979380329e+00,
+    1.15680619864981864e+01, 1.05577824047246231e+01, 1.05750628670203888e+01,
+    6.72026562479922251e+00, 9.96257534066053552e+00, 4.37837048813894292e+00,
+    9.57403538599440296e+00, 2.66856249070757023e+00, 9.35529882199100804e+00,
+    1.26836383397809693e+00, 9.28442701824178229e+00, 5.46703443806614864e+00,
+    1.76032980318069114e+01, 9.23595404404188436e+00, 1.37187257141666059e+01,
+    1.16029782674371909e+01, 1.01548327984372744e+01, 1.31123697248751370e+01,
+    6.72050582218758930e+00, 1.39626435483485825e+01, 3.34747641819011843e+00,
+    1.42380399544621117e+01,
+};
+
+static const real_t RadauIIA21_transf2_T[121] = {
+    1.16156221441051404e+01, 2.15743233556066105e+00, -2.12611010815443748e+01,
+    3.07046365638931462e+00, 5.06945108295151403e+00, -4.77689120534618095e+00,
+    3.16506277933720792e+00, -1.99701354288880228e+00, 1.28068852210814721e+00,
+    -8.05837935746041345e-01, 3.02005582082712110e-01, 7.77054416019167427e+00,
+    2.37977119898419041e+01, 3.66855053859950342e+00, -1.42592037041074082e+01,
+    7.14957171283677706e+00, -1.99682374516970729e+00, 1.03270001203059958e-01,
+    3.98139368717357445e-01, -4.47195800995423554e-01, 3.53018338255594755e-01,
+    -1.43311952892401423e-01, -3.75000073918502537e+01, 3.31410361139271572e+02,
+    3.91553497599954255e+02, -3.41148502221526115e+01, -4.74310831838971936e+01,
+    7.58458731406549003e+00, 5.62599855399669302e+00, -4.76835688537298541e+00,
+    2.43459854773248185e+00, -1.04541960087613117e+00, 2.99196222356639618e-01,
+    -4.16652267418250233e+02, -4.90936617940200563e+02, 7.46506886941740362e+01,
+    1.71992211146914372e+02, -2.74981668523090477e+01, -6.65602793422616390e+00,
+    -6.79842966722983166e-01, 5.34360187478122217e+00, -5.68890562062428007e+00,
+    4.36673450314316991e+00, -1.74832246525802870e+00, -1.64124812200197334e+03,
+    -3.80992727473111790e+03, -2.44561898530556209e+03, -1.16679030570528468e+02,
+    1.79422127547994336e+02, 2.46380281306312483e+01, -1.32324811036022876e+01,
+    7.74637138082217902e+00, -1.02154806335799613e+01, 9.76222817314976865e+00,
+    -4.24961285194006688e+00, 3.27283398968545953e+03, 2.61246901278425958e+03,
+    -6.71368901052225283e+02, -8.20696240244118485e+02, -7.90707225994413534e+01,
+    4.51845450474008388e+01, -7.70485591582069862e+00, 1.14539822930811148e+01,
+    -1.13216385607256385e+01, 7.76848323851666223e+00, -2.89299895195752654e+00,
+    1.13972406970821667e+04, 1.61964054377009397e+04, 8.09020272351126277e+03,
+    1.28424361637487323e+03, -1.56611308482291520e+02, -4.63472065017375314e+01,
+    -3.23850657754286360e+01, 2.50213199437279386e+01, -2.43277283295202800e+01,
+    2.01803256782429798e+01, -8.27895823517710916e+00, -9.33355331931108412e+03,
+    -5.93868620393390211e+03, 1.83672820430396382e+03, 1.92427573127460869e+03,
+    4.31454530525681434e+02, 1.36618776245273033e+01, 2.18551258612050381e+00,
+    -1.21674830515653554e+01, 1.20663394882472801e+01, -1.25697375647884027e+01,
+    5.90965724745051180e+00, -3.06052847084742716e+04, -3.58143326584480455e+04,
+    -1.61286149763595240e+04, -3.59697000923709447e+03, -4.06959702703101243e+02,
+    -1.92246730315391261e+01, 1.00646283139374120e+01, -5.80233395862275536e+00,
+    8.96975607630363569e+00, -8.97687368966372823e+00, 4.45499364702754796e+00,
+    1.04790965717453837e+04, 5.88248806192003394e+03, -1.97498622885586383e+03,
+    -2.00539902042142285e+03, -5.50509674639902642e+02, -1.29331543574058998e+02,
+    2.19638153158385165e+01, -3.88758996857222243e+01, 3.76001557170774419e+01,
+    -3.28504492038180089e+01, 1.42753902957205074e+01, 2.08751765186418233e+04,
+    2.30942867020033918e+04, 1.01137388416354133e+04, 2.46044980999851305e+03,
+    4.26510515738344168e+02, 3.81261552939261037e+01, 2.67618572317596097e+01,
+    -2.01999869376655745e+01, 2.18581658169559745e+01, -1.91144226251068510e+01,
+    8.47237563565027507e+00,
+};
+
+static const real_t RadauIIA23_c[12] = {
+    1.00182804616804066e-02, 5.20354511271805542e-02, 1.24619225144443069e-01,
+    2.22840607043837846e-01, 3.40008157914665210e-01, 4.68137613089584015e-01,
+    5.98497279767139179e-01, 7.22203284890967967e-01, 8.30824899622818580e-01,
+    9.16958386552594873e-01, 9.74726379602479653e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA23_A[144] = {
+    1.28468104978648259e-02, 2.76708435717247098e-02, 2.46610607049230005e-02,
+    2.61869225060604623e-02, 2.52631998071592527e-02, 2.58648569681953593e-02,
+    2.54621187987015482e-02, 2.57306118346561190e-02, 2.55580034515043540e-02,
+    2.56599367291042574e-02, 2.56101212864913719e-02, 2.56240496036346486e-02,
+    -4.86767191626658480e-03, 2.91575487226817531e-02, 6.27727172030030645e-02,
+    5.55964259368231101e-02, 5.93604274835720230e-02, 5.70483328991812227e-02,
+    5.85501916913120923e-02, 5.75661197969384239e-02, 5.81920967759589763e-02,
+    5.78248595556743808e-02, 5.80036207647202443e-02, 5.79537401458691953e-02,
+    3.69701439614477561e-03, -7.86586914583481921e-03, 4.36253654711897879e-02,
+    9.35095102424598756e-02, 8.29098687642028792e-02, 8.84387940001911954e-02,
+    8.50918161348751950e-02, 8.72043311560928291e-02, 8.58896417159507042e-02,
+    8.66507406017873877e-02, 8.62831562589072565e-02, 8.63853196566542886e-02,
+    -3.06945234762891726e-03, 5.45623603178471868e-03, -1.02833552689759553e-02,
+    5.52409718643392111e-02, 1.17738339158937513e-01, 1.04716750487765867e-01,
+    1.11360319696331964e-01, 1.07470583022929389e-01, 1.09796051617481807e-01,
+    1.08480612856707251e-01, 1.09107535768493608e-01, 1.08934439513096226e-01,
+    2.63889126427294335e-03, -4.36275244538354267e-03, 6.70426625807702976e-03,
+    -1.20663093170696421e-02, 6.32109740826506394e-02, 1.33810193585640086e-01,
+    1.19527112349676334e-01, 1.26554714419835485e-01, 1.22662501165042445e-01,
+    1.24777509890046864e-01, 1.23791370786467902e-01, 1.24060780402004980e-01,
+    -2.30279942377861757e-03, 3.67032170295594241e-03, -5.17109082934296294e-03,
+    7.51881938426431258e-03, -1.31178359242801676e-02, 6.69918929612609987e-02,
+    1.40631733081430732e-01, 1.26330227627598907e-01, 1.32984966283181405e-01,
+    1.29631011163608728e-01, 1.31137267999388851e-01, 1.30732830276066553e-01,
+    2.01619025322835816e-03, -3.14728622213144649e-03, 4.23710113519743144e-03,
+    -5.61589517038224226e-03, 7.88389739240234928e-03, -1.33737507551443396e-02,
+    6.63259500929239548e-02, 1.37738156660273253e-01, 1.24663122368040877e-01,
+    1.30212745183091949e-01, 1.27890699342168956e-01, 1.28495669076353874e-01,
+    -1.75356762862261830e-03, 2.70279605984309872e-03, -3.54377182531146005e-03,
+    4.47234867016917028e-03, -5.71108727495074631e-03, 7.78512373667848614e-03,
+    -1.28176199783742086e-02, 6.12584290810067669e-02, 1.25324473632064309e-01,
+    1.14642177257679709e-01, 1.18432514772864844e-01, 1.17501557572492921e-01,
+    1.49605373271751298e-03, -2.28754043814499448e-03, 2.95124735863396557e-03,
+    -3.62041635667073288e-03, 4.39896768226671984e-03, -5.45611524906796253e-03,
+    7.22528170204296809e-03, -1.14829166132147543e-02, 5.21344423857683092e-02,
+    1.04230227160451133e-01, 9.69538577630327109e-02, 9.84992674130448220e-02,
+    -1.22368395464923893e-03, 1.86179278059606275e-03, -2.37837134251743087e-03,
+    2.86910505739717582e-03, -3.39044280566007210e-03, 4.00823863087306550e-03,
+    -4.84435707006649306e-03, 6.21879511331711876e-03, -9.44494048692506860e-03,
+    3.95748005001397354e-02, 7.58737553624783956e-02, 7.27818344269975659e-02,
+    9.02345917096023724e-04, -1.36899876054780113e-03, 1.73912670937159957e-03,
+    -2.07857171691229643e-03, 2.41988962349350958e-03, -2.79179640807527716e-03,
+    3.23367767451624832e-03, -3.82047738830290163e-03, 4.74525740765263833e-03,
+    -6.78032485771443063e-03, 2.44275003305121884e-02, 4.20860674693404879e-02,
+    -3.61850328698057366e-04, 5.48359269636872725e-04, -6.95070429805002676e-04,
+    8.27695943359451464e-04, -9.58040075128701717e-04, 1.09509223208533748e-03,
+    -1.24894440623116642e-03, 1.43471017983729074e-03, -1.68071669290216085e-03,
+    2.05409051201785146e-03, -2.78502083304667768e-03, 6.94444444444444406e-03,
+};
+
+static const real_t RadauIIA23_b[12] = {
+    2.56240496036346486e-02, 5.79537401458691953e-02, 8.63853196566542886e-02,
+    1.08934439513096226e-01, 1.24060780402004980e-01, 1.30732830276066553e-01,
+    1.28495669076353874e-01, 1.17501557572492921e-01, 9.84992674130448220e-02,
+    7.27818344269975659e-02, 4.20860674693404879e-02, 6.94444444444444406e-03,
+};
+
+static const real_t RadauIIA23_eig[12] = {
+    5.69357760583048478e+00, -1.94846293682976857e+01, 9.66460291603877764e+00,
+    -1.55269887259769011e+01, 1.22232279801269357e+01, -1.19133708537901626e+01,
+    1.39287203046513799e+01, -8.44249696607331046e+00, 1.49894720849360663e+01,
+    -5.04267301319419836e+00, 1.55003991084163584e+01, -1.67740907542671547e+00,
+};
+
+static const real_t RadauIIA23_transf1[144] = {
+    -2.67401382057801925e+02, -1.59587145529391023e+02, -2.03415061801330717e+03,
+    1.01659600827665163e+04, 8.83470961985550966e+04, -5.21889670123635515e+04,
+    -4.72214196495039738e+05, -6.84881510150060203e+04, 9.18360632703548064e+05,
+    8.39836314484207309e+05, -5.32211366101350402e+05, -1.90299735781287518e+06,
+    -1.12928090745790712e+02, -5.45595932332225630e+02, -1.17313614090278879e+04,
+    1.02822008098130373e+04, 1.38722052076627209e+05, -4.63941168310647663e+03,
+    -5.28004551589057897e+05, -2.87459919734285970e+05, 8.68864640376062598e+05,
+    1.22212979722676659e+06, -4.67724492170914891e+05, -2.28245255586925009e+06,
+    5.03702638634299205e+02, -1.89562170227231405e+02, -1.06042005054320125e+04,
+    -4.51870715430456767e+03, 5.75083836334572916e+04, 6.30570420565585518e+04,
+    -1.44316642925728200e+05, -2.92305992036482552e+05, 1.87851250060438324e+05,
+    7.28794950831561000e+05, -9.09539062134003325e+04, -1.12405574242296955e+06,
+    2.18468136136864501e+01, 3.85142431103679655e+02, 2.00087771639473908e+03,
+    -5.33238093856502110e+03, -1.36286997159205566e+04, 2.92748911101555532e+04,
+    3.75369343949716786e+04, -9.74990997865185345e+04, -5.25288528941406767e+04,
+    2.11870738079198345e+05, 2.66086895285960381e+04, -3.08772189139144728e+05,
+    -1.97794346237513594e+02, -1.36821966586835458e+02, 1.66714245903179494e+03,
+    1.26292566496583640e+03, -8.37710819834719223e+03, -2.06107316956354680e+03,
+    2.31802122336202629e+04, -4.98384054033807479e+03, -3.16087701384976208e+04,
+    2.81950759052183421e+04, 1.53253351350652629e+04, -5.56118097686079054e+04,
+    1.44095480698985398e+02, -3.93589160074825761e+00, -4.98810890149497709e+02,
+    2.31235208957665463e+02, 2.56584983429283966e+02, -2.09909780923117114e+03,
+    2.19301389363943827e+03, 3.23908558915998628e+03, -6.73636463826636827e+03,
+    1.28290781589342373e+03, 4.65340422520755692e+03, -6.83251577324985010e+03,
+    -7.90996977996815787e+01, 3.86259439818883692e+01, -6.48436593665739309e+01,
+    -6.68803334336869852e+01, 5.49036508063516976e+02, 3.09275646675592725e+02,
+    2.70247000473468347e+02, 5.08982568643252648e+02, -6.07217435965421373e+02,
+    -1.26799871295942762e+03, -8.19713165939101600e+01, -1.35667559021745456e+03,
+    4.16954145996318033e+01, -3.76907131758394769e+01, 9.27828560223231307e+01,
+    -1.09105426983692865e+02, -2.04445622564248225e+02, -1.70682885959097945e+02,
+    -6.81478064744467019e+02, 1.38798185953861747e+02, -2.21106473796812423e+02,
+    7.30880790141903049e+02, 9.89975824674384739e+02, 4.99851688254404223e+02,
+    -2.29176967156457252e+01, 2.97885168442315553e+01, -3.39333454446085980e+01,
+    1.43128702071681431e+02, 2.11703610578028901e+02, 2.41511024050137053e+02,
+    5.82541946444359155e+02, -1.83029365515042173e+02, 1.54427495997969942e+02,
+    -9.32166743376859358e+02, -9.16245435001244687e+02, -6.24611910027322779e+02,
+    1.33631439540470769e+01, -2.20590757171598604e+01, -2.24115464451883817e+00,
+    -1.21681579592672449e+02, -2.49688893362784569e+02, -2.00177729618423029e+02,
+    -5.67678547913066723e+02, 2.11325033365632066e+02, -1.01665124314734328e+02,
+    9.06340347188808778e+02, 9.48622549547729022e+02, 5.96372982729750220e+02,
+    -7.90547761930525539e+00, 1.50991154229568512e+01, 1.34737946521474239e+01,
+    8.65962389739019471e+01, 2.17219915276735492e+02, 1.28360830315791844e+02,
+    4.55699050068510701e+02, -2.25327856736380994e+02, 4.63405804446722058e+01,
+    -7.82133268532334569e+02, -8.23487974214472274e+02, -5.01012700846788050e+02,
+    2.88403384407035857e+00, -5.85546325637189291e+00, -7.13257483589199914e+00,
+    -3.38642943392989935e+01, -9.17030154586897766e+01, -4.67776588640265700e+01,
+    -1.85932082083900525e+02, 1.05276855456505487e+02, -6.94526829095886722e+00,
+    3.36760723399847620e+02, 3.61328906825370780e+02, 2.13098925737790836e+02,
+};
+
+static const real_t RadauIIA23_transf2[144] = {
+    6.44930789174650351e-03, -1.05012575850794744e-02, 1.51008356357506691e-02,
+    -2.12789062713378101e-02, 2.91282275602911533e-02, -3.36570831816823748e-02,
+    7.85707842900943212e-03, 1.28097214572858831e-01, -3.73559646507787724e-01,
+    -3.16505816578250831e-02, 7.63996958829259443e-01, 1.00000000000000000e+00,
+    -1.71318933992457259e-03, 3.20217127236062903e-03, -5.83904030052453862e-03,
+    1.14458493174834121e-02, -2.42856691674480339e-02, 5.38982815007072597e-02,
+    -1.12941739144058681e-01, 1.64825152362397337e-01, 5.44450267552582176e-02,
+    -6.20473831599452241e-01, -4.10130606925654395e-01, 0.00000000000000000e+00,
+    -1.86862695909001094e-04, 4.30194375485786894e-04, -9.31193756344941403e-04,
+    1.80783786225882583e-03, -2.49284277489308188e-03, -1.11387475175653934e-03,
+    1.96613319226434380e-02, -2.58253923290537313e-02, -1.70105620992375806e-01,
+    1.24677371329360867e-01, 7.23668057223444516e-01, 1.00000000000000000e+00,
+    -9.27996827684688633e-04, 1.42491285649547542e-03, -1.74736349137405433e-03,
+    1.56042843387369824e-03, 2.19321600911714048e-04, -4.53962221162147392e-03,
+    2.80535670530558700e-04, 6.35016965124442501e-02, -9.64759456035471225e-02,
+    -4.30238086274840337e-01, -2.99682541692472826e-01, 0.00000000000000000e+00,
+    -2.53938517566132415e-04, 3.61424179391750858e-04, -3.67999923857954098e-04,
+    2.34742933809463887e-04, -2.61598458628715231e-04, 1.71954504365628242e-03,
+    3.33794564497446287e-04, -3.28899798025720502e-02, -5.45179890752985688e-02,
+    1.99130233833468756e-01, 7.01169268134101409e-01, 1.00000000000000000e+00,
+    6.99852812079563229e-05, -1.48169417864821924e-04, 2.58485728157191366e-04,
+    -2.87699895686709952e-04, -4.23514561654170869e-05, -3.22692084251093860e-04,
+    7.57181474688082244e-03, 5.45166523437287751e-03, -1.14060583942695318e-01,
+    -3.02881614088002349e-01, -2.17729058961595862e-01, 0.00000000000000000e+00,
+    4.26600362611527734e-05, -7.57769043017001462e-05, 9.80051643898381485e-05,
+    -8.24766981111337488e-05, 1.74373194114763426e-04, -2.20470172320793982e-04,
+    -3.53908388720009653e-03, -1.46533567534668768e-02, 1.35001498041645226e-02,
+    2.40327779364637423e-01, 6.87320104804781673e-01, 1.00000000000000000e+00,
+    1.03142498847194803e-04, -1.36074694656472317e-04, 1.26788358926594629e-04,
+    -1.21833689110977981e-04, 1.66732867028470858e-04, 5.04958316890683954e-04,
+    9.89318090287536877e-04, -1.49809200153383504e-02, -9.37521301127573620e-02,
+    -2.02919256764153594e-01, -1.48906276110828267e-01, 0.00000000000000000e+00,
+    5.59718695431403216e-05, -7.01938105594492691e-05, 6.84533181628062579e-05,
+    -6.86093198736081850e-05, 5.13521600418713288e-06, -3.56732663800206817e-04,
+    -1.02610206524855318e-03, 2.59524244198511972e-03, 5.21090040517648845e-02,
+    2.63110715864440403e-01, 6.79111122028262404e-01, 1.00000000000000000e+00,
+    -3.36492108043639441e-05, 5.06593557251927551e-05, -5.45912068232024238e-05,
+    6.25901734053299668e-05, -4.32634072395195543e-05, -1.06239290506054376e-04,
+    -2.22696654074360564e-03, -1.52894217738545456e-02, -5.96815405252192760e-02,
+    -1.17098230653817012e-01, -8.70267683382947577e-02, 0.00000000000000000e+00,
+    -3.25923771500611433e-05, 4.34271389690745998e-05, -4.55259835657283225e-05,
+    4.51990444135410335e-05, -2.36354847130531251e-05, 2.00053044873483920e-04,
+    1.51963123687574300e-03, 1.20741211343547358e-02, 6.97138499039598736e-02,
+    2.73386192784896953e-01, 6.75260129897231609e-01, 1.00000000000000000e+00,
+    -3.84767350868616900e-05, 4.81926256576251097e-05, -5.01604466408421234e-05,
+    3.95920512585956242e-05, -7.26943576325959066e-05, -1.69153873363909633e-04,
+    -1.26678830492807110e-03, -6.03513274161012695e-03, -2.03560093682135998e-02,
+    -3.83157041439393525e-02, -2.86498243053656468e-02, 0.00000000000000000e+00,
+};
+
+static const real_t RadauIIA23_transf1_T[144] = {
+    7.01004943117025658e-02, 1.15908197492375895e-01, 1.26030425254214911e-02,
+    -1.18701358196008858e-02, -3.93770900248347974e-03, -2.16981768636889932e-03,
+    -2.76580520322779340e-04, 1.79680024467276348e-03, 1.00867074329703365e-03,
+    -2.22136069988922456e-04, -4.40653629090486136e-04, -6.51075499456406121e-04,
+    -1.22182845435223092e-01, -1.86381301299952173e-01, -1.79669480425213718e-02,
+    2.04508401661338025e-02, 6.18296736644949156e-03, 2.49467171037630071e-03,
+    9.33348912259043394e-05, -2.53509264707637346e-03, -1.30762672989738981e-03,
+    4.05392564282222102e-04, 5.92299238510574371e-04, 8.19850008802238349e-04,
+    1.99749315727311111e-01, 2.60989156419575485e-01, 1.81316753377801544e-02,
+    -3.13462092505813680e-02, -7.57758330593373726e-03, -1.22458958221188254e-03,
+    2.94676187626245658e-04, 2.59340789239501015e-03, 1.30136470712769706e-03,
+    -4.73105670596184625e-04, -6.21531326649187011e-04, -8.53872640390355747e-04,
+    -3.44171235979602141e-01, -3.49443770706028833e-01, -6.75671962513874676e-03,
+    4.31511992979725367e-02, 6.29679194858944434e-03, -7.20041789058533505e-04,
+    -1.20214308956200126e-04, -2.39329665288565358e-03, -1.34403926333410170e-03,
+    5.92219291270248971e-04, 6.34191161632994844e-04, 6.89509883328999181e-04,
+    6.39041086823627591e-01, 4.29280376053317092e-01, -2.74977395761772658e-02,
+    -3.65866854776762118e-02, -2.69302899557193921e-03, -3.63419095642401315e-03,
+    1.02115372542065184e-03, 3.79452063271060311e-03, 2.95137393090435748e-04,
+    -6.22600419954761892e-04, -2.44421270947965436e-04, -1.16643793279497406e-03,
+    -1.24181725371025720e+00, -3.48921742867872253e-01, 5.97215057261127336e-02,
+    -6.11687667768254090e-02, 2.48627415619738432e-02, 1.65412388916906378e-02,
+    -7.33397642411771650e-03, 5.17210440054989215e-03, -4.81150430264230301e-03,
+    -3.39135705603409686e-03, 3.38464228071713117e-03, -2.28638175483758836e-03,
+    2.24536281322360365e+00, -4.89950295647265277e-01, 1.85663091639223704e-01,
+    3.07992544960036918e-01, -8.61257900554090461e-02, 9.65286363102488831e-02,
+    -5.76472245752424894e-02, -1.60987700084188126e-02, -4.15086418704421669e-03,
+    -3.85553499897746260e-02, 2.56798128685211853e-02, -1.70866810842220454e-02,
+    -2.48222557209321604e+00, 3.43437154543159817e+00, -1.23558228784034685e+00,
+    2.12728105750430524e-01, -4.66969431096407483e-01, -3.25193579730637172e-01,
+    -7.76261359648335453e-02, -3.32375964733935492e-01, 1.16000868704137339e-01,
+    -2.16093401849111799e-01, 1.97277082898044964e-01, -7.32937257986598506e-02,
+    -3.18773200507194998e+00, -6.96868427407396318e+00, -1.46022360963265208e-01,
+    -3.57362976458155845e+00, 6.92460226823748304e-01, -2.04368154313488271e+00,
+    9.79541884732966106e-01, -1.19187222454268738e+00, 1.08204095540012935e+00,
+    -6.31826117212492933e-01, 1.11473785174932405e+00, -1.98587624950134961e-01,
+    1.19094975985043785e+01, -4.14941576549223967e+00, 7.88525920158911386e+00,
+    -2.22221612418734304e+00, 6.04235523930740204e+00, -1.32987869612641263e+00,
+    5.06060362979722012e+00, -7.97439023746545295e-01, 4.53437881830836709e+00,
+    -4.28459353208974547e-01, 4.30186620875876802e+00, -1.35328225477318653e-01,
+    1.23411188442542272e+01, 1.25510871422371348e+01, 1.16471318623169466e+01,
+    8.34007299953104564e+00, 1.11644388421181091e+01, 5.69193759697609636e+00,
+    1.08306302838844175e+01, 3.72862402798064085e+00, 1.06183647423372722e+01,
+    2.12005001336288412e+00, 1.05148589907073635e+01, 6.88603759044264074e-01,
+    5.69357760583048478e+00, 1.94846293682976857e+01, 9.66460291603877764e+00,
+    1.55269887259769011e+01, 1.22232279801269357e+01, 1.19133708537901626e+01,
+    1.39287203046513799e+01, 8.44249696607331046e+00, 1.49894720849360663e+01,
+    5.04267301319419836e+00, 1.55003991084163584e+01, 1.67740907542671547e+00,
+};
+
+static const real_t RadauIIA23_transf2_T[144] = {
+    3.85137252422614873e+00, 2.42381820221631088e+01, 1.59231605975791020e+01,
+    -1.79096120628544178e+01, 3.73668742650076569e+00, 2.17708981389270662e+00,
+    -2.91935703850065620e+00, 2.35831605743212824e+00, -1.72520693661096103e+00,
+    1.22770390687901298e+00, -8.23192873954772031e-01, 3.16724730215187045e-01,
+    -1.48491133674935600e+01, -1.28783594683866784e+01, 2.11983959373596633e+01,
+    6.35457711016667659e+00, -1.12431939016228846e+01, 6.75917660014646060e+00,
+    -3.20653325043509208e+00, 1.45079275429068644e+00, -6.72073196179980736e-01,
+    3.27084306444107298e-01, -1.65184825743407232e-01, 5.54661314042171477e-02,
+    -5.30673509600439615e+02, -8.16254571593397941e+02, -9.66345353645303504e+01,
+    3.05339228394096210e+02, -1.04551482218600142e+01, -2.51461842613755167e+01,
+    1.23100717484271138e+00, 7.74544308981693153e+00, -7.62442927936157044e+00,
+    5.58365833697868474e+00, -3.63046115015649384e+00, 1.36588352077111885e+00,
+    1.99304461731096694e+02, -2.47477805515994532e+02, -6.22803704170880792e+02,
+    -6.11905307263045231e+01, 1.13878315121475879e+02, -1.64734456193576300e+01,
+    -4.94241711980087750e+00, 1.15452033017034084e+00, 2.56029914772411926e+00,
+    -3.61982585819846703e+00, 3.12750662266357127e+00, -1.30954540204488801e+00,
+    5.84079868604453441e+03, 6.00991315561545616e+03, -1.65732664495501950e+02,
+    -1.76891924055718550e+03, -2.67186521706285305e+02, 9.66020528828495060e+01,
+    1.03883006997923975e+01, -1.59807714455685046e+00, -9.93729540075853013e-01,
+    -2.29018524411073088e+00, 3.86467687680478456e+00, -1.93463160357612241e+00,
+    1.42308020803475551e+03, 5.47800569928643290e+03, 4.99725665439175737e+03,
+    6.70943894716409091e+02, -4.29032764365597529e+02, -7.75770303509048063e+01,
+    3.54272477087848969e+01, -1.55213804359721603e+01, 1.87898283402926438e+01,
+    -1.86089596074955956e+01, 1.42680934580280674e+01, -5.71253704311310262e+00,
+    -2.26138996226626768e+04, -1.85745448769894647e+04, 1.72511181866539710e+03,
+    5.07370296988873633e+03, 1.37567802727322760e+03, 1.20621476410076021e+01,
+    -2.00874116537384761e+00, -4.01979774455301850e+01, 3.64109864580429061e+01,
+    -3.65310760542907573e+01, 3.10972509684950857e+01, -1.31126729471769874e+01,
+    -1.86238164236664052e+04, -3.18963586594599110e+04, -1.99402195367878267e+04,
+    -3.92458005192487235e+03, 4.76017673281566886e+02, 2.39858376142986288e+02,
+    3.53244064556777815e+01, -1.43999672823734226e+01, 8.92905266732860348e+00,
+    -6.97037942227105844e+00, 2.67150099969578037e+00, -3.89615556810022023e-01,
+    3.81056875759959585e+04, 2.74317054275029732e+04, -3.43558377510809123e+03,
+    -7.41974999080917496e+03, -2.46279784823590717e+03, -4.29581468020825298e+02,
+    -1.08261778286037806e+01, -2.79868182169145250e+01, 2.80489364548578628e+01,
+    -2.43661418184912577e+01, 1.85462827511569657e+01, -7.20586847372847128e+00,
+    6.88477106481961382e+04, 9.07609627732751105e+04, 4.74646752876147220e+04,
+    1.16385262968146162e+04, 1.05247146594447122e+03, -5.89300980620430011e+01,
+    -8.82347010113138737e+01, 3.93444421426274573e+01, -5.27520331594467393e+01,
+    5.22680089709364850e+01, -4.59396051512739660e+01, 2.00423259210487146e+01,
+    -2.08057645023016048e+04, -1.40750573165577298e+04, 1.95691599570514745e+03,
+    3.82753664514638194e+03, 1.36102480346432412e+03, 3.43886361944450982e+02,
+    4.13496815784317473e+00, 5.96791136597525025e+01, -5.41165571568523873e+01,
+    5.63760408730350449e+01, -4.90545565723455681e+01, 2.15705647734952741e+01,
+    -1.25022402484978185e+05, -1.48774374686717376e+05, -7.23060861809275666e+04,
+    -1.95060683482580644e+04, -3.44048008302184144e+03, -4.03581715867694243e+02,
+    -8.70777292676296781e+01, 3.87059694995164492e+01, -4.61528447835021680e+01,
+    4.45755403131292880e+01, -3.76311122799126423e+01, 1.60822689214226422e+01,
+};
+
+static const real_t RadauIIA25_c[13] = {
+    8.53905498842741882e-03, 4.44464631554077200e-02, 1.06854490883476663e-01,
+    1.92151054529854037e-01, 2.95380884262580246e-01, 4.10545081201457662e-01,
+    5.30950849312817663e-01, 6.49600650277254998e-01, 7.59598889525227028e-01,
+    8.54552543764935835e-01, 9.28942101264411013e-01, 9.78437936834149591e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA25_A[169] = {
+    1.09509892932726418e-02, 2.36035107221010294e-02, 2.10219946047938838e-02,
+    2.23410356752699567e-02, 2.15330222397708999e-02, 2.20684591975585966e-02,
+    2.17009413961793927e-02, 2.19552959579746507e-02, 2.17819032129691684e-02,
+    2.18950783370846641e-02, 2.18275574161702381e-02, 2.18607691313520182e-02,
+    2.18514516339510384e-02, -4.15340282379236727e-03, 2.49484501321641620e-02,
+    5.37900690051845015e-02, 4.75812966842892870e-02, 5.08763365337418158e-02,
+    4.88174187542884455e-02, 5.01885336257023099e-02, 4.92561186035843576e-02,
+    4.98848355951908573e-02, 4.94773464493846113e-02, 4.97193533543265342e-02,
+    4.96006492080381875e-02, 4.96339034409235408e-02, 3.16099936321771443e-03,
+    -6.74453056686048769e-03, 3.76038750694925872e-02, 8.07924980322720920e-02,
+    7.15003919563558105e-02, 7.64297887262068987e-02, 7.33716035221687463e-02,
+    7.53739479862906708e-02, 7.40538697735215745e-02, 7.48974493969288002e-02,
+    7.44009194989717487e-02, 7.46431430811139440e-02, 7.45754750450001030e-02,
+    -2.63292239102052694e-03, 4.69371929679243075e-03, -8.89320459402955128e-03,
+    4.81619231340790974e-02, 1.03000369800199262e-01, 9.13694876184702465e-02,
+    9.74480730381471622e-02, 9.37588439130698781e-02, 9.60930502957221683e-02,
+    9.46374460296101894e-02, 9.54814304718041712e-02, 9.50733815987643144e-02,
+    9.51868577798158644e-02, 2.27442605518530421e-03, -3.77074809050672189e-03,
+    5.82508995185514016e-03, -1.05686518717164057e-02, 5.60074652637181300e-02,
+    1.19124950813776997e-01, 1.06030398955670430e-01, 1.12702855570730967e-01,
+    1.08797218226921039e-01, 1.11132489433151432e-01, 1.09811189331732353e-01,
+    1.10441044613044520e-01, 1.10267114644225728e-01, -1.99856483865400733e-03,
+    3.19389836290074171e-03, -4.52256184141347148e-03, 6.62769464802354102e-03,
+    -1.16945300268769849e-02, 6.06842673329337987e-02, 1.28231058917928936e-01,
+    1.14629426716529717e-01, 1.21306475895815363e-01, 1.17613250688864107e-01,
+    1.19618608369394058e-01, 1.18683992787358653e-01, 1.18939273830356018e-01,
+    1.76775301776538806e-03, -2.76623995262784052e-03, 3.74149023389951400e-03,
+    -4.99553800901186840e-03, 7.08920232878540533e-03, -1.22122538673888406e-02,
+    6.19204460728482800e-02, 1.29790152186488594e-01, 1.16666568288407005e-01,
+    1.22758421007327811e-01, 1.19692844722480873e-01, 1.21068318630351779e-01,
+    1.20699171143845568e-01, -1.56157428269184544e-03, 2.41208608515891369e-03,
+    -3.17569435987471744e-03, 4.03419053129478074e-03, -5.20221304092057055e-03,
+    7.19372411178054606e-03, -1.20937817345123707e-02, 5.96441111367703239e-02,
+    1.23711091243659352e-01, 1.12024547369187419e-01, 1.16974245376961619e-01,
+    1.14905933331307164e-01, 1.15444431443497711e-01, 1.36640381705946021e-03,
+    -2.09303129092896795e-03, 2.70956220446346568e-03, -3.34218866104697828e-03,
+    4.09463024380518712e-03, -5.14166633236053626e-03, 6.93675412293533362e-03,
+    -1.13451798183543534e-02, 5.39874868566474556e-02, 1.10345003163421690e-01,
+    1.00975787101889536e-01, 1.04294820794747653e-01, 1.03480305727938537e-01,
+    -1.17055539244203806e-03, 1.78325212145434694e-03, -2.28370560259111201e-03,
+    2.76600534139377283e-03, -3.28882758954641930e-03, 3.92481999435971736e-03,
+    -4.81337997760326961e-03, 6.32695564208109358e-03, -1.00054775856592316e-02,
+    4.52791270814557473e-02, 9.04630917812603713e-02, 8.41654948797796315e-02,
+    8.55017302353083264e-02, 9.60045994716318836e-04, -1.45745199268470507e-03,
+    1.85377726418007129e-03, -2.22014437870859428e-03, 2.59314765360364958e-03,
+    -3.00727108498054056e-03, 3.51312111926605636e-03, -4.21239600782294561e-03,
+    5.37841642124571324e-03, -8.13897309033689495e-03, 3.40243079948129717e-02,
+    6.52045398239739921e-02, 6.25519171655761763e-02, -7.09077172942704117e-04,
+    1.07427258603022264e-03, -1.36104021731708338e-03, 1.61963336348061463e-03,
+    -1.87307997978013868e-03, 2.13900024158559078e-03, -2.43757146538061374e-03,
+    2.80022727177463510e-03, -3.28974794965893351e-03, 4.07032835382517295e-03,
+    -5.80129217154703048e-03, 2.08703908684911878e-02, 3.59512081462477623e-02,
+    2.84534348754081410e-04, -4.30724257585400280e-04, 5.44839164833428786e-04,
+    -6.46699959765261877e-04, 7.44968879724178202e-04, -8.45644304773246892e-04,
+    9.54651719467253289e-04, -1.07970888186259572e-03, 1.23319925044551343e-03,
+    -1.43897045496886675e-03, 1.75405801615356629e-03, -2.37454191417341750e-03,
+    5.91715976331360933e-03,
+};
+
+static const real_t RadauIIA25_b[13] = {
+    2.18514516339510384e-02, 4.96339034409235408e-02, 7.45754750450001030e-02,
+    9.51868577798158644e-02, 1.10267114644225728e-01, 1.18939273830356018e-01,
+    1.20699171143845568e-01, 1.15444431443497711e-01, 1.03480305727938537e-01,
+    8.55017302353083264e-02, 6.25519171655761763e-02, 3.59512081462477623e-02,
+    5.91715976331360933e-03,
+};
+
+static const real_t RadauIIA25_eig[13] = {
+    5.90718754547843883e+00, -2.13724667907769366e+01, 1.00669707738162320e+01,
+    -1.73451013895604937e+01, 1.28027565656812641e+01, -1.36835371252579456e+01,
+    1.46872619820811554e+01, -1.01769443369505108e+01, 1.59369174838045691e+01,
+    -6.75023849009822818e+00, 1.66544961771492446e+01, -3.36581446671059714e+00,
+    1.68888189439781939e+01,
+};
+
+static const real_t RadauIIA25_transf1[169] = {
+    -6.87593769696245971e+01, 3.65929955764258068e+02, 1.50419711775594733e+04,
+    -1.64072772292348486e+03, -1.30104012722663101e+05, -1.23180904286470075e+05,
+    1.19023391184869266e+05, 9.85679446124600247e+05, 1.43810826534840418e+06,
+    -2.74662515852105059e+06, -5.13775242373209912e+06, 3.03590425224820198e+06,
+    3.69577254316981789e+06, -5.63807768981165509e+02, 3.96719974077822201e+02,
+    2.08250891829386055e+04, 1.18002908940157558e+04, -8.11517332400290325e+04,
+    -2.43724457527672843e+05, -3.22927271544971794e+05, 1.29111210803037626e+06,
+    2.63445043786365492e+06, -2.97522257645655703e+06, -6.82790894585561194e+06,
+    2.99018417375149345e+06, 4.57726185467195138e+06, -5.27153611036124175e+02,
+    -4.70842748042873382e+02, -4.74253537705595136e+02, 1.91454722085567555e+04,
+    8.81269630591413734e+04, -1.49737258030777797e+05, -6.16760036779248621e+05,
+    5.09203184554103296e+05, 2.01173558644188684e+06, -9.09758622227636864e+05,
+    -3.87961656057356996e+06, 7.98302118483868544e+05, 2.39752761469766730e+06,
+    4.38238922895805956e+02, -3.09060072251675479e+02, -1.04070967371744664e+04,
+    7.25604116731459044e+02, 7.37878804376866465e+04, 9.76306993592580329e+03,
+    -2.86607397386177036e+05, -5.13791285817509852e+04, 7.16157813897117390e+05,
+    1.08363524854920310e+05, -1.21738711208577314e+06, -1.03730612782872107e+05,
+    7.24006346853842610e+05, 9.85994020499943780e+00, 3.47805616429481177e+02,
+    7.32620753984250427e+02, -4.26119169381320171e+03, 6.52030455883007562e+02,
+    2.26970325719236644e+04, -2.54306815627930264e+04, -7.00629756678147969e+04,
+    1.06428859639889284e+05, 1.21967967700486755e+05, -2.29840251046462508e+05,
+    -1.05004938916680068e+05, 1.47458834332256636e+05, -1.42275948310046772e+02,
+    -1.58141325561188694e+02, 1.09967640493419458e+03, 8.54486413517385586e+02,
+    -5.66595489119193462e+03, 4.64347671703073615e+02, 1.14703650398943664e+04,
+    -9.67890514375886050e+03, -7.31587236602731537e+02, 2.70965445708313891e+04,
+    -2.79229509576333439e+04, -3.06596581713943815e+04, 2.18808569260427903e+04,
+    1.22488369414685906e+02, 4.44379119773452587e+01, -2.64194215376636521e+02,
+    1.27765603792286555e+02, 6.82150978160010055e+01, -1.60543121829817392e+03,
+    1.58068570779214247e+03, 8.61512314090222276e+02, -4.06108248023358556e+03,
+    3.48655083181619284e+03, -1.30542153950258557e+03, -3.68172046113500619e+03,
+    3.87252353718010500e+03, -8.26308566620588465e+01, -1.25329612823556857e+00,
+    -1.32868322569338972e+02, -4.52349675021980318e+01, 2.60218553737204729e+02,
+    4.42317370155386698e+02, 7.04089154107279114e+02, 7.74899298346354158e+02,
+    3.90605237701521219e+02, -9.55401775311071333e+02, -5.84656152979879948e+02,
+    -2.36421260056279289e+03, -5.70397850340525110e+02, 5.37063584727133900e+01,
+    -1.12401010871993510e+01, 1.69424051058535895e+02, -8.58518104814243372e+01,
+    -3.49997364509693440e+01, -3.86550752515433885e+02, -9.00737515781197999e+02,
+    -3.16012443472469272e+02, -1.09944542224391034e+03, 9.28725734438456698e+02,
+    7.41020986443248034e+02, 1.66631099359317386e+03, 1.09099049889938510e+03,
+    -3.56162262796804967e+01, 1.30228087989311252e+01, -1.20577366655135478e+02,
+    1.28543267419424694e+02, 6.84515783194661225e+01, 4.46946897456171769e+02,
+    8.65283921328484553e+02, 2.77816210949010213e+02, 1.02732088269843393e+03,
+    -1.10326470026803645e+03, -7.58188836253343311e+02, -1.83531491400654818e+03,
+    -1.07494587217467893e+03, 2.41130960756300041e+01, -1.13797606132260771e+01,
+    7.48678735841782270e+01, -1.21339495901437473e+02, -1.34093423894776521e+02,
+    -3.99393349724362508e+02, -8.59935771228565500e+02, -1.96594282102014944e+02,
+    -9.29802851788642670e+02, 1.10799311784765632e+03, 8.08321301200036032e+02,
+    1.75573547085465566e+03, 1.06400390235801797e+03, -1.57656197255724138e+01,
+    8.45599513443470308e+00, -4.37442718143483020e+01, 9.25208744844723014e+01,
+    1.39901111732523276e+02, 2.92724319255294802e+02, 7.11276449311484953e+02,
+    8.95681277771673194e+01, 7.17938517874813328e+02, -9.74226177527211121e+02,
+    -7.25004787622162439e+02, -1.46311463291766540e+03, -9.00170875047259642e+02,
+    6.00838284931980038e+00, -3.38287228718626576e+00, 1.56570860987153839e+01,
+    -3.72731245238915676e+01, -6.28308802160716695e+01, -1.15546179056260229e+02,
+    -2.96777125657264719e+02, -2.25648517534803013e+01, -2.87965357995251793e+02,
+    4.23547748931480726e+02, 3.23502645149268517e+02, 6.20446869815921104e+02,
+    3.87405249771284446e+02,
+};
+
+static const real_t RadauIIA25_transf2[169] = {
+    -5.11097282068875749e-03, 8.40584045714979494e-03, -1.23685228986022914e-02,
+    1.83009564837879786e-02, -2.79702310632194001e-02, 4.34295494472042645e-02,
+    -6.22305144880866204e-02, 5.36607382991093132e-02, 9.33116290238308610e-02,
+    -4.19007764534282401e-01, 3.18945121594919404e-02, 7.89459219977589277e-01,
+    1.00000000000000000e+00, -2.01608253468911871e-03, 3.02624508580965181e-03,
+    -3.63331813763457731e-03, 3.43022600113024236e-03, -7.21748352664550695e-04,
+    -9.77887505761186430e-03, 4.23755063944034893e-02, -1.22450057017606945e-01,
+    2.22474659051256490e-01, -1.48580292243015478e-02, -6.56127924316749045e-01,
+    -3.91512057461769647e-01, 0.00000000000000000e+00, -3.36997918182448380e-04,
+    4.51006641589426984e-04, -3.80368769612264394e-04, -4.12009280661864943e-05,
+    1.06739372031733467e-03, -2.18675075353735090e-03, -2.18429248202770768e-03,
+    2.85775853425923043e-02, -4.58383681213094460e-02, -1.88375727446229740e-01,
+    1.62264886925146096e-01, 7.49261107311322228e-01, 1.00000000000000000e+00,
+    6.25862949895084715e-04, -1.01891085021870798e-03, 1.43302634684400686e-03,
+    -1.82255102042065903e-03, 1.69037919957902940e-03, 6.62714568003439758e-04,
+    -7.48829879169698662e-03, 5.11692300452019910e-03, 7.68190830272257041e-02,
+    -1.34609292559501076e-01, -4.61042902563364665e-01, -2.94158561483410574e-01,
+    0.00000000000000000e+00, 1.61680370855813707e-04, -2.53071992076899042e-04,
+    3.19030662461439911e-04, -3.11118465988083879e-04, 1.72811044398673088e-04,
+    -3.70271409754359437e-04, 2.66880838093229824e-03, 7.37299706424060270e-04,
+    -4.54084855010410404e-02, -6.33683963134717282e-02, 2.26897111372839910e-01,
+    7.25959211622556166e-01, 1.00000000000000000e+00, 8.18312638498599121e-05,
+    -9.80116425179759245e-05, 5.94576676606658390e-05, 2.30131601709536671e-05,
+    5.32929435762121282e-06, -4.84866700000227680e-04, -3.59433862630521958e-04,
+    1.12418952083061224e-02, 6.78819564182586797e-03, -1.41884554311624278e-01,
+    -3.32641316847733348e-01, -2.20644155960401267e-01, 0.00000000000000000e+00,
+    2.62819797633880398e-05, -2.81518026434447998e-05, 1.48913110699434383e-05,
+    -8.24799725257954782e-06, 1.88300307115478247e-05, 1.71063734511792180e-04,
+    5.83933275233336713e-05, -5.30245979402579372e-03, -2.24867327127362022e-02,
+    1.06800629790711823e-02, 2.64032492842693811e-01, 7.11085705542817692e-01,
+    1.00000000000000000e+00, -6.51192446482868427e-05, 9.62946657059924704e-05,
+    -1.08518507332722646e-04, 1.00043305649673015e-04, -1.23634989073983647e-04,
+    1.37265277410784876e-04, 9.39648522093730404e-04, 2.46205037889720996e-03,
+    -1.88040832870052625e-02, -1.17577681458641212e-01, -2.33070984452278779e-01,
+    -1.58582272042135319e-01, 0.00000000000000000e+00, -3.60262249322721391e-05,
+    5.03010032927513035e-05, -5.34154990474657691e-05, 5.42675972397889766e-05,
+    -4.79103877925425375e-05, -1.22120594429839935e-05, -6.04920698141682921e-04,
+    -2.64781956670819343e-03, -1.15244630659864762e-03, 5.47226138649174673e-02,
+    2.85868424782089903e-01, 7.01695681488117007e-01, 1.00000000000000000e+00,
+    -9.91318006679329010e-06, 9.61431667038452852e-06, -5.90170206346604275e-06,
+    4.44849624935117743e-06, 1.29570434646796210e-05, 6.11704008537686478e-05,
+    1.45674279289282373e-05, -2.63194733368182082e-03, -2.16540039912510134e-02,
+    -8.18781036670892109e-02, -1.48709497241224287e-01, -1.02856999475302649e-01,
+    0.00000000000000000e+00, -3.56741647190963468e-06, 3.22651325514004912e-06,
+    -2.47287519502997902e-06, -3.31981957851447727e-07, -5.98841291576857956e-06,
+    -2.19728582625225911e-05, -3.12111125148963450e-06, 1.11456890751713070e-03,
+    1.25921577161359228e-02, 7.82933239991065733e-02, 2.97508434580017134e-01,
+    6.96462938815544330e-01, 1.00000000000000000e+00, 2.57441744646467017e-05,
+    -3.44612214790882644e-05, 3.63906113652495789e-05, -3.56659759075588303e-05,
+    2.67084931120844896e-05, -7.88816490351666949e-05, -3.79510095888770669e-04,
+    -2.72202880021706062e-03, -1.31876736100604471e-02, -4.17281734286543901e-02,
+    -7.25348167824016177e-02, -5.06374557256415100e-02, 0.00000000000000000e+00,
+    2.30823473727972176e-05, -3.04240629862554143e-05, 3.23276594435117164e-05,
+    -2.95660202725736939e-05, 3.50634451844342382e-05, 2.21204474997731772e-05,
+    3.85057578757745352e-04, 2.67203237262630434e-03, 1.72628925425950507e-02,
+    8.57285067390704952e-02, 3.01176167184902144e-01, 6.94778444127087225e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA25_transf1_T[169] = {
+    1.28971820284571482e-02, -1.21143474518306149e-01, -1.42482045150792852e-02,
+    4.55280966062851858e-04, 9.50213292619714041e-04, 3.26002510756278957e-03,
+    1.04872525024251304e-03, -6.88953161107765219e-04, -5.07230644352461369e-04,
+    -4.01171142917340748e-04, -1.46063638840347661e-04, 4.16748993235386558e-04,
+    3.89833585581182956e-04, -1.50234465394646216e-02, 1.97530143299463334e-01,
+    2.22133826836445475e-02, -2.43458982454219930e-03, -1.89887315905032210e-03,
+    -4.71773919870745358e-03, -1.39345835352726105e-03, 1.12780565421368318e-03,
+    7.36744008384736812e-04, 4.92766339956372465e-04, 1.69726030468084552e-04,
+    -5.63074436392185080e-04, -5.13826491315056127e-04, 4.58978681433417322e-03,
+    -2.85808536552737413e-01, -2.86851485668798874e-02, 7.82869947744015832e-03,
+    3.27088070566587327e-03, 5.12668995890943387e-03, 1.32309939559499871e-03,
+    -1.44229170323706304e-03, -8.11440504249802907e-04, -4.54622296437466166e-04,
+    -1.63668536667794059e-04, 5.97744058760871265e-04, 5.45975987224056169e-04,
+    3.47947909173595485e-02, 4.11399573001265284e-01, 3.11975636981468643e-02,
+    -1.90622021310157194e-02, -4.29807541470237676e-03, -3.96256919222549592e-03,
+    -1.13927564935737010e-03, 1.38542283069934447e-03, 8.34829808649429576e-04,
+    4.37214541306095764e-04, 1.14516065431093662e-04, -5.95116249083158856e-04,
+    -4.99335163277485881e-04, -1.49799857882182696e-01, -6.02056337408843678e-01,
+    -1.85743772169127928e-02, 3.55310503003133105e-02, 2.13953413610341089e-03,
+    2.43289600001132594e-03, 1.53478799609655281e-03, -1.62422730026684807e-03,
+    -8.51007030379984314e-04, -1.16911211222084561e-04, -1.89629832513553263e-04,
+    4.24660609608097552e-04, 5.92180177272013893e-04, 4.65545176020231488e-01,
+    8.70430954349663444e-01, -3.35088072998395783e-02, -3.12578853463302830e-02,
+    1.89419676793773977e-03, -1.12742529087034981e-02, 1.11551679680224137e-03,
+    3.75695719457263275e-03, -6.07537377947998968e-04, 8.92433317162361463e-04,
+    -1.00445888453672616e-04, -1.38769068651839207e-03, 3.73588232783444269e-04,
+    -1.27327642328948509e+00, -1.07969954066323193e+00, 1.07896093199268114e-01,
+    -1.13271259646842301e-01, 3.90864306249057783e-02, 3.19169943159655634e-02,
+    -8.70511260630503318e-03, 1.43951296589202773e-02, -9.73890486323703529e-03,
+    -3.85119908319848025e-03, 1.22538003559875862e-03, -6.33105452257155116e-03,
+    6.50316773064618398e-03, 2.93404382209922288e+00, 4.23526895508753332e-01,
+    1.98936168114138501e-01, 5.47193029574454148e-01, -1.44389421783820748e-01,
+    1.54016115594137387e-01, -1.02934765805113723e-01, -1.78020592447730719e-02,
+    -2.44318097509012150e-02, -5.98185410326354874e-02, 2.77244275239869331e-02,
+    -4.15825860942381914e-02, 4.51274709537341293e-02, -4.20362296954452219e+00,
+    3.30849922763726667e+00, -1.79388829595694732e+00, -2.17356788896661927e-02,
+    -6.74240312964534128e-01, -5.34441080832717130e-01, -1.38900425553757090e-01,
+    -5.05026724706520436e-01, 1.27803249513705253e-01, -3.52877362219115975e-01,
+    2.54103305164445126e-01, -1.77251193116171935e-01, 2.91549866601239160e-01,
+    -2.15760471194289716e+00, -9.04299869777078236e+00, 4.38438884723990008e-01,
+    -4.62250390596764404e+00, 1.13019241446479568e+00, -2.68361721280535725e+00,
+    1.35344240243103409e+00, -1.61820380437561595e+00, 1.42480650853312807e+00,
+    -9.35493887483048181e-01, 1.44438515503500131e+00, -4.31440902283892369e-01,
+    1.44785322865377597e+00, 1.42114791379587828e+01, -3.19420630082774704e+00,
+    9.63035176419086092e+00, -1.82680450989856902e+00, 7.45661829084339001e+00,
+    -1.15397075620513845e+00, 6.24986482949171052e+00, -7.36130626265803389e-01,
+    5.55968606909822860e+00, -4.40290942523640982e-01, 5.19899182204896082e+00,
+    -2.06672635734883647e-01, 5.08650975782711789e+00, 1.30310621182051616e+01,
+    1.45599558119008847e+01, 1.26449997427972889e+01, 1.00347242322479300e+01,
+    1.23134715625728308e+01, 7.10883640725900889e+00, 1.20577850044203352e+01,
+    4.90754026891393202e+00, 1.18771754514523362e+01, 3.09738968424716621e+00,
+    1.17696756330683918e+01, 1.50082372218987592e+00, 1.17339873490412447e+01,
+    5.90718754547843883e+00, 2.13724667907769366e+01, 1.00669707738162320e+01,
+    1.73451013895604937e+01, 1.28027565656812641e+01, 1.36835371252579456e+01,
+    1.46872619820811554e+01, 1.01769443369505108e+01, 1.59369174838045691e+01,
+    6.75023849009822818e+00, 1.66544961771492446e+01, 3.36581446671059714e+00,
+    1.68888189439781939e+01,
+};
+
+static const real_t RadauIIA25_transf2_T[169] = {
+    -1.67325235720232470e+01, -2.40186095024776236e+01, 1.41334105597817832e+01,
+    1.86995362226858326e+01, -1.50001249793598248e+01, 5.16481039102897377e+00,
+    -4.60029521526515772e-01, -9.38278073772691457e-01, 1.13383784622054051e+00,
+    -9.93988078890548410e-01, 7.84364488530289505e-01, -5.56983213564171797e-01,
+    2.19235241414310805e-01, 1.40754823361978132e+00, -1.97415367256762835e+01,
+    -2.85714477344990847e+01, 1.53364260019055028e+01, 4.60725907905899135e+00,
+    -8.08448802930200294e+00, 5.85827790963423212e+00, -3.60689633373251706e+00,
+    2.19949181014581674e+00, -1.39172293824969984e+00, 9.11439382667543985e-01,
+    -5.83714343575408745e-01, 2.20532295492498254e-01, 4.47258239507800454e+02,
+    1.23529739583702085e+01, -8.37537126852048345e+02, -2.91781833914560877e+02,
+    2.02105401846297923e+02, -9.32564998201976714e+00, -1.21227894584117948e+01,
+    -1.37489138038391312e+00, 7.94312178800805846e+00, -8.56159942310233646e+00,
+    7.10682206564739083e+00, -5.08496853017914408e+00, 1.99933531630300498e+00,
+    6.07631821537193332e+02, 1.19346273568565812e+03, 4.58758243125012996e+02,
+    -4.30654014356001142e+02, -7.50626006958040790e+01, 6.88123651712058972e+01,
+    -8.19565392031874040e+00, -6.86230241914188532e+00, 5.15770269406667747e+00,
+    -1.98257679291165601e+00, 1.91622030909203711e-01, 4.29283034875883096e-01,
+    -2.57719110264530371e-01, 5.65584142716063027e+01, 6.53865391110102610e+03,
+    9.04800091158466603e+03, 2.30982624541600171e+03, -8.60680916430966818e+02,
+    -2.24672683541019609e+02, 6.50472286038044842e+01, -7.74869197626422856e+00,
+    1.37869620440518119e+01, -1.49208289700533800e+01, 1.06745003137988341e+01,
+    -6.30609626041048710e+00, 2.21179692070197431e+00, -9.56098669041007997e+03,
+    -1.20483852984750356e+04, -2.02523585563165420e+03, 3.23130904705829334e+03,
+    8.52931416989605623e+02, -2.03859951657443361e+02, -5.58750802714187955e+01,
+    2.62668319983081773e+01, -1.54573231573897534e+01, 1.89628834274334501e+01,
+    -1.97870222000459002e+01, 1.61242319887484875e+01, -6.66114155500741933e+00,
+    -2.59425115607419430e+04, -5.60077839423687183e+04, -4.46015638786530180e+04,
+    -1.15463785123497946e+04, 1.06337286703894824e+03, 8.36147065162957688e+02,
+    4.52521831373691370e+01, 7.68914362426738229e+00, -3.13616356407425663e+01,
+    3.09482277390386855e+01, -3.32910855337704632e+01, 2.98640650262935097e+01,
+    -1.29326182725693712e+01, 4.91353630711213118e+04, 4.90986004942738437e+04,
+    3.76486452597979451e+03, -1.14988062581944559e+04, -4.03350122458574151e+03,
+    -7.96256651183664133e+01, 9.00127787342285757e+01, 5.80878373416507614e+01,
+    -4.32468668754573571e+01, 4.03597758860484177e+01, -3.64530711816165791e+01,
+    2.67914506941388204e+01, -1.04974901538864600e+01, 1.38405077985787386e+05,
+    2.07205013710304193e+05, 1.27530685061219861e+05, 3.56595913913790064e+04,
+    2.91381071408939943e+03, -6.49529948145513231e+02, -2.94628189363225886e+02,
+    4.23107611109180581e+01, -7.94218230643612770e+01, 7.95177559914868652e+01,
+    -7.44360885362859221e+01, 6.01499659060110545e+01, -2.48649712727830909e+01,
+    -1.13720728975229868e+05, -9.89237297093395318e+04, -3.06810167703287743e+03,
+    2.19034999435065729e+04, 8.88734506403311752e+03, 1.42512267742294057e+03,
+    9.39792961361964245e+01, -4.20278292709653414e+01, 2.46352211984916138e+01,
+    -3.55464526752901264e+01, 3.79955388846691093e+01, -3.56530403741988096e+01,
+    1.60447127275776289e+01, -3.31779194256860646e+05, -4.28747423979630461e+05,
+    -2.33113178222297895e+05, -6.90189312207260518e+04, -1.20347592921348660e+04,
+    -1.25336601433908800e+03, -3.23835098246713926e+01, -6.16434650378707083e+00,
+    2.33211478488528705e+01, -2.23411928078811712e+01, 2.61609952264468042e+01,
+    -2.47661709026200576e+01, 1.14286583309878562e+01, 1.15235971118604226e+05,
+    9.28938272944362980e+04, 8.21784741897569575e+02, -2.01768655375809067e+04,
+    -8.73708242493557555e+03, -2.09422460238664553e+03, -2.27609247776993300e+02,
+    -1.43202209291406547e+02, 1.04764841388423108e+02, -1.14714441292087670e+02,
+    1.10708153968724801e+02, -9.28561844667847254e+01, 3.95637073828455570e+01,
+    2.18829543701607821e+05, 2.71023205936138052e+05, 1.41959459844438650e+05,
+    4.28689743939727268e+04, 8.73115135057054613e+03, 1.29558242045365387e+03,
+    2.29295106426661988e+02, -3.37736968009775396e+01, 6.45983891779705743e+01,
+    -6.36483744505981122e+01, 6.30004919756330750e+01, -5.32998120255307057e+01,
+    2.29385637359453156e+01,
+};
+
+static const real_t RadauIIA27_c[14] = {
+    7.36465102608932151e-03, 3.83981387396783516e-02, 9.25952246990026373e-02,
+    1.67251011391557736e-01, 2.58623540705762489e-01, 3.62131397282238809e-01,
+    4.72584386004117729e-01, 5.84443964021340467e-01, 6.92101001719601649e-01,
+    7.90157028273437478e-01, 8.73694821306689406e-01, 9.38524459100731012e-01,
+    9.81389634989012105e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA27_A[196] = {
+    9.44557819254078328e-03, 2.03697937347772674e-02, 1.81322755764509735e-02,
+    1.92825611391681424e-02, 1.85714954579707693e-02, 1.90488279958033468e-02,
+    1.87151490600572026e-02, 1.89521931797045594e-02, 1.87842660315793407e-02,
+    1.89006194597194782e-02, 1.88238025627431721e-02, 1.88699926785983498e-02,
+    1.88471584240327561e-02, 1.88535816349484561e-02, -3.58521259602177789e-03,
+    2.15830882963055047e-02, 4.65882771144149194e-02, 4.11701685035228415e-02,
+    4.40717173810219742e-02, 4.22352158289455368e-02, 4.34806160626301300e-02,
+    4.26114330229955887e-02, 4.32203588944270814e-02, 4.28015223904494382e-02,
+    4.30766879852501894e-02, 4.29117672773048561e-02, 4.29931307666699403e-02,
+    4.29702677214902004e-02, 2.73296366053420430e-03, -5.84440886454352937e-03,
+    3.27211294922412077e-02, 7.04317043327951087e-02, 6.22397190787585194e-02,
+    6.66411632853936009e-02, 6.38611292035476952e-02, 6.57286230877771743e-02,
+    6.44499638540394632e-02, 6.53166838863553367e-02, 6.47527205624579966e-02,
+    6.50886089812114516e-02, 6.49235460566020273e-02, 6.49698343686711671e-02,
+    -2.28210095062226061e-03, 4.07765169643523658e-03, -7.75844543062069632e-03,
+    4.22840927161173830e-02, 9.06689272847969047e-02, 8.02675481398785751e-02,
+    8.58002816863283474e-02, 8.23566915589741683e-02, 8.46181545460526485e-02,
+    8.31234584521894221e-02, 8.40805595067774109e-02, 8.35163577244437821e-02,
+    8.37918767868086056e-02, 8.37148639455431443e-02, 1.97853845231837694e-03,
+    -3.28760612520765565e-03, 5.10010770724185318e-03, -9.31215754238793984e-03,
+    4.97911335436174510e-02, 1.06286827558457836e-01, 9.43466105673912564e-02,
+    1.00582573578338219e-01, 9.67970475024291926e-02, 9.91934224475522069e-02,
+    9.76981992057150833e-02, 9.85655873224502155e-02, 9.81460687289597150e-02,
+    9.82627592264912197e-02, -1.74751481195548281e-03, 2.79875370480908454e-03,
+    -3.97917830419375947e-03, 5.86796750274094173e-03, -1.04457364153654354e-02,
+    5.48655797360583855e-02, 1.16504028711230903e-01, 1.03769278931046691e-01,
+    1.10246030028986447e-01, 1.06458815738945875e-01, 1.08722036015845402e-01,
+    1.07441873565727417e-01, 1.08052029685834411e-01, 1.07883550302309422e-01,
+    1.55698708585261811e-03, -2.44138538966133349e-03, 3.31477875479686433e-03,
+    -4.45219920253639868e-03, 6.37249430485905492e-03, -1.11084215232593198e-02,
+    5.72529094139527586e-02, 1.20809035939767329e-01, 1.08062434025704646e-01,
+    1.14305831465090088e-01, 1.10857372384968594e-01, 1.12728129562428697e-01,
+    1.11856725454088882e-01, 1.12094674001353894e-01, -1.38995835337620997e-03,
+    2.15098200586755824e-03, -2.84186536754307611e-03, 3.62991165126723197e-03,
+    -4.71830771407776191e-03, 6.59857447672048975e-03, -1.12692100363214961e-02,
+    5.68333813545390115e-02, 1.18986046581233684e-01, 1.07011068693230432e-01,
+    1.12557979422256968e-01, 1.09770518583854143e-01, 1.11020120115773294e-01,
+    1.10684905749785470e-01, 1.23572328701262849e-03, -1.89592308933847725e-03,
+    2.46193402492899793e-03, -3.05140554367966952e-03, 3.76492130414764203e-03,
+    -4.77593785391560756e-03, 6.53800194905555278e-03, -1.09203662659741463e-02,
+    5.36280046136908620e-02, 1.11125734274925045e-01, 1.00669144086750290e-01,
+    1.05089993569422127e-01, 1.03244740531475490e-01, 1.03724881667587837e-01,
+    -1.08615289711527373e-03, 1.65684968672006813e-03, -2.12714880005605888e-03,
+    2.58659859004458292e-03, -3.09360409956837635e-03, 3.72350950201050593e-03,
+    -4.62395617903518883e-03, 6.19263484812816387e-03, -1.00780374622201248e-02,
+    4.77974572362115935e-02, 9.76202426728730588e-02, 8.93570816212281294e-02,
+    9.22804091425902806e-02, 9.15635010628648299e-02, 9.33398605760942706e-04,
+    -1.41831049071526757e-03, 1.80719261676647513e-03, -2.17048554041983496e-03,
+    2.54595372488726187e-03, -2.97122650540602865e-03, 3.50400925070882240e-03,
+    -4.26329240771799751e-03, 5.57327448052908486e-03, -8.78032338699056072e-03,
+    3.96339481579402603e-02, 7.91419456723433529e-02, 7.36447849792130904e-02,
+    7.48102696765606812e-02, -7.67150502781701444e-04, 1.16274279217559056e-03,
+    -1.47433196709210817e-03, 1.75680668609879136e-03, -2.03597745105673928e-03,
+    2.33258848256540823e-03, -2.67186509643597579e-03, 3.09534165679558899e-03,
+    -3.68995012369975400e-03, 4.69215720096997305e-03, -7.08054874776973923e-03,
+    2.95461257348170608e-02, 5.66034615294815566e-02, 5.43038613721814126e-02,
+    5.67321080156402428e-04, -8.58587412293670624e-04, 1.08556444339584740e-03,
+    -1.28766071552956847e-03, 1.48203291619527274e-03, -1.68053645435424959e-03,
+    1.89495960285498023e-03, -2.14098408345567105e-03, 2.44477615431999609e-03,
+    -2.85998054420920659e-03, 3.52809556340751528e-03, -5.01856052596657502e-03,
+    1.80340492141597315e-02, 3.10610084538857287e-02, -2.27769226213927778e-04,
+    3.44498194347974828e-04, -4.35065161728806992e-04, 5.15108814356127361e-04,
+    -5.91228610424023677e-04, 6.67684613340324045e-04, -7.48278191847248490e-04,
+    8.37419620421752981e-04, -9.41367407470927796e-04, 1.07056095899838214e-03,
+    -1.24541807252677656e-03, 1.51503733286801408e-03, -2.04846642667763602e-03,
+    5.10204081632653021e-03,
+};
+
+static const real_t RadauIIA27_b[14] = {
+    1.88535816349484561e-02, 4.29702677214902004e-02, 6.49698343686711671e-02,
+    8.37148639455431443e-02, 9.82627592264912197e-02, 1.07883550302309422e-01,
+    1.12094674001353894e-01, 1.10684905749785470e-01, 1.03724881667587837e-01,
+    9.15635010628648299e-02, 7.48102696765606812e-02, 5.43038613721814126e-02,
+    3.10610084538857287e-02, 5.10204081632653021e-03,
+};
+
+static const real_t RadauIIA27_eig[14] = {
+    6.10953706591082568e+00, -2.32659732506468941e+01, 1.04466532469180926e+01,
+    -1.91718385658013624e+01, 1.33474860189496454e+01, -1.54639361328642106e+01,
+    1.53970406475504671e+01, -1.19224339983808445e+01, 1.68185419175290498e+01,
+    -8.46894658268211131e+00, 1.77208535297202978e+01, -5.06457474842360877e+00,
+    1.81598875734216207e+01, -1.68556744734413266e+00,
+};
+
+static const real_t RadauIIA27_transf1[196] = {
+    4.35072757427216118e+02, -7.34824987141965096e+01, -8.72847042569886980e+03,
+    -1.97517768764293687e+04, -1.39173284295436286e+05, 2.68364005169198208e+05,
+    1.82860250812479155e+06, -7.36901192731161136e+05, -7.07712371014102641e+06,
+    -1.64149136133997305e+06, 1.17893513165985979e+07, 1.17541908841069210e+07,
+    -6.39338599885567557e+06, -2.40962540589566641e+07, 7.12608284992366521e+02,
+    4.41031956780067560e+02, 6.36738849631648645e+03, -3.50302729074588569e+04,
+    -3.72518016039624286e+05, 2.61653360359725601e+05, 2.78604413982245186e+06,
+    -3.66808031625404547e+04, -8.66608976181431673e+06, -4.63015717192653101e+06,
+    1.28927687778842617e+07, 1.76941375315794088e+07, -6.64726973518148717e+06,
+    -3.16490467339797914e+07, -2.28616164932758039e+02, 8.75210989620308851e+02,
+    2.86209978700103238e+04, -1.05317393745318186e+04, -3.25527760807205748e+05,
+    -7.45550525489927531e+04, 1.47474959289753949e+06, 1.08226725788053637e+06,
+    -3.47368622275262652e+06, -4.85578071385046840e+06, 4.40644127898134105e+06,
+    1.18769022114748769e+07, -2.11038219377447478e+06, -1.81530616341019012e+07,
+    -6.64423558255332978e+02, -2.88989732805124220e+02, 8.60355502083423380e+03,
+    1.58889307229743536e+04, -3.00045878644238728e+04, -1.56206276250889845e+05,
+    3.52253290451791836e+04, 7.45252250512084225e+05, 2.35005679775827157e+04,
+    -2.19148776641069353e+06, -9.97317311170365720e+04, 4.34813074551398680e+06,
+    6.30831845755185641e+04, -6.06811452125464845e+06, 3.91037470111954462e+02,
+    -2.95483422228048312e+02, -7.87339855381212692e+03, 2.50404253827954653e+03,
+    5.15956577761643057e+04, -1.85137918577378950e+04, -1.84860414686111937e+05,
+    1.08948317012524290e+05, 3.92406918965442863e+05, -3.91629580990860704e+05,
+    -4.71369181374456617e+05, 8.92076702893751091e+05, 2.19697740490722324e+05,
+    -1.33854106186828692e+06, -4.59054679823217100e+01, 3.03536279846791217e+02,
+    4.50210280226152236e+02, -3.01610574372413748e+03, 4.98651459490300840e+03,
+    1.40817613312651629e+04, -3.69101455203645237e+04, -3.17999266764999884e+04,
+    1.04553446135463659e+05, 9.85147729120176155e+03, -1.50648191905340558e+05,
+    9.64492054130439501e+04, 7.76260514559962903e+04, -2.12748845091249212e+05,
+    -7.42373063469329963e+01, -1.74387120501635138e+02, 6.28589102802227558e+02,
+    5.85703114934515952e+02, -3.83585978707508048e+03, 1.03498862014128667e+03,
+    4.44777169057066749e+03, -7.26338863542508079e+03, 1.07226718049669562e+04,
+    1.45938414654892513e+04, -2.53554162480388259e+04, -2.40496309640854270e+03,
+    1.34535528468834709e+04, -2.92113035688024138e+04, 8.49172900957095607e+01,
+    8.44463735536249089e+01, -1.02325855444989529e+02, 1.24230814384227017e+02,
+    2.99883433934281527e+02, -1.22822298114275918e+03, 1.02259580332426310e+03,
+    -6.74564568087767839e+02, -2.99339217347857493e+03, 2.59016759334278595e+03,
+    -3.72100490759725153e+03, 8.23837373342986780e+02, 5.42398766600185536e+03,
+    -1.18874330705040688e+03, -6.84575818010729051e+01, -3.90581407435396670e+01,
+    -1.87888743474205370e+02, -1.03270409709330650e+02, -1.48925102211910712e+02,
+    4.89081481471845620e+02, 6.41473677965685397e+02, 1.37190104734224292e+03,
+    1.76037512144179050e+03, -1.55900909562623326e+02, 5.47311450167598537e+02,
+    -3.41205181892830342e+03, -2.56149140889912542e+03, -2.42562141720335694e+03,
+    5.10470985576513812e+01, 1.80851905709405720e+01, 2.34691631163535874e+02,
+    -3.69868420651041641e-02, 2.99913263591143846e+02, -4.82850981097940348e+02,
+    -7.69962797356145416e+02, -1.08274202165172073e+03, -2.32285828714469744e+03,
+    3.23495363070284043e+02, -7.42545269182135712e+02, 3.10515803703004030e+03,
+    3.27242545668706225e+03, 2.15981699221588133e+03, -3.75303292750477411e+01,
+    -8.50545190663751249e+00, -1.98953310589223094e+02, 5.54958941330621514e+01,
+    -2.44800106972682784e+02, 5.55082236575152024e+02, 8.07150843126372251e+02,
+    1.04717165643426733e+03, 2.28336804643391361e+03, -5.10193499750202704e+02,
+    6.64250229208666724e+02, -3.30151777683321870e+03, -3.30591990181163101e+03,
+    -2.23380315760616850e+03, 2.73037447280853982e+01, 4.07385793983361388e+00,
+    1.49726528895986490e+02, -6.97157412575126330e+01, 1.38161188562214846e+02,
+    -5.23279271761256496e+02, -8.55816767854720524e+02, -9.03023072952677353e+02,
+    -2.13107177375700894e+03, 6.15131800908182868e+02, -5.01953817998121224e+02,
+    3.17275038772559719e+03, 3.22843041905019209e+03, 2.10342078020660983e+03,
+    -1.86519396527123078e+01, -1.96898110473722054e+00, -1.02313378160988634e+02,
+    5.96909516209291056e+01, -6.26899445764735006e+01, 4.05615590475417832e+02,
+    7.42415517233405467e+02, 6.51004489228468742e+02, 1.70433550655699946e+03,
+    -6.17878595621036993e+02, 3.14867842975878943e+02, -2.64498706644662207e+03,
+    -2.71179567181318225e+03, -1.71970479605142123e+03, 7.23859642820554861e+00,
+    6.38240331790994819e-01, 3.95506443867464839e+01, -2.50705051036405635e+01,
+    1.80149816847798014e+01, -1.64696494969081954e+02, -3.16914616919083983e+02,
+    -2.54420057519961205e+02, -7.03213239278938545e+02, 2.83906185140885441e+02,
+    -1.06857368956490404e+02, 1.12225528427683912e+03, 1.16068100265478097e+03,
+    7.22791318183059502e+02,
+};
+
+static const real_t RadauIIA27_transf2[196] = {
+    2.44595208654024322e-03, -4.09640675980127000e-03, 6.23294011504911712e-03,
+    -9.70792980852110653e-03, 1.60091832320713272e-02, -2.80712645890365438e-02,
+    5.08698662085997136e-02, -8.68805244898246676e-02, 1.04700463303876404e-01,
+    4.17712737034733675e-02, -4.49715203226331850e-01, 9.46629696252953429e-02,
+    8.10715093533689535e-01, 1.00000000000000000e+00, 3.87081053088419742e-03,
+    -6.13254442567117905e-03, 8.39323711868167170e-03, -1.10419435889968533e-02,
+    1.40661115235148869e-02, -1.62424080377519785e-02, 1.18833211452497173e-02,
+    1.81981828560831144e-02, -1.15971062863728436e-01, 2.71667177932561732e-01,
+    -9.16213674823539714e-02, -6.81128423803941230e-01, -3.74063155418290660e-01,
+    0.00000000000000000e+00, 5.02002664622967104e-04, -7.62132512817602728e-04,
+    9.40264832818408212e-04, -9.67312485520865277e-04, 5.76238687753094568e-04,
+    7.45143362836928448e-04, -2.75073688218644384e-03, -1.81399813313650078e-03,
+    3.75573264601433421e-02, -7.13163498441569815e-02, -2.00699034338467308e-01,
+    2.00952725411237487e-01, 7.71524379143289862e-01, 1.00000000000000000e+00,
+    -2.07938322288500101e-04, 3.74562678953990194e-04, -6.23145219788537709e-04,
+    1.01246160414605250e-03, -1.49244720139404645e-03, 1.44286539661994564e-03,
+    1.65585236088426450e-03, -1.21764564670076465e-02, 1.42880156456775646e-02,
+    8.65938496022169296e-02, -1.76514538346929317e-01, -4.86044673184276854e-01,
+    -2.87610793206041326e-01, 0.00000000000000000e+00, -4.70219801062360615e-05,
+    8.54197936562155799e-05, -1.35923788280247751e-04, 1.83420563753812000e-04,
+    -1.56493973363164518e-04, -9.02840989369229530e-06, -4.16395028890091830e-04,
+    3.99355709074557252e-03, 6.97230893350166050e-04, -6.03553032071877452e-02,
+    -6.91849596226774000e-02, 2.55844869699605681e-01, 7.47956084058255977e-01,
+    1.00000000000000000e+00, -1.18716742485839067e-04, 1.72437694959872909e-04,
+    -1.92341835947082071e-04, 1.63731890220234031e-04, -9.59324589222511690e-05,
+    2.02728187688660621e-04, -9.37739889774265594e-04, -4.65874889126241510e-04,
+    1.63131570148782774e-02, 6.34003092822674110e-03, -1.71957085117242725e-01,
+    -3.58192821353700841e-01, -2.21417629303845481e-01, 0.00000000000000000e+00,
+    -4.14821508633145914e-05, 5.76698120059514034e-05, -5.99441617010493475e-05,
+    5.24253345973880997e-05, -5.69309012429494425e-05, 5.46593415502899424e-05,
+    2.61227354168098926e-04, 4.30862704196411479e-04, -7.56530714837949213e-03,
+    -3.16806401242926000e-02, 9.26226136712085535e-03, 2.88437926568468450e-01,
+    7.32441652915179264e-01, 1.00000000000000000e+00, 1.88856184441013022e-05,
+    -3.24430649270902418e-05, 4.55128610648556891e-05, -4.99145731463193556e-05,
+    4.63772118193608117e-05, -1.02628514194330595e-04, 4.37942000019648199e-05,
+    1.57683334587196229e-03, 4.44092199614969270e-03, -2.36168082509587082e-02,
+    -1.42709124795948161e-01, -2.59656826969812848e-01, -1.65232951660607696e-01,
+    0.00000000000000000e+00, 1.08914092422533424e-05, -1.72370846252011620e-05,
+    2.12729335241631150e-05, -2.23235948347995971e-05, 2.66141260255811583e-05,
+    -7.48172444820655199e-06, -1.48193217427048034e-05, -8.73730553569406539e-04,
+    -4.83825909161749498e-03, -6.01948239894117137e-03, 5.74263981562055173e-02,
+    3.08486384451775175e-01, 7.22188527667139701e-01, 1.00000000000000000e+00,
+    1.94013573692089386e-05, -2.60393055431918548e-05, 2.65124213994560974e-05,
+    -2.54340392205985612e-05, 2.21919751095028120e-05, -2.65261346033974993e-06,
+    1.53546279016395312e-04, 3.24775463160370049e-04, -2.85591105782345310e-03,
+    -2.87156787194744016e-02, -1.04816032576471929e-01, -1.76894796366657087e-01,
+    -1.14773619651092437e-01, 0.00000000000000000e+00, 1.15186219961403473e-05,
+    -1.51885041529505905e-05, 1.57355312794828003e-05, -1.50649316462263723e-05,
+    1.19133102858393070e-05, -2.43843371158222357e-05, -6.70517439980088364e-05,
+    -3.31889040183333420e-04, 5.69170245656556864e-05, 1.17986302055867621e-02,
+    8.55660405945684044e-02, 3.20240910869650064e-01, 7.15883342375946086e-01,
+    1.00000000000000000e+00, -8.13127716901244636e-06, 1.18854575666373343e-05,
+    -1.34982093627264592e-05, 1.43457148504599093e-05, -1.24074972519295463e-05,
+    1.36739148717502000e-05, -5.08960767508568858e-05, -5.35613084207099189e-04,
+    -4.27759982865673089e-03, -2.11965448338858123e-02, -6.36662507058234212e-02,
+    -1.03056215106495513e-01, -6.76761186907124251e-02, 0.00000000000000000e+00,
+    -7.50802424274691662e-06, 1.03236856847104058e-05, -1.12690391237329043e-05,
+    1.12323861841439474e-05, -1.01198778133968758e-05, 1.41261200198949352e-05,
+    3.49430871294659828e-05, 4.11285942675441237e-04, 3.23219077804418574e-03,
+    2.07672341566424237e-02, 9.86120511076546274e-02, 3.25706033271543405e-01,
+    7.12870420951754125e-01, 1.00000000000000000e+00, -8.43192582325474164e-06,
+    1.11959461303320954e-05, -1.19205560632321008e-05, 1.11709256902438047e-05,
+    -1.19381221538678601e-05, 1.39934274348493656e-06, -6.23376908313571360e-05,
+    -3.32787050464798326e-04, -1.85639092856194335e-03, -7.66078692281711715e-03,
+    -2.13218623013208299e-02, -3.38686548614447816e-02, -2.23704755188678106e-02,
+    0.00000000000000000e+00,
+};
+
+static const real_t RadauIIA27_transf1_T[196] = {
+    -7.51145393357144919e-02, 8.05563162313642223e-02, 9.23080771290375225e-03,
+    7.45205449605978749e-03, 1.20820290165138833e-03, -2.31171495774862810e-03,
+    -8.63864902408677184e-04, -2.03785570940788626e-04, 1.88685636904446934e-05,
+    4.18541305253775520e-04, 2.45301274280431390e-04, -8.57562496233391265e-05,
+    -1.22132296460709445e-04, -1.65778106235181457e-04, 1.17652465630015843e-01,
+    -1.32773897574288341e-01, -1.51427893032878378e-02, -1.06985550752185764e-02,
+    -1.52642600018989432e-03, 3.62253595619896470e-03, 1.27474473989064546e-03,
+    1.88037337926459522e-04, -6.93771426095112328e-05, -5.83923100713518552e-04,
+    -3.29348045695437592e-04, 1.33697138072725349e-04, 1.68605449038176897e-04,
+    2.20718391531676204e-04, -1.57196451627089312e-01, 1.96294211269180979e-01,
+    2.17694602255619762e-02, 1.15168235502893131e-02, 1.16012100305024415e-03,
+    -4.66919674706549239e-03, -1.46558677641761407e-03, -1.39169396671295906e-05,
+    1.33247443575394508e-04, 6.26059608315031584e-04, 3.47209735303446510e-04,
+    -1.59506016659276268e-04, -1.84551582293054515e-04, -2.35470683430776022e-04,
+    1.97590607178332461e-01, -2.93325598880882332e-01, -2.95159285464113574e-02,
+    -7.96832351075783644e-03, -8.37360829869659041e-05, 5.02181299891366843e-03,
+    1.40229821165176378e-03, -1.43499120058618676e-04, -1.60050795937921028e-04,
+    -6.16820786953070979e-04, -3.39618392317750416e-04, 1.77920839241927557e-04,
+    1.85149521585133142e-04, 2.21795699133865845e-04, -2.29453076095415515e-01,
+    4.58406658568225878e-01, 3.46327225715243742e-02, -4.54352330532538894e-03,
+    -6.05307703672405308e-04, -3.70046996349433777e-03, -1.42949664748463117e-03,
+    3.53169029653536712e-05, 2.59668142393047231e-04, 5.98630275267350966e-04,
+    2.73952723902726332e-04, -1.59535591028053602e-04, -1.63653333263073618e-04,
+    -2.33852692765376203e-04, 2.06392999438720859e-01, -7.52338884986649248e-01,
+    -1.98781281253786850e-02, 2.93588827411534609e-02, -3.25548232157816088e-03,
+    2.56629689684402008e-03, 2.06517379045195650e-03, -9.28503012619530540e-04,
+    -1.03366854547442898e-04, -1.07975415371933960e-04, -5.01363830420368216e-04,
+    1.18817144606307517e-04, 2.54170064833856993e-04, 4.92224349611809753e-05,
+    3.43143012451380611e-02, 1.25613853747629234e+00, -6.04817285333845364e-02,
+    -3.54385680000256637e-02, 8.94332293823773411e-03, -1.89555762009719214e-02,
+    3.49999473134296555e-03, 3.78876696619802420e-03, -1.54961461887848572e-03,
+    2.45692048568730941e-03, -9.30447149194796861e-04, -1.24151049082941718e-03,
+    7.39636916147316760e-04, -1.07314652690902387e-03, -9.54198220216367687e-01,
+    -1.91017748609097038e+00, 2.14494848201544797e-01, -1.61980897854180267e-01,
+    6.05082069659571425e-02, 5.55378532250443077e-02, -1.21656809225788448e-02,
+    2.94154992739492117e-02, -1.74453799887039421e-02, -1.93732764488897965e-03,
+    -3.16870456800774246e-03, -1.11723978660268064e-02, 8.02984149867587600e-03,
+    -5.35012522580735617e-03, 3.33785100780966415e+00, 1.72742867141930168e+00,
+    1.18420837025844869e-01, 8.69304944893902087e-01, -2.42959338602492331e-01,
+    2.28521569185644952e-01, -1.69429941065855572e-01, -2.18198186667155243e-02,
+    -5.71859051466368784e-02, -8.90072176388231190e-02, 2.26728423317515138e-02,
+    -7.55144594970119376e-02, 6.18252932638615332e-02, -2.82637749959274744e-02,
+    -6.06539814987603432e+00, 2.63161002980083891e+00, -2.40518048302279475e+00,
+    -4.62649626204254316e-01, -9.03633399081887223e-01, -8.48707079901390937e-01,
+    -2.06218266109680054e-01, -7.41339297513750939e-01, 1.41952632112269772e-01,
+    -5.33934521125805084e-01, 3.16433283444063684e-01, -3.15865821732237151e-01,
+    3.90043410553687964e-01, -1.04114455376487780e-01, -6.15891418182757833e-01,
+    -1.10228260293359472e+01, 1.28747501497900729e+00, -5.69175566179951709e+00,
+    1.73568810056125389e+00, -3.36506658642160383e+00, 1.84405153610418338e+00,
+    -2.08686949543431499e+00, 1.85350966546166429e+00, -1.27651173909574456e+00,
+    1.83874575814596763e+00, -6.94864695026507828e-01, 1.82672319851137566e+00,
+    -2.20985358985064495e-01, 1.64254626101727084e+01, -1.95895323274667588e+00,
+    1.14176534514509811e+01, -1.22490695232571478e+00, 8.95395673399954894e+00,
+    -8.24604950150981675e-01, 7.53683186144647532e+00, -5.59064577125801043e-01,
+    6.68640376907281109e+00, -3.62557836278566359e-01, 6.19687818044175032e+00,
+    -2.04360062626949779e-01, 5.97187284831613585e+00, -6.60514774607582900e-02,
+    1.36560372818519600e+01, 1.65767229670309035e+01, 1.35738753575820184e+01,
+    1.17869706198206963e+01, 1.34073214530007672e+01, 8.61097640258203079e+00,
+    1.32474128624253140e+01, 6.18838879151307797e+00, 1.31181696788545530e+01,
+    4.18585113031041445e+00, 1.30288146164030483e+01, 2.42636611183622852e+00,
+    1.29833536442178126e+01, 7.95345855344165464e-01, 6.10953706591082568e+00,
+    2.32659732506468941e+01, 1.04466532469180926e+01, 1.91718385658013624e+01,
+    1.33474860189496454e+01, 1.54639361328642106e+01, 1.53970406475504671e+01,
+    1.19224339983808445e+01, 1.68185419175290498e+01, 8.46894658268211131e+00,
+    1.77208535297202978e+01, 5.06457474842360877e+00, 1.81598875734216207e+01,
+    1.68556744734413266e+00,
+};
+
+static const real_t RadauIIA27_transf2_T[196] = {
+    7.54838192685760401e+00, -1.02091336867266094e+01, -3.76048613267905836e+01,
+    4.60449343662461619e+00, 1.60097748559855440e+01, -1.26894618748462431e+01,
+    6.22801848096052080e+00, -2.49886257696713310e+00, 8.47657168814726414e-01,
+    -1.88194617445366419e-01, -5.42751243086516261e-02, 1.24484951175186973e-01,
+    -1.17768219366971613e-01, 5.07666237060737449e-02, 1.67177892825357546e+01,
+    3.33096474114064378e+01, 4.86602984327809476e-02, -2.97668562632288882e+01,
+    1.26031760654702332e+01, 1.35912086495820628e+00, -4.82625914221821173e+00,
+    4.30603880409439377e+00, -3.16498149034380516e+00, 2.24348579731507503e+00,
+    -1.59884707983547747e+00, 1.14085918602156378e+00, -7.70757799732486149e-01,
+    2.97792651281824361e-01, 6.03103469424402874e+02, 1.54840589260124034e+03,
+    1.05079693284260566e+03, -4.50483074409409994e+02, -2.73253537575656537e+02,
+    1.31169578268064811e+02, -9.78064155785977363e+00, -7.23883797491301806e+00,
+    3.58199277516080064e-02, 5.14472953664520638e+00, -6.59200248365982588e+00,
+    6.08510384350484212e+00, -4.64286765297425053e+00, 1.87504640912869691e+00,
+    -7.83904120160772095e+02, -5.11597826964249350e+02, 9.20291844682610190e+02,
+    6.94226349085608263e+02, -2.61780505872716674e+02, -4.79908495644244368e+01,
+    3.81165359379313244e+01, -1.39288806959210154e+00, -9.81976460904373916e+00,
+    9.43813630727087549e+00, -6.78541841425986725e+00, 4.49396435170752628e+00,
+    -2.80677043750107114e+00, 1.04125040799735391e+00, -1.43966928620189756e+04,
+    -2.16118236210579671e+04, -7.64953049648519846e+03, 4.82897822149423791e+03,
+    2.33643615778619824e+03, -3.62343918415073688e+02, -1.61049369885242555e+02,
+    5.51077742401160151e+01, -2.28879919995960144e+01, 2.74866410786282920e+01,
+    -2.84005345788510937e+01, 2.38110010686486646e+01, -1.70365664838921695e+01,
+    6.67957404704930102e+00, 3.42644795892985076e+03, -5.43551794907593739e+03,
+    -1.44481817264501351e+04, -6.10836117984761131e+03, 1.31985211595440455e+03,
+    6.35213111047701432e+02, -1.09044395921132747e+02, -2.81730866273570655e+01,
+    1.01249804486568529e+01, -4.33035246255451778e+00, 8.68314703937914878e+00,
+    -1.16177287435222105e+01, 1.06509356326264673e+01, -4.60041602018522333e+00,
+    9.74141034793618164e+04, 1.14273840354295462e+05, 2.58522569046246244e+04,
+    -2.20004285094657062e+04, -1.09311369426151286e+04, -4.98860370531019896e+02,
+    4.08951363054229546e+02, 6.27282880644766720e+01, -1.70869626997649746e+01,
+    2.77883666385711470e+00, -1.50576521242927835e-01, -6.35740523547446745e+00,
+    9.67646416157176859e+00, -4.86860805836555066e+00, 2.75710142117802461e+04,
+    8.61036576151385671e+04, 9.03088532637161989e+04, 3.13666505614321904e+04,
+    -1.38841237107912139e+03, -2.45161114935220940e+03, -1.55074800120307970e+02,
+    4.76125950891992211e+00, 7.58706097530077841e+01, -6.81696924078450905e+01,
+    6.78946325938519237e+01, -6.35718797968688847e+01, 4.97739476094991460e+01,
+    -2.02938813316388895e+01, -2.96472726008764876e+05, -3.00458330105722998e+05,
+    -4.87863873249165554e+04, 5.34561891435719153e+04, 2.79661091925376022e+04,
+    4.72382708864724736e+03, 1.60032195424841603e+02, -2.03844481938880364e+02,
+    8.72206562593265176e+01, -1.17902867746464096e+02, 1.20488889816244011e+02,
+    -1.15771606978985972e+02, 9.55964982624182653e+01, -4.01352316924796355e+01,
+    -2.46888408132611832e+05, -4.26596000717276474e+05, -3.13282212447660917e+05,
+    -1.03384120012675194e+05, -9.20330055202225776e+03, 2.96442562115438159e+03,
+    9.48307270526742514e+02, 5.13611446737595969e+01, 3.46502195054558015e+01,
+    -4.01353297526951422e+01, 3.03367839145713063e+01, -2.17219635435430654e+01,
+    1.13995043443703103e+01, -3.32947697968586587e+00, 4.39790448898908158e+05,
+    4.08791128951045685e+05, 5.27982722313759878e+04, -7.00331633278063528e+04,
+    -3.78918619170846723e+04, -9.29728590033155888e+03, -1.28692106112445322e+03,
+    -2.06406219520467403e+02, 7.94263169091838961e+01, -8.50358065753631536e+01,
+    8.38789000360611539e+01, -7.34920716064783619e+01, 5.58629936219130201e+01,
+    -2.23074114456216890e+01, 7.88988096016326454e+05, 1.11532385996513651e+06,
+    6.85311403731803410e+05, 2.25352720639228937e+05, 3.95111067694029553e+04,
+    2.78555465348000098e+03, -5.03512485492271821e+02, -1.25006593833885784e+01,
+    -1.69844601158850935e+02, 1.50923195310606218e+02, -1.62334551942456045e+02,
+    1.58036648345475641e+02, -1.33292945264528413e+02, 5.69542392455279227e+01,
+    -2.26945785358837398e+05, -2.02533012337474676e+05, -2.32278033861146796e+04,
+    3.41943030531786935e+04, 1.87776972720956692e+04, 5.31618298423718625e+03,
+    8.82539495607523918e+02, 3.02152339706635246e+02, -1.27555495565715759e+02,
+    1.67716661660141995e+02, -1.69170401144242675e+02, 1.65600493957610126e+02,
+    -1.39338753689669659e+02, 5.97058641165828021e+01, -1.34795914281407977e+06,
+    -1.76159844917811151e+06, -1.00178008205229952e+06, -3.30975491607138712e+05,
+    -7.19657531648540025e+04, -1.12218789507900674e+04, -1.52664622024349114e+03,
+    -3.74146126376055363e+01, -1.45409755296256975e+02, 1.34500542892250763e+02,
+    -1.38709629596811453e+02, 1.31198586580057480e+02, -1.07631154406753708e+02,
+    4.53433192151847635e+01,
+};
+
+static const real_t RadauIIA29_c[15] = {
+    6.41676079281845724e-03, 3.35014045320131404e-02, 8.09854996819551892e-02,
+    1.46804867681213730e-01, 2.28084270649257986e-01, 3.21271743988936154e-01,
+    4.22294657307570265e-01, 5.26737861339872993e-01, 6.30036688370403941e-01,
+    7.27676452889264636e-01, 8.15389739443474593e-01, 8.89342808819515551e-01,
+    9.46302700060275392e-01, 9.83775234098600238e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA29_A[225] = {
+    8.23035736457686934e-03, 1.77568580343763008e-02, 1.57995597010279695e-02,
+    1.68106972029181644e-02, 1.61811683963562943e-02, 1.66080154040159529e-02,
+    1.63054818738656328e-02, 1.65245444409735202e-02, 1.63651205076578224e-02,
+    1.64800092579008746e-02, 1.63994187738575846e-02, 1.64530969794966613e-02,
+    1.64206205793968468e-02, 1.64367397506957717e-02, 1.64321957922967665e-02,
+    -3.12589943353475249e-03, 1.88515457557533045e-02, 4.07301172961875707e-02,
+    3.59647723571669131e-02, 3.85349810446351804e-02, 3.68919357166351547e-02,
+    3.80215338068990091e-02, 3.72180587477936864e-02, 3.77962321109474031e-02,
+    3.73826830438534485e-02, 3.76712913868798779e-02, 3.74797377549044367e-02,
+    3.75953550313433485e-02, 3.75380571061339069e-02, 3.75541963802532228e-02,
+    2.38590115693310687e-03, -5.11152663013991673e-03, 2.87137686495092005e-02,
+    6.18971790684023360e-02, 5.46336414921554520e-02, 5.85749317593892982e-02,
+    5.60515362124809902e-02, 5.77787769385026684e-02, 5.65643581357153369e-02,
+    5.74200929435709148e-02, 5.68288522371173596e-02, 5.72185989351023591e-02,
+    5.69844316291414146e-02, 5.71001459948227430e-02, 5.70676017448763784e-02,
+    -1.99624586073570255e-03, 3.57352939215742045e-03, -6.82232041877801811e-03,
+    3.73711147901584009e-02, 8.03019268780942042e-02, 7.09756646013957188e-02,
+    7.60033553174131321e-02, 7.28156989818605077e-02, 7.49645265833931013e-02,
+    7.34888293511456042e-02, 7.44915575184479234e-02, 7.38378438279155419e-02,
+    7.42277405841284821e-02, 7.40359523718508300e-02, 7.40897635017336298e-02,
+    1.73561264356409989e-03, -2.88926424924017961e-03, 4.49744435126137650e-03,
+    -8.25366105144034745e-03, 4.44440720953880528e-02, 9.51414235134730307e-02,
+    8.42739388406472806e-02, 9.00535638233147112e-02, 8.64540174307609349e-02,
+    8.88200014781195951e-02, 8.72548257665363841e-02, 8.82578431833421773e-02,
+    8.76662056376860399e-02, 8.79552494595081946e-02, 8.78744363212238394e-02,
+    -1.53898269104953220e-03, 2.46917520618356468e-03, -3.52227763579954570e-03,
+    5.22052452524532622e-03, -9.35870562319774009e-03, 4.96233129701433295e-02,
+    1.05768701430379988e-01, 9.39457314804428983e-02, 1.00110952950428142e-01,
+    9.63710797175492129e-02, 9.87378207199457458e-02, 9.72612391485834227e-02,
+    9.81178065511776748e-02, 9.77035112387182741e-02, 9.78187515225580617e-02,
+    1.37863336379253167e-03, -2.16539154288771570e-03, 2.94938680204410433e-03,
+    -3.98074980363977409e-03, 5.73711319295080579e-03, -1.00945199911214051e-02,
+    5.26824226341830390e-02, 1.11720145787017833e-01, 9.95675881596768675e-02,
+    1.05735922377042435e-01, 1.02133580341586025e-01, 1.04284592776939841e-01,
+    1.03068518390361172e-01, 1.03647951205944083e-01, 1.03487980124776877e-01,
+    -1.24006443587051408e-03, 1.92204803612759179e-03, -2.54692030376912210e-03,
+    3.26804864882532069e-03, -4.27574382166131736e-03, 6.03381069373374636e-03,
+    -1.04310807059072568e-02, 5.34876806176789177e-02, 1.12735941278442595e-01,
+    1.00893685919924855e-01, 1.06682416632540328e-01, 1.03489442737573906e-01,
+    1.05220026806820285e-01, 1.04414375910302004e-01, 1.04634304073847287e-01,
+    1.11444499078078188e-03, -1.71228826351021448e-03, 2.22943855474931575e-03,
+    -2.77472322338987408e-03, 3.44404228127745144e-03, -4.40552466956937745e-03,
+    6.10110039761497299e-03, -1.03543798337509870e-02, 5.20038782873666131e-02,
+    1.08771503583504514e-01, 9.78665573152747020e-02, 1.02908619057877362e-01,
+    1.00377976578855624e-01, 1.01511559593799955e-01, 1.01207593515309210e-01,
+    -9.95534814969936980e-04, 1.52048910124845892e-03, -1.95661646601095118e-03,
+    2.38783245908989446e-03, -2.87085030269167325e-03, 3.48100703751786852e-03,
+    -4.36793712131910462e-03, 5.93657322638882750e-03, -9.86749216356183970e-03,
+    4.82958452440610947e-02, 9.99993187398117572e-02, 9.06197243008800835e-02,
+    9.45792980282882528e-02, 9.29281570860149841e-02, 9.33575729197254484e-02,
+    8.78062294032530945e-04, -1.33554352488477607e-03, 1.70491054342967693e-03,
+    -2.05362665142653925e-03, 2.41917193232180213e-03, -2.84050045223438680e-03,
+    3.37906400788612988e-03, -4.16333693990291517e-03, 5.54538886432169933e-03,
+    -8.99025523540396623e-03, 4.25255965247214318e-02, 8.68009644834470545e-02,
+    7.94720644823267708e-02, 8.20620261555402714e-02, 8.14272386519163116e-02,
+    -7.56427690805291388e-04, 1.14726729534706039e-03, -1.45658470154256896e-03,
+    1.73919270024898475e-03, -2.02163996665425142e-03, 2.32630084096925507e-03,
+    -2.68167658837494341e-03, 3.13625053826477145e-03, -3.79355100277238002e-03,
+    4.93850672561268415e-03, -7.75729013276968242e-03, 3.49451829791701668e-02,
+    6.97490468003483244e-02, 6.49130881872055504e-02, 6.59377312524758175e-02,
+    6.22736585235878892e-04, -9.42719692438872257e-04, 1.19259081809865793e-03,
+    -1.41587175850893120e-03, 1.63183023970413341e-03, -1.85425353874887032e-03,
+    2.09754253869727861e-03, -2.38186846304933898e-03, 2.74251695628054864e-03,
+    -3.25496563739722123e-03, 4.12591632588890037e-03, -6.21225212136353611e-03,
+    2.58852947541430602e-02, 4.95767229165200787e-02, 4.75647997302404493e-02,
+    -4.60988064033300646e-04, 6.97077664737696359e-04, -8.79965273470541265e-04,
+    1.04121647925399107e-03, -1.19409344122983784e-03, 1.34711184385491217e-03,
+    -1.50785966121567299e-03, 1.68521500650455156e-03, -1.89205889587665743e-03,
+    2.15073332251393152e-03, -2.50773650526746024e-03, 3.08633744194335537e-03,
+    -4.38328091332511414e-03, 1.57368621990469013e-02, 2.71013900243222486e-02,
+    1.85155384901688103e-04, -2.79852050816583394e-04, 3.52967765018059626e-04,
+    -4.17078061690142287e-04, 4.77356251809430744e-04, -5.36971740518053147e-04,
+    5.98534324319778999e-04, -6.64793012166605183e-04, 7.39269167623763583e-04,
+    -8.27219202733296211e-04, 9.37613798903756310e-04, -1.08816266629730980e-03,
+    1.32159511958319822e-03, -1.78516507750331606e-03, 4.44444444444444444e-03,
+};
+
+static const real_t RadauIIA29_b[15] = {
+    1.64321957922967665e-02, 3.75541963802532228e-02, 5.70676017448763784e-02,
+    7.40897635017336298e-02, 8.78744363212238394e-02, 9.78187515225580617e-02,
+    1.03487980124776877e-01, 1.04634304073847287e-01, 1.01207593515309210e-01,
+    9.33575729197254484e-02, 8.14272386519163116e-02, 6.59377312524758175e-02,
+    4.75647997302404493e-02, 2.71013900243222486e-02, 4.44444444444444444e-03,
+};
+
+static const real_t RadauIIA29_eig[15] = {
+    6.30197985479334744e+00, -2.51644726856788203e+01, 1.08065249138979951e+01,
+    -2.10062073041128095e+01, 1.38620782190319716e+01, -1.72534325870271168e+01,
+    1.60650314608033611e+01, -1.36778030439440261e+01, 1.76445217656663651e+01,
+    -1.01977439029860921e+01, 1.87143320796240573e+01, -6.77298165933160767e+00,
+    1.93357061672768857e+01, -3.37939988193288166e+00, 1.95396510778120316e+01,
+};
+
+static const real_t RadauIIA29_transf1[225] = {
+    -2.58679679791896831e+02, -4.49790241140001058e+02, -2.26212158341673385e+04,
+    2.00513799016735938e+04, 4.85557922545854002e+05, 9.72552835139301460e+04,
+    -2.26283895543082710e+06, -3.00323966015506722e+06, 3.91039342090585502e+05,
+    1.61508391635244973e+07, 2.21769878528674357e+07, -3.73459770185512900e+07,
+    -6.73791339849475920e+07, 3.76504303471519053e+07, 4.66112918772730157e+07,
+    1.55989307971453201e+02, -9.92354163404049700e+02, -5.09639744867932532e+04,
+    8.01141863291001937e+03, 6.11698903541328385e+05, 4.79824322357761615e+05,
+    -1.51164119395236182e+06, -5.35207751805390418e+06, -5.70783048929617554e+06,
+    2.21720244158940949e+07, 3.93977275184708238e+07, -4.49822070518646687e+07,
+    -9.54884668803411573e+07, 4.24157375449577570e+07, 6.27493036948572174e+07,
+    1.10746965300960323e+03, -2.35800266260700852e+02, -3.12068137018015659e+04,
+    -3.49550928932674069e+04, 5.30041146506999139e+04, 6.09296444282318233e+05,
+    1.44066112208454893e+06, -3.66909891852072440e+06, -1.01083902251165435e+07,
+    1.11536566532465219e+07, 3.22404265386479758e+07, -1.88843500572554730e+07,
+    -6.13014187933842018e+07, 1.61495450902274549e+07, 3.77058302884126008e+07,
+    1.19407184978958369e+02, 9.46730480102871866e+02, 1.80895859860095879e+04,
+    -2.37791053411355606e+04, -2.76742804301476805e+05, 1.59084998292150936e+05,
+    1.70001439381083683e+06, -5.18269728386613075e+05, -6.03513171313097980e+06,
+    9.95603374234077288e+05, 1.41059397642009445e+07, -1.19027223918451206e+06,
+    -2.30384270405983217e+07, 8.06973469016395975e+05, 1.35261259171549249e+07,
+    -6.39597787554606384e+02, -2.10782121742261324e+02, 1.04810697206791556e+04,
+    1.05235588254875620e+04, -7.76777325021143333e+04, -9.47166039310183260e+04,
+    3.91653397333311965e+05, 4.14878483808085439e+05, -1.36195937659388199e+06,
+    -1.06856882156010182e+06, 3.27378158232134255e+06, 1.65124667527657049e+06,
+    -5.51552175636579003e+06, -1.34394104718392040e+06, 3.27989447547552455e+06,
+    3.75818572863818417e+02, -2.16267765984555496e+02, -5.66055350586311579e+03,
+    2.21059572686288038e+03, 2.93080377734449758e+04, -2.25994686306873082e+04,
+    -7.07172082313929859e+04, 1.24743325927652186e+05, 1.86970657386917119e+04,
+    -3.70382355220692523e+05, 3.27936486319317773e+05, 6.33133085463429568e+05,
+    -8.88263084477528813e+05, -5.53287445670619025e+05, 5.88311243138516322e+05,
+    -1.14125753843115504e+02, 2.45825931566312534e+02, 4.77603467891381797e+02,
+    -1.97948623551580476e+03, 5.08828863590991841e+03, 8.48385891528127468e+03,
+    -2.79185855249863635e+04, -1.10084205092710799e+04, 5.59814692714449629e+04,
+    -3.27647623967045474e+04, -2.69385316500318040e+04, 1.13969006914366779e+05,
+    -9.61055225644301099e+04, -1.17406610762205513e+05, 8.95422576368377340e+04,
+    -7.44898251658025146e-01, -1.71262564993931221e+02, 3.34316927443470945e+02,
+    3.43841904551963410e+02, -2.89387157754515238e+03, 7.68197078671533291e+02,
+    8.17518233566289041e+02, -3.97045412166922688e+03, 1.13998234868281033e+04,
+    7.18956471214375688e+03, -9.54177114925929709e+03, 7.16623367857327048e+03,
+    -8.48478760476529351e+03, -2.52307473139283247e+04, 8.35539025436788324e+03,
+    3.43897156907044348e+01, 1.06465923489109741e+02, -3.71344146783417060e+01,
+    1.99127513892964771e+02, 6.79500851736923096e+02, -7.59468797221055297e+02,
+    1.26439139061097853e+03, -1.65848990550474605e+03, -2.81118324367935020e+03,
+    6.10174080773445695e+01, -6.02224057830534730e+03, 2.91870491097385502e+03,
+    2.10554305215880095e+03, 3.05548832046430152e+03, 4.80298333365314193e+03,
+    -3.82111192040422196e+01, -6.58966475916128047e+01, -1.82516137153056604e+02,
+    -2.19237445393185681e+02, -6.04276058810681548e+02, 2.88783804245569002e+02,
+    -1.34867846458788961e+02, 2.01128091613116158e+03, 2.73612572956598206e+03,
+    1.76169035371250152e+03, 3.70387002684213303e+03, -3.54794506070459875e+03,
+    -2.10707163427883734e+03, -6.59479783353391304e+03, -3.39278226061827991e+03,
+    3.35177982140157766e+01, 4.22291133726188406e+01, 2.43502957248887441e+02,
+    1.36008548605700526e+02, 7.20225528495048138e+02, -3.23831317266460132e+02,
+    1.70696749806019490e+01, -1.87185747694734209e+03, -3.23301173556272806e+03,
+    -1.56718778019477259e+03, -4.06594659256226896e+03, 3.56407197134373337e+03,
+    2.49417862917083858e+03, 6.47639010309448167e+03, 3.81614034834236963e+03,
+    -2.72517791062209298e+01, -2.81997183211442461e+01, -2.28519777910812991e+02,
+    -6.82345190470678062e+01, -6.57512156685041191e+02, 4.32327770657272310e+02,
+    1.09425416963761734e+02, 1.86644407469563794e+03, 3.28092028343114407e+03,
+    1.33358901806541076e+03, 3.93975515512543961e+03, -3.83264918163023458e+03,
+    -2.61578380220471081e+03, -6.57440526734554624e+03, -3.83794333729840400e+03,
+    2.11292429308869387e+01, 1.92858671674438398e+01, 1.87372861842915626e+02,
+    2.91223974354599804e+01, 5.12060966752330501e+02, -4.50814608343178520e+02,
+    -2.79624942780180334e+02, -1.68646678011864947e+03, -3.13743183802791827e+03,
+    -1.02633272761268631e+03, -3.52993658842127479e+03, 3.76755780854910563e+03,
+    2.63626933499530969e+03, 6.16327162350816343e+03, 3.65278868354696624e+03,
+    -1.49766026387075044e+01, -1.27039496334516198e+01, -1.35662717906436967e+02,
+    -1.03886660554793444e+01, -3.52229833627174401e+02, 3.71759973616679076e+02,
+    3.27800357015212057e+02, 1.29242637908888059e+03, 2.56426585047090748e+03,
+    6.54223790639292929e+02, 2.73867516026126668e+03, -3.19426447644958671e+03,
+    -2.27422443141682925e+03, -5.01468081258383336e+03, -3.00709558003204256e+03,
+    5.89965175301059386e+00, 4.85746214474006077e+00, 5.37814977106834462e+01,
+    2.43340408167997380e+00, 1.35979466214583141e+02, -1.54931257438932477e+02,
+    -1.54201412044661680e+02, -5.23118159695878489e+02, -1.07181264863325691e+03,
+    -2.35764058557434623e+02, -1.11473131737932999e+03, 1.36628314206360005e+03,
+    9.86598169095589242e+02, 2.10303242415996601e+03, 1.27148659328338204e+03,
+};
+
+static const real_t RadauIIA29_transf2[225] = {
+    2.49250037749485301e-04, -2.65436492086144101e-04, 8.76839430127898317e-06,
+    8.01011872494865329e-04, -2.87331473968258349e-03, 7.95685896501206399e-03,
+    -2.02268961307467549e-02, 4.83828638235620778e-02, -1.02607868581728837e-01,
+    1.55338555130740297e-01, -2.31106541522358676e-02, -4.65389576202459077e-01,
+    1.54780201055165295e-01, 8.28743847720028182e-01, 1.00000000000000000e+00,
+    -3.84827177116040800e-03, 6.15679768738909734e-03, -8.60922435355855956e-03,
+    1.18169076760353247e-02, -1.64102565683049879e-02, 2.30792698085472772e-02,
+    -3.17468842914614552e-02, 3.74745013378406031e-02, -1.68906645965976633e-02,
+    -9.21144902604651150e-02, 3.08037084604644906e-01, -1.71515902676687454e-01,
+    -6.97177599976593898e-01, -3.57911536951229903e-01, 0.00000000000000000e+00,
+    -4.04883884839322126e-04, 6.39999121415113894e-04, -8.64200956097035066e-04,
+    1.08350493796886198e-03, -1.19094170819418910e-03, 7.98412433591292074e-04,
+    9.98400653811793099e-04, -4.55382655791465758e-03, 9.31300188819633463e-04,
+    4.50671932904770783e-02, -1.01143434876195384e-01, -2.06728945542923565e-01,
+    2.39698181769118085e-01, 7.90965730455215121e-01, 1.00000000000000000e+00,
+    -1.18317565657505698e-04, 1.50118740514566389e-04, -1.07442128921612283e-04,
+    -6.17620754724573404e-05, 4.47724738227596659e-04, -1.07030585173740968e-03,
+    1.23733585693054952e-03, 2.60001228071514564e-03, -1.80102082896300593e-02,
+    2.79406561294408447e-02, 9.14427714111721995e-02, -2.20578135932634117e-01,
+    -5.05744310007056441e-01, -2.80503585675952627e-01, 0.00000000000000000e+00,
+    -3.04345783110621177e-05, 3.67545672740488349e-05, -2.34345387468605927e-05,
+    -1.13548077383108891e-05, 4.66222871332610579e-05, 1.15176236875359141e-05,
+    -2.40532599805532072e-04, -4.72951032798388400e-04, 5.92577962674557378e-03,
+    -3.36559011790721937e-04, -7.72942011219522468e-02, -7.16078557494275458e-02,
+    2.85338678987253846e-01, 7.67504355320120291e-01, 1.00000000000000000e+00,
+    8.66672176787024851e-05, -1.34037651141381879e-04, 1.71024177741144374e-04,
+    -1.88839197759639528e-04, 1.61251606212228776e-04, -1.00081661213352550e-04,
+    3.17032825448640236e-04, -1.47566656644348895e-03, -4.80006414147180198e-04,
+    2.28428591747125154e-02, 3.44217142695048836e-03, -2.03501350010695248e-01,
+    -3.79765073848512491e-01, -2.20655011041363369e-01, 0.00000000000000000e+00,
+    2.88427706046212071e-05, -4.32593999759389733e-05, 5.18086695525831115e-05,
+    -5.27218034475844630e-05, 4.96742152038134681e-05, -6.57110398192681846e-05,
+    3.84884997343538278e-05, 4.51807243296441512e-04, 9.27421224068719196e-04,
+    -1.05364516954111042e-02, -4.20133784308990496e-02, 9.65562719584880935e-03,
+    3.13246037449102177e-01, 7.51649365928520941e-01, 1.00000000000000000e+00,
+    9.54656410577842912e-06, -1.08619083279188854e-05, 6.37801292321644756e-06,
+    4.57845353396819336e-07, -6.01746127641592231e-07, 4.36689018789484769e-06,
+    -1.00715508338247364e-04, -8.74046472746246514e-05, 2.46069972524881175e-03,
+    6.93590083379203633e-03, -2.97905974168638232e-02, -1.68748099312256983e-01,
+    -2.82846772184137840e-01, -1.69600118366085489e-01, 0.00000000000000000e+00,
+    3.56940040224091486e-06, -3.83399646007419365e-06, 2.26749007183074025e-06,
+    -7.94553905272995498e-07, -8.28456193594848689e-07, 6.64677127927792521e-06,
+    3.27515462310895401e-05, 2.84870162382403600e-05, -1.18164606621144752e-03,
+    -7.64994587153786879e-03, -1.18081259076742977e-02, 6.07495720643670897e-02,
+    3.31031236158479014e-01, 7.40796521049901235e-01, 1.00000000000000000e+00,
+    -1.32302506124038206e-05, 1.91869859387469915e-05, -2.18455443156747018e-05,
+    2.20389455747718414e-05, -2.24941077875778153e-05, 1.59396404463509488e-05,
+    -3.56518327747347573e-06, 2.50679479501400679e-04, 8.48953834545883843e-04,
+    -2.90741573080071161e-03, -3.66431776937229461e-02, -1.28253504019981368e-01,
+    -2.01865356259195106e-01, -1.23698434506079702e-01, 0.00000000000000000e+00,
+    -7.84470694084258752e-06, 1.10412995175761869e-05, -1.22198395477689389e-05,
+    1.24084286485861902e-05, -1.14618634260426392e-05, 1.04968159541101584e-05,
+    -2.43136813382848255e-05, -1.33321999712747717e-04, -7.99609519399153957e-04,
+    -1.64711968531918861e-03, 9.94554817188476534e-03, 9.22964752030786401e-02,
+    3.42130527087134040e-01, 7.33678448861620036e-01, 1.00000000000000000e+00,
+    -1.47316481166061801e-06, 1.50850903066851988e-06, -9.60121524688280199e-07,
+    3.76446246027097008e-07, 6.34679448823080257e-07, 2.57093233932251872e-06,
+    1.46057808591691848e-05, 8.58227583939675796e-06, -5.84156829936630659e-04,
+    -5.89149904067390318e-03, -2.99837647607076110e-02, -8.58896433001237192e-02,
+    -1.30223620325868733e-01, -8.09498611896500297e-02, 0.00000000000000000e+00,
+    -5.56223674918678356e-07, 5.51815154458980762e-07, -3.79497185264119150e-07,
+    6.88883307489839806e-08, -2.47754201469458718e-07, -1.45642671261456672e-06,
+    -5.07471372603072010e-06, -3.18383655818729610e-06, 2.46537814496460364e-04,
+    3.12870984198154690e-03, 2.28617415526310604e-02, 1.09563757702537609e-01,
+    3.48251181261619969e-01, 7.29627482779401593e-01, 1.00000000000000000e+00,
+    5.80242691565372736e-06, -8.00098161297109948e-06, 8.76614659386585291e-06,
+    -8.75470961827560182e-06, 8.13171844389390742e-06, -9.17251843259995154e-06,
+    -6.09974965492441209e-06, -1.12320467588467236e-04, -7.36823831680921454e-04,
+    -4.11597503601619265e-03, -1.64515107169990911e-02, -4.29977059949246537e-02,
+    -6.38965326135926270e-02, -4.00463010214622828e-02, 0.00000000000000000e+00,
+    5.25733886245890910e-06, -7.19672059238145473e-06, 7.87138334592840377e-06,
+    -7.75178518450830414e-06, 7.69178810075512672e-06, -5.11211668459984301e-06,
+    1.87462978606990468e-05, 9.07959276889655774e-05, 7.30156209412482289e-04,
+    4.88320474909034134e-03, 2.71304762589586052e-02, 1.15068914679045939e-01,
+    3.50210038511957478e-01, 7.28310986092262858e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RadauIIA29_transf1_T[225] = {
+    9.84104985891386674e-02, -1.79794854107714688e-02, -1.88998447683239750e-03,
+    -9.78367654005893490e-03, -1.91719350283589508e-03, 6.76286805283536478e-04,
+    3.32783993594751087e-04, 5.47871588273573856e-04, 1.97899070605337166e-04,
+    -1.97041613706511594e-04, -1.36830732507709873e-04, -8.07013517265918337e-05,
+    -3.03636983751948837e-05, 1.10314319676830717e-04, 1.02726566970268293e-04,
+    -1.56605342661407354e-01, 3.21204456410801864e-02, 3.76274106696395608e-03,
+    1.50662161283095959e-02, 2.82210426455082805e-03, -1.22389795568900108e-03,
+    -5.46396578798285875e-04, -7.66190451682469240e-04, -2.63313002862803898e-04,
+    2.99447076988963918e-04, 1.96413441764859711e-04, 1.03013258072772921e-04,
+    3.77082520034910512e-05, -1.52839825450366796e-04, -1.40621409279638319e-04,
+    2.16701849334250796e-01, -5.40345064226305238e-02, -7.08205752935447443e-03,
+    -1.93146604791804566e-02, -3.27560553054449463e-03, 1.96642429471633557e-03,
+    7.45070701729128710e-04, 8.11091756377894132e-04, 2.62784044278434065e-04,
+    -3.62330899105658044e-04, -2.22183249779227775e-04, -1.00732782186825507e-04,
+    -3.69621608298922400e-05, 1.68217162015189803e-04, 1.53804084079141605e-04,
+    -2.92318289758866312e-01, 9.46269555066289597e-02, 1.30063100673987082e-02,
+    2.20928959346766499e-02, 3.10072313530368720e-03, -2.81361314001497050e-03,
+    -8.53239749624082095e-04, -7.13763143671086926e-04, -2.38767046538956417e-04,
+    3.80763997643306725e-04, 2.29665790795896991e-04, 9.10869997162781054e-05,
+    3.09176691720737732e-05, -1.69045691542010144e-04, -1.51467177735445033e-04,
+    3.94847881572131854e-01, -1.75722556589548967e-01, -2.22749399069892759e-02,
+    -2.01788198712163774e-02, -2.13586192634109950e-03, 3.03967686636519817e-03,
+    8.06248395056317706e-04, 6.69767061448271750e-04, 2.14771437204098223e-04,
+    -4.05346158554285049e-04, -2.18799790672692890e-04, -6.57533887969626480e-05,
+    -3.22708307905282787e-05, 1.56395257946964335e-04, 1.50294855653221651e-04,
+    -5.30633689797661900e-01, 3.45675253485649980e-01, 3.11111304555712863e-02,
+    5.20533024190875191e-03, 1.88641039539626286e-03, -1.18862127217450359e-03,
+    -1.11537938592320344e-03, -8.28628432206309352e-04, -4.52692706689404432e-05,
+    3.49029404080334780e-04, 1.79028021962299459e-04, 1.19208023490893856e-04,
+    2.83656873886717833e-06, -1.82278969487337353e-04, -9.98889762861421830e-05,
+    6.71424110666924312e-01, -7.09067400455484775e-01, -1.52024919760260033e-02,
+    3.43439118713115971e-02, -8.80418619448424845e-03, 2.44720828642641241e-04,
+    1.99588584563276583e-03, -1.09155969122136354e-03, 6.14242196364570741e-04,
+    2.71085926953489942e-04, -5.53938992522189999e-04, 1.08661315505672622e-04,
+    -7.75096802259051638e-05, -1.35092453988158387e-04, 3.66296119198793472e-04,
+    -6.38118232192226187e-01, 1.45369280764244357e+00, -1.03827437113616597e-01,
+    -6.75615272145407980e-02, 1.89042294146392897e-02, -2.86158341306018277e-02,
+    8.45380112832388661e-03, 4.77557207934876157e-03, -2.05372535563461221e-03,
+    4.71362282842616078e-03, -2.55315977299946277e-03, -7.42375898782448836e-04,
+    3.18014046733368512e-04, -2.18255501475058105e-03, 1.77412074632863942e-03,
+    -2.21588052861294238e-01, -2.68851753428246676e+00, 3.88390287615017316e-01,
+    -1.75064679757674813e-01, 9.04253790025222187e-02, 9.55861528570881996e-02,
+    -1.87579150501596889e-02, 5.22163033432977708e-02, -2.95069935247388761e-02,
+    2.92926044449548116e-03, -1.10076745847302714e-02, -1.63478455115320144e-02,
+    7.25700511001401219e-03, -1.34138592452280499e-02, 1.42669975642177559e-02,
+    3.29695301922133321e+00, 3.32850916566431820e+00, -9.99074677749675205e-02,
+    1.24863220144774267e+00, -3.98783138212619293e-01, 3.10842702404709292e-01,
+    -2.64136313508948950e-01, -3.26900459679818692e-02, -1.05330555394300682e-01,
+    -1.29312149013602856e-01, 9.07827018250493417e-03, -1.21411380913348910e-01,
+    7.44053397379742937e-02, -6.90121222176613147e-02, 9.54161169387399144e-02,
+    -7.89723367860820868e+00, 1.35967607654563705e+00, -3.01387486159250795e+00,
+    -1.13646137300868211e+00, -1.13084753449797182e+00, -1.28587463886201414e+00,
+    -2.67476322237739539e-01, -1.05323760012656797e+00, 1.65329007322511101e-01,
+    -7.66967590360752571e-01, 3.89203780004535482e-01, -4.93765115369037333e-01,
+    4.97644150508542882e-01, -2.40842610527959661e-01, 5.30120039674914167e-01,
+    1.38323151420833756e+00, -1.27921730419916049e+01, 2.39948854972222136e+00,
+    -6.72627420725248903e+00, 2.51846312628281765e+00, -4.05643294340117055e+00,
+    2.46322122110805752e+00, -2.57887575735160945e+00, 2.37979353520100956e+00,
+    -1.64346316507512635e+00, 2.30899586552747271e+00, -9.82244973147566758e-01,
+    2.26379906808161957e+00, -4.61131259140744487e-01, 2.24840644273108037e+00,
+    1.85195283806486266e+01, -4.98637048529086524e-01, 1.32140741919877449e+01,
+    -4.30188789492397583e-01, 1.05076381875892508e+01, -3.41261496166578027e-01,
+    8.90102988814175866e+00, -2.59424689200121350e-01, 7.89945905753004851e+00,
+    -1.86045902016284709e-01, 7.28474649056431200e+00, -1.19804290330574256e-01,
+    6.94961444805206074e+00, -5.86045788857463973e-02, 6.84298195647076213e+00,
+    1.42293821286140929e+01, 1.85993506237102402e+01, 1.44399073424598381e+01,
+    1.35839211173463603e+01, 1.44462617648871010e+01, 1.01833476322886600e+01,
+    1.43950277263754991e+01, 7.55628074796858318e+00, 1.43324452958882045e+01,
+    5.37185348586856026e+00, 1.42785740568227748e+01, 3.45426809388403333e+00,
+    1.42431950835361629e+01, 1.69137951952238064e+00, 1.42309425443800279e+01,
+    6.30197985479334744e+00, 2.51644726856788203e+01, 1.08065249138979951e+01,
+    2.10062073041128095e+01, 1.38620782190319716e+01, 1.72534325870271168e+01,
+    1.60650314608033611e+01, 1.36778030439440261e+01, 1.76445217656663651e+01,
+    1.01977439029860921e+01, 1.87143320796240573e+01, 6.77298165933160767e+00,
+    1.93357061672768857e+01, 3.37939988193288166e+00, 1.95396510778120316e+01,
+};
+
+static const real_t RadauIIA29_transf2_T[225] = {
+    1.43967828273537659e+01, 3.85682557048762575e+01, 1.91882618053789002e+01,
+    -3.42832834415141861e+01, 1.89235304959483797e+00, 1.16063361210791829e+01,
+    -1.02609966635411176e+01, 6.39711387492872685e+00, -3.65908063903749392e+00,
+    2.10627201431929700e+00, -1.26521301503918693e+00, 7.99284317082919360e-01,
+    -5.23299549943826325e-01, 3.34795617335032714e-01, -1.26389792377082755e-01,
+    -1.38849686821597587e+01, -3.45992000717526205e+00, 3.92039056802907311e+01,
+    1.33306884977749718e+01, -2.58906024572529141e+01, 1.20278966391006765e+01,
+    -1.96551543905492343e+00, -1.63164082685686052e+00, 2.28294742681723628e+00,
+    -2.04593212224540677e+00, 1.64879851308896419e+00, -1.28311263160723543e+00,
+    9.70696523537998845e-01, -6.78992088888472956e-01, 2.66095688237222128e-01,
+    -1.19285018378917152e+03, -1.28849322027661810e+03, 7.11482133659937176e+02,
+    1.24541650836993085e+03, -1.93168561020664129e+02, -1.92829925746712718e+02,
+    8.37620733617012547e+01, -6.46906844594445563e+00, -8.21481190462875510e+00,
+    4.71825299195499070e+00, -4.04276208223193934e-01, -1.85677194482579400e+00,
+    2.53224502055616085e+00, -2.23606230500413083e+00, 9.49883278630762384e-01,
+    -4.63227391010117742e+02, -1.76328072289533588e+03, -1.85161759768864249e+03,
+    2.20456810364971659e+02, 5.98325552346138579e+02, -1.70270247139562173e+02,
+    -2.03546246374460758e+01, 1.92431251830566197e+01, 2.45828073980324513e+00,
+    -1.11159550260638511e+01, 1.17999301147816773e+01, -9.92347274364053611e+00,
+    7.61718146563531739e+00, -5.30789081932707152e+00, 2.07160482446276184e+00,
+    1.03153550595253073e+04, 4.09934278394138687e+02, -1.99610993385340553e+04,
+    -1.34350350466253476e+04, 1.13795084883462528e+03, 1.62541182813738965e+03,
+    -1.54829575890818063e+02, -1.08952540401910028e+02, 4.59799583117645767e+01,
+    -2.72723427737730013e+01, 3.17881007396556683e+01, -3.38348963638740798e+01,
+    3.03698857904057746e+01, -2.30622567490608255e+01, 9.30522462543102868e+00,
+    1.98549281208657958e+04, 3.51243939113444067e+04, 1.91096138902373059e+04,
+    -5.24564008658610237e+03, -5.41643500252468675e+03, 3.92759634321112060e+02,
+    4.19310667082424743e+02, -8.01905900957898723e+01, 2.44143146002644063e+00,
+    -1.31118668081438834e+01, 1.62041024704664984e+01, -1.09247928379135590e+01,
+    5.27844149060139500e+00, -1.88594510107869207e+00, 4.05120231927142027e-01,
+    1.06142995985901143e+04, 1.09891434839765512e+05, 1.64723330756952288e+05,
+    7.72733263779656700e+04, 1.38666438339577599e+03, -6.38476217194172023e+03,
+    -6.69280497495422992e+02, 1.51494753713266675e+02, 9.65860775130809373e+01,
+    -6.66638025095864322e+01, 5.81289534942438237e+01, -5.33977210247168301e+01,
+    4.17258124698576793e+01, -2.78803585684282069e+01, 1.05080813077026161e+01,
+    -1.77905618658104708e+05, -2.39588956018558965e+05, -8.81445920065363898e+04,
+    3.35299443188684163e+04, 2.70055497364416442e+04, 2.32889717948539283e+03,
+    -1.25506802674870551e+03, -1.18165888614663643e+02, -2.10024213968667333e+01,
+    6.84384937513017348e+01, -6.70263922314563985e+01, 7.07176058942669670e+01,
+    -6.94520479483453954e+01, 5.67122652712079969e+01, -2.36159321645299904e+01,
+    -3.79950954781061097e+05, -7.86897100709858583e+05, -7.03307437133901636e+05,
+    -2.80841380968115700e+05, -3.16238845385818240e+04, 9.88860215298004914e+03,
+    3.18280590830940491e+03, 3.07777450829923112e+02, -1.20928068577494400e+02,
+    7.29850104778514037e+01, -9.88704057980258142e+01, 1.06641472570199866e+02,
+    -1.08089829096732686e+02, 9.28762094893302361e+01, -3.97458243045328103e+01,
+    6.95751168210172327e+05, 8.01804066595987184e+05, 2.25651200818427838e+05,
+    -1.05888112528798723e+05, -7.88381298046263983e+04, -1.52761818362553695e+04,
+    -1.74174655984277962e+01, 5.85348839259466899e+02, -6.64328612317260081e+01,
+    1.42025543826222560e+02, -1.45962746528998167e+02, 1.37214908793091325e+02,
+    -1.20638300744464047e+02, 9.07563044756227413e+01, -3.63331919415118989e+01,
+    1.68637204266641964e+06, 2.63056581543662539e+06, 1.84615581341225980e+06,
+    6.86809574722875492e+05, 1.26439875624070133e+05, 4.66780064966682858e+03,
+    -3.22153045407693162e+03, -5.73352503330825471e+02, -3.34437541465671359e+02,
+    2.35662047371669274e+02, -2.53044670321886741e+02, 2.51675014620363299e+02,
+    -2.31199494433785674e+02, 1.84012274856221040e+02, -7.60295387369181412e+01,
+    -1.38525970322969859e+06, -1.45158442816268653e+06, -3.40934988521053456e+05,
+    1.84963930272225931e+05, 1.33994717162085406e+05, 3.55207982216372475e+04,
+    4.92401437795671700e+03, 1.75423182361722496e+02, 3.49232648888657664e+01,
+    -1.04294950402256347e+02, 9.88656743072579474e+01, -1.13712790520133211e+02,
+    1.17645014726411901e+02, -1.04088818423684089e+02, 4.54911490834308907e+01,
+    -3.71164435779177304e+06, -5.16410317923076823e+06, -3.21804975334894238e+06,
+    -1.16325750853682309e+06, -2.65007725452331884e+05, -3.97244137562093238e+04,
+    -3.79325891430101001e+03, -2.04507256275261739e+02, 7.88664503251832372e+01,
+    -4.78996726804562201e+01, 6.83651316990446958e+01, -7.36081696885148773e+01,
+    7.82423096927967094e+01, -7.01475051989448701e+01, 3.10664398558823436e+01,
+    1.29849407233671728e+06, 1.29109160300670168e+06, 2.72783837739127222e+05,
+    -1.61573556763997156e+05, -1.15822411858890497e+05, -3.55576423679711588e+04,
+    -6.73497768132847705e+03, -1.34062127792925753e+03, 1.71806996064294339e+02,
+    -3.49440042338336582e+02, 3.46893108690179758e+02, -3.52878588879649783e+02,
+    3.32425597495071429e+02, -2.71608248384478543e+02, 1.14193830224715953e+02,
+    2.38547206864926079e+06, 3.21138302035041386e+06, 1.92970847525670053e+06,
+    6.92239890225794399e+05, 1.67858395342584263e+05, 3.01085848869924121e+04,
+    4.58259245675661805e+03, 4.27612050035823188e+02, 2.45807016436803224e+02,
+    -1.73635764891979306e+02, 1.95302379410230770e+02, -1.96418212485714520e+02,
+    1.86942370106845857e+02, -1.53897097141448285e+02, 6.50721237661812921e+01,
+};
+
+static const collocation_table Radau_tables[RADAU_MAX_STAGES] = {
+    {RadauIIA1_c, RadauIIA1_A, RadauIIA1_b, NULL, NULL, NULL, NULL, NULL},
+    {RadauIIA3_c, RadauIIA3_A, RadauIIA3_b, RadauIIA3_eig, RadauIIA3_transf1, RadauIIA3_transf2,
+     RadauIIA3_transf1_T, RadauIIA3_transf2_T},
+    {RadauIIA5_c, RadauIIA5_A, RadauIIA5_b, RadauIIA5_eig, RadauIIA5_transf1, RadauIIA5_transf2,
+     RadauIIA5_transf1_T, RadauIIA5_transf2_T},
+    {RadauIIA7_c, RadauIIA7_A, RadauIIA7_b, RadauIIA7_eig, RadauIIA7_transf1, RadauIIA7_transf2,
+     RadauIIA7_transf1_T, RadauIIA7_transf2_T},
+    {RadauIIA9_c, RadauIIA9_A, RadauIIA9_b, RadauIIA9_eig, RadauIIA9_transf1, RadauIIA9_transf2,
+     RadauIIA9_transf1_T, RadauIIA9_transf2_T},
+    {RadauIIA11_c, RadauIIA11_A, RadauIIA11_b, RadauIIA11_eig,
+     RadauIIA11_transf1, RadauIIA11_transf2, RadauIIA11_transf1_T,
+     RadauIIA11_transf2_T},
+    {RadauIIA13_c, RadauIIA13_A, RadauIIA13_b, RadauIIA13_eig,
+     RadauIIA13_transf1, RadauIIA13_transf2, RadauIIA13_transf1_T,
+     RadauIIA13_transf2_T},
+    {RadauIIA15_c, RadauIIA15_A, RadauIIA15_b, RadauIIA15_eig,
+     RadauIIA15_transf1, RadauIIA15_transf2, RadauIIA15_transf1_T,
+     RadauIIA15_transf2_T},
+    {RadauIIA17_c, RadauIIA17_A, RadauIIA17_b, RadauIIA17_eig,
+     RadauIIA17_transf1, RadauIIA17_transf2, RadauIIA17_transf1_T,
+     RadauIIA17_transf2_T},
+    {RadauIIA19_c, RadauIIA19_A, RadauIIA19_b, RadauIIA19_eig,
+     RadauIIA19_transf1, RadauIIA19_transf2, RadauIIA19_transf1_T,
+     RadauIIA19_transf2_T},
+    {RadauIIA21_c, RadauIIA21_A, RadauIIA21_b, RadauIIA21_eig,
+     RadauIIA21_transf1, RadauIIA21_transf2, RadauIIA21_transf1_T,
+     RadauIIA21_transf2_T},
+    {RadauIIA23_c, RadauIIA23_A, RadauIIA23_b, RadauIIA23_eig,
+     RadauIIA23_transf1, RadauIIA23_transf2, RadauIIA23_transf1_T,
+     RadauIIA23_transf2_T},
+    {RadauIIA25_c, RadauIIA25_A, RadauIIA25_b, RadauIIA25_eig,
+     RadauIIA25_transf1, RadauIIA25_transf2, RadauIIA25_transf1_T,
+     RadauIIA25_transf2_T},
+    {RadauIIA27_c, RadauIIA27_A, RadauIIA27_b, RadauIIA27_eig,
+     RadauIIA27_transf1, RadauIIA27_transf2, RadauIIA27_transf1_T,
+     RadauIIA27_transf2_T},
+    {RadauIIA29_c, RadauIIA29_A, RadauIIA29_b, RadauIIA29_eig,
+     RadauIIA29_transf1, RadauIIA29_transf2, RadauIIA29_transf1_T,
+     RadauIIA29_transf2_T},
+};
+
+const collocation_table *get_Radau_table(const int_t num_stages) {
+    if (num_stages < 1 || num_stages > RADAU_MAX_STAGES) return NULL;
+    return &Radau_tables[num_stages - 1];
+}
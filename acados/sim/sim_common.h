@@ -51,6 +51,28 @@ typedef struct {
                                 casadi_function_t);
     casadi_function_t discrete_model;
 
+    // Implicit model f(xdot1, x1, z, u) = 0 of the first nx1 states with nz
+    // algebraic states, only used by sim_implicit_irk. The remaining nx - nx1
+    // states are a linear output system xdot2 = A_LO*x2 + B_LO*[x1; z; u]
+    // driven by the implicit part, which does not depend on them. If f is
+    // linear in u, B_u = df/du (nx1+nz x nu) and df/du is not evaluated.
+    int_t nz;
+    int_t nx1;
+    casadi_function_t impl_ode;
+    void (*impl_ode_wrapper)(const int_t, const int_t, const int_t, const real_t *,
+                             const real_t *, const real_t *, const real_t *, real_t *,
+                             real_t *, real_t *, real_t *, real_t *, casadi_function_t);
+    real_t *A_LO;  // nx-nx1 x nx-nx1
+    real_t *B_LO;  // nx-nx1 x nx1+nz+nu
+    real_t *B_u;   // NULL if f is nonlinear in u
+
+    // Semilinear model xdot = A_lin*x + B_lin*u + c_lin + g(x), only used by
+    // sim_exact_linear and sim_exp_rk. c_lin may be NULL, g and dg/dx are
+    // evaluated with jacobian_wrapper.
+    real_t *A_lin;
+    real_t *B_lin;
+    real_t *c_lin;
+
     real_t step;
     uint num_steps;
 
@@ -61,6 +83,12 @@ typedef struct {
     real_t CPUtime;
     real_t LAtime;
     real_t ADtime;
+    int_t num_steps;  // accepted integration steps
+    int_t num_rejected_steps;  // steps rejected by the step size control
+    int_t num_recomputed_steps;  // steps recomputed from adjoint checkpoints
+    int_t num_krylov_iter;  // GMRES iterations of matrix-free linear systems
+    int_t num_newton_iter;  // Newton iterations on the stage equations, sim_implicit_irk only
+    int_t num_factorizations;  // of the Newton matrix in these iterations
 } sim_info;
 
 typedef struct {
@@ -76,6 +104,10 @@ typedef struct {
 
 typedef struct {
     int_t (*fun)(const sim_in *, sim_out *, void *, void *, void *);
+    int_t (*calculate_workspace_size)(const sim_in *, void *);
+    // warm start of mem from the memory of the next shooting interval after a
+    // shift of the horizon, NULL for integrators without memory
+    void (*shift_memory)(const sim_in *, void *args, void *mem, const void *next_mem);
     sim_in *in;
     sim_out *out;
     void *args;
@@ -24,21 +24,85 @@
 #include "acados/sim/sim_casadi_wrapper.h"
 #include "acados/sim/sim_common.h"
 
-int_t sim_discrete_model(const sim_in *in, sim_out *out, void *args, void *mem, void *work) {
+static void sim_discrete_model_cast_workspace(sim_discrete_model_workspace *work,
+                                              const sim_in *in) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+
+    char *ptr = (char *)work;
+    ptr += sizeof(sim_discrete_model_workspace);
+    work->jac = NULL;
+    if (in->sens_adj) {
+        work->jac = (real_t *)ptr;
+        ptr += (nx * (nx + nu)) * sizeof(real_t);  // jac
+    }
+}
 
+// One evaluation at (x, u), the Jacobian is written to S_forw if requested
+// and to the workspace otherwise
+static void sim_discrete_model_eval(const sim_in *in, const real_t *x, const real_t *u,
+                                    const real_t *S_adj_seed, real_t *xn, real_t *S_forw,
+                                    real_t *S_adj, sim_discrete_model_workspace *work) {
     int_t nx = in->nx;
     int_t nu = in->nu;
-    real_t *in_array, *out_array;
-    in_array = calloc(nx+nu, sizeof(real_t));
-    out_array = calloc(nx+nx*nu, sizeof(real_t));
-    for (int_t i = 0; i < nx; i++)
-        in_array[i] = in->x[i];
-    for (int_t i = 0; i < nu; i++)
-        in_array[nx+i] = in->u[i];
-    discrete_model_fun(in->nx, in->nu, in_array, out_array, in->discrete_model);
-    for (int_t i = 0; i < nx; i++)
-        out->xn[i] = out_array[i];
-    for (int_t i = 0; i < nx * (nx+nu); i++)
-        out->S_forw[i] = out_array[nx+i];
+
+    real_t *jac = NULL;
+    if (in->sens_forw)
+        jac = S_forw;
+    else if (in->sens_adj)
+        jac = work->jac;
+    discrete_model_fun(nx, nu, x, u, xn, jac, in->discrete_model);
+
+    if (in->sens_adj) {
+        for (int_t j = 0; j < nx + nu; j++) {
+            S_adj[j] = (j < nx) ? 0.0 : S_adj_seed[j];
+            for (int_t i = 0; i < nx; i++)
+                S_adj[j] += jac[j * nx + i] * S_adj_seed[i];
+        }
+    }
+}
+
+int_t sim_discrete_model(const sim_in *in, sim_out *out, void *args, void *mem, void *work_) {
+    (void)args;
+    (void)mem;
+
+    sim_discrete_model_workspace *work = (sim_discrete_model_workspace *)work_;
+    sim_discrete_model_cast_workspace(work, in);
+
+    sim_discrete_model_eval(in, in->x, in->u, in->S_adj, out->xn, out->S_forw, out->S_adj, work);
     return 0;
 }
+
+int_t sim_discrete_model_batch(const sim_in *in, int_t num_points, const real_t *x,
+                               const real_t *u, const real_t *S_adj_seed, real_t *xn,
+                               real_t *S_forw, real_t *S_adj, void *work_) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+
+    sim_discrete_model_workspace *work = (sim_discrete_model_workspace *)work_;
+    sim_discrete_model_cast_workspace(work, in);
+
+    for (int_t k = 0; k < num_points; k++)
+        sim_discrete_model_eval(in, &x[k * nx], &u[k * nu],
+                                in->sens_adj ? &S_adj_seed[k * (nx + nu)] : NULL, &xn[k * nx],
+                                in->sens_forw ? &S_forw[k * nx * (nx + nu)] : NULL,
+                                in->sens_adj ? &S_adj[k * (nx + nu)] : NULL, work);
+    return 0;
+}
+
+int_t sim_discrete_model_calculate_workspace_size(const sim_in *in, void *args) {
+    (void)args;
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+
+    int_t size = sizeof(sim_discrete_model_workspace);
+    if (in->sens_adj)
+        size += (nx * (nx + nu)) * sizeof(real_t);  // jac
+    return size;
+}
+
+void sim_discrete_model_initialize(const sim_in *in, void *args, void **work) {
+    *work = malloc(sim_discrete_model_calculate_workspace_size(in, args));
+}
+
+void sim_discrete_model_destroy(void *work) { free(work); }
@@ -25,8 +25,29 @@ extern "C" {
 #endif
 
 #include "acados/sim/sim_common.h"
+#include "acados/utils/types.h"
 
-int_t sim_discrete_model(const sim_in *, sim_out *, void *, void *, void *);
+typedef struct {
+    real_t *jac;  // df/d(x,u), for adjoints without forward sensitivities
+} sim_discrete_model_workspace;
+
+// xn = f(x, u). With in->sens_forw, out->S_forw is the Jacobian df/d(x,u),
+// nx*(nx+nu) column-major. With in->sens_adj, out->S_adj is the seed in->S_adj
+// of the next states propagated back to (x, u), plus the seed of the controls.
+int_t sim_discrete_model(const sim_in *in, sim_out *out, void *args, void *mem, void *work);
+
+// Evaluates the model of in at num_points pairs x[k*nx], u[k*nu]. The outputs
+// xn[k*nx], S_forw[k*nx*(nx+nu)] and S_adj[k*(nx+nu)] and the adjoint seeds
+// S_adj_seed[k*(nx+nu)] are laid out the same way, S_forw and S_adj are only
+// written with in->sens_forw and in->sens_adj.
+int_t sim_discrete_model_batch(const sim_in *in, int_t num_points, const real_t *x,
+                               const real_t *u, const real_t *S_adj_seed, real_t *xn,
+                               real_t *S_forw, real_t *S_adj, void *work);
+
+int_t sim_discrete_model_calculate_workspace_size(const sim_in *in, void *args);
+
+void sim_discrete_model_initialize(const sim_in *in, void *args, void **work);
+void sim_discrete_model_destroy(void *work);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -19,6 +19,7 @@
 
 #include "acados/sim/sim_erk_integrator.h"
 
+#include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -27,6 +28,68 @@
 
 #include "acados/utils/print.h"
 
+// Number of steps the trajectories of the adjoint sweep are sized for
+static int_t sim_erk_max_num_steps(const sim_in *in, const sim_RK_opts *opts) {
+    if (opts->b_hat != NULL) return opts->max_num_steps;
+    return in->num_steps;
+}
+
+// Number of steps per segment of the trajectory stored for the adjoint sweep,
+// the whole trajectory is one segment if it fits adj_traj_budget
+static int_t sim_erk_checkpoint_interval(const sim_in *in, const sim_RK_opts *opts, int_t NF) {
+    int_t max_num_steps = sim_erk_max_num_steps(in, opts);
+    if (opts->adj_traj_budget <= 0) return max_num_steps;
+
+    // K_traj and out_forw_traj of one segment and the checkpoints, the
+    // smallest size if none of them fits
+    real_t state_size = in->nx * (1 + NF) * sizeof(real_t);
+    int_t best_k = max_num_steps;
+    real_t best_size = 0.0;
+    for (int_t k = max_num_steps; k > 0; k--) {
+        int_t num_segments = (max_num_steps + k - 1) / k;
+        real_t size = state_size * (k * (opts->num_stages + 1) + 1 + num_segments);
+        if (size <= opts->adj_traj_budget) return k;
+        if (k == max_num_steps || size < best_size) {
+            best_k = k;
+            best_size = size;
+        }
+    }
+    return best_k;
+}
+
+// First same as last: the last stage is evaluated at the new states, so it is
+// the first stage of the next step
+static bool sim_erk_fsal(const sim_RK_opts *opts) {
+    int_t num_stages = opts->num_stages;
+    if (num_stages < 2 || opts->b_vec[num_stages - 1] != 0.0) return false;
+    for (int_t j = 0; j < num_stages - 1; j++)
+        if (opts->A_mat[j * num_stages + num_stages - 1] != opts->b_vec[j]) return false;
+    return true;
+}
+
+// Stages first_stage, ..., num_stages-1 of one step of size h from the states
+// and sensitivities x, the stages before first_stage are given in K
+static void sim_erk_stages(const sim_in *in, const sim_RK_opts *opts, int_t NF, real_t h,
+                           const real_t *x, real_t *K, int_t first_stage, real_t *rhs_forw_in,
+                           real_t *timing_ad) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t num_stages = opts->num_stages;
+    acados_timer timer_ad;
+
+    for (int_t s = first_stage; s < num_stages; s++) {
+        for (int_t i = 0; i < nx * (1 + NF); i++)
+            rhs_forw_in[i] = x[i];
+        for (int_t j = 0; j < s; j++)
+            for (int_t i = 0; i < nx * (1 + NF); i++)
+                rhs_forw_in[i] += h * opts->A_mat[j * num_stages + s] *
+                                    K[j * nx * (1 + NF) + i];
+        acados_tic(&timer_ad);
+        in->forward_vde_wrapper(nx, nu, rhs_forw_in, &(K[s*nx*(1+NF)]), in->vde);
+        *timing_ad += acados_toc(&timer_ad);
+    }
+}
+
 static void sim_erk_cast_workspace(sim_erk_workspace *work, const sim_in *in, void *args) {
     int_t nx = in->nx;
     int_t nu = in->nu;
@@ -37,24 +100,32 @@ static void sim_erk_cast_workspace(sim_erk_workspace *work, const sim_in *in, vo
         NF = 0;
     }
     int_t nhess = (NF + 1) * NF / 2;
+    int_t max_num_steps = sim_erk_max_num_steps(in, opts);
 
     char *ptr = (char *)work;
     ptr += sizeof(sim_erk_workspace);
     work->rhs_forw_in = (real_t *)ptr;
     ptr += (nx * (1 + NF) + nu) * sizeof(real_t);  // rhs_forw_in
 
+    if (opts->b_hat != NULL) {
+        work->step_traj = (real_t *)ptr;
+        ptr += max_num_steps * sizeof(real_t);  // step_traj
+    }
+
     if (!in->sens_adj) {
         work->K_traj = (real_t *)ptr;
         ptr += (num_stages * nx * (1 + NF)) * sizeof(real_t);  // K_traj
         work->out_forw_traj = (real_t *)ptr;
         ptr += (nx * (1 + NF)) * sizeof(real_t);  // out_forw_traj
     } else {
+        int_t k = sim_erk_checkpoint_interval(in, opts, NF);
         work->K_traj = (real_t *)ptr;
-        ptr +=
-            (in->num_steps * num_stages * nx * (1 + NF)) * sizeof(real_t);  // K_traj
+        ptr += (k * num_stages * nx * (1 + NF)) * sizeof(real_t);  // K_traj
         work->out_forw_traj = (real_t *)ptr;
-        ptr +=
-            ((in->num_steps + 1) * nx * (1 + NF)) * sizeof(real_t);  // out_forw_traj
+        ptr += ((k + 1) * nx * (1 + NF)) * sizeof(real_t);  // out_forw_traj
+        work->checkpoint_traj = (real_t *)ptr;
+        ptr += (((max_num_steps + k - 1) / k) * nx * (1 + NF)) *
+               sizeof(real_t);  // checkpoint_traj
     }
 
     if (in->sens_hess && in->sens_adj) {
@@ -75,6 +146,7 @@ static void sim_erk_cast_workspace(sim_erk_workspace *work, const sim_in *in, vo
 }
 
 int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem, void *work_) {
+    if (((sim_RK_opts *)args)->num_stages == 0) return -1;
 
     sim_erk_workspace *work = (sim_erk_workspace *)work_;
     sim_erk_cast_workspace(work, in, args);
@@ -90,6 +162,8 @@ int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem, void *work_
     real_t *A_mat = opts->A_mat;
     real_t *b_vec = opts->b_vec;
     //    real_t *c_vec = opts->c_vec;
+    int_t nx = in->nx;
+    int_t nu = in->nu;
 
     real_t *K_traj = work->K_traj;
     real_t *forw_traj = work->out_forw_traj;
@@ -102,8 +176,10 @@ int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem, void *work_
     acados_timer timer, timer_ad;
     real_t timing_ad = 0.0;
 
-    int_t nx = in->nx;
-    int_t nu = in->nu;
+    // the adjoint sweep keeps the trajectory of segments of k steps
+    int_t k = sim_erk_checkpoint_interval(in, opts, NF);
+    int_t nxf = nx * (1 + NF);
+
     acados_tic(&timer);
     for (int_t i = 0; i < nx; i++)
         forw_traj[i] = in->x[i];
@@ -115,29 +191,100 @@ int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem, void *work_
     for (int_t i = 0; i < nu; i++)
         rhs_forw_in[nx * (1 + NF) + i] = in->u[i];
 
+    // With an embedded pair the step size is chosen on the nominal states only.
+    // The sensitivities are propagated through the accepted steps with the step
+    // sizes held fixed, so they are the exact derivatives of the discrete map.
+    int_t num_stages = opts->num_stages;
+    real_t *b_hat = opts->b_hat;
+    real_t T = in->step * in->num_steps;
+    real_t t = 0.0;
+    real_t h = in->step;
+    real_t factor = 1.0;
+    int_t num_steps = 0;
+    int_t num_rejected_steps = 0;
+    int_t num_recomputed_steps = 0;
+    int_t status = ACADOS_SUCCESS;
+
+    // with FSAL the first stage of a step is taken from the accepted step
+    // before, or from the rejected attempt of the same step
+    bool fsal = sim_erk_fsal(opts);
+    real_t *K_first = NULL;
+
     // FORWARD SWEEP:
-    for (int_t istep = 0; istep < in->num_steps; istep++) {
+    while (b_hat == NULL ? num_steps < (int_t) in->num_steps : T - t > ACADOS_EPS * T) {
+        if (b_hat != NULL) {
+            if (num_steps == opts->max_num_steps) {
+                status = ACADOS_MAXITER;
+                break;
+            }
+            if (t + h > T) h = T - t;
+        }
         if (in->sens_adj) {
-            K_traj = &work->K_traj[istep * opts->num_stages * nx * (1 + NF)];
-            forw_traj = &work->out_forw_traj[(istep + 1) * nx * (1 + NF)];
-            for (int_t i = 0; i < nx * (1 + NF); i++)
-                forw_traj[i] = forw_traj[i - nx * (1 + NF)];
+            int_t j = num_steps % k;  // step within the current segment
+            if (j == 0) {  // new segment, starting at a checkpoint
+                if (num_steps > 0)
+                    for (int_t i = 0; i < nxf; i++)
+                        work->out_forw_traj[i] = work->out_forw_traj[k * nxf + i];
+                for (int_t i = 0; i < nxf; i++)
+                    work->checkpoint_traj[(num_steps / k) * nxf + i] = work->out_forw_traj[i];
+            }
+            K_traj = &work->K_traj[j * num_stages * nxf];
+            forw_traj = &work->out_forw_traj[(j + 1) * nxf];
+            for (int_t i = 0; i < nxf; i++)
+                forw_traj[i] = forw_traj[i - nxf];
         }
 
-        for (int_t s = 0; s < opts->num_stages; s++) {
-            for (int_t i = 0; i < nx * (1 + NF); i++)
-                rhs_forw_in[i] = forw_traj[i];
-            for (int_t j = 0; j < s; j++)
-                for (int_t i = 0; i < nx * (1 + NF); i++)
-                    rhs_forw_in[i] += in->step * A_mat[j * opts->num_stages + s] *
-                                        K_traj[j * nx * (1 + NF) + i];
-            acados_tic(&timer_ad);
-            in->forward_vde_wrapper(nx, nu, rhs_forw_in, &(K_traj[s*nx*(1+NF)]), in->vde);
-            timing_ad += acados_toc(&timer_ad);
+        int_t first_stage = 0;
+        if (K_first != NULL) {
+            if (K_first != K_traj)
+                for (int_t i = 0; i < nxf; i++)
+                    K_traj[i] = K_first[i];
+            first_stage = 1;
         }
-        for (int_t s = 0; s < opts->num_stages; s++)
+        sim_erk_stages(in, opts, NF, h, forw_traj, K_traj, first_stage, rhs_forw_in, &timing_ad);
+
+        if (b_hat != NULL) {
+            // scaled RMS norm of the difference to the embedded solution
+            real_t err = 0.0;
+            for (int_t i = 0; i < nx; i++) {
+                real_t x_new = forw_traj[i];
+                real_t x_err = 0.0;
+                for (int_t s = 0; s < num_stages; s++) {
+                    x_new += h * b_vec[s] * K_traj[s * nx * (1 + NF) + i];
+                    x_err += h * (b_vec[s] - b_hat[s]) * K_traj[s * nx * (1 + NF) + i];
+                }
+                real_t scale = opts->abs_tol +
+                               opts->rel_tol * fmax(fabs(forw_traj[i]), fabs(x_new));
+                err += (x_err / scale) * (x_err / scale);
+            }
+            err = sqrt(err / nx);
+
+            factor = 5.0;
+            if (err > 0.0) factor = 0.9 * pow(err, -1.0 / (opts->embedded_order + 1));
+            factor = fmin(5.0, fmax(0.2, factor));
+            if (err > 1.0) {  // reject
+                num_rejected_steps++;
+                if (fsal) K_first = K_traj;
+                h *= fmin(1.0, factor);
+                if (h < ACADOS_EPS * T) {
+                    status = ACADOS_MINSTEP;
+                    break;
+                }
+                continue;
+            }
+            work->step_traj[num_steps] = h;
+        }
+
+        for (int_t s = 0; s < num_stages; s++)
             for (int_t i = 0; i < nx * (1 + NF); i++)
-                forw_traj[i] += in->step * b_vec[s] * K_traj[s * nx * (1 + NF) + i];  // ERK step
+                forw_traj[i] += h * b_vec[s] * K_traj[s * nx * (1 + NF) + i];  // ERK step
+        num_steps++;
+        if (fsal) K_first = &K_traj[(num_stages - 1) * nxf];
+
+        if (b_hat != NULL) {
+            t += h;
+            h *= factor;
+        }
     }
     for (int_t i = 0; i < nx; i++)
         out->xn[i] = forw_traj[i];
@@ -147,7 +294,7 @@ int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem, void *work_
     }
 
     // ADJOINT SWEEP:
-    if (in->sens_adj) {
+    if (in->sens_adj && status == ACADOS_SUCCESS) {
         for (int_t i = 0; i < nx + nu; i++)
             adj_tmp[i] = in->S_adj[i];
 
@@ -162,24 +309,63 @@ int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem, void *work_
         for (int_t i = 0; i < nu; i++)
             rhs_adj_in[nForw + nx + i] = in->u[i];
 
-        for (int_t istep = in->num_steps - 1; istep > -1; istep--) {
-            K_traj = &work->K_traj[istep * opts->num_stages * nx * (1 + NF)];
-            forw_traj = &work->out_forw_traj[istep * nx * (1 + NF)];
+        // the last segment is still stored from the forward sweep
+        int_t last_segment = (num_steps - 1) / k;
+        for (int_t istep = num_steps - 1; istep > -1; istep--) {
+            int_t j = istep % k;
+            if (istep / k != last_segment && j == k - 1) {
+                // recompute the segment from its checkpoint
+                forw_traj = work->out_forw_traj;
+                for (int_t i = 0; i < nxf; i++)
+                    forw_traj[i] = work->checkpoint_traj[(istep / k) * nxf + i];
+                for (int_t jj = 0; jj < k; jj++) {
+                    h = (b_hat != NULL) ? work->step_traj[istep - j + jj] : in->step;
+                    K_traj = &work->K_traj[jj * num_stages * nxf];
+                    int_t first_stage = 0;
+                    if (fsal && jj > 0) {
+                        for (int_t i = 0; i < nxf; i++)
+                            K_traj[i] = K_traj[i - nxf];  // last stage of the step before
+                        first_stage = 1;
+                    }
+                    sim_erk_stages(in, opts, NF, h, forw_traj, K_traj, first_stage, rhs_forw_in,
+                                   &timing_ad);
+                    for (int_t i = 0; i < nxf; i++)
+                        forw_traj[nxf + i] = forw_traj[i];
+                    for (int_t s = 0; s < num_stages; s++)
+                        for (int_t i = 0; i < nxf; i++)
+                            forw_traj[nxf + i] += h * b_vec[s] * K_traj[s * nxf + i];
+                    forw_traj += nxf;
+                }
+                num_recomputed_steps += k;
+            }
+            K_traj = &work->K_traj[j * num_stages * nxf];
+            forw_traj = &work->out_forw_traj[j * nxf];
+            h = (b_hat != NULL) ? work->step_traj[istep] : in->step;
 
             for (int_t s = opts->num_stages - 1; s > -1; s--) {
+                // a stage that enters neither the step nor later stages has a
+                // zero adjoint, e.g. the last stage of an FSAL method
+                bool unused = (b_vec[s] == 0.0);
+                for (int_t j = s + 1; j < opts->num_stages; j++)
+                    unused = unused && (A_mat[s * opts->num_stages + j] == 0.0);
+                if (unused) {
+                    for (int_t i = 0; i < nAdj; i++)
+                        adj_traj[s * nAdj + i] = 0.0;
+                    continue;
+                }
                 // forward variables:
                 for (int_t i = 0; i < nForw; i++)
                     rhs_adj_in[i] = forw_traj[i];
                 for (int_t j = 0; j < s; j++)
                     for (int_t i = 0; i < nForw; i++)
-                        rhs_adj_in[i] += in->step * A_mat[j * opts->num_stages + s] *
+                        rhs_adj_in[i] += h * A_mat[j * opts->num_stages + s] *
                                          K_traj[j * nx * (1 + NF) + i];
                 // adjoint variables:
                 for (int_t i = 0; i < nx; i++)
-                    rhs_adj_in[nForw + i] = in->step * b_vec[s] * adj_tmp[i];
+                    rhs_adj_in[nForw + i] = h * b_vec[s] * adj_tmp[i];
                 for (int_t j = s + 1; j < opts->num_stages; j++)
                     for (int_t i = 0; i < nx; i++)
-                        rhs_adj_in[nForw + i] += in->step * A_mat[s * opts->num_stages + j] *
+                        rhs_adj_in[nForw + i] += h * A_mat[s * opts->num_stages + j] *
                                                  adj_traj[j * nAdj + i];
                 acados_tic(&timer_ad);
                 in->adjoint_vde_wrapper(nx, nu, rhs_adj_in, &(adj_traj[s*nAdj]), in->vde_adj);
@@ -199,7 +385,13 @@ int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem, void *work_
     out->info->CPUtime = acados_toc(&timer);
     out->info->LAtime = 0.0;
     out->info->ADtime = timing_ad;
-    return 0;  // success
+    out->info->num_steps = num_steps;
+    out->info->num_rejected_steps = num_rejected_steps;
+    out->info->num_recomputed_steps = num_recomputed_steps;
+    out->info->num_krylov_iter = 0;
+    out->info->num_newton_iter = 0;
+    out->info->num_factorizations = 0;
+    return status;
 }
 
 int_t sim_erk_calculate_workspace_size(const sim_in *in, void *args) {
@@ -212,18 +404,22 @@ int_t sim_erk_calculate_workspace_size(const sim_in *in, void *args) {
         NF = 0;
     }
     int_t nhess = (int_t)(NF + 1) * (real_t)NF / 2.0;
+    int_t max_num_steps = sim_erk_max_num_steps(in, opts);
 
     int_t size = sizeof(sim_erk_workspace);
     size += (nx * (1 + NF) + nu) * sizeof(real_t);  // rhs_forw_in
+    if (opts->b_hat != NULL)
+        size += max_num_steps * sizeof(real_t);  // step_traj
 
     if (!in->sens_adj) {
         size += (num_stages * nx * (1 + NF)) * sizeof(real_t);  // K_traj
         size += (nx * (1 + NF)) * sizeof(real_t);               // out_forw_traj
     } else {
-        size +=
-            (in->num_steps * num_stages * nx * (1 + NF)) * sizeof(real_t);  // K_traj
-        size +=
-            ((in->num_steps + 1) * nx * (1 + NF)) * sizeof(real_t);  // out_forw_traj
+        int_t k = sim_erk_checkpoint_interval(in, opts, NF);
+        size += (k * num_stages * nx * (1 + NF)) * sizeof(real_t);  // K_traj
+        size += ((k + 1) * nx * (1 + NF)) * sizeof(real_t);         // out_forw_traj
+        size += (((max_num_steps + k - 1) / k) * nx * (1 + NF)) *
+                sizeof(real_t);  // checkpoint_traj
     }
 
     if (in->sens_hess && in->sens_adj) {
@@ -238,35 +434,63 @@ int_t sim_erk_calculate_workspace_size(const sim_in *in, void *args) {
     return size;
 }
 
+static void sim_erk_set_table(sim_RK_opts *opts, const erk_table *table) {
+    int_t num_stages = table->num_stages;
+    opts->scheme.type = exact;
+    opts->num_stages = num_stages;
+    opts->A_mat = calloc(num_stages * num_stages, sizeof(*opts->A_mat));
+    opts->b_vec = calloc(num_stages, sizeof(*opts->b_vec));
+    opts->c_vec = calloc(num_stages, sizeof(*opts->c_vec));
+    memcpy(opts->A_mat, table->A, sizeof(*opts->A_mat) * (num_stages * num_stages));
+    memcpy(opts->b_vec, table->b, sizeof(*opts->b_vec) * (num_stages));
+    memcpy(opts->c_vec, table->c, sizeof(*opts->c_vec) * (num_stages));
+    opts->b_hat = NULL;
+    if (table->b_hat != NULL) {
+        opts->b_hat = calloc(num_stages, sizeof(*opts->b_hat));
+        memcpy(opts->b_hat, table->b_hat, sizeof(*opts->b_hat) * (num_stages));
+        opts->embedded_order = table->embedded_order;
+        opts->abs_tol = 1e-8;
+        opts->rel_tol = 1e-6;
+        opts->max_num_steps = 100;
+    }
+    opts->adj_traj_budget = 0;
+}
+
 void sim_erk_create_arguments(void *args, const int_t num_stages) {
     sim_RK_opts *opts = (sim_RK_opts *)args;
-    opts->scheme.type = exact;
+    const char *name = NULL;
     if (num_stages == 1) {
-        opts->num_stages = 1;  // explicit Euler
-        opts->A_mat = calloc(num_stages * num_stages, sizeof(*opts->A_mat));
-        opts->b_vec = calloc(num_stages, sizeof(*opts->b_vec));
-        opts->c_vec = calloc(num_stages, sizeof(*opts->c_vec));
-        opts->A_mat[0] = 0;
-        opts->b_vec[0] = 1.0;
-        opts->c_vec[0] = 0;
+        name = "Euler";
+    } else if (num_stages == 2) {
+        name = "Heun";
+    } else if (num_stages == 3) {
+        name = "RK3";
     } else if (num_stages == 4) {
-        opts->num_stages = 4;  // 4-stage, 4th order ERK method
-        opts->A_mat = calloc(num_stages * num_stages, sizeof(*opts->A_mat));
-        opts->b_vec = calloc(num_stages, sizeof(*opts->b_vec));
-        opts->c_vec = calloc(num_stages, sizeof(*opts->c_vec));
-
-        memcpy(opts->A_mat,
-            ((real_t[]){0, 0.5, 0, 0, 0, 0, 0.5, 0, 0, 0, 0, 1, 0, 0, 0, 0}),
-            sizeof(*opts->A_mat) * (num_stages * num_stages));
-        memcpy(opts->b_vec, ((real_t[]){1.0 / 6, 2.0 / 6, 2.0 / 6, 1.0 / 6}),
-            sizeof(*opts->b_vec) * (num_stages));
-        memcpy(opts->c_vec, ((real_t[]){0.0, 0.5, 0.5, 1.0}),
-            sizeof(*opts->c_vec) * (num_stages));
+        name = "RK4";
+    } else if (num_stages == 7) {
+        name = "DOPRI5";
+    }
+    if (name != NULL) {
+        sim_erk_set_table(opts, get_ERK_table(name));
     } else {
-        // throw error somehow?
+        // no method with this number of stages, sim_erk returns -1
+        opts->scheme.type = exact;
+        opts->num_stages = 0;
+        opts->A_mat = NULL;
+        opts->b_vec = NULL;
+        opts->c_vec = NULL;
+        opts->b_hat = NULL;
+        opts->adj_traj_budget = 0;
     }
 }
 
+int_t sim_erk_create_arguments_by_name(void *args, const char *name) {
+    const erk_table *table = get_ERK_table(name);
+    if (table == NULL) return -1;
+    sim_erk_set_table((sim_RK_opts *)args, table);
+    return 0;
+}
+
 void sim_erk_initialize(const sim_in *in, void *args, void **work) {
     sim_RK_opts *opts = (sim_RK_opts *)args;
 
@@ -276,6 +500,10 @@ void sim_erk_initialize(const sim_in *in, void *args, void **work) {
     } else {
         sim_erk_create_arguments(args, 4);
     }
+    sim_erk_initialize_workspace(in, args, work);
+}
+
+void sim_erk_initialize_workspace(const sim_in *in, void *args, void **work) {
     int_t work_space_size = sim_erk_calculate_workspace_size(in, args);
     *work = (void *)malloc(work_space_size);
 }
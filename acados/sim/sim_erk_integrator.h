@@ -32,6 +32,8 @@ typedef struct {
 
     real_t *rhs_forw_in;
     real_t *out_forw_traj;
+    real_t *step_traj;  // accepted step sizes, with step size control only
+    real_t *checkpoint_traj;  // states at the start of the segments, adjoints only
 
     real_t *adj_traj;
     real_t *rhs_adj_in;
@@ -43,9 +45,41 @@ int_t sim_erk(const sim_in *in, sim_out *out, void *args, void *mem,
 
 int_t sim_erk_calculate_workspace_size(const sim_in *in, void *args);
 
+// Butcher tableau of an explicit Runge-Kutta method, A is strictly lower
+// triangular and stored column-major. b_hat are the weights of the embedded
+// method of order embedded_order, NULL for methods without step size control.
+typedef struct {
+    const char *name;
+    int_t num_stages;
+    int_t order;
+    const real_t *c;
+    const real_t *A;
+    const real_t *b;
+    const real_t *b_hat;
+    int_t embedded_order;
+} erk_table;
+
+// Tableaus: "Euler", "Heun", "RK3", "SSPRK3", "BS3" (Bogacki-Shampine 3(2)),
+// "RK4", "DOPRI5" (Dormand-Prince 5(4)), "RK6" (Butcher, 7 stages) and "RK8"
+// (Cooper-Verner, 11 stages). NULL if the name is unknown.
+const erk_table *get_ERK_table(const char *name);
+
+// num_stages 1: explicit Euler, 2: Heun, 3: Kutta's third order method,
+// 4: classic RK4, all with the fixed step in->step. 7: Dormand-Prince 5(4)
+// with step size control, in->step is the initial step and the integration
+// ends at in->step * in->num_steps.
 void sim_erk_create_arguments(void *args, const int_t num_stages);
 
+// Arguments for the tableau called name, see get_ERK_table. The embedded pairs
+// use step size control. Returns -1 if the name is unknown.
+int_t sim_erk_create_arguments_by_name(void *args, const char *name);
+
+// Creates the arguments of sim_erk_create_arguments for num_stages (4 if not
+// positive) and allocates the workspace.
 void sim_erk_initialize(const sim_in *in, void *args_, void **work);
+// Only allocates the workspace, for arguments that were already created, e.g.
+// by name, and possibly modified.
+void sim_erk_initialize_workspace(const sim_in *in, void *args_, void **work);
 void sim_erk_destroy(void *work);
 
 #ifdef __cplusplus
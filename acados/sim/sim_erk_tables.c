@@ -0,0 +1,271 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "acados/sim/sim_erk_integrator.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "acados/utils/types.h"
+
+// Explicit Runge-Kutta methods: nodes c, strictly lower triangular Butcher table A (column-major)
+// and weights b, and for the embedded pairs the weights b_hat of the embedded method. The values
+// are the exact coefficients rounded to double precision.
+
+static const real_t Euler_c[1] = {
+    0.00000000000000000e+00,
+};
+
+static const real_t Euler_A[1] = {
+    0.00000000000000000e+00,
+};
+
+static const real_t Euler_b[1] = {
+    1.00000000000000000e+00,
+};
+
+static const real_t Heun_c[2] = {
+    0.00000000000000000e+00, 1.00000000000000000e+00,
+};
+
+static const real_t Heun_A[4] = {
+    0.00000000000000000e+00, 1.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00,
+};
+
+static const real_t Heun_b[2] = {
+    5.00000000000000000e-01, 5.00000000000000000e-01,
+};
+
+static const real_t RK3_c[3] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RK3_A[9] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, -1.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 2.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+};
+
+static const real_t RK3_b[3] = {
+    1.66666666666666657e-01, 6.66666666666666630e-01, 1.66666666666666657e-01,
+};
+
+static const real_t SSPRK3_c[3] = {
+    0.00000000000000000e+00, 1.00000000000000000e+00, 5.00000000000000000e-01,
+};
+
+static const real_t SSPRK3_A[9] = {
+    0.00000000000000000e+00, 1.00000000000000000e+00, 2.50000000000000000e-01,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 2.50000000000000000e-01,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+};
+
+static const real_t SSPRK3_b[3] = {
+    1.66666666666666657e-01, 1.66666666666666657e-01, 6.66666666666666630e-01,
+};
+
+static const real_t BS3_c[4] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, 7.50000000000000000e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t BS3_A[16] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, 0.00000000000000000e+00,
+    2.22222222222222210e-01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    7.50000000000000000e-01, 3.33333333333333315e-01, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 4.44444444444444420e-01,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00,
+};
+
+static const real_t BS3_b[4] = {
+    2.22222222222222210e-01, 3.33333333333333315e-01, 4.44444444444444420e-01,
+    0.00000000000000000e+00,
+};
+
+static const real_t BS3_b_hat[4] = {
+    2.91666666666666685e-01, 2.50000000000000000e-01, 3.33333333333333315e-01,
+    1.25000000000000000e-01,
+};
+
+static const real_t RK4_c[4] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, 5.00000000000000000e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RK4_A[16] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    5.00000000000000000e-01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 1.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00,
+};
+
+static const real_t RK4_b[4] = {
+    1.66666666666666657e-01, 3.33333333333333315e-01, 3.33333333333333315e-01,
+    1.66666666666666657e-01,
+};
+
+static const real_t DOPRI5_c[7] = {
+    0.00000000000000000e+00, 2.00000000000000011e-01, 2.99999999999999989e-01,
+    8.00000000000000044e-01, 8.88888888888888840e-01, 1.00000000000000000e+00,
+    1.00000000000000000e+00,
+};
+
+static const real_t DOPRI5_A[49] = {
+    0.00000000000000000e+00, 2.00000000000000011e-01, 7.49999999999999972e-02,
+    9.77777777777777746e-01, 2.95259868922420354e+00, 2.84627525252525260e+00,
+    9.11458333333333287e-02, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    2.25000000000000006e-01, -3.73333333333333339e+00, -1.15957933241883850e+01,
+    -1.07575757575757578e+01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 3.55555555555555536e+00,
+    9.82289285169943582e+00, 8.90642271774347272e+00, 4.49236298292902070e-01,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, -2.90809327846364873e-01, 2.78409090909090884e-01,
+    6.51041666666666630e-01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    -2.73531303602058296e-01, -3.22376179245283001e-01, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 1.30952380952380959e-01,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00,
+};
+
+static const real_t DOPRI5_b[7] = {
+    9.11458333333333287e-02, 0.00000000000000000e+00, 4.49236298292902070e-01,
+    6.51041666666666630e-01, -3.22376179245283001e-01, 1.30952380952380959e-01,
+    0.00000000000000000e+00,
+};
+
+static const real_t DOPRI5_b_hat[7] = {
+    8.99131944444444414e-02, 0.00000000000000000e+00, 4.53489068583408206e-01,
+    6.14062499999999956e-01, -2.71512382075471681e-01, 8.90476190476190421e-02,
+    2.50000000000000014e-02,
+};
+
+static const real_t RK6_c[7] = {
+    0.00000000000000000e+00, 3.33333333333333315e-01, 6.66666666666666630e-01,
+    3.33333333333333315e-01, 5.00000000000000000e-01, 5.00000000000000000e-01,
+    1.00000000000000000e+00,
+};
+
+static const real_t RK6_A[49] = {
+    0.00000000000000000e+00, 3.33333333333333315e-01, 0.00000000000000000e+00,
+    8.33333333333333287e-02, -6.25000000000000000e-02, 0.00000000000000000e+00,
+    2.04545454545454558e-01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    6.66666666666666630e-01, 3.33333333333333315e-01, 1.12500000000000000e+00,
+    1.12500000000000000e+00, -8.18181818181818232e-01, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, -8.33333333333333287e-02,
+    -1.87500000000000000e-01, -3.75000000000000000e-01, 1.43181818181818188e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, -3.75000000000000000e-01, -7.50000000000000000e-01,
+    1.63636363636363646e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    5.00000000000000000e-01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, -1.45454545454545459e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00,
+};
+
+static const real_t RK6_b[7] = {
+    9.16666666666666602e-02, 0.00000000000000000e+00, 6.75000000000000044e-01,
+    6.75000000000000044e-01, -2.66666666666666663e-01, -2.66666666666666663e-01,
+    9.16666666666666602e-02,
+};
+
+static const real_t RK8_c[11] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, 5.00000000000000000e-01,
+    8.27326835353988543e-01, 8.27326835353988543e-01, 5.00000000000000000e-01,
+    1.72673164646011429e-01, 1.72673164646011429e-01, 5.00000000000000000e-01,
+    8.27326835353988543e-01, 1.00000000000000000e+00,
+};
+
+static const real_t RK8_A[121] = {
+    0.00000000000000000e+00, 5.00000000000000000e-01, 2.50000000000000000e-01,
+    1.42857142857142849e-01, 1.85506853511379050e-01, 1.99636993644913330e-01,
+    1.28986292977241901e-01, 7.14285714285714246e-02, 3.12500000000000000e-02,
+    7.14285714285714246e-02, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 2.50000000000000000e-01, -2.11711500865995106e-01,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 8.96181193362840856e-01, 5.76671472695608922e-01,
+    3.77293769304328896e-01, -3.30255113144848206e-02, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 6.51485091470006411e-02, -4.63455389640606230e-01,
+    -3.49705286317742225e-01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 3.86524626691364004e-01, 3.28517213141737152e-01,
+    2.00216599311492036e-03, -9.08696110082055607e-03, 1.11111111111111105e-01,
+    -5.51220563072728931e-01, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 9.79004561592594219e-02, -1.18686838867860314e-02,
+    1.52777777777777790e-01, -6.37931350185264590e-01, 2.45138043241696701e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 1.11111111111111105e-01, -6.32546160695909743e-01,
+    2.03108313916686178e+00, -7.16495155323138189e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 9.57605344018952476e-01, -1.81086308293775433e+00,
+    7.55384044212027117e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 1.06249844677046346e+00, -2.22915821019474469e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 9.40109451961617770e-01, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00,
+};
+
+static const real_t RK8_b[11] = {
+    5.00000000000000028e-02, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 0.00000000000000000e+00, 0.00000000000000000e+00,
+    0.00000000000000000e+00, 2.72222222222222199e-01, 3.55555555555555569e-01,
+    2.72222222222222199e-01, 5.00000000000000028e-02,
+};
+
+static const erk_table ERK_tables[] = {
+    {"Euler", 1, 1, Euler_c, Euler_A, Euler_b, NULL, 0},
+    {"Heun", 2, 2, Heun_c, Heun_A, Heun_b, NULL, 0},
+    {"RK3", 3, 3, RK3_c, RK3_A, RK3_b, NULL, 0},
+    {"SSPRK3", 3, 3, SSPRK3_c, SSPRK3_A, SSPRK3_b, NULL, 0},
+    {"BS3", 4, 3, BS3_c, BS3_A, BS3_b, BS3_b_hat, 2},
+    {"RK4", 4, 4, RK4_c, RK4_A, RK4_b, NULL, 0},
+    {"DOPRI5", 7, 5, DOPRI5_c, DOPRI5_A, DOPRI5_b, DOPRI5_b_hat, 4},
+    {"RK6", 7, 6, RK6_c, RK6_A, RK6_b, NULL, 0},
+    {"RK8", 11, 8, RK8_c, RK8_A, RK8_b, NULL, 0},
+};
+
+const erk_table *get_ERK_table(const char *name) {
+    for (size_t i = 0; i < sizeof(ERK_tables) / sizeof(ERK_tables[0]); i++)
+        if (strcmp(ERK_tables[i].name, name) == 0) return &ERK_tables[i];
+    return NULL;
+}
@@ -0,0 +1,449 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+#include "acados/sim/sim_exact_linear.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "acados/sim/sim_lifted_irk_integrator.h"
+#include "acados/utils/math.h"
+#include "acados/utils/timing.h"
+
+#define PADE_WORK_SIZE(n) (6 * (n) * (n))
+
+static int_t exp_mat_dim(const sim_in *in, bool exp_rk) {
+    return exp_rk ? 3 * in->nx : in->nx + in->nu + 1;
+}
+
+static void sim_exact_linear_cast_workspace(sim_exact_linear_workspace *work, const sim_in *in,
+                                            bool exp_rk) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t NF = in->num_forw_sens;
+    int_t m = exp_mat_dim(in, exp_rk);
+    int_t num_jac = (exp_rk && in->sens_adj) ? in->num_steps : 1;
+
+    char *ptr = (char *)work;
+    ptr += sizeof(sim_exact_linear_workspace);
+    work->exp_mat = (real_t *)ptr;
+    ptr += m * m * sizeof(real_t);  // exp_mat
+    work->pade = (real_t *)ptr;
+    ptr += PADE_WORK_SIZE(m) * sizeof(real_t);  // pade
+    work->x = (real_t *)ptr;
+    ptr += nx * sizeof(real_t);  // x
+    work->S = (real_t *)ptr;
+    ptr += nx * NF * sizeof(real_t);  // S
+    work->adj = (real_t *)ptr;
+    ptr += (nx + nu) * sizeof(real_t);  // adj
+
+    work->a = NULL;
+    work->dA = NULL;
+    work->N = NULL;
+    work->dN = NULL;
+    work->jac_in = NULL;
+    work->jac_out = NULL;
+    work->jac_traj = NULL;
+    work->adj_tmp = NULL;
+    if (exp_rk) {
+        work->a = (real_t *)ptr;
+        ptr += nx * sizeof(real_t);  // a
+        work->dA = (real_t *)ptr;
+        ptr += nx * NF * sizeof(real_t);  // dA
+        work->N = (real_t *)ptr;
+        ptr += 2 * nx * sizeof(real_t);  // N
+        work->dN = (real_t *)ptr;
+        ptr += nx * NF * sizeof(real_t);  // dN
+        work->jac_in = (real_t *)ptr;
+        ptr += (nx + nu) * sizeof(real_t);  // jac_in
+        work->jac_out = (real_t *)ptr;
+        ptr += nx * (1 + nx) * sizeof(real_t);  // jac_out
+        work->jac_traj = (real_t *)ptr;
+        ptr += num_jac * 2 * nx * nx * sizeof(real_t);  // jac_traj
+        work->adj_tmp = (real_t *)ptr;
+        ptr += 3 * nx * sizeof(real_t);  // adj_tmp
+    }
+
+    work->ipiv = (int_t *)ptr;
+    ptr += m * sizeof(int_t);  // ipiv
+}
+
+static int_t sim_exact_linear_workspace_size(const sim_in *in, bool exp_rk) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t NF = in->num_forw_sens;
+    int_t m = exp_mat_dim(in, exp_rk);
+    int_t num_jac = (exp_rk && in->sens_adj) ? in->num_steps : 1;
+
+    int_t size = sizeof(sim_exact_linear_workspace);
+    size += m * m * sizeof(real_t);               // exp_mat
+    size += PADE_WORK_SIZE(m) * sizeof(real_t);   // pade
+    size += nx * sizeof(real_t);                  // x
+    size += nx * NF * sizeof(real_t);             // S
+    size += (nx + nu) * sizeof(real_t);           // adj
+    size += m * sizeof(int_t);                    // ipiv
+    if (exp_rk) {
+        size += nx * sizeof(real_t);                     // a
+        size += nx * NF * sizeof(real_t);                // dA
+        size += 2 * nx * sizeof(real_t);                 // N
+        size += nx * NF * sizeof(real_t);                // dN
+        size += (nx + nu) * sizeof(real_t);              // jac_in
+        size += nx * (1 + nx) * sizeof(real_t);          // jac_out
+        size += num_jac * 2 * nx * nx * sizeof(real_t);  // jac_traj
+        size += 3 * nx * sizeof(real_t);                 // adj_tmp
+    }
+    return size;
+}
+
+// Matrix exponential of the n x n matrix M in place, by scaling and squaring
+// with a diagonal Pade approximation of degree 3, 5, 7, 9 or 13 as in expm,
+// without heap allocations. work holds PADE_WORK_SIZE(n) elements.
+static void expm_pade(int_t n, real_t *M, real_t *work, int_t *ipiv) {
+    const int_t degrees[] = {3, 5, 7, 9, 13};
+    const real_t theta[] = {0.01495585217958292, 0.2539398330063230, 0.9504178996162932,
+                            2.097847961257068, 5.371920351148152};
+    int_t n2 = n * n;
+    real_t *A2 = work;
+    real_t *P = A2 + n2;
+    real_t *U = P + n2;
+    real_t *V = U + n2;
+    real_t *tmp = V + n2;
+    real_t *perm = tmp + n2;
+
+    real_t norm = 0.0;
+    for (int_t j = 0; j < n; j++) {
+        real_t col = 0.0;
+        for (int_t i = 0; i < n; i++) col += fabs(M[j * n + i]);
+        norm = fmax(norm, col);
+    }
+    int_t m = degrees[4];
+    for (int_t i = 0; i < 5; i++) {
+        if (norm <= theta[i]) {
+            m = degrees[i];
+            break;
+        }
+    }
+    int_t s = 0;
+    if (norm > theta[4]) {
+        s = (int_t)ceil(log2(norm / theta[4]));
+        dscal_3l(n2, pow(2.0, -s), M);
+    }
+
+    // U = M*sum_k c_(2k+1) M^2k, V = sum_k c_2k M^2k
+    dgemm_nn_3l(n, n, n, M, n, M, n, A2, n);
+    for (int_t i = 0; i < n2; i++) {
+        P[i] = (i % (n + 1) == 0) ? 1.0 : 0.0;
+        tmp[i] = 0.0;
+        V[i] = 0.0;
+    }
+    real_t c = 1.0;
+    for (int_t k = 0; k <= m; k++) {
+        if (k % 2 == 0) {
+            daxpy_3l(n2, c, P, V);
+        } else {
+            daxpy_3l(n2, c, P, tmp);
+            if (k < m) {
+                dgemm_nn_3l(n, n, n, P, n, A2, n, U, n);
+                dmcopy(n, n, U, n, P, n);
+            }
+        }
+        c *= (real_t)(m - k) / ((2 * m - k) * (k + 1));
+    }
+    dgemm_nn_3l(n, n, n, M, n, tmp, n, U, n);
+
+    // (V - U)^-1 * (V + U)
+    for (int_t i = 0; i < n2; i++) {
+        A2[i] = V[i] - U[i];
+        P[i] = V[i] + U[i];
+    }
+    LU_system_ACADO(A2, ipiv, n);
+    solve_system_ACADO(A2, P, ipiv, perm, n, n);
+
+    for (int_t i = 0; i < s; i++) {
+        dgemm_nn_3l(n, n, n, P, n, P, n, tmp, n);
+        dmcopy(n, n, tmp, n, P, n);
+    }
+    dmcopy(n, n, P, n, M, n);
+}
+
+// Factors of the step size T from the exponential of an augmented matrix,
+// see sim_exact_linear_memory
+static void compute_factors(const sim_in *in, bool exp_rk, real_t T, sim_exact_linear_memory *mem,
+                            sim_exact_linear_workspace *work) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t m = exp_mat_dim(in, exp_rk);
+    real_t *M = work->exp_mat;
+
+    for (int_t i = 0; i < m * m; i++) M[i] = 0.0;
+    for (int_t j = 0; j < nx; j++)
+        for (int_t i = 0; i < nx; i++) M[j * m + i] = T * in->A_lin[j * nx + i];
+    if (exp_rk) {
+        // exp(T*[A I 0; 0 0 I; 0 0 0]) = [Phi0 Phi1 T*Phi2; 0 I T*I; 0 0 I]
+        for (int_t i = 0; i < 2 * nx; i++) M[(nx + i) * m + i] = T;
+    } else {
+        // exp(T*[A B c; 0 0 0; 0 0 0]) = [Phi0 Phi1; 0 I]
+        for (int_t j = 0; j < nu; j++)
+            for (int_t i = 0; i < nx; i++) M[(nx + j) * m + i] = T * in->B_lin[j * nx + i];
+        if (in->c_lin != NULL) {
+            for (int_t i = 0; i < nx; i++) M[(nx + nu) * m + i] = T * in->c_lin[i];
+        }
+    }
+    expm_pade(m, M, work->pade, work->ipiv);
+
+    dmcopy(nx, nx, M, m, mem->Phi0, nx);
+    if (exp_rk) {
+        dmcopy(nx, nx, &M[nx * m], m, mem->Phi1, nx);
+        dmcopy(nx, nx, &M[2 * nx * m], m, mem->Phi2, nx);
+        dscal_3l(nx * nx, 1.0 / T, mem->Phi2);
+    } else {
+        dmcopy(nx, nu + 1, &M[nx * m], m, mem->Phi1, nx);
+    }
+    mem->T = T;
+}
+
+int_t sim_exact_linear(const sim_in *in, sim_out *out, void *args, void *mem_, void *work_) {
+    (void)args;
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t NF = in->num_forw_sens;
+    if (in->sens_forw && (NF < nu || NF > nx + nu)) return -1;
+
+    sim_exact_linear_memory *mem = (sim_exact_linear_memory *)mem_;
+    sim_exact_linear_workspace *work = (sim_exact_linear_workspace *)work_;
+    sim_exact_linear_cast_workspace(work, in, false);
+
+    acados_timer timer, timer_la;
+    acados_tic(&timer);
+    real_t T = in->step * in->num_steps;
+    real_t timing_la = 0.0;
+    if (mem->T != T) {
+        acados_tic(&timer_la);
+        compute_factors(in, false, T, mem, work);
+        timing_la = acados_toc(&timer_la);
+    }
+    real_t *Phi0 = mem->Phi0;
+    real_t *Phi1 = mem->Phi1;
+
+    for (int_t i = 0; i < nx; i++) out->xn[i] = (in->c_lin != NULL) ? Phi1[nu * nx + i] : 0.0;
+    dgemv_n_3l(nx, nx, Phi0, nx, in->x, out->xn);
+    dgemv_n_3l(nx, nu, Phi1, nx, in->u, out->xn);
+
+    if (in->sens_forw) {
+        // the last nu directions are those of the controls
+        dgemm_nn_3l(nx, NF, nx, Phi0, nx, in->S_forw, nx, out->S_forw, nx);
+        for (int_t j = 0; j < nu; j++)
+            for (int_t i = 0; i < nx; i++) out->S_forw[(NF - nu + j) * nx + i] += Phi1[j * nx + i];
+    }
+
+    if (in->sens_adj) {
+        for (int_t i = 0; i < nx; i++) out->S_adj[i] = 0.0;
+        for (int_t i = 0; i < nu; i++) out->S_adj[nx + i] = in->S_adj[nx + i];
+        dgemv_t_3l(nx, nx, Phi0, nx, in->S_adj, out->S_adj);
+        dgemv_t_3l(nx, nu, Phi1, nx, in->S_adj, &out->S_adj[nx]);
+    }
+
+    out->info->CPUtime = acados_toc(&timer);
+    out->info->LAtime = timing_la;
+    out->info->ADtime = 0.0;
+    out->info->num_steps = in->num_steps;
+    out->info->num_rejected_steps = 0;
+    out->info->num_recomputed_steps = 0;
+    out->info->num_krylov_iter = 0;
+    out->info->num_newton_iter = 0;
+    out->info->num_factorizations = 0;
+    return 0;
+}
+
+// N = B_lin*u + c_lin + g(x) and dg/dx
+static void exp_rk_nonlinearity(const sim_in *in, const real_t *x, real_t *N, real_t *jac_g,
+                                sim_exact_linear_workspace *work, real_t *timing_ad) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    acados_timer timer_ad;
+
+    for (int_t i = 0; i < nx; i++) work->jac_in[i] = x[i];
+    for (int_t i = 0; i < nu; i++) work->jac_in[nx + i] = in->u[i];
+    acados_tic(&timer_ad);
+    in->jacobian_wrapper(nx, work->jac_in, work->jac_out, in->jac);
+    *timing_ad += acados_toc(&timer_ad);
+
+    for (int_t i = 0; i < nx; i++) N[i] = work->jac_out[i] + ((in->c_lin != NULL) ? in->c_lin[i] : 0.0);
+    dgemv_n_3l(nx, nu, in->B_lin, nx, in->u, N);
+    for (int_t i = 0; i < nx * nx; i++) jac_g[i] = work->jac_out[nx + i];
+}
+
+int_t sim_exp_rk(const sim_in *in, sim_out *out, void *args, void *mem_, void *work_) {
+    (void)args;
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t NF = in->num_forw_sens;
+    if (in->sens_forw && (NF < nu || NF > nx + nu)) return -1;
+
+    sim_exact_linear_memory *mem = (sim_exact_linear_memory *)mem_;
+    sim_exact_linear_workspace *work = (sim_exact_linear_workspace *)work_;
+    sim_exact_linear_cast_workspace(work, in, true);
+
+    int_t num_steps = in->num_steps;
+    real_t h = in->step;
+    real_t *x = work->x;
+    real_t *S = work->S;
+    real_t *a = work->a;
+    real_t *dA = work->dA;
+    real_t *N0 = work->N;
+    real_t *N1 = work->N + nx;
+    real_t *dN = work->dN;
+
+    acados_timer timer, timer_la;
+    real_t timing_ad = 0.0;
+    real_t timing_la = 0.0;
+    acados_tic(&timer);
+    if (mem->T != h) {
+        acados_tic(&timer_la);
+        compute_factors(in, true, h, mem, work);
+        timing_la = acados_toc(&timer_la);
+    }
+    real_t *Phi0 = mem->Phi0;
+    real_t *Phi1 = mem->Phi1;
+    real_t *Phi2 = mem->Phi2;
+
+    for (int_t i = 0; i < nx; i++) x[i] = in->x[i];
+    if (in->sens_forw) {
+        for (int_t i = 0; i < nx * NF; i++) S[i] = in->S_forw[i];
+    }
+
+    for (int_t istep = 0; istep < num_steps; istep++) {
+        // dg/dx at x and a, kept for the adjoint sweep
+        real_t *jac_g0 = &work->jac_traj[(in->sens_adj ? istep : 0) * 2 * nx * nx];
+        real_t *jac_g1 = jac_g0 + nx * nx;
+
+        exp_rk_nonlinearity(in, x, N0, jac_g0, work, &timing_ad);
+        for (int_t i = 0; i < nx; i++) a[i] = 0.0;
+        dgemv_n_3l(nx, nx, Phi0, nx, x, a);
+        dgemv_n_3l(nx, nx, Phi1, nx, N0, a);
+        if (in->sens_forw) {
+            // dN = dg/dx*S + B_lin*du, dA = Phi0*S + Phi1*dN
+            dgemm_nn_3l(nx, NF, nx, jac_g0, nx, S, nx, dN, nx);
+            for (int_t j = 0; j < nu; j++)
+                for (int_t i = 0; i < nx; i++) dN[(NF - nu + j) * nx + i] += in->B_lin[j * nx + i];
+            dgemm_nn_3l(nx, NF, nx, Phi0, nx, S, nx, dA, nx);
+            for (int_t p = 0; p < NF; p++) dgemv_n_3l(nx, nx, Phi1, nx, &dN[p * nx], &dA[p * nx]);
+        }
+
+        exp_rk_nonlinearity(in, a, N1, jac_g1, work, &timing_ad);
+        for (int_t i = 0; i < nx; i++) {
+            x[i] = a[i];
+            N1[i] -= N0[i];
+        }
+        dgemv_n_3l(nx, nx, Phi2, nx, N1, x);
+        if (in->sens_forw) {
+            // the controls enter N(a) - N(x) through g only
+            dgemm_nn_3l(nx, NF, nx, jac_g1, nx, dA, nx, dN, nx);
+            for (int_t p = 0; p < NF; p++) {
+                for (int_t i = 0; i < nx; i++) N0[i] = 0.0;
+                dgemv_n_3l(nx, nx, jac_g0, nx, &S[p * nx], N0);
+                for (int_t i = 0; i < nx; i++) {
+                    dN[p * nx + i] -= N0[i];
+                    S[p * nx + i] = dA[p * nx + i];
+                }
+                dgemv_n_3l(nx, nx, Phi2, nx, &dN[p * nx], &S[p * nx]);
+            }
+        }
+    }
+
+    for (int_t i = 0; i < nx; i++) out->xn[i] = x[i];
+    if (in->sens_forw) {
+        for (int_t i = 0; i < nx * NF; i++) out->S_forw[i] = S[i];
+    }
+
+    // ADJOINT SWEEP:
+    if (in->sens_adj) {
+        real_t *adj = work->adj;
+        real_t *mu = work->adj_tmp;
+        real_t *adj_a = mu + nx;
+        real_t *nu_a = adj_a + nx;
+        for (int_t i = 0; i < nx + nu; i++) adj[i] = in->S_adj[i];
+
+        acados_tic(&timer_la);
+        for (int_t istep = num_steps - 1; istep > -1; istep--) {
+            real_t *jac_g0 = &work->jac_traj[istep * 2 * nx * nx];
+            real_t *jac_g1 = jac_g0 + nx * nx;
+            // mu = Phi2'*adj, adj_a = adj + dg/dx(a)'*mu, nu_a = Phi1'*adj_a
+            for (int_t i = 0; i < nx; i++) {
+                mu[i] = 0.0;
+                nu_a[i] = 0.0;
+            }
+            dgemv_t_3l(nx, nx, Phi2, nx, adj, mu);
+            for (int_t i = 0; i < nx; i++) adj_a[i] = adj[i];
+            dgemv_t_3l(nx, nx, jac_g1, nx, mu, adj_a);
+            dgemv_t_3l(nx, nx, Phi1, nx, adj_a, nu_a);
+            // adj = Phi0'*adj_a + dg/dx(x)'*(nu_a - mu), the controls get B_lin'*nu_a
+            dgemv_t_3l(nx, nu, in->B_lin, nx, nu_a, &adj[nx]);
+            for (int_t i = 0; i < nx; i++) {
+                mu[i] = nu_a[i] - mu[i];
+                adj[i] = 0.0;
+            }
+            dgemv_t_3l(nx, nx, Phi0, nx, adj_a, adj);
+            dgemv_t_3l(nx, nx, jac_g0, nx, mu, adj);
+        }
+        timing_la += acados_toc(&timer_la);
+        for (int_t i = 0; i < nx + nu; i++) out->S_adj[i] = adj[i];
+    }
+
+    out->info->CPUtime = acados_toc(&timer);
+    out->info->LAtime = timing_la;
+    out->info->ADtime = timing_ad;
+    out->info->num_steps = num_steps;
+    out->info->num_rejected_steps = 0;
+    out->info->num_recomputed_steps = 0;
+    out->info->num_krylov_iter = 0;
+    out->info->num_newton_iter = 0;
+    out->info->num_factorizations = 0;
+    return 0;
+}
+
+int_t sim_exact_linear_calculate_workspace_size(const sim_in *in, void *args) {
+    (void)args;
+    return sim_exact_linear_workspace_size(in, false);
+}
+
+int_t sim_exp_rk_calculate_workspace_size(const sim_in *in, void *args) {
+    (void)args;
+    return sim_exact_linear_workspace_size(in, true);
+}
+
+void sim_exact_linear_create_memory(const sim_in *in, void *args, sim_exact_linear_memory *mem) {
+    (void)args;
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t ncol = (nx > nu + 1) ? nx : nu + 1;
+    mem->T = 0.0;
+    mem->Phi0 = calloc(nx * nx, sizeof(*mem->Phi0));
+    mem->Phi1 = calloc(nx * ncol, sizeof(*mem->Phi1));
+    mem->Phi2 = calloc(nx * nx, sizeof(*mem->Phi2));
+}
+
+void sim_exact_linear_reset_memory(sim_exact_linear_memory *mem) { mem->T = 0.0; }
+
+void sim_exact_linear_free_memory(sim_exact_linear_memory *mem) {
+    free(mem->Phi0);
+    free(mem->Phi1);
+    free(mem->Phi2);
+}
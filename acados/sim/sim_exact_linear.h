@@ -0,0 +1,84 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef ACADOS_SIM_SIM_EXACT_LINEAR_H_
+#define ACADOS_SIM_SIM_EXACT_LINEAR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "acados/sim/sim_common.h"
+#include "acados/utils/types.h"
+
+typedef struct {
+    real_t *exp_mat;  // augmented matrix and its exponential
+    real_t *pade;     // scratch of the Pade approximation
+    int_t *ipiv;
+
+    real_t *x;  // states and their sensitivities at the current step
+    real_t *S;
+    real_t *a;  // first stage of sim_exp_rk and its sensitivities
+    real_t *dA;
+    real_t *N;  // nonlinear part B_lin*u + c_lin + g at x and a
+    real_t *dN;
+    real_t *jac_in;
+    real_t *jac_out;
+    real_t *jac_traj;  // dg/dx at x and a of all steps, for the adjoint sweep
+    real_t *adj;
+    real_t *adj_tmp;
+} sim_exact_linear_workspace;
+
+// Matrix exponentials of the linear part, computed by the first call and
+// reused as long as the step size does not change. Shooting intervals with
+// the same model can share one memory.
+typedef struct {
+    real_t T;       // step size the factors belong to, 0 if none
+    real_t *Phi0;   // exp(T*A_lin)
+    real_t *Phi1;   // T*phi1(T*A_lin), times [B_lin c_lin] for sim_exact_linear
+    real_t *Phi2;   // T*phi2(T*A_lin), sim_exp_rk only
+} sim_exact_linear_memory;
+
+// Exact discretization of the affine model xdot = A_lin*x + B_lin*u + c_lin over
+// in->step*in->num_steps: xn = Phi0*x + Phi1*[u; 1], one product
+// with a cached matrix. Forward sensitivities in NF = in->num_forw_sens
+// directions as in sim_lifted_irk, nu <= NF <= nx+nu, adjoints with the
+// convention of sim_erk. Returns -1 for unsupported dimensions.
+int_t sim_exact_linear(const sim_in *in, sim_out *out, void *args, void *mem, void *work);
+
+// Exponential Runge-Kutta method of order two (ETD2) for the semilinear model
+// with the nonlinearity g(x):
+//     a = Phi0*x + Phi1*N(x), xn = a + Phi2*(N(a) - N(x)),
+// N = B_lin*u + c_lin + g, with in->num_steps steps of in->step. The linear
+// part is integrated exactly, sensitivities as for sim_exact_linear.
+int_t sim_exp_rk(const sim_in *in, sim_out *out, void *args, void *mem, void *work);
+
+int_t sim_exact_linear_calculate_workspace_size(const sim_in *in, void *args);
+int_t sim_exp_rk_calculate_workspace_size(const sim_in *in, void *args);
+
+void sim_exact_linear_create_memory(const sim_in *in, void *args, sim_exact_linear_memory *mem);
+// To be called when A_lin, B_lin or c_lin change
+void sim_exact_linear_reset_memory(sim_exact_linear_memory *mem);
+void sim_exact_linear_free_memory(sim_exact_linear_memory *mem);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // ACADOS_SIM_SIM_EXACT_LINEAR_H_
@@ -0,0 +1,528 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+#include "acados/sim/sim_implicit_irk_integrator.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "acados/sim/sim_lifted_irk_integrator.h"
+#include "acados/utils/timing.h"
+
+static int_t max_of(int_t a, int_t b) { return a > b ? a : b; }
+
+static void sim_implicit_irk_cast_workspace(sim_implicit_irk_workspace *work, const sim_in *in,
+                                            void *args) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t nz = in->nz;
+    int_t nx1 = in->nx1;
+    int_t nx2 = nx - nx1;
+    int_t nf = nx1 + nz;
+    sim_RK_opts *opts = (sim_RK_opts *)args;
+    int_t num_stages = opts->num_stages;
+    int_t NF = in->num_forw_sens;
+    int_t nw = num_stages * nf;
+    int_t n2s = num_stages * nx2;
+    int_t num_steps = in->num_steps;
+
+    char *ptr = (char *)work;
+    ptr += sizeof(sim_implicit_irk_workspace);
+    work->res = (real_t *)ptr;
+    ptr += nw * sizeof(real_t);  // res
+    work->jac = (real_t *)ptr;
+    ptr += num_stages * nf * (2 * nx1 + nz + nu) * sizeof(real_t);  // jac
+    work->sys_mat = (real_t *)ptr;
+    ptr += nw * nw * sizeof(real_t);  // sys_mat
+    work->sys_perm = (real_t *)ptr;
+    ptr += max_of(nw, n2s) * max_of(1, NF) * sizeof(real_t);  // sys_perm
+    work->X1 = (real_t *)ptr;
+    ptr += nx1 * sizeof(real_t);  // X1
+    work->x = (real_t *)ptr;
+    ptr += nx * sizeof(real_t);  // x
+    work->S = (real_t *)ptr;
+    ptr += nx * NF * sizeof(real_t);  // S
+    work->dW = (real_t *)ptr;
+    ptr += nw * NF * sizeof(real_t);  // dW
+    work->dy = (real_t *)ptr;
+    ptr += (nf + nu) * NF * sizeof(real_t);  // dy
+
+    work->M_LO = NULL;
+    work->K2 = NULL;
+    work->dK2 = NULL;
+    if (nx2 > 0) {
+        work->M_LO = (real_t *)ptr;
+        ptr += n2s * n2s * sizeof(real_t);  // M_LO
+        work->K2 = (real_t *)ptr;
+        ptr += n2s * sizeof(real_t);  // K2
+        work->dK2 = (real_t *)ptr;
+        ptr += n2s * NF * sizeof(real_t);  // dK2
+    }
+
+    work->jac_traj = NULL;
+    work->adj = NULL;
+    work->adj_W = NULL;
+    work->adj_X1 = NULL;
+    work->adj_K2 = NULL;
+    if (in->sens_adj) {
+        work->jac_traj = (real_t *)ptr;
+        ptr += num_steps * (nw * nw + nw * (nx1 + nu)) * sizeof(real_t);  // jac_traj
+        work->adj = (real_t *)ptr;
+        ptr += (nx + nu) * sizeof(real_t);  // adj
+        work->adj_W = (real_t *)ptr;
+        ptr += nw * sizeof(real_t);  // adj_W
+        work->adj_X1 = (real_t *)ptr;
+        ptr += num_stages * nx1 * sizeof(real_t);  // adj_X1
+        work->adj_K2 = (real_t *)ptr;
+        ptr += n2s * sizeof(real_t);  // adj_K2
+    }
+
+    work->ipiv = (int_t *)ptr;
+    ptr += nw * sizeof(int_t);  // ipiv
+    work->ipiv_LO = NULL;
+    if (nx2 > 0) {
+        work->ipiv_LO = (int_t *)ptr;
+        ptr += n2s * sizeof(int_t);  // ipiv_LO
+    }
+    work->ipiv_traj = NULL;
+    if (in->sens_adj) {
+        work->ipiv_traj = (int_t *)ptr;
+        ptr += num_steps * nw * sizeof(int_t);  // ipiv_traj
+    }
+}
+
+// Residuals and Jacobians of the stage equations at the stage variables W of
+// the step from x. The residuals are written to res and the factorized Newton
+// matrix to sys_mat unless they are NULL, df/du to the workspace if jac_u.
+static void implicit_irk_stages(const sim_in *in, const sim_RK_opts *opts, const real_t *x,
+                                const real_t *W, real_t *res, bool jac_u, real_t *sys_mat,
+                                int_t *ipiv, sim_implicit_irk_workspace *work,
+                                real_t *timing_ad) {
+    int_t nu = in->nu;
+    int_t nz = in->nz;
+    int_t nx1 = in->nx1;
+    int_t nf = nx1 + nz;
+    int_t num_stages = opts->num_stages;
+    int_t nw = num_stages * nf;
+    int_t nj = nf * (2 * nx1 + nz + nu);
+    real_t h = in->step;
+    real_t *A_mat = opts->A_mat;
+    real_t *X1 = work->X1;
+    bool jac = (sys_mat != NULL);
+    acados_timer timer_ad;
+
+    for (int_t s = 0; s < num_stages; s++) {
+        real_t *jac_xdot = &work->jac[s * nj];
+        real_t *jac_x = jac_xdot + nf * nx1;
+        real_t *jac_z = jac_x + nf * nx1;
+        real_t *jac_u_s = jac_z + nf * nz;
+        for (int_t i = 0; i < nx1; i++) {
+            X1[i] = x[i];
+            for (int_t j = 0; j < num_stages; j++)
+                X1[i] += h * A_mat[j * num_stages + s] * W[j * nf + i];
+        }
+        acados_tic(&timer_ad);
+        in->impl_ode_wrapper(nx1, nz, nu, &W[s * nf], X1, &W[s * nf + nx1], in->u,
+                             res ? &res[s * nf] : NULL, jac ? jac_xdot : NULL, jac ? jac_x : NULL,
+                             jac ? jac_z : NULL, jac_u ? jac_u_s : NULL, in->impl_ode);
+        *timing_ad += acados_toc(&timer_ad);
+    }
+    if (!jac) return;
+
+    // block (s, j) is d/dK1_j = delta_sj*df/dxdot + h*a_sj*df/dx, d/dZ_j = delta_sj*df/dz
+    for (int_t j = 0; j < num_stages; j++) {
+        for (int_t s = 0; s < num_stages; s++) {
+            real_t *jac_xdot = &work->jac[s * nj];
+            real_t *jac_x = jac_xdot + nf * nx1;
+            real_t *jac_z = jac_x + nf * nx1;
+            real_t a = h * A_mat[j * num_stages + s];
+            for (int_t c = 0; c < nx1; c++)
+                for (int_t r = 0; r < nf; r++)
+                    sys_mat[(j * nf + c) * nw + s * nf + r] =
+                        (s == j ? jac_xdot[c * nf + r] : 0.0) + a * jac_x[c * nf + r];
+            for (int_t c = 0; c < nz; c++)
+                for (int_t r = 0; r < nf; r++)
+                    sys_mat[(j * nf + nx1 + c) * nw + s * nf + r] =
+                        (s == j) ? jac_z[c * nf + r] : 0.0;
+        }
+    }
+    LU_system_ACADO(sys_mat, ipiv, nw);
+}
+
+int_t sim_implicit_irk(const sim_in *in, sim_out *out, void *args, void *mem_, void *work_) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t nz = in->nz;
+    int_t nx1 = in->nx1;
+    int_t NF = in->num_forw_sens;
+    if (nx1 < 0 || nx1 > nx || nz < 0 || (in->sens_forw && (NF < nu || NF > nx + nu)))
+        return -1;
+
+    sim_RK_opts *opts = (sim_RK_opts *)args;
+    sim_implicit_irk_memory *mem = (sim_implicit_irk_memory *)mem_;
+    sim_implicit_irk_workspace *work = (sim_implicit_irk_workspace *)work_;
+    sim_implicit_irk_cast_workspace(work, in, args);
+
+    int_t nx2 = nx - nx1;
+    int_t nf = nx1 + nz;
+    int_t ny = nf + nu;
+    int_t num_stages = opts->num_stages;
+    int_t nw = num_stages * nf;
+    int_t n2s = num_stages * nx2;
+    int_t nj = nf * (2 * nx1 + nz + nu);
+    int_t num_steps = in->num_steps;
+    int_t size_jac_step = nw * nw + nw * (nx1 + nu);
+    int_t NF_u = NF - nu;  // first direction of the controls
+    real_t h = in->step;
+    real_t *A_mat = opts->A_mat;
+    real_t *b_vec = opts->b_vec;
+    real_t *A_LO = in->A_LO;
+    real_t *B_LO = in->B_LO;
+
+    real_t *x = work->x;
+    real_t *S = work->S;
+    real_t *dW = work->dW;
+    real_t *dy = work->dy;
+    real_t *K2 = work->K2;
+    real_t *dK2 = work->dK2;
+    real_t *X1 = work->X1;
+    real_t *sys_perm = work->sys_perm;
+
+    // last factorized Newton matrix, kept over iterations and steps with newton_reuse
+    real_t *iter_mat = NULL;
+    int_t *iter_ipiv = NULL;
+    int_t num_newton_iter = 0;
+    int_t num_factorizations = 0;
+    int_t status = ACADOS_SUCCESS;
+
+    acados_timer timer, timer_la;
+    real_t timing_ad = 0.0;
+    real_t timing_la = 0.0;
+
+    acados_tic(&timer);
+    for (int_t i = 0; i < nx; i++) x[i] = in->x[i];
+    if (in->sens_forw) {
+        for (int_t i = 0; i < nx * NF; i++) S[i] = in->S_forw[i];
+    }
+
+    // stage matrix I - h*A kron A_LO of the linear output system, the same for all steps
+    if (nx2 > 0) {
+        acados_tic(&timer_la);
+        for (int_t j = 0; j < num_stages; j++)
+            for (int_t s = 0; s < num_stages; s++)
+                for (int_t c = 0; c < nx2; c++)
+                    for (int_t r = 0; r < nx2; r++)
+                        work->M_LO[(j * nx2 + c) * n2s + s * nx2 + r] =
+                            (s == j && r == c ? 1.0 : 0.0) -
+                            h * A_mat[j * num_stages + s] * A_LO[c * nx2 + r];
+        LU_system_ACADO(work->M_LO, work->ipiv_LO, n2s);
+        timing_la += acados_toc(&timer_la);
+    }
+
+    for (int_t istep = 0; istep < num_steps; istep++) {
+        real_t *W = &mem->W_traj[istep * nw];
+        // the adjoint sweep needs the factorized matrices of all steps
+        real_t *sys_mat = work->sys_mat;
+        int_t *ipiv = work->ipiv;
+        if (in->sens_adj) {
+            sys_mat = &work->jac_traj[istep * size_jac_step];
+            ipiv = &work->ipiv_traj[istep * nw];
+        }
+
+        if (opts->newton_tol <= 0.0) {
+            for (int_t iter = 0; iter < opts->newton_iter; iter++) {
+                implicit_irk_stages(in, opts, x, W, work->res, false, sys_mat, ipiv, work,
+                                    &timing_ad);
+                acados_tic(&timer_la);
+                solve_system_ACADO(sys_mat, work->res, ipiv, sys_perm, nw, 1);
+                timing_la += acados_toc(&timer_la);
+                for (int_t i = 0; i < nw; i++) W[i] -= work->res[i];
+            }
+            num_newton_iter += opts->newton_iter;
+            num_factorizations += opts->newton_iter;
+        } else {
+            // the residual of the last iterate decides on convergence and on a new matrix
+            real_t res_prev = INFINITY;
+            for (int_t iter = 0;; iter++) {
+                implicit_irk_stages(in, opts, x, W, work->res, false, NULL, NULL, work,
+                                    &timing_ad);
+                real_t res_norm = 0.0;
+                for (int_t i = 0; i < nw; i++) res_norm = fmax(res_norm, fabs(work->res[i]));
+                if (res_norm <= opts->newton_tol) break;
+                if (iter == opts->newton_iter) {
+                    status = ACADOS_MAXITER;
+                    break;
+                }
+                if (!opts->newton_reuse || iter_mat == NULL ||
+                    res_norm > IMPLICIT_IRK_CONTRACTION * res_prev) {
+                    implicit_irk_stages(in, opts, x, W, NULL, false, sys_mat, ipiv, work,
+                                        &timing_ad);
+                    iter_mat = sys_mat;
+                    iter_ipiv = ipiv;
+                    num_factorizations++;
+                }
+                res_prev = res_norm;
+                acados_tic(&timer_la);
+                solve_system_ACADO(iter_mat, work->res, iter_ipiv, sys_perm, nw, 1);
+                timing_la += acados_toc(&timer_la);
+                for (int_t i = 0; i < nw; i++) W[i] -= work->res[i];
+                num_newton_iter++;
+            }
+        }
+
+        if (in->sens_forw || in->sens_adj) {
+            // Jacobians at the last iterate, the Newton matrix of the next step
+            bool jac_u = (in->B_u == NULL);
+            implicit_irk_stages(in, opts, x, W, NULL, jac_u, sys_mat, ipiv, work, &timing_ad);
+            iter_mat = sys_mat;
+            iter_ipiv = ipiv;
+            if (in->sens_adj) {
+                real_t *jac_x_traj = sys_mat + nw * nw;
+                real_t *jac_u_traj = jac_x_traj + nw * nx1;
+                for (int_t s = 0; s < num_stages; s++) {
+                    real_t *jac_x = &work->jac[s * nj + nf * nx1];
+                    real_t *jac_u_s = jac_u ? jac_x + nf * (nx1 + nz) : in->B_u;
+                    for (int_t i = 0; i < nf * nx1; i++) jac_x_traj[s * nf * nx1 + i] = jac_x[i];
+                    for (int_t i = 0; i < nf * nu; i++) jac_u_traj[s * nf * nu + i] = jac_u_s[i];
+                }
+            }
+        }
+
+        if (in->sens_forw) {
+            // dW = -J^-1 * (df/dx1*S1 + df/du*Su)
+            acados_tic(&timer_la);
+            for (int_t s = 0; s < num_stages; s++) {
+                real_t *jac_x = &work->jac[s * nj + nf * nx1];
+                real_t *jac_u_s = (in->B_u == NULL) ? jac_x + nf * (nx1 + nz) : in->B_u;
+                for (int_t p = 0; p < NF; p++) {
+                    for (int_t r = 0; r < nf; r++) {
+                        real_t tmp = (p >= NF_u) ? jac_u_s[(p - NF_u) * nf + r] : 0.0;
+                        for (int_t c = 0; c < nx1; c++) tmp += jac_x[c * nf + r] * S[p * nx + c];
+                        dW[p * nw + s * nf + r] = -tmp;
+                    }
+                }
+            }
+            solve_system_ACADO(sys_mat, dW, ipiv, sys_perm, nw, NF);
+            timing_la += acados_toc(&timer_la);
+        }
+
+        if (nx2 > 0) {
+            // K2_s = A_LO*(x2 + h*sum_j a_sj*K2_j) + B_LO*[X1_s; Z_s; u]
+            acados_tic(&timer_la);
+            for (int_t s = 0; s < num_stages; s++) {
+                for (int_t i = 0; i < nx1; i++) {
+                    X1[i] = x[i];
+                    for (int_t j = 0; j < num_stages; j++)
+                        X1[i] += h * A_mat[j * num_stages + s] * W[j * nf + i];
+                }
+                for (int_t r = 0; r < nx2; r++) {
+                    real_t tmp = 0.0;
+                    for (int_t c = 0; c < nx2; c++) tmp += A_LO[c * nx2 + r] * x[nx1 + c];
+                    for (int_t c = 0; c < nx1; c++) tmp += B_LO[c * nx2 + r] * X1[c];
+                    for (int_t c = 0; c < nz; c++)
+                        tmp += B_LO[(nx1 + c) * nx2 + r] * W[s * nf + nx1 + c];
+                    for (int_t c = 0; c < nu; c++) tmp += B_LO[(nf + c) * nx2 + r] * in->u[c];
+                    K2[s * nx2 + r] = tmp;
+                }
+            }
+            solve_system_ACADO(work->M_LO, K2, work->ipiv_LO, sys_perm, n2s, 1);
+
+            if (in->sens_forw) {
+                for (int_t s = 0; s < num_stages; s++) {
+                    for (int_t p = 0; p < NF; p++) {
+                        for (int_t i = 0; i < nx1; i++) {
+                            dy[p * ny + i] = S[p * nx + i];
+                            for (int_t j = 0; j < num_stages; j++)
+                                dy[p * ny + i] +=
+                                    h * A_mat[j * num_stages + s] * dW[p * nw + j * nf + i];
+                        }
+                        for (int_t i = nx1; i < nf; i++) dy[p * ny + i] = dW[p * nw + s * nf + i];
+                        for (int_t i = 0; i < nu; i++)
+                            dy[p * ny + nf + i] = (p - NF_u == i) ? 1.0 : 0.0;
+                        for (int_t r = 0; r < nx2; r++) {
+                            real_t tmp = 0.0;
+                            for (int_t c = 0; c < nx2; c++)
+                                tmp += A_LO[c * nx2 + r] * S[p * nx + nx1 + c];
+                            for (int_t c = 0; c < ny; c++)
+                                tmp += B_LO[c * nx2 + r] * dy[p * ny + c];
+                            dK2[p * n2s + s * nx2 + r] = tmp;
+                        }
+                    }
+                }
+                solve_system_ACADO(work->M_LO, dK2, work->ipiv_LO, sys_perm, n2s, NF);
+            }
+            timing_la += acados_toc(&timer_la);
+        }
+
+        for (int_t s = 0; s < num_stages; s++) {
+            for (int_t i = 0; i < nx1; i++) x[i] += h * b_vec[s] * W[s * nf + i];
+            for (int_t i = 0; i < nx2; i++) x[nx1 + i] += h * b_vec[s] * K2[s * nx2 + i];
+            if (in->sens_forw) {
+                for (int_t p = 0; p < NF; p++) {
+                    for (int_t i = 0; i < nx1; i++)
+                        S[p * nx + i] += h * b_vec[s] * dW[p * nw + s * nf + i];
+                    for (int_t i = 0; i < nx2; i++)
+                        S[p * nx + nx1 + i] += h * b_vec[s] * dK2[p * n2s + s * nx2 + i];
+                }
+            }
+        }
+    }
+
+    for (int_t i = 0; i < nx; i++) out->xn[i] = x[i];
+    if (in->sens_forw) {
+        for (int_t i = 0; i < nx * NF; i++) out->S_forw[i] = S[i];
+    }
+
+    // ADJOINT SWEEP:
+    if (in->sens_adj) {
+        real_t *adj = work->adj;
+        real_t *adj_W = work->adj_W;
+        real_t *adj_X1 = work->adj_X1;
+        real_t *adj_K2 = work->adj_K2;
+        for (int_t i = 0; i < nx + nu; i++) adj[i] = in->S_adj[i];
+
+        acados_tic(&timer_la);
+        for (int_t istep = num_steps - 1; istep > -1; istep--) {
+            real_t *sys_mat = &work->jac_traj[istep * size_jac_step];
+            real_t *jac_x_traj = sys_mat + nw * nw;
+            real_t *jac_u_traj = jac_x_traj + nw * nx1;
+            int_t *ipiv = &work->ipiv_traj[istep * nw];
+
+            for (int_t i = 0; i < num_stages * nx1; i++) adj_X1[i] = 0.0;
+            for (int_t s = 0; s < num_stages; s++)
+                for (int_t i = nx1; i < nf; i++) adj_W[s * nf + i] = 0.0;
+            if (nx2 > 0) {
+                for (int_t s = 0; s < num_stages; s++)
+                    for (int_t i = 0; i < nx2; i++)
+                        adj_K2[s * nx2 + i] = h * b_vec[s] * adj[nx1 + i];
+                solve_system_trans_ACADO(work->M_LO, adj_K2, work->ipiv_LO, sys_perm, n2s, 1);
+                for (int_t s = 0; s < num_stages; s++) {
+                    for (int_t c = 0; c < nx2; c++)
+                        for (int_t r = 0; r < nx2; r++)
+                            adj[nx1 + c] += A_LO[c * nx2 + r] * adj_K2[s * nx2 + r];
+                    for (int_t c = 0; c < ny; c++) {
+                        real_t tmp = 0.0;
+                        for (int_t r = 0; r < nx2; r++)
+                            tmp += B_LO[c * nx2 + r] * adj_K2[s * nx2 + r];
+                        if (c < nx1)
+                            adj_X1[s * nx1 + c] = tmp;
+                        else if (c < nf)
+                            adj_W[s * nf + c] = tmp;
+                        else
+                            adj[nx + c - nf] += tmp;
+                    }
+                }
+            }
+            for (int_t j = 0; j < num_stages; j++) {
+                for (int_t i = 0; i < nx1; i++) {
+                    adj_W[j * nf + i] = h * b_vec[j] * adj[i];
+                    for (int_t s = 0; s < num_stages; s++)
+                        adj_W[j * nf + i] += h * A_mat[j * num_stages + s] * adj_X1[s * nx1 + i];
+                }
+            }
+            for (int_t s = 0; s < num_stages; s++)
+                for (int_t i = 0; i < nx1; i++) adj[i] += adj_X1[s * nx1 + i];
+
+            // the stage variables depend on x1 and u through the stage equations
+            solve_system_trans_ACADO(sys_mat, adj_W, ipiv, sys_perm, nw, 1);
+            for (int_t s = 0; s < num_stages; s++) {
+                for (int_t c = 0; c < nx1; c++)
+                    for (int_t r = 0; r < nf; r++)
+                        adj[c] -= jac_x_traj[s * nf * nx1 + c * nf + r] * adj_W[s * nf + r];
+                for (int_t c = 0; c < nu; c++)
+                    for (int_t r = 0; r < nf; r++)
+                        adj[nx + c] -= jac_u_traj[s * nf * nu + c * nf + r] * adj_W[s * nf + r];
+            }
+        }
+        timing_la += acados_toc(&timer_la);
+        for (int_t i = 0; i < nx + nu; i++) out->S_adj[i] = adj[i];
+    }
+
+    out->info->CPUtime = acados_toc(&timer);
+    out->info->LAtime = timing_la;
+    out->info->ADtime = timing_ad;
+    out->info->num_steps = num_steps;
+    out->info->num_rejected_steps = 0;
+    out->info->num_recomputed_steps = 0;
+    out->info->num_krylov_iter = 0;
+    out->info->num_newton_iter = num_newton_iter;
+    out->info->num_factorizations = num_factorizations;
+    return status;
+}
+
+int_t sim_implicit_irk_calculate_workspace_size(const sim_in *in, void *args) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t nz = in->nz;
+    int_t nx1 = in->nx1;
+    int_t nx2 = nx - nx1;
+    int_t nf = nx1 + nz;
+    sim_RK_opts *opts = (sim_RK_opts *)args;
+    int_t num_stages = opts->num_stages;
+    int_t NF = in->num_forw_sens;
+    int_t nw = num_stages * nf;
+    int_t n2s = num_stages * nx2;
+    int_t num_steps = in->num_steps;
+
+    int_t size = sizeof(sim_implicit_irk_workspace);
+    size += nw * sizeof(real_t);                                      // res
+    size += num_stages * nf * (2 * nx1 + nz + nu) * sizeof(real_t);  // jac
+    size += nw * nw * sizeof(real_t);                                 // sys_mat
+    size += max_of(nw, n2s) * max_of(1, NF) * sizeof(real_t);         // sys_perm
+    size += nx1 * sizeof(real_t);                                     // X1
+    size += nx * sizeof(real_t);                                      // x
+    size += nx * NF * sizeof(real_t);                                 // S
+    size += nw * NF * sizeof(real_t);                                 // dW
+    size += (nf + nu) * NF * sizeof(real_t);                          // dy
+    size += nw * sizeof(int_t);                                       // ipiv
+    if (nx2 > 0) {
+        size += n2s * n2s * sizeof(real_t);  // M_LO
+        size += n2s * sizeof(real_t);        // K2
+        size += n2s * NF * sizeof(real_t);   // dK2
+        size += n2s * sizeof(int_t);         // ipiv_LO
+    }
+    if (in->sens_adj) {
+        size += num_steps * (nw * nw + nw * (nx1 + nu)) * sizeof(real_t);  // jac_traj
+        size += num_steps * nw * sizeof(int_t);                            // ipiv_traj
+        size += (nx + nu) * sizeof(real_t);                                // adj
+        size += nw * sizeof(real_t);                                       // adj_W
+        size += num_stages * nx1 * sizeof(real_t);                         // adj_X1
+        size += n2s * sizeof(real_t);                                      // adj_K2
+    }
+    return size;
+}
+
+void sim_implicit_irk_create_memory(const sim_in *in, void *args, sim_implicit_irk_memory *mem) {
+    sim_RK_opts *opts = (sim_RK_opts *)args;
+    int_t nw = opts->num_stages * (in->nx1 + in->nz);
+    mem->W_traj = calloc(in->num_steps * nw, sizeof(*mem->W_traj));
+}
+
+void sim_implicit_irk_free_memory(sim_implicit_irk_memory *mem) { free(mem->W_traj); }
+
+void sim_implicit_irk_initialize(const sim_in *in, void *args, void *mem, void **work) {
+    sim_implicit_irk_create_memory(in, args, (sim_implicit_irk_memory *)mem);
+    *work = malloc(sim_implicit_irk_calculate_workspace_size(in, args));
+}
+
+void sim_implicit_irk_destroy(void *mem, void *work) {
+    free(work);
+    sim_implicit_irk_free_memory((sim_implicit_irk_memory *)mem);
+}
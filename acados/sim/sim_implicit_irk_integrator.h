@@ -0,0 +1,92 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef ACADOS_SIM_SIM_IMPLICIT_IRK_INTEGRATOR_H_
+#define ACADOS_SIM_SIM_IMPLICIT_IRK_INTEGRATOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "acados/sim/sim_common.h"
+#include "acados/sim/sim_rk_common.h"
+#include "acados/utils/types.h"
+
+// With sim_RK_opts.newton_reuse a Newton matrix is factorized again when a
+// simplified Newton iteration reduces the largest residual by less than this factor
+#define IMPLICIT_IRK_CONTRACTION 0.5
+
+typedef struct {
+    real_t *res;      // residuals of the stages, num_stages*(nx1+nz)
+    real_t *jac;      // df/d(xdot1, x1, z, u) of the stages
+    real_t *sys_mat;  // Newton matrix of all stages
+    int_t *ipiv;
+    real_t *sys_perm;
+    real_t *X1;  // states of the implicit part at one stage
+
+    real_t *x;       // states and their sensitivities at the current step
+    real_t *S;
+    real_t *dW;      // sensitivities of the stage variables
+    real_t *dy;      // sensitivities of [x1; z; u] at one stage
+
+    real_t *M_LO;  // stage matrix of the linear output system, factorized
+    int_t *ipiv_LO;
+    real_t *K2;
+    real_t *dK2;
+
+    real_t *jac_traj;  // factorized Newton matrices, df/dx1 and df/du of all steps
+    int_t *ipiv_traj;
+    real_t *adj;
+    real_t *adj_W;
+    real_t *adj_X1;
+    real_t *adj_K2;
+} sim_implicit_irk_workspace;
+
+typedef struct {
+    // stage derivatives of x1 and algebraic states, num_steps*num_stages*(nx1+nz),
+    // the initial guess of the next call
+    real_t *W_traj;
+} sim_implicit_irk_memory;
+
+// Implicit Runge-Kutta integrator for the index-1 DAE in->impl_ode, see sim_in.
+// Every step solves the stage equations of the implicit part with
+// opts->newton_iter Newton iterations, or until the residuals are below
+// opts->newton_tol, then the stages of the linear output system with a matrix
+// that is factorized once per call. Forward sensitivities in
+// NF = in->num_forw_sens directions as in sim_lifted_irk, nu <= NF <= nx+nu,
+// and adjoint sensitivities with the convention of sim_erk. The sensitivities
+// are those of the last Newton iterate, returns -1 for unsupported dimensions
+// and ACADOS_MAXITER if a step has not reached the tolerance.
+// The arguments are created with sim_irk_create_arguments, Radau IIA methods
+// are the natural choice for DAEs.
+int_t sim_implicit_irk(const sim_in *in, sim_out *out, void *args, void *mem, void *work);
+
+int_t sim_implicit_irk_calculate_workspace_size(const sim_in *in, void *args);
+
+void sim_implicit_irk_create_memory(const sim_in *in, void *args, sim_implicit_irk_memory *mem);
+void sim_implicit_irk_free_memory(sim_implicit_irk_memory *mem);
+
+void sim_implicit_irk_initialize(const sim_in *in, void *args, void *mem, void **work);
+void sim_implicit_irk_destroy(void *mem, void *work);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // ACADOS_SIM_SIM_IMPLICIT_IRK_INTEGRATOR_H_
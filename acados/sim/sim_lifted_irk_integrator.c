@@ -29,9 +29,29 @@
 #include "blasfeo/include/blasfeo_d_blas.h"
 #include "blasfeo/include/blasfeo_d_kernel.h"
 #include "blasfeo/include/blasfeo_i_aux_ext_dep.h"
+#include "blasfeo/include/blasfeo_v_aux_ext_dep.h"
 
 #include "acados/utils/print.h"
 
+static bool matrix_free(const sim_RK_opts *opts) {
+    return opts->scheme.type == exact && opts->matrix_free;
+}
+
+static bool use_sparse(const sim_RK_opts *opts) {
+    return opts->scheme.type == exact && !opts->matrix_free && opts->jac_sparsity != NULL;
+}
+
+// second order sensitivities of the exact scheme
+static bool hessian(const sim_in *in, const sim_RK_opts *opts) {
+    return in->sens_adj && in->sens_hess && opts->scheme.type == exact;
+}
+
+static bool use_blasfeo(const sim_in *in, const sim_RK_opts *opts) {
+    if (matrix_free(opts) || use_sparse(opts)) return false;
+    if (opts->la_blasfeo >= 0) return opts->la_blasfeo;
+    return in->nx >= LIFTED_IRK_BLASFEO_NX;
+}
+
 static void sim_lifted_irk_cast_workspace(sim_lifted_irk_workspace *work,
                                           const sim_in *in, void *args) {
     int_t nx = in->nx;
@@ -53,7 +73,21 @@ static void sim_lifted_irk_cast_workspace(sim_lifted_irk_workspace *work,
     ptr += (nx * (1 + NF) + nu + 1) * sizeof(real_t);  // rhs_in
     work->out_tmp = (real_t *)ptr;
     ptr += (nx * (1 + NF)) * sizeof(real_t);  // out_tmp
-    if (opts->scheme.type == exact) {
+    if (matrix_free(opts)) {
+        int_t krylov_dim = opts->krylov_dim;
+        work->jac_stages = (real_t *)ptr;
+        ptr += (num_stages * nx * nx) * sizeof(real_t);  // jac_stages
+        work->prec_mat = (real_t *)ptr;
+        ptr += (num_stages * nx * nx) * sizeof(real_t);  // prec_mat
+        work->krylov_V = (real_t *)ptr;
+        ptr += (dim_sys * (krylov_dim + 1)) * sizeof(real_t);  // krylov_V
+        work->krylov_H = (real_t *)ptr;
+        ptr += ((krylov_dim + 1) * krylov_dim) * sizeof(real_t);  // krylov_H
+        work->krylov_tmp = (real_t *)ptr;
+        ptr += (3 * dim_sys + nx + 3 * krylov_dim + 1) * sizeof(real_t);  // krylov_tmp
+        work->ipiv = (int_t *)ptr;
+        ptr += (dim_sys) * sizeof(int_t);  // ipiv, of the diagonal blocks
+    } else if (opts->scheme.type == exact && !use_sparse(opts)) {
         work->ipiv = (int_t *)ptr;
         ptr += (dim_sys) * sizeof(int_t);  // ipiv
         work->sys_mat = (real_t *)ptr;
@@ -69,6 +103,12 @@ static void sim_lifted_irk_cast_workspace(sim_lifted_irk_workspace *work,
     }
     work->jac_tmp = (real_t *)ptr;
     ptr += (nx * (nx + 1)) * sizeof(real_t);  // jac_tmp
+    if (NF != nx + nu) {
+        work->vde_in = (real_t *)ptr;
+        ptr += (nx * (1 + nx + nu) + nu + 1) * sizeof(real_t);  // vde_in
+        work->vde_out = (real_t *)ptr;
+        ptr += (nx * (1 + nx + nu)) * sizeof(real_t);  // vde_out
+    }
 
     if (opts->scheme.type == simplified_in ||
         opts->scheme.type == simplified_inis) {
@@ -85,42 +125,86 @@ static void sim_lifted_irk_cast_workspace(sim_lifted_irk_workspace *work,
         ptr += (nx) * sizeof(real_t);  // out_adj_tmp
     }
 
-#if !TRIPLE_LOOP
+    if (hessian(in, opts)) {
+        int_t nhess = (NF + 1) * NF / 2;
+        work->hess_in = (real_t *)ptr;
+        ptr += (nx * (2 + nx + nu) + nu) * sizeof(real_t);  // hess_in
+        work->hess_out = (real_t *)ptr;
+        ptr += (nx + nu + nhess) * sizeof(real_t);  // hess_out
+        work->adj_mu = (real_t *)ptr;
+        ptr += (num_stages * nx) * sizeof(real_t);  // adj_mu
+        work->adj_hess = (real_t *)ptr;
+        ptr += (nx + nu + nhess) * sizeof(real_t);  // adj_hess
+    }
+
+    if (!use_blasfeo(in, opts)) {
+        work->sys_perm = (real_t *)ptr;
+        ptr += ((num_stages * nx) * (1 + NF)) * sizeof(real_t);  // sys_perm
+        return;
+    }
+
     work->str_mat = (struct d_strmat *)ptr;
     ptr += sizeof(struct d_strmat);
     work->str_sol = (struct d_strmat *)ptr;
     ptr += sizeof(struct d_strmat);
-#if defined(LA_HIGH_PERFORMANCE)
-    // matrices in matrix struct format:
-    int size_strmat = 0;
-    size_strmat += d_size_strmat(dim_sys, dim_sys);
-    size_strmat += d_size_strmat(dim_sys, 1 + NF);
+    work->str_adj = (struct d_strvec *)ptr;
+    ptr += sizeof(struct d_strvec);
+    if (opts->scheme.type == simplified_in ||
+        opts->scheme.type == simplified_inis) {
+        work->str_trans = (struct d_strmat *)ptr;
+        ptr += sizeof(struct d_strmat);
+        work->str_stages = (struct d_strmat *)ptr;
+        ptr += sizeof(struct d_strmat);
+        work->str_stages_trans = (struct d_strmat *)ptr;
+        ptr += sizeof(struct d_strmat);
+    }
+
+    // align memory to typical cache line size
+    size_t s_ptr = (size_t)ptr;
+    s_ptr = (s_ptr + 63) / 64 * 64;
+    ptr = (char *)s_ptr;
 
     d_create_strmat(dim_sys, dim_sys, work->str_mat, ptr);
     ptr += work->str_mat->memory_size;
     d_create_strmat(dim_sys, 1 + NF, work->str_sol, ptr);
     ptr += work->str_sol->memory_size;
-
-#elif defined(LA_REFERENCE)
-
-    //  pointer to column-major matrix
-    d_create_strmat(dim_sys, dim_sys, work->str_mat, work->sys_mat);
-    d_create_strmat(dim_sys, 1 + NF, work->str_sol, work->sys_sol);
-
-    d_cast_diag_mat2strmat((double *)ptr, work->str_mat);
-    ptr += d_size_diag_strmat(dim_sys, dim_sys);
-
-#else  // LA_BLAS
-
-    // not allocate new memory: point to column-major matrix
-    d_create_strmat(dim_sys, dim_sys, work->str_mat, work->sys_mat);
-    d_create_strmat(dim_sys, 1 + NF, work->str_sol, work->sys_sol);
-
-#endif  // LA_HIGH_PERFORMANCE
-#endif  // !TRIPLE_LOOP
+    d_create_strvec(num_stages * nx, work->str_adj, ptr);
+    ptr += work->str_adj->memory_size;
+    if (opts->scheme.type == simplified_in ||
+        opts->scheme.type == simplified_inis) {
+        d_create_strmat(num_stages, num_stages, work->str_trans, ptr);
+        ptr += work->str_trans->memory_size;
+        d_create_strmat(nx, num_stages * (1 + NF), work->str_stages, ptr);
+        ptr += work->str_stages->memory_size;
+        d_create_strmat(nx, num_stages * (1 + NF), work->str_stages_trans, ptr);
+        ptr += work->str_stages_trans->memory_size;
+    }
 }
 
-#if TRIPLE_LOOP
+// VDE in NF < nx+nu directions: the seeds of rhs_in are padded with zeros to
+// the nx+nu directions of the VDE, the last nu directions seed the controls
+static void directional_vde(const sim_in *in, int_t NF, const real_t *rhs_in,
+                            real_t *vde_in, real_t *vde_out, real_t *out) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t nx_dirs = NF - nu;  // directions in the states only
+
+    for (int_t i = 0; i < nx; i++) vde_in[i] = rhs_in[i];
+    for (int_t j = 0; j < nx; j++)
+        for (int_t i = 0; i < nx; i++)
+            vde_in[(1 + j) * nx + i] = (j < nx_dirs) ? rhs_in[(1 + j) * nx + i] : 0.0;
+    for (int_t j = 0; j < nu; j++)
+        for (int_t i = 0; i < nx; i++)
+            vde_in[(1 + nx + j) * nx + i] = rhs_in[(1 + nx_dirs + j) * nx + i];
+    for (int_t i = 0; i < nu + 1; i++)
+        vde_in[nx * (1 + nx + nu) + i] = rhs_in[nx * (1 + NF) + i];  // controls, time
+
+    in->forward_vde_wrapper(nx, nu, vde_in, vde_out, in->vde);
+
+    for (int_t i = 0; i < nx * (1 + nx_dirs); i++) out[i] = vde_out[i];
+    for (int_t i = 0; i < nx * nu; i++)
+        out[nx * (1 + nx_dirs) + i] = vde_out[nx * (1 + nx) + i];
+}
 
 #if CODE_GENERATION
 #define DIM 6      // num_stages*NX
@@ -181,7 +265,7 @@ real_t LU_system_ACADO(real_t *const A, int *const perm, int dim) {
 }
 
 real_t solve_system_ACADO(real_t *const A, real_t *const b, int *const perm,
-                          int dim, int dim2) {
+                          real_t *const bPerm, int dim, int dim2) {
     int i, j, k;
     int index1;
 //    printf("solve_system_ACADO, dim: %d, dim2: %d \n", dim, dim2);
@@ -193,8 +277,6 @@ real_t solve_system_ACADO(real_t *const A, real_t *const b, int *const perm,
     dim += 0;
     dim2 += 0;
 #endif
-    real_t *bPerm;
-    bPerm = (real_t *) calloc(DIM*DIM_RHS, sizeof(real_t));
     real_t tmp_var;
 
     for (i = 0; i < DIM; ++i) {
@@ -230,7 +312,8 @@ real_t solve_system_ACADO(real_t *const A, real_t *const b, int *const perm,
 }
 
 real_t solve_system_trans_ACADO(real_t *const A, real_t *const b,
-                                int *const perm, int dim, int dim2) {
+                                int *const perm, real_t *const bPerm, int dim,
+                                int dim2) {
     int i, j, k;
     int index1;
 //    printf("solve_system_trans_ACADO, dim: %d, dim2: %d \n", dim, dim2);
@@ -242,8 +325,6 @@ real_t solve_system_trans_ACADO(real_t *const A, real_t *const b,
     dim += 0;
     dim2 += 0;
 #endif
-    real_t *bPerm;
-    bPerm = (real_t *) calloc(DIM*DIM_RHS, sizeof(real_t));
     real_t tmp_var;
 
     for (k = 0; k < DIM * DIM_RHS; ++k) {
@@ -278,8 +359,6 @@ real_t solve_system_trans_ACADO(real_t *const A, real_t *const b,
     return 0;
 }
 
-#endif
-
 void transform_mat(real_t *mat, real_t *trans, real_t *mat_trans,
                    const int_t stages, const int_t n, const int_t m) {
     //    print_matrix_name("stdout", "trans", trans, stages, stages);
@@ -312,6 +391,49 @@ void transform_vec(real_t *mat, real_t *trans, real_t *mat_trans,
     }
 }
 
+// Same as transform_mat, with the n x stages blocks of the m columns of mat
+// multiplied by trans' in BLASFEO
+static void transform_mat_blasfeo(sim_lifted_irk_workspace *work, real_t *mat,
+                                  real_t *trans, real_t *mat_trans,
+                                  const int_t stages, const int_t n,
+                                  const int_t m) {
+    d_cvt_mat2strmat(stages, stages, trans, stages, work->str_trans, 0, 0);
+    d_cvt_mat2strmat(n, stages * m, mat, n, work->str_stages, 0, 0);
+    for (int_t j = 0; j < m; j++) {
+        dgemm_nt_libstr(n, stages, stages, 1.0, work->str_stages, 0, j * stages,
+                        work->str_trans, 0, 0, 0.0, work->str_stages_trans, 0,
+                        j * stages, work->str_stages_trans, 0, j * stages);
+    }
+    d_cvt_strmat2mat(n, stages * m, work->str_stages_trans, 0, 0, mat_trans, n);
+}
+
+static void transform_stages(sim_lifted_irk_workspace *work, bool blasfeo,
+                             real_t *mat, real_t *trans, real_t *mat_trans,
+                             const int_t stages, const int_t n, const int_t m) {
+    if (blasfeo)
+        transform_mat_blasfeo(work, mat, trans, mat_trans, stages, n, m);
+    else
+        transform_mat(mat, trans, mat_trans, stages, n, m);
+}
+
+// Solves A'*x = b in place for the LU factorization P*A = L*U computed by
+// dgetrf_libstr
+static void solve_system_trans_blasfeo(struct d_strmat *str_mat, int *ipiv,
+                                       struct d_strvec *str_vec, int_t vi,
+                                       real_t *b, int_t dim) {
+    d_cvt_vec2strvec(dim, b, str_vec, vi);
+    dtrsv_utn_libstr(dim, str_mat, 0, 0, str_vec, vi, str_vec, vi);  // U'
+    dtrsv_ltu_libstr(dim, str_mat, 0, 0, str_vec, vi, str_vec, vi);  // L'
+    d_cvt_strvec2vec(dim, str_vec, vi, b);
+    for (int_t i = dim - 1; i >= 0; i--) {  // inverse row permutations
+        if (ipiv[i] != i) {
+            real_t tmp = b[i];
+            b[i] = b[ipiv[i]];
+            b[ipiv[i]] = tmp;
+        }
+    }
+}
+
 void construct_subsystems(real_t *mat, real_t **mat2, const int_t stages,
                           const int_t n, const int_t m) {
     int_t idx = 0;
@@ -370,6 +492,301 @@ void destruct_subsystems(real_t *mat, real_t **mat2, const int_t stages,
     }
 }
 
+typedef enum {
+    LU_SUBSYSTEM,
+    SOLVE_SUBSYSTEM,
+    SOLVE_TRANS_SUBSYSTEM,
+} subsystem_task;
+
+typedef struct {
+    subsystem_task task;
+    int_t nx;
+    int_t num_stages;
+    int_t num_rhs;  // of SOLVE_SUBSYSTEM
+    bool simplified;
+    bool blasfeo;
+    bool sparse;  // of the exact scheme, the matrix is mem->sparse_val
+    bool singular;  // zero pivot of the sparse factorization
+    sim_lifted_irk_memory *mem;
+    sim_lifted_irk_workspace *work;
+} subsystem_context;
+
+static int_t num_subsystems(const sim_RK_opts *opts) {
+    if (opts->scheme.type == simplified_in ||
+        opts->scheme.type == simplified_inis)
+        return (opts->num_stages + 1) / 2;
+    return 1;
+}
+
+// Factorizes or solves linear subsystem idx, which is the full system of all
+// stages for the exact Newton scheme. The subsystems of the simplified schemes
+// only share the scratch arrays sys_perm and str_adj, of which each subsystem
+// uses the rows of its own stages, so they can be processed in any order and
+// on any thread with bitwise identical results.
+static void process_subsystem(void *ctx_, int_t idx, int_t thread_id) {
+    subsystem_context *ctx = (subsystem_context *)ctx_;
+    sim_lifted_irk_memory *mem = ctx->mem;
+    sim_lifted_irk_workspace *work = ctx->work;
+    int_t nx = ctx->nx;
+    int_t row = 2 * idx * nx;  // first row of the subsystem in the full system
+    int_t dim_sys;
+    real_t *sys_mat, *sys_sol;
+    int *ipiv;
+    struct d_strmat *str_mat, *str_sol;
+
+    (void)thread_id;
+    if (ctx->simplified) {
+        // complex conjugate pair of eigenvalues, or the last real one
+        dim_sys = (2 * idx + 1 < ctx->num_stages) ? 2 * nx : nx;
+        sys_mat = mem->sys_mat2[idx];
+        sys_sol = mem->sys_sol2[idx];
+        ipiv = mem->ipiv2[idx];
+        str_mat = ctx->blasfeo ? mem->str_mat2[idx] : NULL;
+        str_sol = ctx->blasfeo ? mem->str_sol2[idx] : NULL;
+    } else {
+        dim_sys = ctx->num_stages * nx;
+        sys_mat = work->sys_mat;
+        sys_sol = work->sys_sol;
+        ipiv = work->ipiv;
+        str_mat = work->str_mat;
+        str_sol = work->str_sol;
+    }
+
+    switch (ctx->task) {
+        case LU_SUBSYSTEM:
+            if (ctx->sparse) {
+                if (sparse_lu_factorize(&mem->sparse_lu, mem->sparse_val, work->sys_perm) != 0)
+                    ctx->singular = true;
+            } else if (!ctx->blasfeo) {
+                LU_system_ACADO(sys_mat, ipiv, dim_sys);
+            } else {
+                d_cvt_mat2strmat(dim_sys, dim_sys, sys_mat, dim_sys, str_mat, 0,
+                                 0);
+                dgetrf_libstr(dim_sys, dim_sys, str_mat, 0, 0, str_mat, 0, 0,
+                              ipiv);  // Gauss elimination
+            }
+            break;
+        case SOLVE_SUBSYSTEM:
+            if (ctx->sparse) {
+                sparse_lu_solve(&mem->sparse_lu, mem->sparse_val, sys_sol, ctx->num_rhs,
+                                work->sys_perm);
+            } else if (!ctx->blasfeo) {
+                solve_system_ACADO(sys_mat, sys_sol, ipiv,
+                                   work->sys_perm + row * ctx->num_rhs, dim_sys,
+                                   ctx->num_rhs);
+            } else {
+                d_cvt_mat2strmat(dim_sys, ctx->num_rhs, sys_sol, dim_sys,
+                                 str_sol, 0, 0);
+                drowpe_libstr(dim_sys, ipiv, str_sol);  // row permutations
+                dtrsm_llnu_libstr(dim_sys, ctx->num_rhs, 1.0, str_mat, 0, 0,
+                                  str_sol, 0, 0, str_sol, 0, 0);  // L backsolve
+                dtrsm_lunn_libstr(dim_sys, ctx->num_rhs, 1.0, str_mat, 0, 0,
+                                  str_sol, 0, 0, str_sol, 0, 0);  // U backsolve
+                d_cvt_strmat2mat(dim_sys, ctx->num_rhs, str_sol, 0, 0, sys_sol,
+                                 dim_sys);
+            }
+            break;
+        case SOLVE_TRANS_SUBSYSTEM:
+            if (!ctx->blasfeo) {
+                solve_system_trans_ACADO(sys_mat, sys_sol, ipiv,
+                                         work->sys_perm + row, dim_sys, 1);
+            } else {
+                solve_system_trans_blasfeo(str_mat, ipiv, work->str_adj, row,
+                                           sys_sol, dim_sys);
+            }
+            break;
+    }
+}
+
+// Processes all subsystems, on the thread pool of the memory if there is one
+static void process_subsystems(subsystem_context *ctx, subsystem_task task,
+                               int_t num_sys) {
+    ctx->task = task;
+    if (ctx->mem->pool != NULL && num_sys > 1) {
+        acados_thread_pool_run_items(ctx->mem->pool, num_sys,
+                                     &process_subsystem, ctx);
+    } else {
+        for (int_t idx = 0; idx < num_sys; idx++)
+            process_subsystem(ctx, idx, 0);
+    }
+}
+
+// Product y = M*v with the matrix I - h*A kron J of the exact Newton scheme,
+// row block s1 is v_s1 - h*J_s1*sum_s2 a_s1s2*v_s2
+static void mf_product(const sim_in *in, const sim_RK_opts *opts,
+                       const real_t *jac_stages, const real_t *v, real_t *y,
+                       real_t *tmp) {
+    int_t nx = in->nx;
+    int_t num_stages = opts->num_stages;
+    real_t H_INT = in->step;
+    for (int_t s1 = 0; s1 < num_stages; s1++) {
+        for (int_t i = 0; i < nx; i++) {
+            tmp[i] = 0.0;
+            for (int_t s2 = 0; s2 < num_stages; s2++)
+                tmp[i] += H_INT * opts->A_mat[s2 * num_stages + s1] * v[s2 * nx + i];
+        }
+        for (int_t i = 0; i < nx; i++) y[s1 * nx + i] = v[s1 * nx + i];
+        for (int_t j = 0; j < nx; j++)
+            for (int_t i = 0; i < nx; i++)
+                y[s1 * nx + i] -= jac_stages[s1 * nx * nx + j * nx + i] * tmp[j];
+    }
+}
+
+// Diagonal blocks I - h*a_ss*J_s of the system matrix of the current step
+static void mf_factorize_preconditioner(const sim_in *in, const sim_RK_opts *opts,
+                                        sim_lifted_irk_workspace *work) {
+    int_t nx = in->nx;
+    int_t num_stages = opts->num_stages;
+    for (int_t s = 0; s < num_stages; s++) {
+        real_t *prec = &work->prec_mat[s * nx * nx];
+        real_t a = in->step * opts->A_mat[s * num_stages + s];
+        for (int_t j = 0; j < nx; j++)
+            for (int_t i = 0; i < nx; i++)
+                prec[j * nx + i] = (i == j ? 1.0 : 0.0) -
+                                   a * work->jac_stages[s * nx * nx + j * nx + i];
+        LU_system_ACADO(prec, &work->ipiv[s * nx], nx);
+    }
+}
+
+static void mf_precondition(const sim_in *in, const sim_RK_opts *opts,
+                            sim_lifted_irk_workspace *work, const real_t *v,
+                            real_t *z) {
+    int_t nx = in->nx;
+    for (int_t i = 0; i < opts->num_stages * nx; i++) z[i] = v[i];
+    for (int_t s = 0; s < opts->num_stages; s++)
+        solve_system_ACADO(&work->prec_mat[s * nx * nx], &z[s * nx],
+                           &work->ipiv[s * nx], work->sys_perm, nx, 1);
+}
+
+static real_t mf_dot(int_t n, const real_t *x, const real_t *y) {
+    real_t dot = 0.0;
+    for (int_t i = 0; i < n; i++) dot += x[i] * y[i];
+    return dot;
+}
+
+// Restarted GMRES with right preconditioning for M*x = b, x holds the initial
+// guess. Adds the number of iterations to num_iter and returns false if the
+// tolerance is not reached within krylov_max_iter iterations.
+static bool mf_gmres(const sim_in *in, const sim_RK_opts *opts,
+                     sim_lifted_irk_workspace *work, const real_t *b,
+                     real_t *x, int_t *num_iter) {
+    int_t n = opts->num_stages * in->nx;
+    int_t m = opts->krylov_dim;
+    real_t *V = work->krylov_V;
+    real_t *H = work->krylov_H;
+    real_t *w = work->krylov_tmp;
+    real_t *z = w + n;
+    real_t *tmp = z + 2 * n;  // after the solution vector
+    real_t *cs = tmp + in->nx;
+    real_t *sn = cs + m;
+    real_t *g = sn + m;
+
+    real_t tol = opts->krylov_tol * sqrt(mf_dot(n, b, b));
+    int_t iter = 0;
+    bool converged = false;
+    while (!converged && iter < opts->krylov_max_iter) {
+        mf_product(in, opts, work->jac_stages, x, w, tmp);
+        for (int_t i = 0; i < n; i++) V[i] = b[i] - w[i];
+        real_t beta = sqrt(mf_dot(n, V, V));
+        if (beta <= tol) {
+            converged = true;
+            break;
+        }
+        for (int_t i = 0; i < n; i++) V[i] /= beta;
+        g[0] = beta;
+
+        int_t k = 0;
+        while (k < m && iter < opts->krylov_max_iter) {
+            real_t *h = &H[k * (m + 1)];
+            real_t *v_new = &V[(k + 1) * n];
+            mf_precondition(in, opts, work, &V[k * n], z);
+            mf_product(in, opts, work->jac_stages, z, v_new, tmp);
+            for (int_t i = 0; i <= k; i++) {  // modified Gram-Schmidt
+                h[i] = mf_dot(n, v_new, &V[i * n]);
+                for (int_t l = 0; l < n; l++) v_new[l] -= h[i] * V[i * n + l];
+            }
+            h[k + 1] = sqrt(mf_dot(n, v_new, v_new));
+            if (h[k + 1] > 0.0)
+                for (int_t l = 0; l < n; l++) v_new[l] /= h[k + 1];
+
+            // Givens rotations of the Hessenberg matrix and the residual
+            for (int_t i = 0; i < k; i++) {
+                real_t t = cs[i] * h[i] + sn[i] * h[i + 1];
+                h[i + 1] = -sn[i] * h[i] + cs[i] * h[i + 1];
+                h[i] = t;
+            }
+            real_t r = hypot(h[k], h[k + 1]);
+            cs[k] = (r > 0.0) ? h[k] / r : 1.0;
+            sn[k] = (r > 0.0) ? h[k + 1] / r : 0.0;
+            h[k] = r;
+            h[k + 1] = 0.0;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] *= cs[k];
+            k++;
+            iter++;
+            if (fabs(g[k]) <= tol) {
+                converged = true;
+                break;
+            }
+        }
+
+        // x += P^-1*V*y with the triangular solve H*y = g
+        for (int_t i = k - 1; i >= 0; i--) {
+            for (int_t j = i + 1; j < k; j++) g[i] -= H[j * (m + 1) + i] * g[j];
+            g[i] /= H[i * (m + 1) + i];
+        }
+        for (int_t i = 0; i < n; i++) {
+            w[i] = 0.0;
+            for (int_t j = 0; j < k; j++) w[i] += V[j * n + i] * g[j];
+        }
+        mf_precondition(in, opts, work, w, z);
+        for (int_t i = 0; i < n; i++) x[i] += z[i];
+    }
+    *num_iter += iter;
+    return converged;
+}
+
+// Keeps the factorized Newton matrix of the exact scheme at step istep for the
+// adjoint sweep of the second order sensitivities
+static void store_newton_matrix(int_t istep, const sim_in *in, const sim_RK_opts *opts,
+                                sim_lifted_irk_memory *mem,
+                                sim_lifted_irk_workspace *work, bool blasfeo) {
+    int_t dim_sys = opts->num_stages * in->nx;
+    if (use_sparse(opts)) {
+        int_t nnz = mem->sparse_lu.nnz;
+        memcpy(&mem->sys_mat_traj[istep * nnz], mem->sparse_val, nnz * sizeof(real_t));
+        return;
+    }
+    real_t *mat = &mem->sys_mat_traj[istep * dim_sys * dim_sys];
+    if (blasfeo)
+        d_cvt_strmat2mat(dim_sys, dim_sys, work->str_mat, 0, 0, mat, dim_sys);
+    else
+        memcpy(mat, work->sys_mat, dim_sys * dim_sys * sizeof(real_t));
+    memcpy(&mem->ipiv_traj[istep * dim_sys], work->ipiv, dim_sys * sizeof(int_t));
+}
+
+// Solves with the transposed Newton matrix of step istep in place
+static void solve_newton_matrix_trans(int_t istep, const sim_in *in,
+                                      const sim_RK_opts *opts,
+                                      sim_lifted_irk_memory *mem,
+                                      sim_lifted_irk_workspace *work, bool blasfeo,
+                                      real_t *b) {
+    int_t dim_sys = opts->num_stages * in->nx;
+    if (use_sparse(opts)) {
+        sparse_lu_solve_trans(&mem->sparse_lu, &mem->sys_mat_traj[istep * mem->sparse_lu.nnz],
+                              b, 1, work->sys_perm);
+        return;
+    }
+    real_t *mat = &mem->sys_mat_traj[istep * dim_sys * dim_sys];
+    int_t *ipiv = &mem->ipiv_traj[istep * dim_sys];
+    if (blasfeo) {
+        d_cvt_mat2strmat(dim_sys, dim_sys, mat, dim_sys, work->str_mat, 0, 0);
+        solve_system_trans_blasfeo(work->str_mat, ipiv, work->str_adj, 0, b, dim_sys);
+    } else {
+        solve_system_trans_ACADO(mat, b, ipiv, work->sys_perm, dim_sys, 1);
+    }
+}
+
 void form_linear_system_matrix(int_t istep, const sim_in *in, void *args,
                                sim_lifted_irk_memory *mem,
                                sim_lifted_irk_workspace *work, real_t *sys_mat,
@@ -418,7 +835,11 @@ void form_linear_system_matrix(int_t istep, const sim_in *in, void *args,
             }
             idx++;
         }
-    } else if (opts->scheme.type == exact) {
+    } else if (use_sparse(opts)) {
+        for (i = 0; i < mem->sparse_lu.nnz; i++) mem->sparse_val[i] = 0.0;
+        for (i = 0; i < num_stages * nx; i++)
+            mem->sparse_val[mem->sparse_lu.diag[mem->sparse_lu.iperm[i]]] = 1.0;  // identity
+    } else if (opts->scheme.type == exact && !opts->matrix_free) {
         for (i = 0; i < num_stages * nx * num_stages * nx; i++)
             sys_mat[i] = 0.0;
         for (i = 0; i < num_stages * nx; i++)
@@ -450,7 +871,17 @@ void form_linear_system_matrix(int_t istep, const sim_in *in, void *args,
         }
 
         // put jac_tmp in sys_mat:
-        if (opts->scheme.type == exact) {
+        if (matrix_free(opts)) {
+            for (i = 0; i < nx * nx; i++)
+                work->jac_stages[s1 * nx * nx + i] = jac_tmp[nx + i];
+        } else if (use_sparse(opts)) {  // structural nonzeros only
+            for (s2 = 0; s2 < num_stages; s2++) {
+                int_t *pos = &mem->sparse_pos[(s2 * num_stages + s1) * mem->nnz_jac];
+                for (i = 0; i < mem->nnz_jac; i++)
+                    mem->sparse_val[pos[i]] -= H_INT * A_mat[s2 * num_stages + s1] *
+                                               jac_tmp[nx + mem->jac_idx[i]];
+            }
+        } else if (opts->scheme.type == exact) {
             for (s2 = 0; s2 < num_stages; s2++) {
                 for (j = 0; j < nx; j++) {
                     for (i = 0; i < nx; i++) {
@@ -497,13 +928,14 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
     int_t nu = in->nu;
     sim_RK_opts *opts = (sim_RK_opts *)args;
     int_t num_stages = opts->num_stages;
-    int_t dim_sys = num_stages * nx;
     int_t i, s1, s2, j, istep;
     sim_lifted_irk_memory *mem = (sim_lifted_irk_memory *)mem_;
+    int_t NF = in->num_forw_sens;
+    if (NF < nu || NF > nx + nu) return -1;  // the controls are seeded
+    if (hessian(in, opts) && (matrix_free(opts) || NF != nx + nu)) return -1;
     sim_lifted_irk_workspace *work = (sim_lifted_irk_workspace *)work_;
     sim_lifted_irk_cast_workspace(work, in, args);
     real_t H_INT = in->step;
-    int_t NF = in->num_forw_sens;
 
     real_t *A_mat = opts->A_mat;
     real_t *b_vec = opts->b_vec;
@@ -525,27 +957,32 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
 
     real_t *adj_tmp = work->out_adj_tmp;
 
-    int *ipiv = work->ipiv;    // pivoting vector
-    int **ipiv2 = mem->ipiv2;  // pivoting vector
     real_t *sys_mat = work->sys_mat;
     real_t **sys_mat2 = mem->sys_mat2;
     real_t *sys_sol = work->sys_sol;
     real_t **sys_sol2 = mem->sys_sol2;
     real_t *sys_sol_trans = work->sys_sol_trans;
-#if !TRIPLE_LOOP
-    struct d_strmat *str_mat = work->str_mat;
-    struct d_strmat **str_mat2 = mem->str_mat2;
-
-    struct d_strmat *str_sol = work->str_sol;
-    struct d_strmat **str_sol2 = mem->str_sol2;
-#endif  // !TRIPLE_LOOP
+    bool blasfeo = use_blasfeo(in, opts);
+
+    // decoupled linear subsystems of the simplified Newton schemes
+    int_t num_sys = num_subsystems(opts);
+    subsystem_context sub;
+    sub.nx = nx;
+    sub.num_stages = num_stages;
+    sub.num_rhs = 1;
+    sub.simplified = opts->scheme.type == simplified_in ||
+                     opts->scheme.type == simplified_inis;
+    sub.blasfeo = blasfeo;
+    sub.sparse = use_sparse(opts);
+    sub.singular = false;
+    sub.mem = mem;
+    sub.work = work;
 
     acados_timer timer, timer_la, timer_ad;
     real_t timing_la = 0.0;
     real_t timing_ad = 0.0;
-
-    if (NF != nx + nu) return -1;  // NOT YET IMPLEMENTED
-//    printf("NU = %d, NF = %d \n", nu, NF);
+    int_t num_krylov_iter = 0;
+    int_t status = ACADOS_SUCCESS;
 
     acados_tic(&timer);
     for (i = 0; i < nx; i++) out_tmp[i] = in->x[i];
@@ -559,27 +996,30 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
         for (i = 0; i < nx; i++) adj_tmp[i] = in->S_adj[i];
     }
 
-    // Newton step of the collocation variables with respect to the inputs:
-    if (NF == (nx + nu) && in->sens_adj) {
+    // Newton step of the collocation variables with respect to the inputs,
+    // only with the full sensitivities:
+    if (in->sens_adj) {
         for (istep = in->num_steps - 1; istep > -1; istep--) {  // ADJOINT update
-            for (s1 = 0; s1 < num_stages; s1++) {
-                for (j = 0; j < nx; j++) {  // step in X
-                    for (i = 0; i < nx; i++) {
-                        K_traj[(istep * num_stages + s1) * nx + i] +=
-                            DK_traj[(istep * num_stages + s1) * nx * (nx + nu) +
-                                    j * nx + i] *
-                            (in->x[j] - mem->x[j]);  // RK step
+            if (NF == nx + nu) {
+                for (s1 = 0; s1 < num_stages; s1++) {
+                    for (j = 0; j < nx; j++) {  // step in X
+                        for (i = 0; i < nx; i++) {
+                            K_traj[(istep * num_stages + s1) * nx + i] +=
+                                DK_traj[(istep * num_stages + s1) * nx * (nx + nu) +
+                                        j * nx + i] *
+                                (in->x[j] - mem->x[j]);  // RK step
+                        }
+                        mem->x[j] = in->x[j];
                     }
-                    mem->x[j] = in->x[j];
-                }
-                for (j = 0; j < nu; j++) {  // step in U
-                    for (i = 0; i < nx; i++) {
-                        K_traj[(istep * num_stages + s1) * nx + i] +=
-                            DK_traj[(istep * num_stages + s1) * nx * (nx + nu) +
-                                    (nx + j) * nx + i] *
-                            (in->u[j] - mem->u[j]);  // RK step
+                    for (j = 0; j < nu; j++) {  // step in U
+                        for (i = 0; i < nx; i++) {
+                            K_traj[(istep * num_stages + s1) * nx + i] +=
+                                DK_traj[(istep * num_stages + s1) * nx * (nx + nu) +
+                                        (nx + j) * nx + i] *
+                                (in->u[j] - mem->u[j]);  // RK step
+                        }
+                        mem->u[j] = in->u[j];
                     }
-                    mem->u[j] = in->u[j];
                 }
             }
             if (opts->scheme.type == simplified_inis && !opts->scheme.freeze) {
@@ -627,45 +1067,15 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
                                 opts->scheme.transf1_T[s2 * num_stages + s1];
                         }
                     }
-                    transform_vec(sys_sol, work->trans, sys_sol_trans,
-                                  num_stages, nx);
+                    transform_stages(work, blasfeo, sys_sol, work->trans,
+                                     sys_sol_trans, num_stages, nx, 1);
 
                     // construct sys_sol2 from sys_sol_trans:
                     construct_subsystems(sys_sol_trans, sys_sol2, num_stages,
                                          nx, 1);
                 }
                 acados_tic(&timer_la);
-                int_t idx = 0;
-                for (s1 = 0; s1 < num_stages; s1++) {
-                    // THIS LOOP IS PARALLELIZABLE BECAUSE OF DECOMPOSABLE
-                    // LINEAR SUBSYSTEMS
-                    if (opts->scheme.type == simplified_in ||
-                        opts->scheme.type == simplified_inis) {
-                        sys_mat = sys_mat2[idx];
-                        ipiv = ipiv2[idx];
-                        sys_sol = sys_sol2[idx];
-#if !TRIPLE_LOOP
-                        str_mat = str_mat2[idx];
-                        str_sol = str_sol2[idx];
-#endif
-                        idx++;
-                        if ((s1 + 1) < num_stages) {
-                            dim_sys = 2 * nx;
-                            s1++;  // complex conjugate pair of eigenvalues
-                        } else {
-                            dim_sys = nx;
-                        }
-                    } else {
-                        dim_sys = num_stages * nx;
-                        s1 = num_stages;  // break out of for-loop
-                    }
-#if TRIPLE_LOOP
-                    solve_system_trans_ACADO(sys_mat, sys_sol, ipiv, dim_sys,
-                                             1);
-#else  // TRIPLE_LOOP
-#error : NOT YET IMPLEMENTED
-#endif  // TRIPLE_LOOP
-                }
+                process_subsystems(&sub, SOLVE_TRANS_SUBSYSTEM, num_sys);
                 timing_la += acados_toc(&timer_la);
                 // TRANSFORM using transf2_T:
                 if (opts->scheme.type == simplified_in ||
@@ -676,8 +1086,9 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
 
                     // apply the transf2 operation:
                     sys_sol = work->sys_sol;
-                    transform_vec(sys_sol_trans, opts->scheme.transf2_T,
-                                  sys_sol, num_stages, nx);
+                    transform_stages(work, blasfeo, sys_sol_trans,
+                                     opts->scheme.transf2_T, sys_sol,
+                                     num_stages, nx, 1);
                 }
 
                 // update mu_traj
@@ -709,48 +1120,24 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
     }
 
     for (istep = 0; istep < in->num_steps; istep++) {
+        if (hessian(in, opts))
+            memcpy(&mem->forw_traj[istep * nx * (1 + NF)], out_tmp, nx * (1 + NF) * sizeof(real_t));
+
 // form linear system matrix (explicit ODE case):
 
         form_linear_system_matrix(istep, in, args, mem, work, sys_mat, sys_mat2, timing_ad);
 
-        int_t idx;
-        if (opts->scheme.type == exact || (istep == 0 && !opts->scheme.freeze)) {
-            acados_tic(&timer_la);
-            idx = 0;
-            for (s1 = 0; s1 < num_stages; s1++) {
-                // THIS LOOP IS PARALLELIZABLE BECAUSE OF DECOMPOSABLE LINEAR
-                // SUBSYSTEMS
-                if (opts->scheme.type == simplified_in ||
-                    opts->scheme.type == simplified_inis) {
-                    sys_mat = sys_mat2[idx];
-                    ipiv = ipiv2[idx];
-#if !TRIPLE_LOOP
-                    str_mat = str_mat2[idx];
-#endif
-                    idx++;
-                    if ((s1 + 1) < num_stages) {
-                        dim_sys = 2 * nx;
-                        s1++;  // complex conjugate pair of eigenvalues
-                    } else {
-                        dim_sys = nx;
-                    }
-                } else {
-                    dim_sys = num_stages * nx;
-                    s1 = num_stages;  // break out of for-loop
-                }
-#if TRIPLE_LOOP
-                LU_system_ACADO(sys_mat, ipiv, dim_sys);
-#else  // TRIPLE_LOOP
-// ---- BLASFEO: LU factorization ----
-#if defined(LA_HIGH_PERFORMANCE)
-                d_cvt_mat2strmat(dim_sys, dim_sys, sys_mat, dim_sys, str_mat, 0,
-                                 0);  // mat2strmat
-#endif  // LA_BLAS | LA_REFERENCE
-                dgetrf_libstr(dim_sys, dim_sys, str_mat, 0, 0, str_mat, 0, 0,
-                              ipiv);  // Gauss elimination
-// ---- BLASFEO: LU factorization ----
-#endif  // TRIPLE_LOOP
+        if (matrix_free(opts)) {
+            if (istep == 0) {  // reused by all steps
+                acados_tic(&timer_la);
+                mf_factorize_preconditioner(in, opts, work);
+                timing_la += acados_toc(&timer_la);
             }
+        } else if (opts->scheme.type == exact || (istep == 0 && !opts->scheme.freeze)) {
+            acados_tic(&timer_la);
+            process_subsystems(&sub, LU_SUBSYSTEM, num_sys);
+            if (sub.singular) return -1;
+            if (hessian(in, opts)) store_newton_matrix(istep, in, opts, mem, work, blasfeo);
             timing_la += acados_toc(&timer_la);
         }
 
@@ -782,7 +1169,10 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
             rhs_in[nx*(1+NF)+nu] = ((real_t) istep+c_vec[s1])/((real_t) in->num_steps);  // time
 
             acados_tic(&timer_ad);
-            in->forward_vde_wrapper(nx, nu, rhs_in, VDE_tmp[s1], in->vde);  // k evaluation
+            if (NF == nx + nu)
+                in->forward_vde_wrapper(nx, nu, rhs_in, VDE_tmp[s1], in->vde);  // k evaluation
+            else
+                directional_vde(in, NF, rhs_in, work->vde_in, work->vde_out, VDE_tmp[s1]);
             timing_ad += acados_toc(&timer_ad);
 
             // put VDE_tmp in sys_sol:
@@ -829,11 +1219,11 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
                 }
             }
             if (!opts->scheme.freeze) {
-                transform_mat(sys_sol, work->trans, sys_sol_trans, num_stages,
-                              nx, 1 + NF);
+                transform_stages(work, blasfeo, sys_sol, work->trans,
+                                 sys_sol_trans, num_stages, nx, 1 + NF);
             } else {
-                transform_mat(sys_sol, work->trans, sys_sol_trans, num_stages,
-                              nx, 1);
+                transform_stages(work, blasfeo, sys_sol, work->trans,
+                                 sys_sol_trans, num_stages, nx, 1);
             }
 
             // construct sys_sol2 from sys_sol_trans:
@@ -847,59 +1237,24 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
         }
 
         acados_tic(&timer_la);
-        idx = 0;
-        for (s1 = 0; s1 < num_stages; s1++) {
-            // THIS LOOP IS PARALLELIZABLE BECAUSE OF DECOMPOSABLE LINEAR
-            // SUBSYSTEMS
-            if (opts->scheme.type == simplified_in ||
-                opts->scheme.type == simplified_inis) {
-                sys_mat = sys_mat2[idx];
-                ipiv = ipiv2[idx];
-                sys_sol = sys_sol2[idx];
-#if !TRIPLE_LOOP
-                str_mat = str_mat2[idx];
-                str_sol = str_sol2[idx];
-#endif
-                idx++;
-                if ((s1 + 1) < num_stages) {
-                    dim_sys = 2 * nx;
-                    s1++;  // complex conjugate pair of eigenvalues
-                } else {
-                    dim_sys = nx;
-                }
-            } else {
-                dim_sys = num_stages * nx;
-                s1 = num_stages;  // break out of for-loop
-            }
-#if TRIPLE_LOOP
-            if (!opts->scheme.freeze) {
-                solve_system_ACADO(sys_mat, sys_sol, ipiv, dim_sys, 1 + NF);
-            } else {
-                solve_system_ACADO(sys_mat, sys_sol, ipiv, dim_sys, 1);
+        sub.num_rhs = opts->scheme.freeze ? 1 : 1 + NF;
+        if (matrix_free(opts)) {
+            // the Newton step starts from zero, the sensitivities from the
+            // previous ones
+            real_t *sol = work->krylov_tmp + 2 * num_stages * nx;
+            for (j = 0; j < sub.num_rhs; j++) {
+                for (s1 = 0; s1 < num_stages; s1++)
+                    for (i = 0; i < nx; i++)
+                        sol[s1 * nx + i] = (j == 0) ? 0.0 :
+                            DK_traj[(istep * num_stages + s1) * nx * NF + (j - 1) * nx + i];
+                if (!mf_gmres(in, opts, work, &sys_sol[j * num_stages * nx], sol,
+                              &num_krylov_iter))
+                    status = ACADOS_MAXITER;
+                for (i = 0; i < num_stages * nx; i++)
+                    sys_sol[j * num_stages * nx + i] = sol[i];
             }
-#else  // TRIPLE_LOOP
-#if defined(LA_HIGH_PERFORMANCE)
-            // ---- BLASFEO: row transformations + backsolve ----
-            d_cvt_mat2strmat(dim_sys, 1 + NF, sys_sol, dim_sys, str_sol, 0,
-                             0);                    // mat2strmat
-            drowpe_libstr(dim_sys, ipiv, str_sol);  // row permutations
-            dtrsm_llnu_libstr(dim_sys, 1 + NF, 1.0, str_mat, 0, 0, str_sol, 0,
-                              0, str_sol, 0, 0);  // L backsolve
-            dtrsm_lunn_libstr(dim_sys, 1 + NF, 1.0, str_mat, 0, 0, str_sol, 0,
-                              0, str_sol, 0, 0);  // U backsolve
-            d_cvt_strmat2mat(dim_sys, 1 + NF, str_sol, 0, 0, sys_sol,
-                             dim_sys);  // strmat2mat
-                                        // BLASFEO: row transformations + backsolve
-#else   // LA_BLAS | LA_REFERENCE
-            // ---- BLASFEO: row transformations + backsolve ----
-            drowpe_libstr(dim_sys, ipiv, str_sol);  // row permutations
-            dtrsm_llnu_libstr(dim_sys, 1 + NF, 1.0, str_mat, 0, 0, str_sol, 0,
-                              0, str_sol, 0, 0);  // L backsolve
-            dtrsm_lunn_libstr(dim_sys, 1 + NF, 1.0, str_mat, 0, 0, str_sol, 0,
-                              0, str_sol, 0, 0);  // U backsolve
-                                                  // BLASFEO: row transformations + backsolve
-#endif  // LA_BLAFEO
-#endif  // TRIPLE_LOOP
+        } else {
+            process_subsystems(&sub, SOLVE_SUBSYSTEM, num_sys);
         }
         timing_la += acados_toc(&timer_la);
         if (opts->scheme.type == simplified_in || opts->scheme.type == simplified_inis) {
@@ -914,11 +1269,13 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
             // apply the transf2 operation:
             sys_sol = work->sys_sol;
             if (!opts->scheme.freeze) {
-                transform_mat(sys_sol_trans, opts->scheme.transf2, sys_sol,
-                              num_stages, nx, 1 + NF);
+                transform_stages(work, blasfeo, sys_sol_trans,
+                                 opts->scheme.transf2, sys_sol, num_stages, nx,
+                                 1 + NF);
             } else {
-                transform_mat(sys_sol_trans, opts->scheme.transf2, sys_sol,
-                              num_stages, nx, 1);
+                transform_stages(work, blasfeo, sys_sol_trans,
+                                 opts->scheme.transf2, sys_sol, num_stages, nx,
+                                 1);
             }
         }
 
@@ -1023,11 +1380,59 @@ int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem_,
     for (i = 0; i < nx; i++) out->xn[i] = out_tmp[i];
     for (i = 0; i < nx * NF; i++) out->S_forw[i] = out_tmp[nx + i];
 
+    // Forward-over-adjoint sweep: the multipliers mu of the stage equations of
+    // a step solve M'*mu = h*b kron lambda with its Newton matrix M, then
+    // every stage adds J'*mu to the adjoint and S'*(mu'*f)''*S to the Hessian,
+    // with the sensitivities S of the stage values.
+    if (hessian(in, opts)) {
+        int_t nhess = (NF + 1) * NF / 2;
+        real_t *hess_in = work->hess_in;
+        real_t *mu = work->adj_mu;
+        real_t *adj = work->adj_hess;
+        for (i = 0; i < nx + nu; i++) adj[i] = in->S_adj[i];
+        for (i = 0; i < nhess; i++) adj[nx + nu + i] = 0.0;
+        for (i = 0; i < nu; i++) hess_in[nx * (2 + nx + nu) + i] = in->u[i];
+
+        for (istep = in->num_steps - 1; istep > -1; istep--) {
+            for (s1 = 0; s1 < num_stages; s1++)
+                for (i = 0; i < nx; i++) mu[s1 * nx + i] = H_INT * b_vec[s1] * adj[i];
+            acados_tic(&timer_la);
+            solve_newton_matrix_trans(istep, in, opts, mem, work, blasfeo, mu);
+            timing_la += acados_toc(&timer_la);
+
+            for (s1 = 0; s1 < num_stages; s1++) {
+                for (i = 0; i < nx * (1 + NF); i++)
+                    hess_in[i] = mem->forw_traj[istep * nx * (1 + NF) + i];
+                for (s2 = 0; s2 < num_stages; s2++) {
+                    real_t a = H_INT * A_mat[s2 * num_stages + s1];
+                    for (i = 0; i < nx; i++)
+                        hess_in[i] += a * K_traj[(istep * num_stages + s2) * nx + i];
+                    for (i = 0; i < nx * NF; i++)
+                        hess_in[nx + i] += a * DK_traj[(istep * num_stages + s2) * nx * NF + i];
+                }
+                for (i = 0; i < nx; i++) hess_in[nx * (1 + NF) + i] = mu[s1 * nx + i];
+
+                acados_tic(&timer_ad);
+                in->adjoint_vde_wrapper(nx, nu, hess_in, work->hess_out, in->vde_adj);
+                timing_ad += acados_toc(&timer_ad);
+                for (i = 0; i < nx + nu + nhess; i++) adj[i] += work->hess_out[i];
+            }
+        }
+        for (i = 0; i < nx + nu; i++) out->S_adj[i] = adj[i];
+        for (i = 0; i < nhess; i++) out->S_hess[i] = adj[nx + nu + i];
+    }
+
     out->info->CPUtime = acados_toc(&timer);
     out->info->LAtime = timing_la;
     out->info->ADtime = timing_ad;
-
-    return 0;  // success
+    out->info->num_steps = in->num_steps;
+    out->info->num_rejected_steps = 0;
+    out->info->num_recomputed_steps = 0;
+    out->info->num_krylov_iter = num_krylov_iter;
+    out->info->num_newton_iter = 0;
+    out->info->num_factorizations = 0;
+
+    return status;
 }
 
 int_t sim_lifted_irk_calculate_workspace_size(const sim_in *in, void *args) {
@@ -1047,7 +1452,14 @@ int_t sim_lifted_irk_calculate_workspace_size(const sim_in *in, void *args) {
     int_t size = sizeof(sim_lifted_irk_workspace);
     size += (nx * (1 + NF) + nu + 1) * sizeof(real_t);  // rhs_in
     size += (nx * (1 + NF)) * sizeof(real_t);           // out_tmp
-    if (opts->scheme.type == exact) {
+    if (matrix_free(opts)) {
+        int_t krylov_dim = opts->krylov_dim;
+        size += (2 * num_stages * nx * nx) * sizeof(real_t);        // jac_stages, prec_mat
+        size += (dim_sys * (krylov_dim + 1)) * sizeof(real_t);      // krylov_V
+        size += ((krylov_dim + 1) * krylov_dim) * sizeof(real_t);   // krylov_H
+        size += (3 * dim_sys + nx + 3 * krylov_dim + 1) * sizeof(real_t);  // krylov_tmp
+        size += (dim_sys) * sizeof(int_t);                          // ipiv
+    } else if (opts->scheme.type == exact && !use_sparse(opts)) {
         size += (dim_sys) * sizeof(int_t);             // ipiv
         size += (dim_sys * dim_sys) * sizeof(real_t);  // sys_mat
     }
@@ -1055,6 +1467,10 @@ int_t sim_lifted_irk_calculate_workspace_size(const sim_in *in, void *args) {
     size += (num_stages) * sizeof(real_t *);                  // VDE_tmp
     size += (num_stages * nx * (1 + NF)) * sizeof(real_t);    // VDE_tmp[...]
     size += (nx * (nx + 1)) * sizeof(real_t);                 // jac_tmp
+    if (NF != nx + nu) {
+        size += (nx * (1 + nx + nu) + nu + 1) * sizeof(real_t);  // vde_in
+        size += (nx * (1 + nx + nu)) * sizeof(real_t);           // vde_out
+    }
 
     if (opts->scheme.type == simplified_in ||
         opts->scheme.type == simplified_inis) {
@@ -1068,24 +1484,29 @@ int_t sim_lifted_irk_calculate_workspace_size(const sim_in *in, void *args) {
         size += (nx) * sizeof(real_t);  // out_adj_tmp
     }
 
-#if !TRIPLE_LOOP
-    size += sizeof(struct d_strmat);  // str_mat
-    size += sizeof(struct d_strmat);  // str_sol
-
-    int size_strmat = 0;
-#if defined(LA_HIGH_PERFORMANCE)
-    // matrices in matrix struct format:
-    size_strmat += d_size_strmat(dim_sys, dim_sys);
-    size_strmat += d_size_strmat(dim_sys, 1 + NF);
-
-#elif defined(LA_REFERENCE)
-    // allocate new memory only for the diagonal
-    int size_strmat = 0;
-    size_strmat += d_size_diag_strmat(dim_sys, dim_sys);
+    if (hessian(in, opts)) {
+        int_t nhess = (NF + 1) * NF / 2;
+        size += (nx * (2 + nx + nu) + nu) * sizeof(real_t);  // hess_in
+        size += 2 * (nx + nu + nhess) * sizeof(real_t);       // hess_out, adj_hess
+        size += (num_stages * nx) * sizeof(real_t);           // adj_mu
+    }
 
-#endif  // LA_HIGH_PERFORMANCE
-    size += size_strmat;
-#endif  // !TRIPLE_LOOP
+    if (!use_blasfeo(in, opts)) {
+        size += ((num_stages * nx) * (1 + NF)) * sizeof(real_t);  // sys_perm
+    } else {
+        size += 2 * sizeof(struct d_strmat);  // str_mat, str_sol
+        size += sizeof(struct d_strvec);      // str_adj
+        size += d_size_strmat(dim_sys, dim_sys);
+        size += d_size_strmat(dim_sys, 1 + NF);
+        size += d_size_strvec(num_stages * nx);
+        if (opts->scheme.type == simplified_in ||
+            opts->scheme.type == simplified_inis) {
+            size += 3 * sizeof(struct d_strmat);  // str_trans, str_stages(_trans)
+            size += d_size_strmat(num_stages, num_stages);
+            size += 2 * d_size_strmat(nx, num_stages * (1 + NF));
+        }
+        size += 64;  // align once to typical cache line size
+    }
 
     return size;
 }
@@ -1109,6 +1530,11 @@ void sim_lifted_irk_create_memory(const sim_in *in, void *args,
     mem->mu_traj = calloc(num_steps*num_stages*nx, sizeof(*mem->mu_traj));
     mem->x = calloc(nx, sizeof(*mem->x));
     mem->u = calloc(nu, sizeof(*mem->u));
+    mem->delta_DK_traj = NULL;
+    mem->adj_traj = NULL;
+    mem->jac_traj = NULL;
+    mem->sys_mat2 = NULL;
+    mem->str_mat2 = NULL;
     if (opts->scheme.type == simplified_inis) {
         mem->delta_DK_traj =
             calloc(num_steps * num_stages * nx * NF, sizeof(*mem->delta_DK_traj));
@@ -1123,9 +1549,9 @@ void sim_lifted_irk_create_memory(const sim_in *in, void *args,
         for (i = 0; i < num_steps * num_stages * nx; i++) mem->adj_traj[i] = 0.0;
 
         mem->jac_traj = calloc(num_steps * num_stages, sizeof(*mem->jac_traj));
-        for (int_t i = 0; i < num_steps * num_stages; i++) {
-            mem->jac_traj[i] = calloc(nx * nx, sizeof(*mem->jac_traj[i]));
-        }
+        mem->jac_traj[0] = calloc(num_steps * num_stages * nx * nx, sizeof(*mem->jac_traj[0]));
+        for (int_t i = 1; i < num_steps * num_stages; i++)
+            mem->jac_traj[i] = mem->jac_traj[0] + i * nx * nx;
     }
 
     for (i = 0; i < num_steps * num_stages * nx; i++) mem->K_traj[i] = 0.0;
@@ -1164,14 +1590,81 @@ void sim_lifted_irk_create_memory(const sim_in *in, void *args,
     } else {
         num_sys = 1;
     }
+    mem->num_sys = num_sys;
+
+    mem->sparse_val = NULL;
+    if (use_sparse(opts)) {
+        // structural nonzeros of the Jacobian, the first nx columns
+        const int_t *sp = opts->jac_sparsity;
+        bool dense = sp[2];
+        const int_t *colind = sp + 2, *row = sp + sp[1] + 3;
+        mem->nnz_jac = dense ? nx * nx : colind[nx];
+        mem->jac_idx = calloc(mem->nnz_jac, sizeof(*mem->jac_idx));
+        int_t *mat_row = calloc(num_stages * (nx + num_stages * mem->nnz_jac), sizeof(*mat_row));
+        int_t *mat_col = calloc(num_stages * (nx + num_stages * mem->nnz_jac), sizeof(*mat_col));
+        for (int_t j = 0, e = 0; j < nx; j++) {
+            int_t num_rows = dense ? nx : colind[j + 1] - colind[j];
+            for (int_t k = 0; k < num_rows; k++, e++)
+                mem->jac_idx[e] = j * nx + (dense ? k : row[colind[j] + k]);
+        }
 
-#if !TRIPLE_LOOP
-    if (opts->scheme.type == simplified_in ||
-        opts->scheme.type == simplified_inis) {
+        // the identity and I - h*A kron J, block (s1, s2) for every pair of stages
+        int_t nnz = 0;
+        for (i = 0; i < num_stages * nx; i++, nnz++) mat_row[nnz] = mat_col[nnz] = i;
+        for (int_t s2 = 0; s2 < num_stages; s2++) {
+            for (int_t s1 = 0; s1 < num_stages; s1++) {
+                for (int_t e = 0; e < mem->nnz_jac; e++, nnz++) {
+                    mat_row[nnz] = s1 * nx + mem->jac_idx[e] % nx;
+                    mat_col[nnz] = s2 * nx + mem->jac_idx[e] / nx;
+                }
+            }
+        }
+        sparse_lu_symbolic(num_stages * nx, nnz, mat_row, mat_col, &mem->sparse_lu);
+        mem->sparse_val = calloc(mem->sparse_lu.nnz, sizeof(*mem->sparse_val));
+        mem->sparse_pos = calloc(num_stages * num_stages * mem->nnz_jac, sizeof(*mem->sparse_pos));
+        for (i = 0; i < num_stages * num_stages * mem->nnz_jac; i++)
+            mem->sparse_pos[i] =
+                sparse_lu_position(&mem->sparse_lu, mat_row[num_stages * nx + i],
+                                   mat_col[num_stages * nx + i]);
+        free(mat_row);
+        free(mat_col);
+    }
+
+    mem->sys_mat_traj = NULL;
+    mem->ipiv_traj = NULL;
+    mem->forw_traj = NULL;
+    if (hessian(in, opts) && !opts->matrix_free) {
+        int_t dim_sys = num_stages * nx;
+        mem->forw_traj = calloc(num_steps * nx * (1 + NF), sizeof(*mem->forw_traj));
+        if (use_sparse(opts)) {
+            mem->sys_mat_traj =
+                calloc(num_steps * mem->sparse_lu.nnz, sizeof(*mem->sys_mat_traj));
+        } else {
+            mem->sys_mat_traj = calloc(num_steps * dim_sys * dim_sys, sizeof(*mem->sys_mat_traj));
+            mem->ipiv_traj = calloc(num_steps * dim_sys, sizeof(*mem->ipiv_traj));
+        }
+    }
+
+    mem->pool = NULL;
+    if (opts->num_threads > 1 && num_sys > 1)
+        mem->pool = acados_thread_pool_create(opts->num_threads);
+
+    if (use_blasfeo(in, opts) && (opts->scheme.type == simplified_in ||
+                                  opts->scheme.type == simplified_inis)) {
         mem->str_mat2 = calloc(num_sys, sizeof(*mem->str_mat2));
         mem->str_sol2 = calloc(num_sys, sizeof(*mem->str_sol2));
         int_t dim_sys;
 
+        // one aligned block for the matrices of all subsystems
+        int size_strmat = 0;
+        for (int_t i = 0; i < num_sys; i++) {
+            dim_sys = ((i + 1) == num_sys && num_sys != floor(num_stages / 2.0)) ? nx : 2 * nx;
+            size_strmat += d_size_strmat(dim_sys, dim_sys);
+            size_strmat += d_size_strmat(dim_sys, 1 + NF);
+        }
+        v_zeros_align(&mem->str_memory, size_strmat);
+        char *ptr_memory_strmat = (char *)mem->str_memory;
+
         for (int_t i = 0; i < num_sys; i++) {
             if ((i + 1) == num_sys &&
                 num_sys != floor(num_stages / 2.0)) {  // odd number of stages
@@ -1180,60 +1673,93 @@ void sim_lifted_irk_create_memory(const sim_in *in, void *args,
                 dim_sys = 2 * nx;
             }
 
-#if defined(LA_HIGH_PERFORMANCE)
             // matrices in matrix struct format:
-            int size_strmat = 0;
-            size_strmat += d_size_strmat(dim_sys, dim_sys);
-            size_strmat += d_size_strmat(dim_sys, 1 + NF);
-
-            // accocate memory
-            void *memory_strmat;
-            v_zeros_align(&memory_strmat, size_strmat);
-            char *ptr_memory_strmat = (char *)memory_strmat;
-
+            mem->str_mat2[i] = calloc(1, sizeof(*mem->str_mat2[i]));
+            mem->str_sol2[i] = calloc(1, sizeof(*mem->str_sol2[i]));
             d_create_strmat(dim_sys, dim_sys, mem->str_mat2[i],
                             ptr_memory_strmat);
             ptr_memory_strmat += mem->str_mat2[i]->memory_size;
             d_create_strmat(dim_sys, 1 + NF, mem->str_sol2[i],
                             ptr_memory_strmat);
             ptr_memory_strmat += mem->str_sol2[i]->memory_size;
+        }
+    }
+}
 
-#elif defined(LA_REFERENCE)
-
-            //  pointer to column-major matrix
-            d_create_strmat(dim_sys, dim_sys, mem->str_mat2[i],
-                            mem->sys_mat2[i]);
-            d_create_strmat(dim_sys, 1 + NF, mem->str_sol2[i],
-                            mem->sys_sol2[i]);
-
-            // allocate new memory only for the diagonal
-            int size_strmat = 0;
-            size_strmat += d_size_diag_strmat(dim_sys, dim_sys);
-
-            void *memory_strmat = malloc(size_strmat);
-            //    void *memory_strmat;
-            //    v_zeros_align(&memory_strmat, size_strmat);
-            char *ptr_memory_strmat = (char *)memory_strmat;
-
-            d_cast_diag_mat2strmat((double *)ptr_memory_strmat,
-                                   mem->str_mat2[i]);
-//    ptr_memory_strmat += d_size_diag_strmat(dim_sys, dim_sys);
-
-#else  // LA_BLAS
-
-            // not allocate new memory: point to column-major matrix
-            d_create_strmat(dim_sys, dim_sys, mem->str_mat2[i],
-                            mem->sys_mat2[i]);
-            d_create_strmat(dim_sys, 1 + NF, mem->str_sol2[i],
-                            mem->sys_sol2[i]);
+void sim_lifted_irk_shift_memory(const sim_in *in, void *args, void *mem_,
+                                 const void *next_mem_) {
+    int_t nx = in->nx;
+    int_t nu = in->nu;
+    int_t num_steps = in->num_steps;
+    sim_RK_opts *opts = (sim_RK_opts *)args;
+    int_t num_stages = opts->num_stages;
+    int_t NF = in->num_forw_sens;
+    sim_lifted_irk_memory *mem = (sim_lifted_irk_memory *)mem_;
+    const sim_lifted_irk_memory *next_mem = (const sim_lifted_irk_memory *)next_mem_;
+
+    memcpy(mem->K_traj, next_mem->K_traj, num_steps * num_stages * nx * sizeof(real_t));
+    memcpy(mem->DK_traj, next_mem->DK_traj, num_steps * num_stages * nx * NF * sizeof(real_t));
+    memcpy(mem->mu_traj, next_mem->mu_traj, num_steps * num_stages * nx * sizeof(real_t));
+    memcpy(mem->x, next_mem->x, nx * sizeof(real_t));
+    memcpy(mem->u, next_mem->u, nu * sizeof(real_t));
+    if (opts->scheme.type == simplified_inis)
+        memcpy(mem->delta_DK_traj, next_mem->delta_DK_traj,
+               num_steps * num_stages * nx * NF * sizeof(real_t));
+    if (opts->scheme.type == simplified_in ||
+        opts->scheme.type == simplified_inis) {
+        memcpy(mem->adj_traj, next_mem->adj_traj, num_steps * num_stages * nx * sizeof(real_t));
+        for (int_t i = 0; i < num_steps * num_stages; i++)
+            memcpy(mem->jac_traj[i], next_mem->jac_traj[i], nx * nx * sizeof(real_t));
+    }
+}
 
-#endif  // LA_HIGH_PERFORMANCE
+void sim_lifted_irk_free_memory_members(sim_lifted_irk_memory *mem) {
+    free(mem->K_traj);
+    free(mem->DK_traj);
+    free(mem->delta_DK_traj);
+    free(mem->mu_traj);
+    free(mem->adj_traj);
+    free(mem->x);
+    free(mem->u);
+    if (mem->jac_traj != NULL) {
+        free(mem->jac_traj[0]);
+        free(mem->jac_traj);
+    }
+    if (mem->sys_mat2 != NULL) {
+        for (int_t i = 0; i < mem->num_sys; i++) {
+            free(mem->sys_mat2[i]);
+            free(mem->ipiv2[i]);
+            free(mem->sys_sol2[i]);
         }
+        free(mem->sys_mat2);
+        free(mem->ipiv2);
+        free(mem->sys_sol2);
     }
-#endif  // !TRIPLE_LOOP
+    if (mem->str_mat2 != NULL) {
+        for (int_t i = 0; i < mem->num_sys; i++) {
+            free(mem->str_mat2[i]);
+            free(mem->str_sol2[i]);
+        }
+        free(mem->str_mat2);
+        free(mem->str_sol2);
+        v_free_align(mem->str_memory);
+    }
+    if (mem->pool != NULL) acados_thread_pool_destroy(mem->pool);
+    if (mem->sparse_val != NULL) {
+        sparse_lu_free(&mem->sparse_lu);
+        free(mem->sparse_val);
+        free(mem->jac_idx);
+        free(mem->sparse_pos);
+    }
+    free(mem->sys_mat_traj);
+    free(mem->ipiv_traj);
+    free(mem->forw_traj);
 }
 
-void sim_lifted_irk_free_memory(void *mem_) { free(mem_); }
+void sim_lifted_irk_free_memory(void *mem_) {
+    sim_lifted_irk_free_memory_members((sim_lifted_irk_memory *)mem_);
+    free(mem_);
+}
 
 void sim_irk_create_arguments(void *args, const int_t num_stages,
                               const char *name) {
@@ -1242,17 +1768,41 @@ void sim_irk_create_arguments(void *args, const int_t num_stages,
     opts->A_mat = calloc(num_stages * num_stages, sizeof(*opts->A_mat));
     opts->b_vec = calloc(num_stages, sizeof(*opts->b_vec));
     opts->c_vec = calloc(num_stages, sizeof(*opts->c_vec));
+    opts->b_hat = NULL;
+    opts->la_blasfeo = -1;
+    opts->num_threads = 1;
+    opts->newton_iter = 3;
+    opts->newton_tol = 0.0;
+    opts->newton_reuse = false;
+    opts->matrix_free = false;
+    opts->krylov_dim = 20;
+    opts->krylov_max_iter = 100;
+    opts->krylov_tol = 1e-12;
+    opts->jac_sparsity = NULL;
     opts->scheme.type = exact;
 
     if (strcmp(name, "Gauss") == 0) {  // GAUSS METHODS
-        get_Gauss_nodes(opts->num_stages, opts->c_vec);
-        create_Butcher_table(opts->num_stages, opts->c_vec, opts->b_vec,
-                             opts->A_mat);
-    } else if (strcmp(name, "Radau") == 0) {
-        // TODO(rien): add Radau IIA collocation schemes
-        //        get_Radau_nodes(opts->num_stages, opts->c_vec);
-        create_Butcher_table(opts->num_stages, opts->c_vec, opts->b_vec,
-                             opts->A_mat);
+        const collocation_table *table = get_Gauss_table(num_stages);
+        if (table != NULL) {
+            memcpy(opts->c_vec, table->c, num_stages * sizeof(*opts->c_vec));
+            memcpy(opts->b_vec, table->b, num_stages * sizeof(*opts->b_vec));
+            memcpy(opts->A_mat, table->A,
+                   num_stages * num_stages * sizeof(*opts->A_mat));
+        } else {
+            get_Gauss_nodes(opts->num_stages, opts->c_vec);
+            create_Butcher_table(opts->num_stages, opts->c_vec, opts->b_vec,
+                                 opts->A_mat);
+        }
+    } else if (strcmp(name, "Radau") == 0) {  // RADAU IIA METHODS
+        const collocation_table *table = get_Radau_table(num_stages);
+        if (table != NULL) {
+            memcpy(opts->c_vec, table->c, num_stages * sizeof(*opts->c_vec));
+            memcpy(opts->b_vec, table->b, num_stages * sizeof(*opts->b_vec));
+            memcpy(opts->A_mat, table->A,
+                   num_stages * num_stages * sizeof(*opts->A_mat));
+        } else {
+            // throw error somehow?
+        }
     } else {
         // throw error somehow?
     }
@@ -1267,26 +1817,32 @@ void sim_irk_create_Newton_scheme(void *args, int_t num_stages, const char* name
     sim_RK_opts *opts = (sim_RK_opts*) args;
     opts->scheme.type = type;
     opts->scheme.freeze = false;
+    int_t max_stages = 0;
     if (strcmp(name, "Gauss") == 0) {  // GAUSS METHODS
-        if (num_stages <= 15 &&
-            (type == simplified_in || type == simplified_inis)) {
-            opts->scheme.eig = calloc(num_stages, sizeof(*opts->scheme.eig));
-            opts->scheme.transf1 =
-                calloc(num_stages * num_stages, sizeof(*opts->scheme.transf1));
-            opts->scheme.transf2 =
-                calloc(num_stages * num_stages, sizeof(*opts->scheme.transf2));
-            opts->scheme.transf1_T = calloc(num_stages * num_stages,
-                                            sizeof(*opts->scheme.transf1_T));
-            opts->scheme.transf2_T = calloc(num_stages * num_stages,
-                                            sizeof(*opts->scheme.transf2_T));
-            read_Gauss_simplified(opts->num_stages, &opts->scheme);
-        } else if (num_stages == 1) {
-            opts->scheme.type = exact;
-        } else {
-            // throw error somehow?
-        }
-    } else if (strcmp(name, "Radau") == 0) {
-        // TODO(rien): add Radau IIA collocation schemes
+        max_stages = GAUSS_MAX_STAGES;
+    } else if (strcmp(name, "Radau") == 0) {  // RADAU IIA METHODS
+        max_stages = RADAU_MAX_STAGES;
+    } else {
+        // throw error somehow?
+        return;
+    }
+    if (num_stages > 1 && num_stages <= max_stages &&
+        (type == simplified_in || type == simplified_inis)) {
+        opts->scheme.eig = calloc(num_stages, sizeof(*opts->scheme.eig));
+        opts->scheme.transf1 =
+            calloc(num_stages * num_stages, sizeof(*opts->scheme.transf1));
+        opts->scheme.transf2 =
+            calloc(num_stages * num_stages, sizeof(*opts->scheme.transf2));
+        opts->scheme.transf1_T = calloc(num_stages * num_stages,
+                                        sizeof(*opts->scheme.transf1_T));
+        opts->scheme.transf2_T = calloc(num_stages * num_stages,
+                                        sizeof(*opts->scheme.transf2_T));
+        if (strcmp(name, "Gauss") == 0)
+            get_Gauss_simplified(opts->num_stages, &opts->scheme);
+        else
+            get_Radau_simplified(opts->num_stages, &opts->scheme);
+    } else if (num_stages == 1) {
+        opts->scheme.type = exact;
     } else {
         // throw error somehow?
     }
@@ -26,27 +26,56 @@ extern "C" {
 
 #include "acados/sim/sim_collocation.h"
 #include "acados/sim/sim_rk_common.h"
+#include "acados/utils/sparse_lu.h"
+#include "acados/utils/threads.h"
 #include "acados/utils/types.h"
 
-#define TRIPLE_LOOP 1
 #define CODE_GENERATION 0
 
+// Default number of states from which the linear systems are solved with
+// BLASFEO instead of the triple loops, see la_blasfeo in sim_RK_opts. The
+// crossover depends on the BLASFEO target, examples/c/lifted_irk_blasfeo_benchmark
+// prints the value for a machine, which can be set at compile time.
+#ifndef LIFTED_IRK_BLASFEO_NX
+#define LIFTED_IRK_BLASFEO_NX 12
+#endif
+
 typedef struct {
     real_t *rhs_in;
     real_t *jac_tmp;
     real_t **VDE_tmp;
+    real_t *vde_in;  // seeds padded to nx+nu directions, NF < nx+nu only
+    real_t *vde_out;
     real_t *out_tmp;
     int_t *ipiv;
 
     real_t *sys_mat;
     real_t *sys_sol;
     real_t *sys_sol_trans;
+    real_t *sys_perm;  // permuted right hand sides, rows of all subsystems
 
     real_t *trans;
     struct d_strmat *str_mat;
     struct d_strmat *str_sol;
+    struct d_strvec *str_adj;  // right hand side of the transposed solves
+    struct d_strmat *str_trans;  // stage transformation
+    struct d_strmat *str_stages;  // nx x num_stages*(1+NF), one block per column
+    struct d_strmat *str_stages_trans;
 
     real_t *out_adj_tmp;
+
+    // matrix-free linear systems, see sim_RK_opts.matrix_free
+    real_t *jac_stages;  // Jacobians of the stages of the current step
+    real_t *prec_mat;    // factorized diagonal blocks of the first step
+    real_t *krylov_V;
+    real_t *krylov_H;
+    real_t *krylov_tmp;
+
+    // adjoint sweep of the second order sensitivities
+    real_t *hess_in;   // stage values, sensitivities and multipliers for vde_adj
+    real_t *hess_out;
+    real_t *adj_mu;    // multipliers of the stage equations of one step
+    real_t *adj_hess;  // adjoint of the states and controls, Hessian
 } sim_lifted_irk_workspace;
 
 typedef struct {
@@ -55,10 +84,12 @@ typedef struct {
     real_t *delta_DK_traj;
     real_t *mu_traj;
 
+    int_t num_sys;  // decoupled subsystems of the simplified Newton schemes
     real_t **sys_mat2;
     real_t **sys_sol2;
     struct d_strmat **str_mat2;
     struct d_strmat **str_sol2;
+    void *str_memory;  // of str_mat2 and str_sol2
     int_t **ipiv2;
     real_t *adj_traj;
 
@@ -66,8 +97,42 @@ typedef struct {
 
     real_t *x;
     real_t *u;
+
+    // solves the decoupled subsystems of the simplified Newton schemes in
+    // parallel, NULL for a single thread
+    acados_thread_pool *pool;
+
+    // sparse Newton matrix of the exact scheme, see sim_RK_opts.jac_sparsity
+    sparse_lu_pattern sparse_lu;
+    real_t *sparse_val;  // NULL without a pattern
+    int_t nnz_jac;
+    int_t *jac_idx;     // dense index of the structural nonzeros of the Jacobian
+    int_t *sparse_pos;  // their positions in sparse_val, for all pairs of stages
+
+    // factorized Newton matrices (sparse_val with a pattern) and the states
+    // and sensitivities at the start of every step, kept for the adjoint
+    // sweep of the second order sensitivities, NULL without them
+    real_t *sys_mat_traj;
+    int_t *ipiv_traj;
+    real_t *forw_traj;
 } sim_lifted_irk_memory;
 
+// Forward sensitivities in NF = in->num_forw_sens directions, nu <= NF <= nx+nu.
+// in->S_forw are the nx*NF seeds of the states, the controls are seeded with
+// the identity in the last nu directions. S_forw = [I 0] with NF = nx+nu gives
+// the full sensitivities, S_forw = 0 with NF = nu those with respect to u.
+// With sens_adj and sens_hess the exact Newton scheme also returns S_adj and
+// the lower triangle of the symmetric S_hess as sim_erk, from the adjoint VDE
+// in->vde_adj with Hessian (see vde_hess_fun). The adjoint sweep solves with
+// the transposed Newton matrices that the forward sweep has factorized, this
+// needs NF = nx+nu and is not supported by the matrix-free mode, -1 otherwise.
+// The sweep runs at the stage variables after this call's Newton update but
+// with the matrices factorized before it, so S_adj and S_hess are exact only
+// once the lifted Newton iterations have converged, like the lifted S_forw.
+// In the matrix-free mode ACADOS_MAXITER is returned if GMRES has not reached
+// krylov_tol within krylov_max_iter iterations for some linear system. The
+// sparse LU does not pivot, a zero or small pivot (see SPARSE_LU_PIVOT_TOL) of
+// the Newton matrix returns -1.
 int_t sim_lifted_irk(const sim_in *in, sim_out *out, void *args, void *mem,
                      void *work);
 
@@ -75,7 +140,17 @@ int_t sim_lifted_irk_calculate_workspace_size(const sim_in *in, void *args);
 
 void sim_lifted_irk_create_memory(const sim_in *in, void *args,
                                   sim_lifted_irk_memory *mem);
+// Frees the arrays of a memory of sim_lifted_irk_create_memory, and the
+// memory itself, which must then come from malloc.
 void sim_lifted_irk_free_memory(void *mem_);
+// Frees only the arrays, e.g. for a memory on the stack
+void sim_lifted_irk_free_memory_members(sim_lifted_irk_memory *mem);
+
+// Warm start after a shift of the horizon: mem takes over the lifted stage
+// variables of next_mem, the memory of the next shooting interval, which has
+// the same dimensions. The linear systems are not copied.
+void sim_lifted_irk_shift_memory(const sim_in *in, void *args, void *mem_,
+                                 const void *next_mem_);
 
 void sim_irk_create_arguments(void *args, const int_t num_stages, const char* name);
 
@@ -83,6 +158,15 @@ void sim_lifted_irk_initialize(const sim_in *in, void *args_, void *mem_,
                                void **work);
 void sim_lifted_irk_destroy(void *mem, void *work);
 
+// LU factorization with partial pivoting of the column-major dim x dim matrix A
+// in place, and the solutions with A and its transpose of dim2 right hand sides
+// b, bPerm is a scratch array of dim*dim2 elements
+real_t LU_system_ACADO(real_t *const A, int *const perm, int dim);
+real_t solve_system_ACADO(real_t *const A, real_t *const b, int *const perm,
+                          real_t *const bPerm, int dim, int dim2);
+real_t solve_system_trans_ACADO(real_t *const A, real_t *const b, int *const perm,
+                                real_t *const bPerm, int dim, int dim2);
+
 void sim_irk_control_collocation(void *args, int_t num_stages,
                                  const char *name);
 
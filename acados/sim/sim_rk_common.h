@@ -34,6 +34,59 @@ typedef struct {
     real_t *c_vec;
     real_t *b_vec;
 
+    // Step size control with an embedded pair, only used by sim_erk. b_hat are
+    // the weights of the embedded method, NULL for fixed steps.
+    real_t *b_hat;
+    int_t embedded_order;  // order of the embedded method
+    real_t abs_tol;
+    real_t rel_tol;
+    int_t max_num_steps;  // maximum number of accepted steps
+
+    // Memory budget in bytes for the trajectories that sim_erk stores for the
+    // adjoint sweep, 0 for no limit. If the whole trajectory does not fit,
+    // only the state at the start of every segment of k steps is stored and
+    // the stages of a segment are recomputed when the adjoint sweep reaches
+    // it, with the largest k that fits the budget.
+    int_t adj_traj_budget;
+
+    // Linear algebra of the Newton iterations, only used by sim_lifted_irk: 1
+    // for BLASFEO, 0 for the triple loops and -1 to use BLASFEO from
+    // LIFTED_IRK_BLASFEO_NX states on.
+    int_t la_blasfeo;
+    // Number of threads for the decoupled linear subsystems of the simplified
+    // Newton schemes, only used by sim_lifted_irk.
+    int_t num_threads;
+
+    // Newton iterations per integration step, only used by sim_implicit_irk.
+    // With newton_tol > 0 newton_iter is the maximum number of iterations and
+    // a step stops as soon as the largest residual of the stage equations is
+    // below newton_tol. With newton_reuse the factorized Newton matrix is then
+    // kept over iterations and steps as long as the residuals contract fast
+    // enough, see IMPLICIT_IRK_CONTRACTION.
+    int_t newton_iter;
+    real_t newton_tol;
+    bool newton_reuse;
+
+    // Matrix-free linear systems of the exact Newton scheme of sim_lifted_irk:
+    // restarted GMRES on the products with the stage Jacobians, preconditioned
+    // by the diagonal blocks of the first step, which are factorized once per
+    // call. The iterations stop at a residual of krylov_tol relative to the
+    // right hand side, the sensitivities start from those of the last call.
+    bool matrix_free;
+    int_t krylov_dim;  // restart length
+    int_t krylov_max_iter;  // per right hand side
+    real_t krylov_tol;
+
+    // CasADi sparsity pattern of the Jacobian of the ODE, nx x nx or nx x nx+nu
+    // of which the first nx columns are used, NULL if it is dense. With a
+    // pattern the exact Newton scheme of sim_lifted_irk factorizes its matrix
+    // with a sparse LU, of which the ordering and the symbolic factorization
+    // are computed by sim_lifted_irk_create_memory. The sparse LU does not
+    // pivot: sim_lifted_irk returns -1 when a pivot is small relative to its
+    // column (SPARSE_LU_PIVOT_TOL), so only use a pattern for Newton matrices
+    // with a dominant diagonal, i.e. small enough steps.
+    const int_t *jac_sparsity;
+
     Newton_scheme scheme;
 } sim_RK_opts;
 
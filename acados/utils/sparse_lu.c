@@ -0,0 +1,191 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "acados/utils/sparse_lu.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+void sparse_lu_symbolic(int_t n, int_t nnz, const int_t *row, const int_t *col,
+                        sparse_lu_pattern *lu) {
+    // adjacency of the symmetrized pattern, the eliminated graph keeps the fill
+    char *adj = calloc(n * n, sizeof(*adj));
+    char *eliminated = calloc(n, sizeof(*eliminated));
+    int_t *deg = calloc(n, sizeof(*deg));
+    int_t *nbr = calloc(n, sizeof(*nbr));
+
+    for (int_t k = 0; k < nnz; k++) {
+        int_t i = row[k], j = col[k];
+        if (i == j || adj[j * n + i]) continue;
+        adj[j * n + i] = adj[i * n + j] = 1;
+        deg[i]++;
+        deg[j]++;
+    }
+
+    lu->n = n;
+    lu->perm = calloc(n, sizeof(*lu->perm));
+    lu->iperm = calloc(n, sizeof(*lu->iperm));
+    for (int_t k = 0; k < n; k++) {
+        int_t v = -1;
+        for (int_t i = 0; i < n; i++)
+            if (!eliminated[i] && (v < 0 || deg[i] < deg[v])) v = i;
+        lu->perm[k] = v;
+        lu->iperm[v] = k;
+        eliminated[v] = 1;
+
+        // the remaining neighbours of v become a clique
+        int_t num_nbr = 0;
+        for (int_t i = 0; i < n; i++) {
+            if (!eliminated[i] && adj[v * n + i]) {
+                nbr[num_nbr++] = i;
+                deg[i]--;
+            }
+        }
+        for (int_t a = 0; a < num_nbr; a++) {
+            for (int_t b = a + 1; b < num_nbr; b++) {
+                int_t i = nbr[a], j = nbr[b];
+                if (adj[j * n + i]) continue;
+                adj[j * n + i] = adj[i * n + j] = 1;
+                deg[i]++;
+                deg[j]++;
+            }
+        }
+    }
+
+    // pattern of L+U in the elimination order
+    lu->col_ptr = calloc(n + 1, sizeof(*lu->col_ptr));
+    lu->diag = calloc(n, sizeof(*lu->diag));
+    lu->nnz = 0;
+    for (int_t j = 0; j < n; j++)
+        for (int_t i = 0; i < n; i++)
+            if (i == j || adj[lu->perm[j] * n + lu->perm[i]]) lu->nnz++;
+    lu->row_ind = calloc(lu->nnz, sizeof(*lu->row_ind));
+    int_t pos = 0;
+    for (int_t j = 0; j < n; j++) {
+        lu->col_ptr[j] = pos;
+        for (int_t i = 0; i < n; i++) {
+            if (i == j) lu->diag[j] = pos;
+            if (i == j || adj[lu->perm[j] * n + lu->perm[i]]) lu->row_ind[pos++] = i;
+        }
+    }
+    lu->col_ptr[n] = pos;
+
+    free(adj);
+    free(eliminated);
+    free(deg);
+    free(nbr);
+}
+
+void sparse_lu_free(sparse_lu_pattern *lu) {
+    free(lu->perm);
+    free(lu->iperm);
+    free(lu->col_ptr);
+    free(lu->row_ind);
+    free(lu->diag);
+}
+
+int_t sparse_lu_position(const sparse_lu_pattern *lu, int_t i, int_t j) {
+    int_t row = lu->iperm[i];
+    int_t lo = lu->col_ptr[lu->iperm[j]], hi = lu->col_ptr[lu->iperm[j] + 1];
+    while (lo < hi) {  // binary search in the sorted rows
+        int_t mid = (lo + hi) / 2;
+        if (lu->row_ind[mid] < row)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo < lu->col_ptr[lu->iperm[j] + 1] && lu->row_ind[lo] == row) ? lo : -1;
+}
+
+// Left-looking factorization: column j is scattered into w, updated with the
+// finished columns k < j of L in its pattern and gathered back. The pattern is
+// closed under fill-in, so all updates stay in the pattern of column j.
+int_t sparse_lu_factorize(const sparse_lu_pattern *lu, real_t *val, real_t *w) {
+    const int_t *col_ptr = lu->col_ptr;
+    const int_t *row_ind = lu->row_ind;
+    for (int_t i = 0; i < lu->n; i++) w[i] = 0.0;
+
+    for (int_t j = 0; j < lu->n; j++) {
+        real_t col_norm = 0.0;
+        for (int_t p = col_ptr[j]; p < col_ptr[j + 1]; p++) {
+            w[row_ind[p]] = val[p];
+            col_norm = fmax(col_norm, fabs(val[p]));
+        }
+        for (int_t p = col_ptr[j]; p < lu->diag[j]; p++) {
+            int_t k = row_ind[p];
+            real_t u_kj = w[k];
+            if (u_kj == 0.0) continue;
+            for (int_t q = lu->diag[k] + 1; q < col_ptr[k + 1]; q++)
+                w[row_ind[q]] -= val[q] * u_kj;
+        }
+        real_t pivot = w[j];
+        for (int_t p = col_ptr[j]; p < col_ptr[j + 1]; p++)
+            col_norm = fmax(col_norm, fabs(w[row_ind[p]]));
+        if (pivot == 0.0 || fabs(pivot) < SPARSE_LU_PIVOT_TOL * col_norm) return -1;
+        for (int_t p = col_ptr[j]; p < col_ptr[j + 1]; p++) {
+            int_t i = row_ind[p];
+            val[p] = (i > j) ? w[i] / pivot : w[i];
+            w[i] = 0.0;
+        }
+    }
+    return 0;
+}
+
+void sparse_lu_solve(const sparse_lu_pattern *lu, const real_t *val, real_t *b,
+                     int_t nrhs, real_t *w) {
+    int_t n = lu->n;
+    const int_t *col_ptr = lu->col_ptr;
+    const int_t *row_ind = lu->row_ind;
+    for (int_t r = 0; r < nrhs; r++) {
+        real_t *x = &b[r * n];
+        for (int_t k = 0; k < n; k++) w[k] = x[lu->perm[k]];
+        for (int_t k = 0; k < n; k++) {  // L has a unit diagonal
+            if (w[k] == 0.0) continue;
+            for (int_t q = lu->diag[k] + 1; q < col_ptr[k + 1]; q++)
+                w[row_ind[q]] -= val[q] * w[k];
+        }
+        for (int_t k = n - 1; k >= 0; k--) {
+            w[k] /= val[lu->diag[k]];
+            if (w[k] == 0.0) continue;
+            for (int_t q = col_ptr[k]; q < lu->diag[k]; q++)
+                w[row_ind[q]] -= val[q] * w[k];
+        }
+        for (int_t k = 0; k < n; k++) x[lu->perm[k]] = w[k];
+    }
+}
+
+void sparse_lu_solve_trans(const sparse_lu_pattern *lu, const real_t *val, real_t *b,
+                           int_t nrhs, real_t *w) {
+    int_t n = lu->n;
+    const int_t *col_ptr = lu->col_ptr;
+    const int_t *row_ind = lu->row_ind;
+    for (int_t r = 0; r < nrhs; r++) {
+        real_t *x = &b[r * n];
+        for (int_t k = 0; k < n; k++) w[k] = x[lu->perm[k]];
+        for (int_t k = 0; k < n; k++) {  // U' with the columns of U
+            for (int_t q = col_ptr[k]; q < lu->diag[k]; q++) w[k] -= val[q] * w[row_ind[q]];
+            w[k] /= val[lu->diag[k]];
+        }
+        for (int_t k = n - 1; k >= 0; k--) {  // L', unit diagonal
+            for (int_t q = lu->diag[k] + 1; q < col_ptr[k + 1]; q++)
+                w[k] -= val[q] * w[row_ind[q]];
+        }
+        for (int_t k = 0; k < n; k++) x[lu->perm[k]] = w[k];
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef ACADOS_UTILS_SPARSE_LU_H_
+#define ACADOS_UTILS_SPARSE_LU_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "acados/utils/types.h"
+
+// Smallest magnitude of a pivot relative to the largest entry of its column,
+// before or after the updates, sparse_lu_factorize fails below
+#ifndef SPARSE_LU_PIVOT_TOL
+#define SPARSE_LU_PIVOT_TOL 1e-10
+#endif
+
+// Symbolic LU factorization of a sparse n x n matrix: a minimum degree
+// ordering of the symmetrized pattern and the pattern of L+U with fill-in,
+// column by column (CSC) in the permuted order with the rows sorted. The
+// numeric factorization does not pivot, it is meant for matrices with a
+// dominant diagonal like the Newton matrices of implicit integrators.
+typedef struct {
+    int_t n;
+    int_t nnz;       // of L+U, the length of the value arrays
+    int_t *perm;     // perm[k] is the row and column of pivot k
+    int_t *iperm;
+    int_t *col_ptr;  // n+1
+    int_t *row_ind;  // nnz, in the permuted order
+    int_t *diag;     // position of the pivot in each column
+} sparse_lu_pattern;
+
+// Computes the pattern of the matrix with the nnz entries (row[i], col[i]),
+// duplicates are allowed. Allocates, to be called once at initialization.
+void sparse_lu_symbolic(int_t n, int_t nnz, const int_t *row, const int_t *col,
+                        sparse_lu_pattern *lu);
+void sparse_lu_free(sparse_lu_pattern *lu);
+
+// Position of the entry (i, j) of the original matrix in the value array, -1
+// if it is not in the pattern
+int_t sparse_lu_position(const sparse_lu_pattern *lu, int_t i, int_t j);
+
+// Numeric factorization in place, val holds the entries at the positions of
+// sparse_lu_position and zeros elsewhere. w is a scratch array of n elements.
+// Returns -1 for a zero pivot or one below SPARSE_LU_PIVOT_TOL relative to its
+// column, 0 otherwise. The pivots are not exchanged, so matrices that need
+// row pivoting cannot be factorized.
+int_t sparse_lu_factorize(const sparse_lu_pattern *lu, real_t *val, real_t *w);
+
+// Solves for the nrhs columns of b (n x nrhs, column-major) in place
+void sparse_lu_solve(const sparse_lu_pattern *lu, const real_t *val, real_t *b,
+                     int_t nrhs, real_t *w);
+// The same with the transposed matrix
+void sparse_lu_solve_trans(const sparse_lu_pattern *lu, const real_t *val, real_t *b,
+                           int_t nrhs, real_t *w);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // ACADOS_UTILS_SPARSE_LU_H_
@@ -0,0 +1,255 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE  // pthread_setaffinity_np
+#endif
+
+#include "acados/utils/threads.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#ifdef ACADOS_WITH_THREADS
+#include <pthread.h>
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#endif
+#endif
+
+#ifdef ACADOS_WITH_THREADS
+
+typedef struct {
+    acados_thread_pool *pool;
+    int_t thread_id;
+} acados_thread_worker;
+
+struct acados_thread_pool_ {
+    int_t num_threads;
+    pthread_t *threads;
+    acados_thread_worker *workers;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    acados_thread_task task;
+    void *ctx;
+    int_t generation;  // incremented for every task handed to the workers
+    int_t pending;     // number of workers still busy with the current task
+    bool shutdown;
+};
+
+static void *acados_thread_worker_loop(void *worker_) {
+    acados_thread_worker *worker = (acados_thread_worker *)worker_;
+    acados_thread_pool *pool = worker->pool;
+    int_t seen_generation = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true) {
+        while (pool->generation == seen_generation && !pool->shutdown)
+            pthread_cond_wait(&pool->start, &pool->lock);
+        if (pool->shutdown) break;
+        seen_generation = pool->generation;
+        acados_thread_task task = pool->task;
+        void *ctx = pool->ctx;
+        pthread_mutex_unlock(&pool->lock);
+
+        task(ctx, worker->thread_id, pool->num_threads);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->pending--;
+        if (pool->pending == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+acados_thread_pool *acados_thread_pool_create(int_t num_threads) {
+    acados_thread_pool *pool = (acados_thread_pool *)malloc(sizeof(acados_thread_pool));
+    if (num_threads < 1) num_threads = 1;
+
+    pool->threads = (pthread_t *)malloc(num_threads * sizeof(pthread_t));
+    pool->workers = (acados_thread_worker *)malloc(num_threads * sizeof(acados_thread_worker));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->task = NULL;
+    pool->ctx = NULL;
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->shutdown = false;
+
+    // The calling thread is thread 0, spawn the others. If the system refuses to
+    // create more threads, continue with the ones we already have.
+    pool->num_threads = 1;
+    for (int_t i = 1; i < num_threads; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].thread_id = i;
+        if (pthread_create(&pool->threads[i], NULL, acados_thread_worker_loop, &pool->workers[i]))
+            break;
+        pool->num_threads++;
+    }
+
+    return pool;
+}
+
+int_t acados_thread_pool_num_threads(const acados_thread_pool *pool) {
+    return pool->num_threads;
+}
+
+void acados_thread_pool_run(acados_thread_pool *pool, acados_thread_task task, void *ctx) {
+    if (pool->num_threads == 1) {
+        task(ctx, 0, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->ctx = ctx;
+    pool->pending = pool->num_threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    task(ctx, 0, pool->num_threads);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+typedef struct {
+    acados_thread_pool *pool;
+    acados_thread_item item;
+    void *ctx;
+    int_t num_items;
+    int_t next_item;  // protected by pool->lock
+} acados_thread_items;
+
+static void acados_thread_items_task(void *ctx, int_t thread_id, int_t num_threads) {
+    acados_thread_items *items = (acados_thread_items *)ctx;
+    acados_thread_pool *pool = items->pool;
+
+    while (true) {
+        pthread_mutex_lock(&pool->lock);
+        int_t item = items->next_item++;
+        pthread_mutex_unlock(&pool->lock);
+        if (item >= items->num_items) break;
+        items->item(items->ctx, item, thread_id);
+    }
+}
+
+void acados_thread_pool_run_items(acados_thread_pool *pool, int_t num_items,
+                                  acados_thread_item item, void *ctx) {
+    if (pool->num_threads == 1 || num_items <= 1) {
+        for (int_t i = 0; i < num_items; i++) item(ctx, i, 0);
+        return;
+    }
+
+    acados_thread_items items = {pool, item, ctx, num_items, 0};
+    acados_thread_pool_run(pool, &acados_thread_items_task, &items);
+}
+
+typedef struct {
+    pthread_mutex_t lock;
+    int_t num_pinned;
+} acados_thread_pinning;
+
+static void acados_thread_pin_task(void *ctx, int_t thread_id, int_t num_threads) {
+#ifdef __linux__
+    acados_thread_pinning *pinning = (acados_thread_pinning *)ctx;
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    // the affinity of the calling thread would outlive the pool
+    if (thread_id == 0 || num_cpus < 1) return;
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(thread_id % num_cpus, &cpus);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus) == 0) {
+        pthread_mutex_lock(&pinning->lock);
+        pinning->num_pinned++;
+        pthread_mutex_unlock(&pinning->lock);
+    }
+#endif
+}
+
+int_t acados_thread_pool_pin(acados_thread_pool *pool) {
+    acados_thread_pinning pinning;
+    pthread_mutex_init(&pinning.lock, NULL);
+    pinning.num_pinned = 0;
+
+    acados_thread_pool_run(pool, &acados_thread_pin_task, &pinning);
+
+    pthread_mutex_destroy(&pinning.lock);
+    return pinning.num_pinned;
+}
+
+void acados_thread_pool_destroy(acados_thread_pool *pool) {
+    if (pool == NULL) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int_t i = 1; i < pool->num_threads; i++) pthread_join(pool->threads[i], NULL);
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+}
+
+#else  // Serial fallback when acados is built without thread support
+
+struct acados_thread_pool_ {
+    int_t num_threads;
+};
+
+acados_thread_pool *acados_thread_pool_create(int_t num_threads) {
+    acados_thread_pool *pool = (acados_thread_pool *)malloc(sizeof(acados_thread_pool));
+    pool->num_threads = 1;
+    return pool;
+}
+
+int_t acados_thread_pool_num_threads(const acados_thread_pool *pool) {
+    return pool->num_threads;
+}
+
+void acados_thread_pool_run(acados_thread_pool *pool, acados_thread_task task, void *ctx) {
+    task(ctx, 0, 1);
+}
+
+void acados_thread_pool_run_items(acados_thread_pool *pool, int_t num_items,
+                                  acados_thread_item item, void *ctx) {
+    for (int_t i = 0; i < num_items; i++) item(ctx, i, 0);
+}
+
+int_t acados_thread_pool_pin(acados_thread_pool *pool) {
+    return 0;
+}
+
+void acados_thread_pool_destroy(acados_thread_pool *pool) {
+    free(pool);
+}
+
+#endif  // ACADOS_WITH_THREADS
@@ -0,0 +1,66 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef ACADOS_UTILS_THREADS_H_
+#define ACADOS_UTILS_THREADS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "acados/utils/types.h"
+
+/** Task executed by every thread of a pool, thread_id runs from 0 to num_threads-1. */
+typedef void (*acados_thread_task)(void *ctx, int_t thread_id, int_t num_threads);
+
+/** Item of a dynamically scheduled loop, item runs from 0 to num_items-1. */
+typedef void (*acados_thread_item)(void *ctx, int_t item, int_t thread_id);
+
+/** Opaque handle to a persistent pool of worker threads. */
+typedef struct acados_thread_pool_ acados_thread_pool;
+
+/** Creates a pool with num_threads threads, the calling thread counts as thread 0.
+ *  Without ACADOS_WITH_THREADS the pool always has a single (calling) thread. */
+acados_thread_pool *acados_thread_pool_create(int_t num_threads);
+
+/** Number of threads that actually run tasks of the pool. */
+int_t acados_thread_pool_num_threads(const acados_thread_pool *pool);
+
+/** Runs task on all threads of the pool and returns when all of them are done. */
+void acados_thread_pool_run(acados_thread_pool *pool, acados_thread_task task, void *ctx);
+
+/** Runs item for all 0 <= item < num_items on the threads of the pool and returns when all items
+ *  are done. Every thread takes the next unprocessed item as soon as it is idle, so items of
+ *  different cost are balanced over the threads. */
+void acados_thread_pool_run_items(acados_thread_pool *pool, int_t num_items,
+                                  acados_thread_item item, void *ctx);
+
+/** Pins worker thread i > 0 of the pool to processor i modulo the number of online processors.
+ *  The calling thread (thread 0) keeps its affinity. Returns the number of pinned threads, 0 on
+ *  systems without thread affinity support. */
+int_t acados_thread_pool_pin(acados_thread_pool *pool);
+
+/** Joins all workers and frees the pool. */
+void acados_thread_pool_destroy(acados_thread_pool *pool);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // ACADOS_UTILS_THREADS_H_
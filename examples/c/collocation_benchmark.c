@@ -0,0 +1,149 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+// Accuracy of the Gauss-Legendre and Radau IIA schemes of the lifted IRK integrator against the
+// number of integration steps, for the pendulum and a chain of three free masses. The reference
+// solution is computed with RK4 on a fine grid.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "acados/sim/sim_casadi_wrapper.h"
+#include "acados/sim/sim_collocation.h"
+#include "acados/sim/sim_erk_integrator.h"
+#include "acados/sim/sim_lifted_irk_integrator.h"
+#include "acados/utils/timing.h"
+#include "acados/utils/types.h"
+#include "examples/c/chain_model/chain_model.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define NREP 100
+#define NITER 10  // lifted Newton iterations before measuring the error
+#define NREF 2000
+
+int vdeFun(const real_t **arg, real_t **res, int *iw, real_t *w, int mem);
+int jacFun(const real_t **arg, real_t **res, int *iw, real_t *w, int mem);
+
+static void setup_sim(sim_in *in, sim_out *out, sim_info *info, int_t nx, int_t nu,
+                      casadi_function_t vde, casadi_function_t jac) {
+    in->nx = nx;
+    in->nu = nu;
+    in->sens_forw = true;
+    in->sens_adj = false;
+    in->sens_hess = false;
+    in->num_forw_sens = nx + nu;
+    in->vde = vde;
+    in->forward_vde_wrapper = &vde_fun;
+    in->jac = jac;
+    in->jacobian_wrapper = &jac_fun;
+
+    in->x = calloc(nx, sizeof(*in->x));
+    in->u = calloc(nu, sizeof(*in->u));
+    in->S_forw = calloc(nx * (nx + nu), sizeof(*in->S_forw));
+    in->S_adj = calloc(nx + nu, sizeof(*in->S_adj));
+    for (int_t i = 0; i < nx; i++) in->S_forw[i * (nx + 1)] = 1.0;
+
+    out->xn = calloc(nx, sizeof(*out->xn));
+    out->S_forw = calloc(nx * (nx + nu), sizeof(*out->S_forw));
+    out->S_adj = calloc(nx + nu, sizeof(*out->S_adj));
+    out->grad = calloc(nx + nu, sizeof(*out->grad));
+    out->info = info;
+}
+
+static void benchmark(const char *model, sim_in *in, sim_out *out, real_t T) {
+    int_t nx = in->nx;
+    sim_RK_opts rk_opts;
+    real_t xref[nx];
+
+    in->num_steps = NREF;
+    in->step = T / NREF;
+    sim_erk_create_arguments(&rk_opts, 4);
+    void *erk_work = malloc(sim_erk_calculate_workspace_size(in, &rk_opts));
+    sim_erk(in, out, &rk_opts, 0, erk_work);
+    for (int_t i = 0; i < nx; i++) xref[i] = out->xn[i];
+    free(erk_work);
+
+    printf("\n%s, nx = %d\n", model, nx);
+    printf("scheme  stages  Newton      steps  error      time [us]\n");
+    const char *names[2] = {"Gauss", "Radau"};
+    const enum Newton_type_collocation types[2] = {exact, simplified_in};
+    for (int_t m = 0; m < 2; m++) {
+        for (int_t num_stages = 1; num_stages <= 4; num_stages++) {
+            for (int_t k = 0; k < 2; k++) {
+                if (num_stages == 1 && types[k] != exact) continue;
+                for (int_t num_steps = 1; num_steps <= 8; num_steps *= 2) {
+                    sim_lifted_irk_memory irk_mem;
+                    in->num_steps = num_steps;
+                    in->step = T / num_steps;
+                    in->grad_K = calloc(num_stages * nx, sizeof(*in->grad_K));
+                    sim_irk_create_arguments(&rk_opts, num_stages, names[m]);
+                    sim_irk_create_Newton_scheme(&rk_opts, num_stages, names[m], types[k]);
+                    sim_lifted_irk_create_memory(in, &rk_opts, &irk_mem);
+                    void *irk_work =
+                        malloc(sim_lifted_irk_calculate_workspace_size(in, &rk_opts));
+
+                    for (int_t iter = 0; iter < NITER; iter++)
+                        sim_lifted_irk(in, out, &rk_opts, &irk_mem, irk_work);
+                    real_t err = 0.0;
+                    for (int_t i = 0; i < nx; i++) err = fmax(err, fabs(out->xn[i] - xref[i]));
+
+                    acados_timer timer;
+                    acados_tic(&timer);
+                    for (int_t rep = 0; rep < NREP; rep++)
+                        sim_lifted_irk(in, out, &rk_opts, &irk_mem, irk_work);
+                    real_t time = acados_toc(&timer) / NREP;
+
+                    printf("%-7s %6d  %-10s %6d  %.3e  %9.2f\n", names[m], num_stages,
+                           types[k] == exact ? "exact" : "simplified", num_steps, err,
+                           1e6 * time);
+
+                    free(irk_work);
+                    free(in->grad_K);
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    sim_in in;
+    sim_out out;
+    sim_info info;
+
+    // pendulum, swinging up from the downward position
+    setup_sim(&in, &out, &info, 4, 1, vdeFun, jacFun);
+    in.x[1] = M_PI;
+    in.u[0] = 1.0;
+    benchmark("pendulum", &in, &out, 0.5);
+
+    // chain of three free masses, pulled away from its resting position
+    setup_sim(&in, &out, &info, 18, 3, vde_chain_nm4, jac_chain_nm4);
+    FILE *initStates = fopen(X0_NM4_FILE, "r");
+    for (int_t i = 0; i < in.nx; i++)
+        if (!fscanf(initStates, "%lf", &in.x[i])) break;
+    fclose(initStates);
+    for (int_t i = 0; i < in.nu; i++) in.u[i] = 1.0;
+    benchmark("chain", &in, &out, 0.2);
+
+    return 0;
+}
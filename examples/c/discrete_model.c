@@ -91,11 +91,16 @@ int main() {
         sim_in *sim = simulators[k]->in;
         sim->nx = NX;
         sim->nu = NU;
+        sim->sens_forw = true;
+        sim->sens_adj = false;
+        sim->sens_hess = false;
+        sim->num_forw_sens = NX + NU;
         sim->discrete_model = discrete_model;
         simulators[k]->fun = sim_discrete_model;
+        simulators[k]->calculate_workspace_size = sim_discrete_model_calculate_workspace_size;
         simulators[k]->args = NULL;
         simulators[k]->mem = NULL;
-        simulators[k]->work = NULL;
+        sim_discrete_model_initialize(sim, NULL, &simulators[k]->work);
     }
 
     ocp_nlp_out output;
@@ -105,6 +110,7 @@ int main() {
     sensitivity_method.fun = &ocp_nlp_sm_gn;
     sensitivity_method.initialize = &ocp_nlp_sm_gn_initialize;
     sensitivity_method.destroy = &ocp_nlp_sm_gn_destroy;
+    sensitivity_method.args = ocp_nlp_sm_gn_create_arguments();
 
     ocp_nlp_sqp_args *nlp_args = ocp_nlp_sqp_create_arguments();
     nlp_args->maxIter = num_sqp_iterations;
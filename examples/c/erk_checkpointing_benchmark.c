@@ -0,0 +1,104 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+// Adjoint sensitivities of RK4 for the chain of three free masses, with the whole trajectory
+// stored and with checkpoints under a few memory budgets of sim_RK_opts.adj_traj_budget. The
+// checkpoints cost one extra forward step per recomputed step, which pays off once the stored
+// trajectory no longer fits in the cache.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "acados/sim/sim_casadi_wrapper.h"
+#include "acados/sim/sim_erk_integrator.h"
+#include "acados/utils/timing.h"
+#include "acados/utils/types.h"
+#include "examples/c/chain_model/chain_model.h"
+
+#define NREP 5
+
+int main() {
+    int_t nx = 18;
+    int_t nu = 3;
+    real_t T = 0.2;
+    sim_in in;
+    sim_out out;
+    sim_info info;
+
+    in.nx = nx;
+    in.nu = nu;
+    in.sens_forw = true;
+    in.sens_adj = true;
+    in.sens_hess = false;
+    in.num_forw_sens = nx + nu;
+    in.vde = vde_chain_nm4;
+    in.forward_vde_wrapper = &vde_fun;
+    in.vde_adj = vde_adj_chain_nm4;
+    in.adjoint_vde_wrapper = &vde_adj_fun;
+
+    in.x = calloc(nx, sizeof(*in.x));
+    in.u = calloc(nu, sizeof(*in.u));
+    in.S_forw = calloc(nx * (nx + nu), sizeof(*in.S_forw));
+    in.S_adj = calloc(nx + nu, sizeof(*in.S_adj));
+    for (int_t i = 0; i < nx; i++) in.S_forw[i * (nx + 1)] = 1.0;
+    for (int_t i = 0; i < nx; i++) in.S_adj[i] = 1.0;
+    FILE *initStates = fopen(X0_NM4_FILE, "r");
+    for (int_t i = 0; i < nx; i++)
+        if (!fscanf(initStates, "%lf", &in.x[i])) break;
+    fclose(initStates);
+    for (int_t i = 0; i < nu; i++) in.u[i] = 1.0;
+
+    out.xn = calloc(nx, sizeof(*out.xn));
+    out.S_forw = calloc(nx * (nx + nu), sizeof(*out.S_forw));
+    out.S_adj = calloc(nx + nu, sizeof(*out.S_adj));
+    out.info = &info;
+
+    const int_t budgets[4] = {0, 32 * 1024, 256 * 1024, 2048 * 1024};
+    printf("steps  budget [kB]  workspace [kB]  recomputed  time [us]\n");
+    for (int_t num_steps = 10; num_steps <= 1000; num_steps *= 10) {
+        for (int_t k = 0; k < 3; k++) {
+            in.num_steps = (k == 0 ? 1 : k == 1 ? 2 : 5) * num_steps;
+            in.step = T / in.num_steps;
+            for (int_t b = 0; b < 4; b++) {
+                sim_RK_opts rk_opts;
+                sim_erk_create_arguments(&rk_opts, 4);
+                rk_opts.adj_traj_budget = budgets[b];
+                int_t size = sim_erk_calculate_workspace_size(&in, &rk_opts);
+                void *work = malloc(size);
+
+                sim_erk(&in, &out, &rk_opts, 0, work);
+                acados_timer timer;
+                acados_tic(&timer);
+                for (int_t rep = 0; rep < NREP; rep++)
+                    sim_erk(&in, &out, &rk_opts, 0, work);
+                real_t time = acados_toc(&timer) / NREP;
+
+                if (budgets[b] == 0)
+                    printf("%5d  %11s", in.num_steps, "-");
+                else
+                    printf("%5d  %11d", in.num_steps, budgets[b] / 1024);
+                printf("  %14d  %10d  %9.1f\n", size / 1024, info.num_recomputed_steps,
+                       1e6 * time);
+                free(work);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+// BLASFEO against the triple loops for the linear systems of the lifted IRK integrator, for the
+// chain with 2 to 10 masses and the exact and simplified Newton schemes. Prints the number of
+// states from which BLASFEO is faster at all larger sizes, the value for LIFTED_IRK_BLASFEO_NX
+// on this machine.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "acados/sim/sim_casadi_wrapper.h"
+#include "acados/sim/sim_lifted_irk_integrator.h"
+#include "acados/utils/timing.h"
+#include "acados/utils/types.h"
+#include "examples/c/chain_model/chain_model.h"
+
+#define NREP 1000
+#define NUM_STAGES 2
+#define NUM_MASSES 9  // 2 to 10
+
+int main() {
+    const char *x0_files[] = {X0_NM2_FILE, X0_NM3_FILE, X0_NM4_FILE, X0_NM5_FILE, X0_NM6_FILE,
+                              X0_NM7_FILE, X0_NM8_FILE, X0_NM9_FILE, X0_NM10_FILE};
+    casadi_function_t vde[] = {vde_chain_nm2, vde_chain_nm3, vde_chain_nm4, vde_chain_nm5,
+                               vde_chain_nm6, vde_chain_nm7, vde_chain_nm8, vde_chain_nm9,
+                               vde_chain_nm10};
+    casadi_function_t jac[] = {jac_chain_nm2, jac_chain_nm3, jac_chain_nm4, jac_chain_nm5,
+                               jac_chain_nm6, jac_chain_nm7, jac_chain_nm8, jac_chain_nm9,
+                               jac_chain_nm10};
+    enum Newton_type_collocation types[] = {exact, simplified_in};
+    const char *type_names[] = {"exact", "simplified_in"};
+
+    // LA time per call of [scheme][size][la_blasfeo]
+    real_t time_la[2][NUM_MASSES][2];
+
+    printf("Gauss-Legendre with %d stages, LA times per call in us\n", NUM_STAGES);
+    printf("masses  nx  exact loops  exact BLASFEO  simplified loops  simplified BLASFEO\n");
+    for (int_t nm = 2; nm <= 10; nm++) {
+        int_t nx = 6 * (nm - 1);
+        int_t nu = 3;
+        sim_in in;
+        sim_out out;
+        sim_info info;
+        sim_RK_opts rk_opts;
+
+        in.nx = nx;
+        in.nu = nu;
+        in.sens_forw = true;
+        in.sens_adj = false;
+        in.sens_hess = false;
+        in.num_forw_sens = nx + nu;
+        in.vde = vde[nm - 2];
+        in.forward_vde_wrapper = &vde_fun;
+        in.jac = jac[nm - 2];
+        in.jacobian_wrapper = &jac_fun;
+        in.num_steps = 2;
+        in.step = 0.1;
+
+        in.x = calloc(nx, sizeof(*in.x));
+        in.u = calloc(nu, sizeof(*in.u));
+        in.S_forw = calloc(nx * (nx + nu), sizeof(*in.S_forw));
+        in.S_adj = calloc(nx + nu, sizeof(*in.S_adj));
+        in.grad_K = calloc(NUM_STAGES * nx, sizeof(*in.grad_K));
+        for (int_t i = 0; i < nx; i++) in.S_forw[i * (nx + 1)] = 1.0;
+        FILE *initStates = fopen(x0_files[nm - 2], "r");
+        for (int_t i = 0; i < nx; i++)
+            if (!fscanf(initStates, "%lf", &in.x[i])) break;
+        fclose(initStates);
+        for (int_t i = 0; i < nu; i++) in.u[i] = 1.0;
+
+        out.xn = calloc(nx, sizeof(*out.xn));
+        out.S_forw = calloc(nx * (nx + nu), sizeof(*out.S_forw));
+        out.S_adj = calloc(nx + nu, sizeof(*out.S_adj));
+        out.grad = calloc(nx + nu, sizeof(*out.grad));
+        out.info = &info;
+
+        for (int_t t = 0; t < 2; t++) {
+            for (int_t la_blasfeo = 0; la_blasfeo < 2; la_blasfeo++) {
+                sim_lifted_irk_memory irk_mem;
+                sim_irk_create_arguments(&rk_opts, NUM_STAGES, "Gauss");
+                sim_irk_create_Newton_scheme(&rk_opts, NUM_STAGES, "Gauss", types[t]);
+                rk_opts.la_blasfeo = la_blasfeo;
+                sim_lifted_irk_create_memory(&in, &rk_opts, &irk_mem);
+                void *irk_work = malloc(sim_lifted_irk_calculate_workspace_size(&in, &rk_opts));
+
+                real_t time = 0.0;
+                for (int_t rep = 0; rep < NREP; rep++) {
+                    sim_lifted_irk(&in, &out, &rk_opts, &irk_mem, irk_work);
+                    time += info.LAtime / NREP;
+                }
+                time_la[t][nm - 2][la_blasfeo] = time;
+
+                sim_lifted_irk_free_memory_members(&irk_mem);
+                free(irk_work);
+            }
+        }
+        printf("%6d  %2d  %11.1f  %13.1f  %16.1f  %18.1f\n", nm, nx, 1e6 * time_la[0][nm - 2][0],
+               1e6 * time_la[0][nm - 2][1], 1e6 * time_la[1][nm - 2][0],
+               1e6 * time_la[1][nm - 2][1]);
+
+        free(in.x);
+        free(in.u);
+        free(in.S_forw);
+        free(in.S_adj);
+        free(in.grad_K);
+        free(out.xn);
+        free(out.S_forw);
+        free(out.S_adj);
+        free(out.grad);
+    }
+
+    for (int_t t = 0; t < 2; t++) {
+        // smallest size from which BLASFEO wins at all larger sizes
+        int_t first = NUM_MASSES;
+        while (first > 0 && time_la[t][first - 1][1] < time_la[t][first - 1][0]) first--;
+        if (first == NUM_MASSES)
+            printf("%s: the triple loops are faster up to nx = %d\n", type_names[t],
+                   6 * NUM_MASSES);
+        else
+            printf("%s: BLASFEO is faster from nx = %d\n", type_names[t], 6 * (first + 1));
+    }
+
+    return 0;
+}
@@ -194,9 +194,15 @@ int main() {
         integrators[jj]->args = &rk_opts[jj];
         if (d > 0) {
             integrators[jj]->fun = &sim_lifted_irk;
+            integrators[jj]->calculate_workspace_size =
+                &sim_lifted_irk_calculate_workspace_size;
+            integrators[jj]->shift_memory = &sim_lifted_irk_shift_memory;
             integrators[jj]->mem = &irk_mem[jj];
         } else {
             integrators[jj]->fun = &sim_erk;
+            integrators[jj]->calculate_workspace_size =
+                &sim_erk_calculate_workspace_size;
+            integrators[jj]->shift_memory = NULL;
             integrators[jj]->mem = 0;
         }
 
@@ -441,12 +447,14 @@ int main() {
     sensitivity_method.fun = &ocp_nlp_sm_gn;
     sensitivity_method.initialize = &ocp_nlp_sm_gn_initialize;
     sensitivity_method.destroy = &ocp_nlp_sm_gn_destroy;
+    sensitivity_method.args = ocp_nlp_sm_gn_create_arguments();
 
     /************************************************
      * QP solver
      ************************************************/
     ocp_qp_solver qp_solver;
     qp_solver.fun = &ocp_qp_condensing_qpoases;
+    qp_solver.prepare = &ocp_qp_condensing_qpoases_prepare;
     qp_solver.initialize = &ocp_qp_condensing_qpoases_initialize;
     qp_solver.destroy = &ocp_qp_condensing_qpoases_destroy;
     qp_solver.qp_in = create_ocp_qp_in(NN, nx, nu, nb, ng);
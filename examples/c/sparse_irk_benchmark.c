@@ -0,0 +1,182 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+// Dense against sparse linear algebra of the exact Newton scheme of the lifted IRK integrator for
+// the chain with 2 to 10 masses. The generated Jacobians declare a dense sparsity pattern, so the
+// structural nonzeros are taken from evaluations at a few perturbed states. The dense path is the
+// LU without BLASFEO (la_blasfeo = 0).
+//
+// Measured with gcc -O2 on one x86-64 core, times per call in us:
+//
+// masses  nx  jac density  LU density  dense  dense LA  sparse  sparse LA
+//      2   6        0.083       0.292    6.0       3.6     2.8        1.1
+//      3  12        0.167       0.396   24.8      19.7    11.7        7.5
+//      4  18        0.167       0.431   66.6      57.4    32.5       24.9
+//      5  24        0.146       0.398  148.9     131.9    64.1       51.0
+//      6  30        0.127       0.355  263.4     236.9   103.7       82.7
+//      7  36        0.111       0.316  569.1     521.1   191.7      155.9
+//      8  42        0.099       0.283  728.0     675.1   209.6      171.6
+//      9  48        0.089       0.256  1143.0   1072.1   271.3      223.8
+//     10  54        0.080       0.233  1572.7   1481.0   497.5      403.9
+//
+// The sparse LU is faster from the smallest chain on, 2x at 2 masses and 3x to 4x from 6
+// masses, so the crossover against the dense LU lies below nx = 6.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "acados/sim/sim_casadi_wrapper.h"
+#include "acados/sim/sim_lifted_irk_integrator.h"
+#include "acados/utils/timing.h"
+#include "acados/utils/types.h"
+#include "examples/c/chain_model/chain_model.h"
+
+#define NREP 2000
+#define NUM_STAGES 2
+#define NUM_PROBES 3
+
+// CasADi sparsity of the nonzeros of df/dx in NUM_PROBES evaluations
+static int_t *probe_sparsity(sim_in *in) {
+    int_t nx = in->nx, nu = in->nu;
+    real_t *jac_in = calloc(nx + nu, sizeof(*jac_in));
+    real_t *jac_out = calloc(nx * (nx + nu + 1), sizeof(*jac_out));
+    char *nz = calloc(nx * nx, sizeof(*nz));
+    for (int_t p = 0; p < NUM_PROBES; p++) {
+        for (int_t i = 0; i < nx; i++) jac_in[i] = in->x[i] + 0.1 * (p + 1) * sin(i + p);
+        for (int_t i = 0; i < nu; i++) jac_in[nx + i] = 0.5 * p - 0.3 * i;
+        in->jacobian_wrapper(nx, jac_in, jac_out, in->jac);
+        for (int_t i = 0; i < nx * nx; i++) nz[i] |= jac_out[nx + i] != 0.0;
+    }
+    int_t nnz = 0;
+    for (int_t i = 0; i < nx * nx; i++) nnz += nz[i];
+    int_t *sparsity = calloc(3 + nx + nnz, sizeof(*sparsity));
+    sparsity[0] = nx;
+    sparsity[1] = nx;
+    int_t *colind = sparsity + 2, *row = sparsity + nx + 3;
+    for (int_t j = 0, k = 0; j < nx; j++) {
+        colind[j] = k;
+        for (int_t i = 0; i < nx; i++)
+            if (nz[j * nx + i]) row[k++] = i;
+        colind[j + 1] = k;
+    }
+    free(jac_in);
+    free(jac_out);
+    free(nz);
+    return sparsity;
+}
+
+int main() {
+    const char *x0_files[] = {X0_NM2_FILE, X0_NM3_FILE, X0_NM4_FILE, X0_NM5_FILE, X0_NM6_FILE,
+                              X0_NM7_FILE, X0_NM8_FILE, X0_NM9_FILE, X0_NM10_FILE};
+    casadi_function_t vde[] = {vde_chain_nm2, vde_chain_nm3, vde_chain_nm4, vde_chain_nm5, vde_chain_nm6,
+                               vde_chain_nm7, vde_chain_nm8, vde_chain_nm9, vde_chain_nm10};
+    casadi_function_t jac[] = {jac_chain_nm2, jac_chain_nm3, jac_chain_nm4, jac_chain_nm5, jac_chain_nm6,
+                               jac_chain_nm7, jac_chain_nm8, jac_chain_nm9, jac_chain_nm10};
+
+    printf("Gauss-Legendre with %d stages, exact Newton scheme, times per call in us\n",
+           NUM_STAGES);
+    printf("masses  nx  jac density  LU density  dense  dense LA  sparse  sparse LA  "
+           "max diff\n");
+    for (int_t nm = 2; nm <= 10; nm++) {
+        int_t nx = 6 * (nm - 1);
+        int_t nu = 3;
+        sim_in in;
+        sim_out out;
+        sim_info info;
+        sim_RK_opts rk_opts;
+
+        in.nx = nx;
+        in.nu = nu;
+        in.sens_forw = true;
+        in.sens_adj = false;
+        in.sens_hess = false;
+        in.num_forw_sens = nx + nu;
+        in.vde = vde[nm - 2];
+        in.forward_vde_wrapper = &vde_fun;
+        in.jac = jac[nm - 2];
+        in.jacobian_wrapper = &jac_fun;
+        in.num_steps = 2;
+        in.step = 0.1;
+
+        in.x = calloc(nx, sizeof(*in.x));
+        in.u = calloc(nu, sizeof(*in.u));
+        in.S_forw = calloc(nx * (nx + nu), sizeof(*in.S_forw));
+        in.grad_K = calloc(NUM_STAGES * nx, sizeof(*in.grad_K));
+        for (int_t i = 0; i < nx; i++) in.S_forw[i * (nx + 1)] = 1.0;
+        FILE *initStates = fopen(x0_files[nm - 2], "r");
+        for (int_t i = 0; i < nx; i++)
+            if (!fscanf(initStates, "%lf", &in.x[i])) break;
+        fclose(initStates);
+        for (int_t i = 0; i < nu; i++) in.u[i] = 1.0;
+
+        out.xn = calloc(nx, sizeof(*out.xn));
+        out.S_forw = calloc(nx * (nx + nu), sizeof(*out.S_forw));
+        out.grad = calloc(nx + nu, sizeof(*out.grad));
+        out.info = &info;
+
+        int_t *sparsity = probe_sparsity(&in);
+        real_t time[2], time_la[2], lu_density = 0.0;
+        real_t *xn = calloc(nx, sizeof(*xn));
+        real_t diff = 0.0;
+        for (int_t sparse = 0; sparse < 2; sparse++) {
+            sim_lifted_irk_memory irk_mem;
+            sim_irk_create_arguments(&rk_opts, NUM_STAGES, "Gauss");
+            sim_irk_create_Newton_scheme(&rk_opts, NUM_STAGES, "Gauss", exact);
+            rk_opts.la_blasfeo = 0;
+            rk_opts.jac_sparsity = sparse ? sparsity : NULL;
+            sim_lifted_irk_create_memory(&in, &rk_opts, &irk_mem);
+            void *irk_work = malloc(sim_lifted_irk_calculate_workspace_size(&in, &rk_opts));
+            if (sparse) {
+                int_t n = NUM_STAGES * nx;
+                lu_density = (real_t) irk_mem.sparse_lu.nnz / (n * n);
+            }
+
+            time[sparse] = time_la[sparse] = 0.0;
+            for (int_t rep = 0; rep < NREP; rep++) {
+                sim_lifted_irk(&in, &out, &rk_opts, &irk_mem, irk_work);
+                time[sparse] += info.CPUtime / NREP;
+                time_la[sparse] += info.LAtime / NREP;
+            }
+            for (int_t i = 0; i < nx; i++) {
+                if (sparse) diff = fmax(diff, fabs(out.xn[i] - xn[i]));
+                xn[i] = out.xn[i];
+            }
+            sim_lifted_irk_free_memory_members(&irk_mem);
+            free(irk_work);
+        }
+
+        real_t jac_density = (real_t) sparsity[2 + nx] / (nx * nx);
+        printf("%6d  %2d  %11.3f  %10.3f  %5.1f  %8.1f  %6.1f  %9.1f  %.1e\n", nm, nx,
+               jac_density, lu_density, 1e6 * time[0], 1e6 * time_la[0], 1e6 * time[1],
+               1e6 * time_la[1], diff);
+
+        free(sparsity);
+        free(xn);
+        free(in.x);
+        free(in.u);
+        free(in.S_forw);
+        free(in.grad_K);
+        free(out.xn);
+        free(out.S_forw);
+        free(out.grad);
+    }
+
+    return 0;
+}
@@ -295,6 +295,8 @@ LangObject *sim_output(const sim_in *in, const sim_out *out) {
         if (!strcmp("explicit runge-kutta", solver_name) || !strcmp("erk", solver_name) ||
                                                             !strcmp("rk", solver_name)) {
             solver->fun = sim_erk;
+            solver->calculate_workspace_size = sim_erk_calculate_workspace_size;
+            solver->shift_memory = NULL;
             args = (void *) malloc(sizeof(sim_RK_opts));
             sim_erk_create_arguments(args, order);
             workspace_size = sim_erk_calculate_workspace_size(input, args);
@@ -303,6 +305,8 @@ LangObject *sim_output(const sim_in *in, const sim_out *out) {
         } else if (!strcmp("implicit runge-kutta", solver_name) || !strcmp("irk", solver_name)
                    || !strcmp("in", solver_name) || !strcmp("inis", solver_name)) {
             solver->fun = sim_lifted_irk;
+            solver->calculate_workspace_size = sim_lifted_irk_calculate_workspace_size;
+            solver->shift_memory = sim_lifted_irk_shift_memory;
             args = (void *) malloc(sizeof(sim_RK_opts));
             sim_irk_create_arguments(args, 2, "Gauss");
             if (!strcmp("implicit runge-kutta", solver_name)
@@ -973,6 +977,7 @@ real_t **ocp_nlp_ls_cost_ls_cost_ref_get(ocp_nlp_ls_cost *ls_cost) {
                 sm->fun = &ocp_nlp_sm_gn;
                 sm->initialize = &ocp_nlp_sm_gn_initialize;
                 sm->destroy = &ocp_nlp_sm_gn_destroy;
+                sm->args = ocp_nlp_sm_gn_create_arguments();
             } else {
                 throw std::invalid_argument(
                     "Chosen sensitivity method not available!");
@@ -995,6 +1000,9 @@ real_t **ocp_nlp_ls_cost_ls_cost_ref_get(ocp_nlp_ls_cost *ls_cost) {
                     simulators[i]->in, simulators[i]->args);
                 simulators[i]->work = (void *)malloc(erk_workspace_size);
                 simulators[i]->fun = &sim_erk;
+                simulators[i]->calculate_workspace_size =
+                    &sim_erk_calculate_workspace_size;
+                simulators[i]->shift_memory = NULL;
             }
 
             ocp_nlp_sqp_initialize(nlp_in, args, &mem, &workspace);
@@ -17,8 +17,10 @@
  *
  */
 
+#include <cmath>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "blasfeo/include/blasfeo_target.h"
 #include "blasfeo/include/blasfeo_common.h"
@@ -254,9 +256,15 @@ TEST_CASE("GN-SQP for nonlinear optimal control of chain of masses",
                     integrators[jj]->args = &rk_opts[jj];
                     if (d > 0) {
                         integrators[jj]->fun = &sim_lifted_irk;
+                        integrators[jj]->calculate_workspace_size =
+                            &sim_lifted_irk_calculate_workspace_size;
+                        integrators[jj]->shift_memory = &sim_lifted_irk_shift_memory;
                         integrators[jj]->mem = &irk_mem[jj];
                     } else {
                         integrators[jj]->fun = &sim_erk;
+                        integrators[jj]->calculate_workspace_size =
+                            &sim_erk_calculate_workspace_size;
+                        integrators[jj]->shift_memory = NULL;
                         integrators[jj]->mem = 0;
                     }
 
@@ -535,12 +543,16 @@ TEST_CASE("GN-SQP for nonlinear optimal control of chain of masses",
                     ((ocp_nlp_sm_gn_args *)sensitivity_method.args)
                         ->freezeSens = true;
                 }
+                // Also exercise the threaded evaluation of the shooting intervals
+                ((ocp_nlp_sm_gn_args *)sensitivity_method.args)->num_threads =
+                    NMF;
 
                 /************************************************
                  * QP solver
                  ************************************************/
                 ocp_qp_solver qp_solver;
                 qp_solver.fun = &ocp_qp_qpdunes;
+                qp_solver.prepare = NULL;
                 qp_solver.initialize = &ocp_qp_qpdunes_initialize;
                 qp_solver.destroy = &ocp_qp_qpdunes_destroy;
                 qp_solver.qp_in = create_ocp_qp_in(N, nx, nu, nb, ng);
@@ -624,6 +636,15 @@ TEST_CASE("GN-SQP for nonlinear optimal control of chain of masses",
                     ocp_nlp_sqp(&nlp_in, &nlp_out, nlp_args, nlp_mem, nlp_work);
                 REQUIRE(status == 0);
 
+                ocp_nlp_sqp_stats *stats = nlp_mem->stats;
+                REQUIRE(stats->converged);
+                REQUIRE(stats->sqp_iter < max_sqp_iters);
+                int_t last = stats->sqp_iter;
+                REQUIRE(stats->res_stat[last] < nlp_args->tol_stat);
+                REQUIRE(stats->res_eq[last] < nlp_args->tol_eq);
+                REQUIRE(stats->res_ineq[last] < nlp_args->tol_ineq);
+                REQUIRE(stats->res_comp[last] < nlp_args->tol_comp);
+
                 real_t out_x[NX * (N + 1)], err_x[NX * (N + 1)];
                 real_t out_u[NU * N], err_u[NU * N];
                 for (int_t i = 0; i < N; i++) {
@@ -668,6 +689,152 @@ TEST_CASE("GN-SQP for nonlinear optimal control of chain of masses",
                 REQUIRE(SQP_x.isApprox(resX, COMPARISON_TOLERANCE_IPOPT));
                 REQUIRE(SQP_u.isApprox(resU, COMPARISON_TOLERANCE_IPOPT));
 
+                if (NMF > 1) {
+                    // The same solve with serial shooting must give the
+                    // threaded result bit for bit. Integrator, sensitivity
+                    // and QP solver memories are fresh so that both solves
+                    // start from the same state.
+                    ocp_nlp_sm sm_serial = sensitivity_method;
+                    sm_serial.args = ocp_nlp_sm_gn_create_arguments();
+                    ((ocp_nlp_sm_gn_args *)sm_serial.args)->freezeSens =
+                        ((ocp_nlp_sm_gn_args *)sensitivity_method.args)->freezeSens;
+                    ((ocp_nlp_sm_gn_args *)sm_serial.args)->num_threads = 1;
+                    ocp_qp_solver qp_serial = qp_solver;
+
+                    sim_lifted_irk_memory *irk_mem_serial[N];
+                    for (jj = 0; jj < N; jj++) {
+                        irk_mem_serial[jj] = NULL;
+                        if (d > 0) {
+                            irk_mem_serial[jj] = (sim_lifted_irk_memory *)malloc(
+                                sizeof(sim_lifted_irk_memory));
+                            sim_lifted_irk_create_memory(&sim_in[jj], &rk_opts[jj],
+                                                         irk_mem_serial[jj]);
+                            integrators[jj]->mem = irk_mem_serial[jj];
+                        }
+                    }
+
+                    ocp_nlp_sqp_args *serial_args = ocp_nlp_sqp_create_arguments();
+                    serial_args->maxIter = max_sqp_iters;
+                    serial_args->sensitivity_method = &sm_serial;
+                    serial_args->qp_solver = &qp_serial;
+
+                    ocp_nlp_sqp_memory *serial_mem;
+                    ocp_nlp_sqp_workspace *serial_work;
+                    ocp_nlp_sqp_initialize(&nlp_in, serial_args, (void **)&serial_mem,
+                                           (void **)&serial_work);
+                    real_t **serial_x_mem = (real_t **)serial_mem->common->x;
+                    real_t **serial_u_mem = (real_t **)serial_mem->common->u;
+                    for (int_t i = 0; i < N; i++) {
+                        for (int_t j = 0; j < NX; j++) serial_x_mem[i][j] = xref[j];
+                        for (int_t j = 0; j < NU; j++) serial_u_mem[i][j] = 0.0;
+                    }
+                    for (int_t j = 0; j < NX; j++) serial_x_mem[N][j] = xref[j];
+
+                    status = ocp_nlp_sqp(&nlp_in, &nlp_out, serial_args, serial_mem,
+                                         serial_work);
+                    REQUIRE(status == 0);
+                    REQUIRE(serial_mem->stats->sqp_iter == stats->sqp_iter);
+                    for (int_t i = 0; i < N; i++) {
+                        for (int_t j = 0; j < NX; j++)
+                            REQUIRE(nlp_out.x[i][j] == out_x[i * NX + j]);
+                        for (int_t j = 0; j < NU; j++)
+                            REQUIRE(nlp_out.u[i][j] == out_u[i * NU + j]);
+                    }
+                    for (int_t j = 0; j < NX; j++)
+                        REQUIRE(nlp_out.x[N][j] == out_x[N * NX + j]);
+
+                    sm_serial.destroy(sm_serial.mem, sm_serial.work);
+                    free(sm_serial.args);
+                    qp_serial.destroy(qp_serial.mem, qp_serial.work);
+                    ocp_nlp_sqp_destroy(serial_mem, serial_work);
+                    free(serial_args);
+                    for (jj = 0; jj < N; jj++) {
+                        if (d > 0) {
+                            sim_lifted_irk_free_memory(irk_mem_serial[jj]);
+                            integrators[jj]->mem = &irk_mem[jj];
+                        }
+                    }
+                }
+
+                if (INEXACT == 0) {
+                    // Real-time iterations with a constant initial state
+                    // converge to the same solution
+                    for (int_t i = 0; i < N; i++) {
+                        for (int_t j = 0; j < NX; j++) nlp_x_mem[i][j] = xref[j];
+                        for (int_t j = 0; j < NU; j++) nlp_u_mem[i][j] = 0.0;
+                    }
+                    for (int_t j = 0; j < NX; j++) nlp_x_mem[N][j] = xref[j];
+
+                    // Largest change of the iterate in one real-time iteration
+                    std::vector<real_t> x_prev(NX * (N + 1)), u_prev(NU * N);
+                    auto store_iterate = [&]() {
+                        for (int_t i = 0; i <= N; i++)
+                            for (int_t j = 0; j < NX; j++)
+                                x_prev[i * NX + j] = nlp_x_mem[i][j];
+                        for (int_t i = 0; i < N; i++)
+                            for (int_t j = 0; j < NU; j++)
+                                u_prev[i * NU + j] = nlp_u_mem[i][j];
+                    };
+                    auto step_norm = [&]() {
+                        real_t step = 0;
+                        for (int_t i = 0; i <= N; i++)
+                            for (int_t j = 0; j < NX; j++)
+                                step = fmax(step, fabs(nlp_x_mem[i][j] -
+                                                       x_prev[i * NX + j]));
+                        for (int_t i = 0; i < N; i++)
+                            for (int_t j = 0; j < NU; j++)
+                                step = fmax(step, fabs(nlp_u_mem[i][j] -
+                                                       u_prev[i * NU + j]));
+                        return step;
+                    };
+
+                    real_t step_cold = 0, step_warm = 0;
+                    for (int_t iter = 0; iter < max_sqp_iters; iter++) {
+                        store_iterate();
+                        ocp_nlp_sqp_rti_preparation(&nlp_in, nlp_args, nlp_mem,
+                                                    nlp_work);
+                        status = ocp_nlp_sqp_rti_feedback(
+                            &nlp_in, &nlp_out, x0.data(), nlp_args, nlp_mem,
+                            nlp_work);
+                        REQUIRE(status == 0);
+                        if (iter == 0) step_cold = step_norm();
+                        if (iter == 1) step_warm = step_norm();
+                    }
+
+                    for (int_t i = 0; i < N; i++) {
+                        for (int_t j = 0; j < NX; j++)
+                            out_x[i * NX + j] = nlp_out.x[i][j];
+                        for (int_t j = 0; j < NU; j++)
+                            out_u[i * NU + j] = nlp_out.u[i][j];
+                    }
+                    for (int_t j = 0; j < NX; j++)
+                        out_x[N * NX + j] = nlp_out.x[N][j];
+
+                    MatrixXd RTI_x = Eigen::Map<MatrixXd>(&out_x[0], NX, N + 1);
+                    MatrixXd RTI_u = Eigen::Map<MatrixXd>(&out_u[0], NU, N);
+
+                    REQUIRE(RTI_x.isApprox(resX, COMPARISON_TOLERANCE_IPOPT));
+                    REQUIRE(RTI_u.isApprox(resU, COMPARISON_TOLERANCE_IPOPT));
+
+                    // Next sample from the predicted state with the shifted
+                    // iterate: the first iteration must take a step of the
+                    // size of a warm iteration, not of a cold start
+                    VectorXd x0_next(NX);
+                    for (int_t j = 0; j < NX; j++) x0_next(j) = nlp_out.x[1][j];
+                    ocp_nlp_sqp_shift(&nlp_in, nlp_args, nlp_mem);
+                    store_iterate();
+                    ocp_nlp_sqp_rti_preparation(&nlp_in, nlp_args, nlp_mem,
+                                                nlp_work);
+                    status = ocp_nlp_sqp_rti_feedback(&nlp_in, &nlp_out,
+                                                      x0_next.data(), nlp_args,
+                                                      nlp_mem, nlp_work);
+                    real_t step_shift = step_norm();
+
+                    REQUIRE(status == 0);
+                    REQUIRE(step_shift < step_cold);
+                    REQUIRE(step_shift <= 10 * step_warm);
+                }
+
                 d_free(W);
                 d_free(WN);
                 d_free(uref);
@@ -29,10 +29,13 @@
 #include "acados/ocp_qp/ocp_qp_ooqp.h"
 #endif
 
+#include "acados/ocp_qp/ocp_qp_batch.h"
 #include "acados/ocp_qp/ocp_qp_condensing_qpoases.h"
 #include "acados/ocp_qp/ocp_qp_condensing_hpipm.h"
 #include "acados/ocp_qp/ocp_qp_hpipm.h"
+#include "acados/ocp_qp/ocp_qp_hpipm_in.h"
 #include "acados/ocp_qp/ocp_qp_hpmpc.h"
+#include "acados/ocp_qp/ocp_qp_partial_condensing.h"
 #include "acados/ocp_qp/ocp_qp_qpdunes.h"
 #include "test/test_utils/read_matrix.h"
 #include "test/test_utils/read_ocp_qp_in.h"
@@ -44,11 +47,12 @@ using Eigen::MatrixXd;
 using Eigen::VectorXd;
 using Eigen::Map;
 
-// TODO(dimitris): enable tests of condensing solvers after updating hpipm submodule
+// TODO(dimitris): enable tests of condensing solvers after updating hpipm submodule,
+// the warm start also needs the warm_start field of the HPIPM ipm arguments
 
 int_t TEST_OOQP = 1;
 real_t TOL_OOQP = 1e-6;
-int_t TEST_QPOASES = 0;
+int_t TEST_QPOASES = 1;
 real_t TOL_QPOASES = 1e-10;
 int_t TEST_QPDUNES = 1;
 real_t TOL_QPDUNES = 1e-10;
@@ -58,11 +62,42 @@ int_t TEST_CON_HPIPM = 0;
 real_t TOL_CON_HPIPM = 1e-5;
 int_t TEST_HPIPM = 0;
 real_t TOL_HPIPM = 1e-5;
+int_t TEST_PARTIAL_CONDENSING = 1;
+real_t TOL_PARTIAL_CONDENSING = 1e-6;
+int_t TEST_HPIPM_IN = 1;
+real_t TOL_HPIPM_IN = 1e-10;
+int_t TEST_PREPARE = 1;
+int_t TEST_BATCH = 1;
+real_t TOL_BATCH = 1e-10;
 
 static vector<std::string> scenarios = {"ocp_qp/LTI", "ocp_qp/LTV"};
 // TODO(dimitris): add back "ONLY_AFFINE" after fixing problem
 vector<std::string> constraints = {"UNCONSTRAINED", "ONLY_BOUNDS", "CONSTRAINED"};
 
+// Write the data of qp_in into an attached HPIPM QP through the setters of ocp_qp_hpipm_in.h
+static void write_qp_in_to_hpipm(const ocp_qp_in *qp_in, struct d_ocp_qp *qp_hpipm) {
+    for (int_t i = 0; i <= qp_in->N; i++) {
+        int_t nxi = qp_in->nx[i], nui = qp_in->nu[i], nci = qp_in->nc[i];
+        MatrixXd hess(nxi+nui, nxi+nui), jac_c(nci, nxi+nui);
+        hess << Map<const MatrixXd>(qp_in->Q[i], nxi, nxi),
+            Map<const MatrixXd>(qp_in->S[i], nui, nxi).transpose(),
+            Map<const MatrixXd>(qp_in->S[i], nui, nxi),
+            Map<const MatrixXd>(qp_in->R[i], nui, nui);
+        jac_c << Map<const MatrixXd>(qp_in->Cx[i], nci, nxi),
+            Map<const MatrixXd>(qp_in->Cu[i], nci, nui);
+        ocp_qp_hpipm_in_set_objective(qp_hpipm, i, hess.data(), qp_in->q[i], qp_in->r[i]);
+        ocp_qp_hpipm_in_set_bounds(qp_hpipm, i, qp_in->idxb[i], qp_in->lb[i], qp_in->ub[i]);
+        ocp_qp_hpipm_in_set_constraints(qp_hpipm, i, jac_c.data(), qp_in->lc[i], qp_in->uc[i]);
+        if (i < qp_in->N) {
+            int_t nx1 = qp_in->nx[i+1];
+            MatrixXd jac_h(nx1, nxi+nui);
+            jac_h << Map<const MatrixXd>(qp_in->A[i], nx1, nxi),
+                Map<const MatrixXd>(qp_in->B[i], nx1, nui);
+            ocp_qp_hpipm_in_set_dynamics(qp_hpipm, i, jac_h.data(), qp_in->b[i]);
+        }
+    }
+}
+
 // TODO(dimitris): Clean up octave code
 TEST_CASE("Solve random OCP_QP", "[QP solvers]") {
     ocp_qp_in *qp_in;
@@ -121,25 +156,52 @@ TEST_CASE("Solve random OCP_QP", "[QP solvers]") {
                             std::cout <<"---> TESTING qpOASES with QP: "<< scenario <<
                                 ", " << constraint << std::endl;
 
-                            ocp_qp_solver *solver =
-                                create_ocp_qp_solver(qp_in, "condensing_qpoases", NULL);
+                            // hotstart 1 reuses the active set, hotstart 2 the previous solution
+                            for (int hotstart = 1; hotstart <= 2; hotstart++) {
+                                ocp_qp_solver *solver =
+                                    create_ocp_qp_solver(qp_in, "condensing_qpoases", NULL);
+                                ((ocp_qp_condensing_qpoases_args *) solver->args)->hotstart =
+                                    hotstart;
 
                                 // TODO(dimitris): also test that qp_in has not changed
-                            return_value = solver->fun(solver->qp_in, solver->qp_out, solver->args,
-                                                       solver->mem, solver->work);
-
-                            acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0], (N+1)*nx + N*nu);
-                            acados_PI = Eigen::Map<VectorXd>(solver->qp_out->pi[0], N*nx);
-
-                            REQUIRE(return_value == 0);
-                            REQUIRE(acados_W.isApprox(true_W, TOL_QPOASES));
-                            // TODO(dimitris): check multipliers in other solvers too
-                            if (constraint == "CONSTRAINED") {
-                                // for (int j = 0; j < N*nx; j++) {
-                                //     printf(" %5.2e \t %5.2e\n", acados_PI(j), true_PI(j));
-                                // }
-                                // TODO(dimitris): re-enable this once HPIPM is updated in acados
-                                // REQUIRE(acados_PI.isApprox(true_PI, TOL_QPOASES));
+                                return_value = solver->fun(solver->qp_in, solver->qp_out,
+                                                           solver->args, solver->mem,
+                                                           solver->work);
+
+                                acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0],
+                                                                (N+1)*nx + N*nu);
+                                acados_PI = Eigen::Map<VectorXd>(solver->qp_out->pi[0], N*nx);
+
+                                REQUIRE(return_value == 0);
+                                REQUIRE(acados_W.isApprox(true_W, TOL_QPOASES));
+                                // TODO(dimitris): check multipliers in other solvers too
+                                if (constraint == "CONSTRAINED") {
+                                    // for (int j = 0; j < N*nx; j++) {
+                                    //     printf(" %5.2e \t %5.2e\n", acados_PI(j), true_PI(j));
+                                    // }
+                                    // TODO(dimitris): re-enable this once HPIPM is updated
+                                    // REQUIRE(acados_PI.isApprox(true_PI, TOL_QPOASES));
+                                }
+
+                                // solving the same QP again reuses the working set
+                                int nwsr_cold = ((ocp_qp_condensing_qpoases_memory *)
+                                    solver->mem)->nwsr;
+                                return_value = solver->fun(solver->qp_in, solver->qp_out,
+                                                           solver->args, solver->mem,
+                                                           solver->work);
+                                int nwsr_hot = ((ocp_qp_condensing_qpoases_memory *)
+                                    solver->mem)->nwsr;
+
+                                acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0],
+                                                                (N+1)*nx + N*nu);
+
+                                REQUIRE(return_value == 0);
+                                REQUIRE(acados_W.isApprox(true_W, TOL_QPOASES));
+                                if (constraint == "CONSTRAINED") {
+                                    REQUIRE(nwsr_hot < nwsr_cold);
+                                } else {
+                                    REQUIRE(nwsr_hot <= nwsr_cold);
+                                }
                             }
                             std::cout <<"---> PASSED " << std::endl;
                         }
@@ -162,6 +224,123 @@ TEST_CASE("Solve random OCP_QP", "[QP solvers]") {
                             std::cout <<"---> PASSED " << std::endl;
                         }
                     }
+                    if (TEST_PARTIAL_CONDENSING) {
+                        SECTION("Partial condensing + qpDUNES") {
+                            std::cout <<"---> TESTING partial condensing + qpDUNES with QP: "<<
+                                scenario << ", " << constraint << std::endl;
+
+                            // blocks of two stages keep the dimensions constant for qpDUNES
+                            ocp_qp_partial_condensing_args *pcond_args =
+                                ocp_qp_partial_condensing_create_arguments(qp_in);
+                            pcond_args->N2 = N/2;
+
+                            void *pcond_mem, *pcond_work;
+                            ocp_qp_partial_condensing_initialize(qp_in, pcond_args, &pcond_mem,
+                                                                 &pcond_work);
+                            ocp_qp_in *pcond_qp_in =
+                                ((ocp_qp_partial_condensing_memory *) pcond_mem)->pcond_qp_in;
+
+                            return_value = ocp_qp_partial_condensing(qp_in, pcond_qp_in,
+                                pcond_args, pcond_mem, pcond_work);
+                            REQUIRE(return_value == 0);
+                            REQUIRE(pcond_qp_in->N == N/2);
+
+                            ocp_qp_solver *solver =
+                                create_ocp_qp_solver(pcond_qp_in, "qpdunes", NULL);
+
+                            return_value = solver->fun(solver->qp_in, solver->qp_out, solver->args,
+                                                       solver->mem, solver->work);
+                            REQUIRE(return_value == 0);
+
+                            return_value = ocp_qp_partial_expansion(qp_in, solver->qp_out, qp_out,
+                                pcond_args, pcond_mem, pcond_work);
+
+                            acados_W = Eigen::Map<VectorXd>(qp_out->x[0], (N+1)*nx + N*nu);
+                            REQUIRE(return_value == 0);
+                            REQUIRE(acados_W.isApprox(true_W, TOL_PARTIAL_CONDENSING));
+
+                            // expanded multipliers against a full-horizon solve, with HPIPM on
+                            // both sides since qpDUNES returns no multipliers for general
+                            // constraints
+                            ocp_qp_solver *full_solver = create_ocp_qp_solver(qp_in, "hpipm", NULL);
+                            return_value = full_solver->fun(full_solver->qp_in,
+                                full_solver->qp_out, full_solver->args, full_solver->mem,
+                                full_solver->work);
+                            REQUIRE(return_value == 0);
+
+                            ocp_qp_solver *pcond_solver =
+                                create_ocp_qp_solver(pcond_qp_in, "hpipm", NULL);
+                            return_value = pcond_solver->fun(pcond_solver->qp_in,
+                                pcond_solver->qp_out, pcond_solver->args, pcond_solver->mem,
+                                pcond_solver->work);
+                            REQUIRE(return_value == 0);
+                            return_value = ocp_qp_partial_expansion(qp_in, pcond_solver->qp_out,
+                                qp_out, pcond_args, pcond_mem, pcond_work);
+                            REQUIRE(return_value == 0);
+
+                            vector<real_t> pi, pi_full, lam, lam_full;
+                            for (int_t i = 0; i <= N; i++) {
+                                if (i < N) {
+                                    for (int_t j = 0; j < qp_in->nx[i+1]; j++) {
+                                        pi.push_back(qp_out->pi[i][j]);
+                                        pi_full.push_back(full_solver->qp_out->pi[i][j]);
+                                    }
+                                }
+                                for (int_t j = 0; j < 2*(qp_in->nb[i] + qp_in->nc[i]); j++) {
+                                    lam.push_back(qp_out->lam[i][j]);
+                                    lam_full.push_back(full_solver->qp_out->lam[i][j]);
+                                }
+                            }
+                            REQUIRE(Map<VectorXd>(pi.data(), pi.size()).isApprox(
+                                Map<VectorXd>(pi_full.data(), pi_full.size()), TOL_HPIPM));
+                            if (!lam.empty()) {
+                                VectorXd lam_diff = Map<VectorXd>(lam.data(), lam.size()) -
+                                    Map<VectorXd>(lam_full.data(), lam_full.size());
+                                REQUIRE(lam_diff.norm() <= TOL_HPIPM *
+                                    (1.0 + Map<VectorXd>(lam_full.data(), lam_full.size()).norm()));
+                            }
+
+                            ocp_qp_partial_condensing_destroy(pcond_mem, pcond_work);
+                            free(pcond_args);
+                            std::cout <<"---> PASSED " << std::endl;
+                        }
+                    }
+                    if (TEST_BATCH) {
+                        SECTION("Batch of qpDUNES") {
+                            std::cout <<"---> TESTING batch of qpDUNES with QP: "<< scenario <<
+                                ", " << constraint << std::endl;
+
+                            const int_t num_instances = 8;
+                            vector<ocp_qp_in *> batch_in(num_instances, qp_in);
+                            vector<ocp_qp_out *> batch_out(num_instances);
+                            for (int_t k = 0; k < num_instances; k++)
+                                batch_out[k] = create_ocp_qp_out(qp_in->N, qp_in->nx, qp_in->nu,
+                                                                 qp_in->nb, qp_in->nc);
+
+                            ocp_qp_batch_args *batch_args = ocp_qp_batch_create_arguments();
+                            batch_args->num_threads = 4;
+                            ocp_qp_batch_solver *batch = create_ocp_qp_batch_solver(
+                                num_instances, batch_in.data(), "qpdunes", batch_args);
+
+                            return_value = ocp_qp_batch_solve(batch, batch_in.data(),
+                                                              batch_out.data());
+
+                            REQUIRE(return_value == 0);
+                            for (int_t k = 0; k < num_instances; k++) {
+                                acados_W = Eigen::Map<VectorXd>(batch_out[k]->x[0],
+                                                                (N+1)*nx + N*nu);
+                                REQUIRE(batch->status[k] == 0);
+                                REQUIRE(batch->time[k] >= 0);
+                                REQUIRE(batch->thread_id[k] < batch->num_threads);
+                                REQUIRE(acados_W.isApprox(true_W, TOL_BATCH));
+                            }
+
+                            ocp_qp_batch_destroy(batch);
+                            free(batch_args);
+                            for (int_t k = 0; k < num_instances; k++) free(batch_out[k]);
+                            std::cout <<"---> PASSED " << std::endl;
+                        }
+                    }
                     #ifdef OOQP
                     if (TEST_OOQP) {
                         SECTION("OOQP") {
@@ -227,6 +406,25 @@ TEST_CASE("Solve random OCP_QP", "[QP solvers]") {
                                 // }
                                 // REQUIRE(acados_PI.isApprox(true_PI, TOL_CON_HPIPM));
                             }
+
+                            // warm start from the previous solution of the same QP
+                            int iter_cold = ((ocp_qp_condensing_hpipm_memory *)
+                                solver->mem)->iter;
+                            ((ocp_qp_condensing_hpipm_args *) solver->args)->warm_start = 1;
+                            return_value = solver->fun(solver->qp_in, solver->qp_out, solver->args,
+                                                    solver->mem, solver->work);
+                            int iter_warm = ((ocp_qp_condensing_hpipm_memory *)
+                                solver->mem)->iter;
+
+                            acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0], (N+1)*nx + N*nu);
+
+                            REQUIRE(return_value == 0);
+                            REQUIRE(acados_W.isApprox(true_W, TOL_CON_HPIPM));
+                            if (constraint == "CONSTRAINED") {
+                                REQUIRE(iter_warm < iter_cold);
+                            } else {
+                                REQUIRE(iter_warm <= iter_cold);
+                            }
                             std::cout <<"---> PASSED " << std::endl;
                         }
                     }
@@ -253,6 +451,122 @@ TEST_CASE("Solve random OCP_QP", "[QP solvers]") {
                                 // }
                                 REQUIRE(acados_PI.isApprox(true_PI, TOL_HPIPM));
                             }
+
+                            // warm start from the solution in qp_out
+                            int iter_cold = ((ocp_qp_hpipm_memory *) solver->mem)->iter;
+                            ((ocp_qp_hpipm_args *) solver->args)->warm_start = 1;
+                            return_value = solver->fun(solver->qp_in, solver->qp_out, solver->args,
+                                                       solver->mem, solver->work);
+                            int iter_warm = ((ocp_qp_hpipm_memory *) solver->mem)->iter;
+
+                            acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0], (N+1)*nx + N*nu);
+
+                            REQUIRE(return_value == 0);
+                            REQUIRE(acados_W.isApprox(true_W, TOL_HPIPM));
+                            if (constraint == "CONSTRAINED") {
+                                REQUIRE(iter_warm < iter_cold);
+                            } else {
+                                REQUIRE(iter_warm <= iter_cold);
+                            }
+
+                            // write the data directly into the HPIPM structure of the solver
+                            ((ocp_qp_hpipm_args *) solver->args)->warm_start = 0;
+                            struct d_ocp_qp *qp_hpipm = ocp_qp_hpipm_in_attach(solver);
+                            REQUIRE(qp_hpipm != NULL);
+                            write_qp_in_to_hpipm(qp_in, qp_hpipm);
+                            return_value = solver->fun(solver->qp_in, solver->qp_out, solver->args,
+                                                       solver->mem, solver->work);
+
+                            acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0], (N+1)*nx + N*nu);
+
+                            REQUIRE(return_value == 0);
+                            REQUIRE(acados_W.isApprox(true_W, TOL_HPIPM));
+                            std::cout <<"---> PASSED " << std::endl;
+                        }
+                    }
+                    if (TEST_HPIPM_IN) {
+                        SECTION("HPIPM input paths") {
+                            std::cout <<"---> TESTING qp_in and attached HPIPM QP with QP: "<<
+                                scenario << ", " << constraint << std::endl;
+
+                            for (std::string solver_name : {"hpipm", "condensing_hpipm"}) {
+                                // reference solution from qp_in
+                                ocp_qp_solver *solver_ref =
+                                    create_ocp_qp_solver(qp_in, solver_name.c_str(), NULL);
+                                return_value = solver_ref->fun(solver_ref->qp_in,
+                                                               solver_ref->qp_out,
+                                                               solver_ref->args, solver_ref->mem,
+                                                               solver_ref->work);
+                                REQUIRE(return_value == 0);
+
+                                // same QP written through the setters of ocp_qp_hpipm_in.h
+                                ocp_qp_solver *solver =
+                                    create_ocp_qp_solver(qp_in, solver_name.c_str(), NULL);
+                                struct d_ocp_qp *qp_hpipm = ocp_qp_hpipm_in_attach(solver);
+                                REQUIRE(qp_hpipm != NULL);
+                                write_qp_in_to_hpipm(qp_in, qp_hpipm);
+                                return_value = solver->fun(solver->qp_in, solver->qp_out,
+                                                           solver->args, solver->mem,
+                                                           solver->work);
+                                REQUIRE(return_value == 0);
+
+                                VectorXd ref_W = Eigen::Map<VectorXd>(solver_ref->qp_out->x[0],
+                                                                      (N+1)*nx + N*nu);
+                                VectorXd ref_PI = Eigen::Map<VectorXd>(solver_ref->qp_out->pi[0],
+                                                                       N*nx);
+                                acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0],
+                                                                (N+1)*nx + N*nu);
+                                acados_PI = Eigen::Map<VectorXd>(solver->qp_out->pi[0], N*nx);
+
+                                REQUIRE(acados_W.isApprox(ref_W, TOL_HPIPM_IN));
+                                REQUIRE(acados_PI.isApprox(ref_PI, TOL_HPIPM_IN));
+                            }
+                            std::cout <<"---> PASSED " << std::endl;
+                        }
+                    }
+                    if (TEST_PREPARE) {
+                        SECTION("Prepare") {
+                            std::cout <<"---> TESTING prepare and solve with QP: "<< scenario <<
+                                ", " << constraint << std::endl;
+
+                            vector<std::string> names = {"hpipm", "condensing_hpipm"};
+                            vector<real_t> tols = {TOL_HPIPM, TOL_CON_HPIPM};
+                            if (TEST_QPOASES) {
+                                names.push_back("condensing_qpoases");
+                                tols.push_back(TOL_QPOASES);
+                            }
+                            real_t *lb0 = (real_t *) qp_in->lb[0];
+                            real_t *ub0 = (real_t *) qp_in->ub[0];
+                            vector<real_t> lb0_true(lb0, lb0 + qp_in->nb[0]);
+                            vector<real_t> ub0_true(ub0, ub0 + qp_in->nb[0]);
+                            for (size_t k = 0; k < names.size(); k++) {
+                                ocp_qp_solver *solver =
+                                    create_ocp_qp_solver(qp_in, names[k].c_str(), NULL);
+                                REQUIRE(solver->prepare != NULL);
+
+                                // prepare with other bounds on the first stage, only these may
+                                // change before the solve
+                                for (int_t j = 0; j < qp_in->nb[0]; j++) {
+                                    lb0[j] = lb0_true[j] - 1.0;
+                                    ub0[j] = ub0_true[j] + 1.0;
+                                }
+                                return_value = solver->prepare(solver->qp_in, solver->args,
+                                                               solver->mem, solver->work);
+                                REQUIRE(return_value == 0);
+                                for (int_t j = 0; j < qp_in->nb[0]; j++) {
+                                    lb0[j] = lb0_true[j];
+                                    ub0[j] = ub0_true[j];
+                                }
+                                return_value = solver->fun(solver->qp_in, solver->qp_out,
+                                                           solver->args, solver->mem,
+                                                           solver->work);
+
+                                acados_W = Eigen::Map<VectorXd>(solver->qp_out->x[0],
+                                                                (N+1)*nx + N*nu);
+
+                                REQUIRE(return_value == 0);
+                                REQUIRE(acados_W.isApprox(true_W, tols[k]));
+                            }
                             std::cout <<"---> PASSED " << std::endl;
                         }
                     }
@@ -20,6 +20,7 @@
 #include "acados/sim/sim_casadi_wrapper.h"
 #include "acados/sim/sim_common.h"
 #include "acados/sim/sim_erk_integrator.h"
+#include "acados/sim/sim_lifted_irk_integrator.h"
 #include "acados/utils/print.h"
 #include "acados/utils/timing.h"
 #include "acados/utils/types.h"
@@ -70,3 +71,67 @@ void create_ERK_integrator(sim_in* sim_in, sim_out* sim_out, sim_info* info, sim
 
     sim_erk_create_arguments(rk_opts, 4);
 }
+
+// Lifted IRK integrator of the pendulum with the inputs and outputs of
+// create_ERK_integrator, adjoints only with the hessian. Owns these arrays,
+// grad_K for up to max_stages stages, the memory and the workspace.
+// create_arguments sets up opts, which can be changed before create_memory.
+struct lifted_irk_pendulum {
+    int_t NX;
+    int_t NU;
+    sim_in in;
+    sim_out out;
+    sim_info info;
+    sim_RK_opts opts;
+    sim_lifted_irk_memory mem;
+    void *work;
+
+    lifted_irk_pendulum(real_t T, int_t max_stages, bool hessian = false)
+        : NX(4), NU(1), work(NULL) {
+        create_ERK_integrator(&in, &out, &info, &opts, NX, NU, T, hessian);
+        in.sens_adj = hessian;
+        in.grad_K = (real_t*) calloc(max_stages*NX, sizeof(*in.grad_K));
+        out.grad = (real_t*) calloc(NX+NU, sizeof(*out.grad));
+    }
+
+    ~lifted_irk_pendulum() {
+        free_memory();
+        free(in.x);
+        free(in.u);
+        free(in.S_forw);
+        free(in.S_adj);
+        free(in.grad_K);
+        free(out.xn);
+        free(out.S_forw);
+        free(out.S_adj);
+        free(out.grad);
+        if (in.sens_hess) free(out.S_hess);
+    }
+
+    void create_arguments(int_t num_stages, const char *name, Newton_type_collocation type) {
+        sim_irk_create_arguments(&opts, num_stages, name);
+        sim_irk_create_Newton_scheme(&opts, num_stages, name, type);
+    }
+
+    // frees the previous memory and workspace
+    void create_memory() {
+        free_memory();
+        sim_lifted_irk_create_memory(&in, &opts, &mem);
+        work = malloc(sim_lifted_irk_calculate_workspace_size(&in, &opts));
+    }
+
+    void free_memory() {
+        if (work == NULL) return;
+        sim_lifted_irk_free_memory_members(&mem);
+        free(work);
+        work = NULL;
+    }
+
+    // x = 0, u = 0.1
+    void reset_point() {
+        for (int_t i = 0; i < NX; i++) in.x[i] = 0.0;
+        in.u[0] = 0.1;
+    }
+
+    int_t integrate() { return sim_lifted_irk(&in, &out, &opts, &mem, work); }
+};
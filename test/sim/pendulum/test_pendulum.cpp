@@ -17,14 +17,22 @@
  *
  */
 
+#include <vector>
+
 #include "catch/include/catch.hpp"
 
+#include "acados/sim/sim_collocation.h"
+#include "acados/sim/sim_discrete_model.h"
 #include "acados/sim/sim_erk_integrator.h"
+#include "acados/sim/sim_exact_linear.h"
+#include "acados/sim/sim_implicit_irk_integrator.h"
+#include "acados/sim/sim_lifted_irk_integrator.h"
 #include "acados/utils/print.h"
 #include "acados/utils/timing.h"
 #include "acados/utils/types.h"
 #include "test/sim/pendulum/pendulum_helper.cpp"
 #include "test/test_utils/eigen.h"
+#include "test/test_utils/malloc_count.h"
 
 extern real_t COMPARISON_TOLERANCE;
 real_t COMPARISON_TOLERANCE_FD = 1e-5;
@@ -137,3 +145,1164 @@ TEST_CASE("ERK simulation with adjoint sensitivities", "[simulation]") {
         REQUIRE(test_hess.isApprox(FD_hess, COMPARISON_TOLERANCE_FD));
     }
 }
+
+TEST_CASE("Lifted IRK simulation without heap allocations", "[simulation]") {
+    int_t num_stages = 2;
+    lifted_irk_pendulum p(0.5, num_stages);
+
+    for (auto type : {exact, simplified_in}) {
+        for (int_t la_blasfeo = 0; la_blasfeo < 2; la_blasfeo++) {
+            p.create_arguments(num_stages, "Gauss", type);
+            p.opts.la_blasfeo = la_blasfeo;
+            p.create_memory();
+            p.reset_point();
+
+            long allocations = malloc_count();
+            for (int_t k = 0; k < 3; k++)
+                REQUIRE(p.integrate() == 0);
+            if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+        }
+    }
+}
+
+TEST_CASE("Lifted IRK simulation with BLASFEO linear algebra", "[simulation]") {
+    int_t num_stages = 2;
+    lifted_irk_pendulum p(0.5, num_stages);
+    int_t NX = p.NX, NU = p.NU;
+
+    for (auto type : {exact, simplified_in}) {
+        VectorXd xn[2];
+        MatrixXd S_forw[2];
+        for (int_t la_blasfeo = 0; la_blasfeo < 2; la_blasfeo++) {
+            p.create_arguments(num_stages, "Gauss", type);
+            p.opts.la_blasfeo = la_blasfeo;
+            p.create_memory();
+            p.reset_point();
+
+            for (int_t k = 0; k < 3; k++)
+                REQUIRE(p.integrate() == 0);
+            xn[la_blasfeo] = Eigen::Map<VectorXd>(p.out.xn, NX);
+            S_forw[la_blasfeo] = Eigen::Map<MatrixXd>(p.out.S_forw, NX, NX+NU);
+        }
+        REQUIRE(xn[1].isApprox(xn[0], 1e-10));
+        REQUIRE(S_forw[1].isApprox(S_forw[0], 1e-10));
+    }
+}
+
+TEST_CASE("Lifted IRK simulation with parallel subsystems", "[simulation]") {
+    int_t num_stages = 5;  // two complex conjugate pairs and one real eigenvalue
+    lifted_irk_pendulum p(0.5, num_stages);
+    int_t NX = p.NX, NU = p.NU;
+
+    VectorXd xn[2];
+    MatrixXd S_forw[2];
+    int_t num_threads[2] = {1, 3};
+    for (int_t k = 0; k < 2; k++) {
+        p.create_arguments(num_stages, "Gauss", simplified_in);
+        p.opts.num_threads = num_threads[k];
+        p.create_memory();
+        p.reset_point();
+
+        for (int_t it = 0; it < 3; it++)
+            REQUIRE(p.integrate() == 0);
+        xn[k] = Eigen::Map<VectorXd>(p.out.xn, NX);
+        S_forw[k] = Eigen::Map<MatrixXd>(p.out.S_forw, NX, NX+NU);
+    }
+    // the subsystems are independent, so the results do not depend on the threads
+    REQUIRE(xn[1] == xn[0]);
+    REQUIRE(S_forw[1] == S_forw[0]);
+}
+
+TEST_CASE("Lifted IRK simulation with directional sensitivities", "[simulation]") {
+    int_t num_stages = 2;
+    lifted_irk_pendulum p(0.5, num_stages);
+    int_t NX = p.NX, NU = p.NU;
+
+    // directions in the states only, the controls are seeded in the last NU
+    MatrixXd x_dirs(NX, 2);
+    x_dirs << 1.0, 0.5,
+              0.0, -1.0,
+              2.0, 0.0,
+              0.0, 0.3;
+
+    for (auto type : {exact, simplified_in, simplified_inis}) {
+        for (int_t num_x_dirs : {0, 2}) {
+            int_t NF = num_x_dirs + NU;
+            // seeds of the states and controls
+            MatrixXd seed = MatrixXd::Zero(NX+NU, NF);
+            seed.topLeftCorner(NX, num_x_dirs) = x_dirs.leftCols(num_x_dirs);
+            seed.bottomRightCorner(NU, NU) = MatrixXd::Identity(NU, NU);
+
+            VectorXd xn[2];
+            MatrixXd S_forw[2];
+            for (int_t k = 0; k < 2; k++) {
+                p.in.num_forw_sens = (k == 0) ? NX+NU : NF;
+                MatrixXd S_forw_in = MatrixXd::Identity(NX, NX+NU);
+                if (k == 1) S_forw_in = seed.topRows(NX);
+                Eigen::Map<MatrixXd>(p.in.S_forw, NX, p.in.num_forw_sens) = S_forw_in;
+
+                p.create_arguments(num_stages, "Gauss", type);
+                p.create_memory();
+                p.reset_point();
+
+                for (int_t it = 0; it < 3; it++)
+                    REQUIRE(p.integrate() == 0);
+                xn[k] = Eigen::Map<VectorXd>(p.out.xn, NX);
+                S_forw[k] = Eigen::Map<MatrixXd>(p.out.S_forw, NX, p.in.num_forw_sens);
+            }
+            // the (lifted) sensitivities are linear in the seeds
+            REQUIRE(xn[1].isApprox(xn[0], 1e-14));
+            REQUIRE(S_forw[1].isApprox(S_forw[0] * seed, 1e-12));
+        }
+    }
+
+    // fewer directions than controls are not supported
+    p.in.num_forw_sens = 0;
+    REQUIRE(sim_lifted_irk(&p.in, &p.out, &p.opts, NULL, NULL) == -1);
+    p.in.num_forw_sens = NX+NU;
+}
+
+TEST_CASE("Matrix-free lifted IRK simulation", "[simulation]") {
+    int_t num_stages = 2;
+    lifted_irk_pendulum p(0.5, num_stages);
+    int_t NX = p.NX, NU = p.NU;
+
+    for (int_t NF : {NX+NU, NU}) {
+        VectorXd xn[2];
+        MatrixXd S_forw[2];
+        for (int_t matrix_free = 0; matrix_free < 2; matrix_free++) {
+            p.in.num_forw_sens = NF;
+            Eigen::Map<MatrixXd>(p.in.S_forw, NX, NF) = MatrixXd::Identity(NX, NX+NU).leftCols(NF);
+            if (NF == NU) Eigen::Map<MatrixXd>(p.in.S_forw, NX, NF).setZero();
+
+            p.create_arguments(num_stages, "Gauss", exact);
+            p.opts.matrix_free = matrix_free;
+            p.create_memory();
+            p.reset_point();
+
+            long allocations = malloc_count();
+            for (int_t it = 0; it < 3; it++)
+                REQUIRE(p.integrate() == 0);
+            if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+            REQUIRE((p.out.info->num_krylov_iter > 0) == (matrix_free == 1));
+            xn[matrix_free] = Eigen::Map<VectorXd>(p.out.xn, NX);
+            S_forw[matrix_free] = Eigen::Map<MatrixXd>(p.out.S_forw, NX, NF);
+        }
+        REQUIRE(xn[1].isApprox(xn[0], 1e-8));
+        REQUIRE(S_forw[1].isApprox(S_forw[0], 1e-8));
+    }
+    p.in.num_forw_sens = NX+NU;
+    Eigen::Map<MatrixXd>(p.in.S_forw, NX, NX+NU) = MatrixXd::Identity(NX, NX+NU);
+
+    // GMRES stopped before the tolerance
+    p.create_arguments(num_stages, "Gauss", exact);
+    p.opts.matrix_free = true;
+    p.opts.krylov_max_iter = 1;
+    p.opts.krylov_tol = 1e-14;
+    p.create_memory();
+    p.reset_point();
+    REQUIRE(p.integrate() == ACADOS_MAXITER);
+}
+
+// df/dx = 2/h*I with the step h = 0.125
+static void singular_jac_fun(const int_t nx, const real_t *in, real_t *out,
+                             casadi_function_t jac) {
+    jac_fun(nx, in, out, jac);
+    for (int_t j = 0; j < nx; j++)
+        for (int_t i = 0; i < nx; i++)
+            out[nx + j * nx + i] = (i == j) ? 16.0 : 0.0;
+}
+
+// df/dx = 16*(I - M) with the nearly singular M = [1 1; 1 1+1e-13] in the first
+// two states and M = I in the others
+static void nearly_singular_jac_fun(const int_t nx, const real_t *in, real_t *out,
+                                    casadi_function_t jac) {
+    jac_fun(nx, in, out, jac);
+    for (int_t j = 0; j < nx; j++)
+        for (int_t i = 0; i < nx; i++) out[nx + j * nx + i] = 0.0;
+    out[nx + 1] = -16.0;
+    out[nx + nx] = -16.0;
+    out[nx + nx + 1] = -16.0 * 1e-13;
+}
+
+TEST_CASE("Lifted IRK simulation with a sparse Newton matrix", "[simulation]") {
+    int_t num_stages = 3;
+    lifted_irk_pendulum p(0.5, num_stages);
+    int_t NX = p.NX, NU = p.NU;
+
+    // structural nonzeros of df/dx at a generic point, in the CasADi format
+    real_t jac_in[] = {0.3, 0.7, -0.2, 0.4, 0.9};
+    real_t jac_out[4 * (4 + 1)];
+    p.in.jacobian_wrapper(NX, jac_in, jac_out, p.in.jac);
+    std::vector<int_t> sparsity = {NX, NX};
+    std::vector<int_t> rows;
+    for (int_t j = 0; j < NX; j++) {
+        sparsity.push_back(rows.size());
+        for (int_t i = 0; i < NX; i++)
+            if (jac_out[NX + j * NX + i] != 0.0) rows.push_back(i);
+    }
+    sparsity.push_back(rows.size());
+    sparsity.insert(sparsity.end(), rows.begin(), rows.end());
+    REQUIRE(rows.size() < (size_t) (NX * NX));
+
+    VectorXd xn[2];
+    MatrixXd S_forw[2];
+    for (int_t sparse = 0; sparse < 2; sparse++) {
+        p.create_arguments(num_stages, "Gauss", exact);
+        p.opts.la_blasfeo = 0;
+        p.opts.jac_sparsity = sparse ? sparsity.data() : NULL;
+        p.create_memory();
+        p.reset_point();
+
+        long allocations = malloc_count();
+        for (int_t it = 0; it < 3; it++)
+            REQUIRE(p.integrate() == 0);
+        if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+        xn[sparse] = Eigen::Map<VectorXd>(p.out.xn, NX);
+        S_forw[sparse] = Eigen::Map<MatrixXd>(p.out.S_forw, NX, NX+NU);
+
+        // the fill-in of the ordering stays within the dense matrix of all stages
+        if (sparse) REQUIRE(p.mem.sparse_lu.nnz < num_stages * NX * num_stages * NX);
+    }
+    REQUIRE(xn[1].isApprox(xn[0], 1e-12));
+    REQUIRE(S_forw[1].isApprox(S_forw[0], 1e-12));
+
+    // the implicit midpoint rule with df/dx = 2/h*I has a zero Newton matrix
+    std::vector<int_t> dense_sparsity = {NX, NX};
+    for (int_t j = 0; j <= NX; j++) dense_sparsity.push_back(j * NX);
+    for (int_t j = 0; j < NX; j++)
+        for (int_t i = 0; i < NX; i++) dense_sparsity.push_back(i);
+    p.in.num_steps = 4;
+    p.in.step = 0.125;
+    p.in.jacobian_wrapper = &singular_jac_fun;
+
+    p.create_arguments(1, "Gauss", exact);
+    p.opts.jac_sparsity = dense_sparsity.data();
+    p.create_memory();
+    REQUIRE(p.integrate() == -1);
+
+    // and a pivot that cancels to 1e-13 relative to its column
+    p.in.jacobian_wrapper = &nearly_singular_jac_fun;
+    REQUIRE(p.integrate() == -1);
+}
+
+TEST_CASE("Lifted IRK simulation with second order sensitivities", "[simulation]") {
+    int_t num_stages = 2;
+    int_t num_iter = 20;  // the lifted Newton iterations converge
+    lifted_irk_pendulum p(0.5, num_stages, true);
+    int_t NX = p.NX, NU = p.NU;
+
+    VectorXd seed(NX+NU);
+    seed << 1.0, 1.0, 1.0, 1.0, 0.0;
+    Eigen::Map<VectorXd>(p.in.S_adj, NX+NU) = seed;
+    std::vector<int_t> dense_sparsity = {NX, NX, 1};
+
+    // gradient of seed'*xn from the forward sensitivities of a fresh memory
+    auto forward_adjoint = [&](int_t s, real_t eps) {
+        p.create_memory();
+        p.reset_point();
+        if (s < NX) p.in.x[s] += eps;
+        else
+            p.in.u[s-NX] += eps;
+        for (int_t it = 0; it < num_iter; it++)
+            REQUIRE(p.integrate() == 0);
+        MatrixXd S_forw = Eigen::Map<MatrixXd>(p.out.S_forw, NX, NX+NU);
+        VectorXd adj = S_forw.transpose() * seed.head(NX);
+        return adj;
+    };
+
+    // triple loops, BLASFEO and the sparse LU
+    for (int_t la = 0; la < 3; la++) {
+        p.create_arguments(num_stages, "Gauss", exact);
+        p.opts.la_blasfeo = (la == 1);
+        p.opts.jac_sparsity = (la == 2) ? dense_sparsity.data() : NULL;
+
+        VectorXd adj = forward_adjoint(0, 0.0);
+        VectorXd S_adj = Eigen::Map<VectorXd>(p.out.S_adj, NX+NU);
+        MatrixXd hess = MatrixXd::Zero(NX+NU, NX+NU);
+        for (int_t j = 0, index = 0; j < NX+NU; j++)
+            for (int_t i = j; i < NX+NU; i++, index++)
+                hess(i, j) = hess(j, i) = p.out.S_hess[index];
+
+        MatrixXd hess_FD(NX+NU, NX+NU);
+        for (int_t s = 0; s < NX+NU; s++)
+            hess_FD.col(s) = (forward_adjoint(s, FD_EPS) - adj) / FD_EPS;
+
+        REQUIRE(S_adj.isApprox(adj, 1e-10));
+        REQUIRE(hess.isApprox(hess_FD, COMPARISON_TOLERANCE_FD));
+    }
+
+    // the adjoint sweep needs the factorized matrices of all directions
+    p.in.num_forw_sens = NU;
+    REQUIRE(sim_lifted_irk(&p.in, &p.out, &p.opts, NULL, NULL) == -1);
+    p.in.num_forw_sens = NX+NU;
+}
+
+TEST_CASE("Lifted IRK simulation after a shift of the horizon", "[simulation]") {
+    int_t num_stages = 2;
+    lifted_irk_pendulum p(0.1, num_stages);
+    int_t NX = p.NX;
+
+    for (auto type : {exact, simplified_in, simplified_inis}) {
+        // two consecutive intervals, the first in the fixture, and a cold one
+        sim_lifted_irk_memory next_mem, cold_mem;
+        p.create_arguments(num_stages, "Gauss", type);
+        p.create_memory();
+        sim_lifted_irk_create_memory(&p.in, &p.opts, &next_mem);
+        sim_lifted_irk_create_memory(&p.in, &p.opts, &cold_mem);
+        sim_lifted_irk_memory *irk_mem[3] = {&p.mem, &next_mem, &cold_mem};
+
+        // converged trajectory over the first two intervals
+        VectorXd x1, x2;
+        p.reset_point();
+        p.in.x[1] = 0.5;
+        for (int_t it = 0; it < 20; it++)
+            sim_lifted_irk(&p.in, &p.out, &p.opts, irk_mem[0], p.work);
+        x1 = Eigen::Map<VectorXd>(p.out.xn, NX);
+        Eigen::Map<VectorXd>(p.in.x, NX) = x1;
+        for (int_t it = 0; it < 20; it++)
+            sim_lifted_irk(&p.in, &p.out, &p.opts, irk_mem[1], p.work);
+        x2 = Eigen::Map<VectorXd>(p.out.xn, NX);
+
+        // after the shift, the first interval starts from x1
+        sim_lifted_irk_shift_memory(&p.in, &p.opts, irk_mem[0], irk_mem[1]);
+        real_t error[2];
+        for (int_t k = 0; k < 2; k++) {
+            REQUIRE(sim_lifted_irk(&p.in, &p.out, &p.opts, irk_mem[2*k], p.work) == 0);
+            error[k] = (Eigen::Map<VectorXd>(p.out.xn, NX) - x2).norm();
+        }
+        // warm start: one iteration is as good as a converged one
+        REQUIRE(error[0] < 1e-12);
+        REQUIRE(error[0] < 1e-6 * error[1]);
+
+        sim_lifted_irk_free_memory_members(&next_mem);
+        sim_lifted_irk_free_memory_members(&cold_mem);
+    }
+}
+
+TEST_CASE("Tabulated Gauss-Legendre methods", "[simulation]") {
+    for (int_t num_stages = 1; num_stages <= GAUSS_MAX_STAGES; num_stages++) {
+        const collocation_table *table = get_Gauss_table(num_stages);
+        REQUIRE(table != NULL);
+
+        VectorXd c = Eigen::Map<const VectorXd>(table->c, num_stages);
+        VectorXd b = Eigen::Map<const VectorXd>(table->b, num_stages);
+        MatrixXd A = Eigen::Map<const MatrixXd>(table->A, num_stages, num_stages);
+
+        // Butcher table and weights follow from the nodes, the Vandermonde solve of
+        // create_Butcher_table loses too many digits for the larger methods
+        if (num_stages <= 8) {
+            VectorXd b_nodes(num_stages);
+            MatrixXd A_nodes(num_stages, num_stages);
+            create_Butcher_table(num_stages, table->c, b_nodes.data(), A_nodes.data());
+            REQUIRE(b_nodes.isApprox(b, 1e-10));
+            REQUIRE(A_nodes.isApprox(A, 1e-10));
+        }
+
+        // order conditions B(2s) and C(s) to round-off
+        for (int_t k = 1; k <= 2*num_stages; k++) {
+            VectorXd ck = c.array().pow(k-1).matrix();
+            REQUIRE(std::abs(b.dot(ck) - 1.0/k) < 1e-14);
+            if (k <= num_stages)
+                REQUIRE((A*ck - c.array().pow(k).matrix()/k).cwiseAbs().maxCoeff() < 1e-14);
+        }
+
+        // transf2*transf1 is the inverse of A
+        if (num_stages > 1) {
+            MatrixXd T1 = Eigen::Map<const MatrixXd>(table->transf1, num_stages, num_stages);
+            MatrixXd T2 = Eigen::Map<const MatrixXd>(table->transf2, num_stages, num_stages);
+            MatrixXd I = MatrixXd::Identity(num_stages, num_stages);
+            REQUIRE((A*T2*T1).isApprox(I, 1e-8));
+        }
+    }
+    REQUIRE(get_Gauss_table(GAUSS_MAX_STAGES + 1) == NULL);
+}
+
+TEST_CASE("Tabulated Radau IIA methods", "[simulation]") {
+    for (int_t num_stages = 1; num_stages <= RADAU_MAX_STAGES; num_stages++) {
+        const collocation_table *table = get_Radau_table(num_stages);
+        REQUIRE(table != NULL);
+        REQUIRE(table->c[num_stages-1] == 1.0);
+
+        // collocation conditions B(s) and C(s), the Vandermonde solve of create_Butcher_table
+        // loses too many digits for the larger methods
+        VectorXd c = Eigen::Map<const VectorXd>(table->c, num_stages);
+        VectorXd b = Eigen::Map<const VectorXd>(table->b, num_stages);
+        MatrixXd A = Eigen::Map<const MatrixXd>(table->A, num_stages, num_stages);
+        for (int_t k = 1; k <= num_stages; k++) {
+            VectorXd ck = c.array().pow(k-1).matrix();
+            REQUIRE(b.dot(ck) == Approx(1.0/k));
+            REQUIRE((A*ck).isApprox(c.array().pow(k).matrix()/k, 1e-10));
+        }
+
+        // stiffly accurate: the last stage is the end point
+        REQUIRE(A.row(num_stages-1).transpose().isApprox(b, 1e-10));
+
+        // transf2*transf1 is the inverse of A
+        if (num_stages > 1) {
+            MatrixXd T1 = Eigen::Map<const MatrixXd>(table->transf1, num_stages, num_stages);
+            MatrixXd T2 = Eigen::Map<const MatrixXd>(table->transf2, num_stages, num_stages);
+            MatrixXd I = MatrixXd::Identity(num_stages, num_stages);
+            REQUIRE((A*T2*T1).isApprox(I, 1e-8));
+        }
+    }
+    REQUIRE(get_Radau_table(RADAU_MAX_STAGES + 1) == NULL);
+}
+
+TEST_CASE("Lifted IRK simulation with Radau IIA", "[simulation]") {
+    int_t NX = 4;
+    int_t NU = 1;
+    real_t T = 0.5;
+    int_t num_stages = 3;
+
+    sim_in  ref_in;
+    sim_out ref_out;
+    sim_info ref_info;
+    sim_RK_opts ref_opts;
+
+    // reference: RK4 with many fixed steps
+    create_ERK_integrator(&ref_in, &ref_out, &ref_info, &ref_opts, NX, NU, T, false);
+    ref_in.num_steps = 1000;
+    ref_in.step = T/ref_in.num_steps;
+    ref_in.sens_adj = false;
+    void *ref_work = malloc(sim_erk_calculate_workspace_size(&ref_in, &ref_opts));
+    for (int_t i = 0; i < NX; i++) ref_in.x[i] = 0.0;
+    ref_in.u[0] = 0.1;
+    REQUIRE(sim_erk(&ref_in, &ref_out, &ref_opts, 0, ref_work) == 0);
+    VectorXd ref_xn = Eigen::Map<VectorXd>(ref_out.xn, NX);
+
+    lifted_irk_pendulum p(T, num_stages);
+    for (auto type : {exact, simplified_in}) {
+        p.create_arguments(num_stages, "Radau", type);
+        p.create_memory();
+        p.reset_point();
+
+        // the lifted integrator performs one Newton iteration per call
+        for (int_t k = 0; k < 10; k++)
+            REQUIRE(p.integrate() == 0);
+
+        VectorXd xn = Eigen::Map<VectorXd>(p.out.xn, NX);
+        REQUIRE(xn.isApprox(ref_xn, COMPARISON_TOLERANCE_FD));
+    }
+    free(ref_work);
+}
+
+// forward VDE and Jacobian that count their evaluations
+static int_t num_vde_evaluations = 0;
+static int_t num_jac_evaluations = 0;
+static void counting_vde_fun(const int_t nx, const int_t nu, const real_t *in, real_t *out,
+                             casadi_function_t vde) {
+    num_vde_evaluations++;
+    vde_fun(nx, nu, in, out, vde);
+}
+static void counting_jac_fun(const int_t nx, const real_t *in, real_t *out,
+                             casadi_function_t jac) {
+    num_jac_evaluations++;
+    jac_fun(nx, in, out, jac);
+}
+
+TEST_CASE("ERK simulation with step size control", "[simulation]") {
+    int_t NX = 4;
+    int_t NU = 1;
+    real_t T = 0.5;
+
+    sim_in  sim_in, ref_in;
+    sim_out sim_out, ref_out;
+    sim_info info, ref_info;
+    sim_RK_opts rk_opts, ref_opts;
+
+    // reference: RK4 with many fixed steps
+    create_ERK_integrator(&ref_in, &ref_out, &ref_info, &ref_opts, NX, NU, T, false);
+    ref_in.num_steps = 1000;
+    ref_in.step = T/ref_in.num_steps;
+    void *ref_work = malloc(sim_erk_calculate_workspace_size(&ref_in, &ref_opts));
+
+    // Dormand-Prince 5(4), the initial step is the whole interval
+    create_ERK_integrator(&sim_in, &sim_out, &info, &rk_opts, NX, NU, T, false);
+    sim_erk_create_arguments(&rk_opts, 7);
+    sim_in.num_steps = 1;
+    sim_in.step = T;
+    sim_in.forward_vde_wrapper = &counting_vde_fun;
+    sim_in.jacobian_wrapper = &counting_jac_fun;
+    void *erk_work = malloc(sim_erk_calculate_workspace_size(&sim_in, &rk_opts));
+
+    for (int_t i = 0; i < NX; i++) sim_in.x[i] = ref_in.x[i] = 0.0;
+    sim_in.u[0] = ref_in.u[0] = 0.1;
+    for (int_t i = 0; i < NX; i++) sim_in.S_adj[i] = ref_in.S_adj[i] = 1.0;
+    for (int_t i = 0; i < NU; i++) sim_in.S_adj[NX+i] = ref_in.S_adj[NX+i] = 0.0;
+
+    REQUIRE(sim_erk(&ref_in, &ref_out, &ref_opts, 0, ref_work) == 0);
+    num_vde_evaluations = 0;
+    num_jac_evaluations = 0;
+    REQUIRE(sim_erk(&sim_in, &sim_out, &rk_opts, 0, erk_work) == 0);
+
+    REQUIRE(info.num_steps > 1);
+    REQUIRE(info.num_steps < ref_info.num_steps);
+
+    // one VDE evaluation per stage of every attempted step, the last stage is
+    // the first stage of the next attempt
+    REQUIRE(info.num_rejected_steps > 0);
+    REQUIRE(num_vde_evaluations == 7 + 6 * (info.num_steps + info.num_rejected_steps - 1));
+    REQUIRE(num_jac_evaluations == 0);
+
+    VectorXd xn = Eigen::Map<VectorXd>(sim_out.xn, NX);
+    VectorXd ref_xn = Eigen::Map<VectorXd>(ref_out.xn, NX);
+    MatrixXd S_forw = Eigen::Map<MatrixXd>(sim_out.S_forw, NX, NX+NU);
+    MatrixXd ref_S_forw = Eigen::Map<MatrixXd>(ref_out.S_forw, NX, NX+NU);
+    REQUIRE(xn.isApprox(ref_xn, COMPARISON_TOLERANCE_FD));
+    REQUIRE(S_forw.isApprox(ref_S_forw, COMPARISON_TOLERANCE_FD));
+
+    // the adjoint sweep goes through the same steps as the forward sweep
+    VectorXd seed = Eigen::Map<VectorXd>(sim_in.S_adj, NX);
+    VectorXd adj = Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU);
+    REQUIRE(adj.isApprox(S_forw.transpose()*seed, 1e-12));
+
+    free(ref_work);
+    free(erk_work);
+}
+
+TEST_CASE("ERK simulation with adjoint checkpointing", "[simulation]") {
+    int_t NX = 4;
+    int_t NU = 1;
+    real_t T = 0.5;
+    int_t nhess = (NX+NU+1)*(NX+NU)/2;
+
+    for (bool hessian : {false, true}) {
+        sim_in  sim_in;
+        sim_out sim_out;
+        sim_info info;
+        sim_RK_opts rk_opts;
+
+        create_ERK_integrator(&sim_in, &sim_out, &info, &rk_opts, NX, NU, T, hessian);
+        sim_in.num_steps = 50;
+        sim_in.step = T/sim_in.num_steps;
+        for (int_t i = 0; i < NX; i++) sim_in.x[i] = 0.0;
+        sim_in.u[0] = 0.1;
+        for (int_t i = 0; i < NX; i++) sim_in.S_adj[i] = 1.0;
+        for (int_t i = 0; i < NU; i++) sim_in.S_adj[NX+i] = 0.0;
+
+        // whole trajectory stored
+        int_t full_size = sim_erk_calculate_workspace_size(&sim_in, &rk_opts);
+        void *erk_work = malloc(full_size);
+        REQUIRE(sim_erk(&sim_in, &sim_out, &rk_opts, 0, erk_work) == 0);
+        REQUIRE(info.num_recomputed_steps == 0);
+        VectorXd ref_adj = Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU);
+        VectorXd ref_hess(nhess);
+        if (hessian) ref_hess = Eigen::Map<VectorXd>(sim_out.S_hess, nhess);
+        free(erk_work);
+
+        // checkpoints, the recomputed stages are identical to the stored ones
+        rk_opts.adj_traj_budget = 8192;
+        int_t checkpoint_size = sim_erk_calculate_workspace_size(&sim_in, &rk_opts);
+        REQUIRE(checkpoint_size < full_size);
+        erk_work = malloc(checkpoint_size);
+        REQUIRE(sim_erk(&sim_in, &sim_out, &rk_opts, 0, erk_work) == 0);
+        REQUIRE(info.num_recomputed_steps > 0);
+        REQUIRE(info.num_recomputed_steps < sim_in.num_steps);
+        REQUIRE(Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU) == ref_adj);
+        if (hessian) REQUIRE(Eigen::Map<VectorXd>(sim_out.S_hess, nhess) == ref_hess);
+        free(erk_work);
+    }
+}
+
+TEST_CASE("ERK simulation with tabulated methods", "[simulation]") {
+    int_t NX = 4;
+    int_t NU = 1;
+    real_t T = 1.0;
+
+    REQUIRE(get_ERK_table("unknown") == NULL);
+
+    sim_in  sim_in;
+    sim_out sim_out;
+    sim_info info;
+    sim_RK_opts rk_opts;
+    create_ERK_integrator(&sim_in, &sim_out, &info, &rk_opts, NX, NU, T, false);
+    REQUIRE(sim_erk_create_arguments_by_name(&rk_opts, "unknown") == -1);
+
+    // number of steps of the coarsest grid, fine enough for the asymptotic
+    // order and coarse enough to stay above round-off on the finest grid
+    const char *names[] = {"Euler", "Heun", "RK3", "SSPRK3", "BS3", "RK4", "DOPRI5", "RK6", "RK8"};
+    const int_t num_steps[] = {64, 32, 32, 32, 32, 16, 64, 8, 4};
+
+    for (int_t m = 0; m < 9; m++) {
+        SECTION(names[m]) {
+            const erk_table *table = get_ERK_table(names[m]);
+            REQUIRE(table != NULL);
+            REQUIRE(sim_erk_create_arguments_by_name(&rk_opts, names[m]) == 0);
+            REQUIRE(rk_opts.num_stages == table->num_stages);
+            // the order is observed with fixed steps
+            free(rk_opts.b_hat);
+            rk_opts.b_hat = NULL;
+
+            for (int_t i = 0; i < NX; i++) sim_in.x[i] = 0.0;
+            sim_in.x[1] = 3.0;
+            sim_in.u[0] = 0.1;
+            for (int_t i = 0; i < NX; i++) sim_in.S_adj[i] = 1.0;
+            for (int_t i = 0; i < NU; i++) sim_in.S_adj[NX+i] = 0.0;
+
+            // results on three grids, each refined by a factor of two
+            VectorXd xn[3];
+            for (int_t k = 0; k < 3; k++) {
+                sim_in.num_steps = num_steps[m] << k;
+                sim_in.step = T/sim_in.num_steps;
+                void *erk_work = malloc(sim_erk_calculate_workspace_size(&sim_in, &rk_opts));
+                REQUIRE(sim_erk(&sim_in, &sim_out, &rk_opts, 0, erk_work) == 0);
+                xn[k] = Eigen::Map<VectorXd>(sim_out.xn, NX);
+
+                // the adjoint sweep differentiates the same discrete map
+                MatrixXd S_forw = Eigen::Map<MatrixXd>(sim_out.S_forw, NX, NX+NU);
+                VectorXd seed = Eigen::Map<VectorXd>(sim_in.S_adj, NX);
+                VectorXd adj = Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU);
+                REQUIRE(adj.isApprox(S_forw.transpose()*seed, 1e-12));
+                free(erk_work);
+            }
+
+            real_t order = log2((xn[0]-xn[1]).norm() / (xn[1]-xn[2]).norm());
+            REQUIRE(order == Approx(table->order).epsilon(0.1));
+        }
+    }
+}
+
+TEST_CASE("ERK workspace initialization keeps the arguments", "[simulation]") {
+    int_t NX = 4;
+    int_t NU = 1;
+    real_t T = 1.0;
+
+    sim_in  sim_in;
+    sim_out sim_out;
+    sim_info info;
+    sim_RK_opts rk_opts;
+    create_ERK_integrator(&sim_in, &sim_out, &info, &rk_opts, NX, NU, T, false);
+
+    const char *names[] = {"SSPRK3", "BS3", "RK6", "RK8"};
+    for (int_t m = 0; m < 4; m++) {
+        REQUIRE(sim_erk_create_arguments_by_name(&rk_opts, names[m]) == 0);
+        rk_opts.abs_tol = 1e-10;
+        rk_opts.rel_tol = 1e-9;
+        rk_opts.max_num_steps = 500;
+        rk_opts.adj_traj_budget = 2;
+        real_t *A_mat = rk_opts.A_mat;
+
+        void *erk_work = NULL;
+        sim_erk_initialize_workspace(&sim_in, &rk_opts, &erk_work);
+        REQUIRE(erk_work != NULL);
+        REQUIRE(rk_opts.A_mat == A_mat);
+        REQUIRE(rk_opts.num_stages == get_ERK_table(names[m])->num_stages);
+        REQUIRE(rk_opts.abs_tol == 1e-10);
+        REQUIRE(rk_opts.rel_tol == 1e-9);
+        REQUIRE(rk_opts.max_num_steps == 500);
+        REQUIRE(rk_opts.adj_traj_budget == 2);
+        sim_erk_destroy(erk_work);
+    }
+
+    // sim_erk_initialize creates the default tableau for the number of stages
+    REQUIRE(sim_erk_create_arguments_by_name(&rk_opts, "SSPRK3") == 0);
+    void *erk_work = NULL;
+    sim_erk_initialize(&sim_in, &rk_opts, &erk_work);
+    REQUIRE(erk_work != NULL);
+    const erk_table *rk3 = get_ERK_table("RK3");
+    REQUIRE(rk_opts.num_stages == rk3->num_stages);
+    for (int_t i = 0; i < rk3->num_stages * rk3->num_stages; i++)
+        REQUIRE(rk_opts.A_mat[i] == rk3->A[i]);
+    sim_erk_destroy(erk_work);
+}
+
+// Pendulum discretized with one explicit Euler step, with the CasADi signature
+// of a discrete model: xn = f(x, u) and its Jacobian df/d(x,u)
+static int discrete_pendulum(const real_t **arg, real_t **res, int *iw, real_t *w, int mem) {
+    (void)iw;
+    (void)w;
+    (void)mem;
+    const real_t h = 0.1;
+    const real_t *x = arg[0], *u = arg[1];
+    res[0][0] = x[0] + h * x[1];
+    res[0][1] = x[1] + h * (-sin(x[0]) + u[0]);
+    if (res[1] != NULL) {
+        real_t jac[] = {1.0, -h * cos(x[0]), h, 1.0, 0.0, h};
+        for (int i = 0; i < 6; i++) res[1][i] = jac[i];
+    }
+    return 0;
+}
+
+TEST_CASE("Discrete model simulation", "[simulation]") {
+    int_t NX = 2;
+    int_t NU = 1;
+
+    sim_in  sim_in;
+    sim_out sim_out;
+    sim_info info;
+
+    real_t x[] = {0.5, -0.2}, u[] = {0.3}, seed[] = {1.0, 2.0, 0.5};
+    sim_in.nx = NX;
+    sim_in.nu = NU;
+    sim_in.x = x;
+    sim_in.u = u;
+    sim_in.S_adj = seed;
+    sim_in.sens_forw = true;
+    sim_in.sens_adj = true;
+    sim_in.sens_hess = false;
+    sim_in.num_forw_sens = NX+NU;
+    sim_in.discrete_model = discrete_pendulum;
+
+    sim_out.xn = (real_t*) calloc(NX, sizeof(*sim_out.xn));
+    sim_out.S_forw = (real_t*) calloc(NX*(NX+NU), sizeof(*sim_out.S_forw));
+    sim_out.S_adj = (real_t*) calloc(NX+NU, sizeof(*sim_out.S_adj));
+    sim_out.info = &info;
+
+    void *work = malloc(sim_discrete_model_calculate_workspace_size(&sim_in, NULL));
+    long allocations = malloc_count();
+    REQUIRE(sim_discrete_model(&sim_in, &sim_out, NULL, NULL, work) == 0);
+    if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+
+    VectorXd xn = Eigen::Map<VectorXd>(sim_out.xn, NX);
+    MatrixXd S_forw = Eigen::Map<MatrixXd>(sim_out.S_forw, NX, NX+NU);
+    VectorXd adj = Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU);
+
+    SECTION("Sensitivities") {
+        // forward sensitivities by finite differences
+        real_t xu[] = {x[0], x[1], u[0]}, xn_fd[2];
+        real_t *res[] = {xn_fd, NULL};
+        const real_t *arg[] = {xu, xu+NX};
+        MatrixXd S_forw_fd(NX, NX+NU);
+        for (int_t j = 0; j < NX+NU; j++) {
+            xu[j] += FD_EPS;
+            discrete_pendulum(arg, res, NULL, NULL, 0);
+            xu[j] -= FD_EPS;
+            S_forw_fd.col(j) = (Eigen::Map<VectorXd>(xn_fd, NX) - xn) / FD_EPS;
+        }
+        REQUIRE(S_forw.isApprox(S_forw_fd, COMPARISON_TOLERANCE_FD));
+
+        // the seed of the controls is passed through
+        VectorXd adj_ref = S_forw.transpose() * Eigen::Map<VectorXd>(seed, NX);
+        adj_ref(NX) += seed[NX];
+        REQUIRE(adj.isApprox(adj_ref, 1e-14));
+
+        // adjoints without forward sensitivities
+        sim_in.sens_forw = false;
+        void *adj_work = malloc(sim_discrete_model_calculate_workspace_size(&sim_in, NULL));
+        REQUIRE(sim_discrete_model(&sim_in, &sim_out, NULL, NULL, adj_work) == 0);
+        REQUIRE(Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU) == adj);
+        free(adj_work);
+    }
+
+    SECTION("Batch evaluation") {
+        int_t num_points = 5;
+        VectorXd xs(NX*num_points), us(NU*num_points), seeds((NX+NU)*num_points);
+        for (int_t k = 0; k < num_points; k++) {
+            xs.segment(k*NX, NX) << x[0] + 0.1*k, x[1] - 0.2*k;
+            us(k) = u[0] * k;
+            seeds.segment(k*(NX+NU), NX+NU) << seed[0], seed[1] * k, seed[2];
+        }
+        VectorXd xns(NX*num_points), S_forws(NX*(NX+NU)*num_points), adjs((NX+NU)*num_points);
+
+        allocations = malloc_count();
+        REQUIRE(sim_discrete_model_batch(&sim_in, num_points, xs.data(), us.data(), seeds.data(),
+                                         xns.data(), S_forws.data(), adjs.data(), work) == 0);
+        if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+
+        for (int_t k = 0; k < num_points; k++) {
+            sim_in.x = &xs(k*NX);
+            sim_in.u = &us(k*NU);
+            sim_in.S_adj = &seeds(k*(NX+NU));
+            REQUIRE(sim_discrete_model(&sim_in, &sim_out, NULL, NULL, work) == 0);
+            REQUIRE(Eigen::Map<VectorXd>(sim_out.xn, NX) == xns.segment(k*NX, NX));
+            REQUIRE(Eigen::Map<VectorXd>(sim_out.S_forw, NX*(NX+NU)) ==
+                    S_forws.segment(k*NX*(NX+NU), NX*(NX+NU)));
+            REQUIRE(Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU) ==
+                    adjs.segment(k*(NX+NU), NX+NU));
+        }
+    }
+
+    free(work);
+    free(sim_out.xn);
+    free(sim_out.S_forw);
+    free(sim_out.S_adj);
+}
+
+// Damped pendulum with a state dependent mass and the applied torque z as an
+// algebraic state, and an output e filtered from p and z:
+//     pdot = v, (1 + p^2/2)*vdot = z, edot = -e/2 + p + z, 0 = z + sin(p) + v/10 - u.
+// dae_pendulum is the implicit form of all states, dae_pendulum_nl the
+// implicit part of (p, v) only, e is its linear output system.
+static int_t dae_jac_u_evaluations = 0;
+
+static int dae_pendulum(const real_t **arg, real_t **res, int *iw, real_t *w, int mem) {
+    (void)iw;
+    (void)w;
+    (void)mem;
+    const real_t *xdot = arg[0], *x = arg[1], *z = arg[2], *u = arg[3];
+    real_t m = 1.0 + 0.5 * x[0] * x[0];
+    real_t r[] = {xdot[0] - x[1], m * xdot[1] - z[0], xdot[2] + 0.5 * x[2] - x[0] - z[0],
+                  z[0] + sin(x[0]) + 0.1 * x[1] - u[0]};
+    real_t jac_xdot[] = {1, 0, 0, 0, 0, m, 0, 0, 0, 0, 1, 0};
+    real_t jac_x[] = {0, x[0] * xdot[1], -1, cos(x[0]), -1, 0, 0, 0.1, 0, 0, 0.5, 0};
+    real_t jac_z[] = {0, -1, -1, 1};
+    real_t jac_u[] = {0, 0, 0, -1};
+    real_t *out[] = {r, jac_xdot, jac_x, jac_z, jac_u};
+    int sizes[] = {4, 12, 12, 4, 4};
+    for (int k = 0; k < 5; k++)
+        if (res[k] != NULL)
+            for (int i = 0; i < sizes[k]; i++) res[k][i] = out[k][i];
+    if (res[4] != NULL) dae_jac_u_evaluations++;
+    return 0;
+}
+
+static int dae_pendulum_nl(const real_t **arg, real_t **res, int *iw, real_t *w, int mem) {
+    (void)iw;
+    (void)w;
+    (void)mem;
+    const real_t *xdot = arg[0], *x = arg[1], *z = arg[2], *u = arg[3];
+    real_t m = 1.0 + 0.5 * x[0] * x[0];
+    real_t r[] = {xdot[0] - x[1], m * xdot[1] - z[0], z[0] + sin(x[0]) + 0.1 * x[1] - u[0]};
+    real_t jac_xdot[] = {1, 0, 0, 0, m, 0};
+    real_t jac_x[] = {0, x[0] * xdot[1], cos(x[0]), -1, 0, 0.1};
+    real_t jac_z[] = {0, -1, 1};
+    real_t jac_u[] = {0, 0, -1};
+    real_t *out[] = {r, jac_xdot, jac_x, jac_z, jac_u};
+    int sizes[] = {3, 6, 6, 3, 3};
+    for (int k = 0; k < 5; k++)
+        if (res[k] != NULL)
+            for (int i = 0; i < sizes[k]; i++) res[k][i] = out[k][i];
+    if (res[4] != NULL) dae_jac_u_evaluations++;
+    return 0;
+}
+
+static VectorXd dae_pendulum_explicit(const VectorXd &x, real_t u) {
+    real_t z = -sin(x(0)) - 0.1 * x(1) + u;
+    VectorXd xdot(3);
+    xdot << x(1), z / (1.0 + 0.5 * x(0) * x(0)), -0.5 * x(2) + x(0) + z;
+    return xdot;
+}
+
+TEST_CASE("Implicit IRK simulation of a DAE", "[simulation]") {
+    int_t NX = 3;
+    int_t NZ = 1;
+    int_t NU = 1;
+    real_t T = 0.5;
+    int_t num_stages = 3;
+
+    sim_in  sim_in;
+    sim_out sim_out;
+    sim_info info;
+    sim_RK_opts rk_opts;
+
+    real_t x[] = {0.5, -0.2, 0.0}, u[] = {0.3}, seed[] = {1.0, 2.0, 0.5, -1.0};
+    real_t A_LO[] = {-0.5}, B_LO[] = {1.0, 0.0, 1.0, 0.0}, B_u[] = {0.0, 0.0, -1.0};
+    sim_in.nx = NX;
+    sim_in.nu = NU;
+    sim_in.nz = NZ;
+    sim_in.x = x;
+    sim_in.u = u;
+    sim_in.S_adj = seed;
+    sim_in.sens_forw = true;
+    sim_in.sens_adj = true;
+    sim_in.sens_hess = false;
+    sim_in.num_forw_sens = NX+NU;
+    sim_in.num_steps = 10;
+    sim_in.step = T / sim_in.num_steps;
+    sim_in.impl_ode_wrapper = &impl_ode_fun;
+    MatrixXd S_forw_in = MatrixXd::Identity(NX, NX+NU);
+    sim_in.S_forw = S_forw_in.data();
+
+    sim_out.xn = (real_t*) calloc(NX, sizeof(*sim_out.xn));
+    sim_out.S_forw = (real_t*) calloc(NX*(NX+NU), sizeof(*sim_out.S_forw));
+    sim_out.S_adj = (real_t*) calloc(NX+NU, sizeof(*sim_out.S_adj));
+    sim_out.info = &info;
+
+    sim_irk_create_arguments(&rk_opts, num_stages, "Radau");
+    rk_opts.newton_iter = 5;
+
+    // without and with the structure of the model
+    VectorXd xn[2], adj[2];
+    MatrixXd S_forw[2];
+    for (int_t k = 0; k < 2; k++) {
+        sim_in.nx1 = (k == 0) ? NX : NX-1;
+        sim_in.impl_ode = (k == 0) ? dae_pendulum : dae_pendulum_nl;
+        sim_in.A_LO = (k == 0) ? NULL : A_LO;
+        sim_in.B_LO = (k == 0) ? NULL : B_LO;
+        sim_in.B_u = (k == 0) ? NULL : B_u;
+
+        sim_implicit_irk_memory irk_mem;
+        sim_implicit_irk_create_memory(&sim_in, &rk_opts, &irk_mem);
+        void *work = malloc(sim_implicit_irk_calculate_workspace_size(&sim_in, &rk_opts));
+
+        dae_jac_u_evaluations = 0;
+        long allocations = malloc_count();
+        REQUIRE(sim_implicit_irk(&sim_in, &sim_out, &rk_opts, &irk_mem, work) == 0);
+        if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+        // df/du is not evaluated if it is constant
+        REQUIRE(dae_jac_u_evaluations == ((k == 0) ? sim_in.num_steps * num_stages : 0));
+
+        xn[k] = Eigen::Map<VectorXd>(sim_out.xn, NX);
+        S_forw[k] = Eigen::Map<MatrixXd>(sim_out.S_forw, NX, NX+NU);
+        adj[k] = Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU);
+
+        free(work);
+        sim_implicit_irk_free_memory(&irk_mem);
+    }
+    REQUIRE(xn[1].isApprox(xn[0], 1e-12));
+    REQUIRE(S_forw[1].isApprox(S_forw[0], 1e-12));
+    REQUIRE(adj[1].isApprox(adj[0], 1e-12));
+
+    // reference solution of the explicit form with RK4 on a fine grid
+    int_t num_steps_ref = 1000;
+    real_t h = T / num_steps_ref;
+    VectorXd x_ref = Eigen::Map<VectorXd>(x, NX);
+    for (int_t i = 0; i < num_steps_ref; i++) {
+        VectorXd k1 = dae_pendulum_explicit(x_ref, u[0]);
+        VectorXd k2 = dae_pendulum_explicit(x_ref + 0.5 * h * k1, u[0]);
+        VectorXd k3 = dae_pendulum_explicit(x_ref + 0.5 * h * k2, u[0]);
+        VectorXd k4 = dae_pendulum_explicit(x_ref + h * k3, u[0]);
+        x_ref += h / 6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+    }
+    REQUIRE((xn[1] - x_ref).norm() < 1e-8);
+
+    // forward sensitivities by finite differences of the structured integrator
+    sim_in.sens_forw = false;
+    sim_in.sens_adj = false;
+    sim_implicit_irk_memory irk_mem;
+    sim_implicit_irk_create_memory(&sim_in, &rk_opts, &irk_mem);
+    void *work = malloc(sim_implicit_irk_calculate_workspace_size(&sim_in, &rk_opts));
+    MatrixXd S_forw_fd(NX, NX+NU);
+    for (int_t j = 0; j < NX+NU; j++) {
+        real_t *xu = (j < NX) ? &x[j] : &u[j-NX];
+        *xu += FD_EPS;
+        sim_implicit_irk(&sim_in, &sim_out, &rk_opts, &irk_mem, work);
+        *xu -= FD_EPS;
+        S_forw_fd.col(j) = (Eigen::Map<VectorXd>(sim_out.xn, NX) - xn[1]) / FD_EPS;
+    }
+    REQUIRE(S_forw[1].isApprox(S_forw_fd, COMPARISON_TOLERANCE_FD));
+    free(work);
+    sim_implicit_irk_free_memory(&irk_mem);
+
+    // the seed of the controls is passed through
+    VectorXd adj_ref = S_forw[1].transpose() * Eigen::Map<VectorXd>(seed, NX);
+    adj_ref(NX) += seed[NX];
+    REQUIRE(adj[1].isApprox(adj_ref, 1e-12));
+
+    free(sim_out.xn);
+    free(sim_out.S_forw);
+    free(sim_out.S_adj);
+}
+
+TEST_CASE("Implicit IRK simulation with a Newton tolerance", "[simulation]") {
+    int_t NX = 3;
+    int_t NZ = 1;
+    int_t NU = 1;
+    real_t T = 0.5;
+    int_t num_stages = 3;
+
+    sim_in  sim_in;
+    sim_out sim_out;
+    sim_info info;
+    sim_RK_opts rk_opts;
+
+    real_t x[] = {0.5, -0.2, 0.0}, u[] = {0.3}, seed[] = {1.0, 2.0, 0.5, -1.0};
+    real_t A_LO[] = {-0.5}, B_LO[] = {1.0, 0.0, 1.0, 0.0}, B_u[] = {0.0, 0.0, -1.0};
+    sim_in.nx = NX;
+    sim_in.nu = NU;
+    sim_in.nz = NZ;
+    sim_in.nx1 = NX-1;
+    sim_in.x = x;
+    sim_in.u = u;
+    sim_in.S_adj = seed;
+    sim_in.sens_forw = true;
+    sim_in.sens_adj = true;
+    sim_in.sens_hess = false;
+    sim_in.num_forw_sens = NX+NU;
+    sim_in.num_steps = 10;
+    sim_in.step = T / sim_in.num_steps;
+    sim_in.impl_ode_wrapper = &impl_ode_fun;
+    sim_in.impl_ode = dae_pendulum_nl;
+    sim_in.A_LO = A_LO;
+    sim_in.B_LO = B_LO;
+    sim_in.B_u = B_u;
+    MatrixXd S_forw_in = MatrixXd::Identity(NX, NX+NU);
+    sim_in.S_forw = S_forw_in.data();
+
+    sim_out.xn = (real_t*) calloc(NX, sizeof(*sim_out.xn));
+    sim_out.S_forw = (real_t*) calloc(NX*(NX+NU), sizeof(*sim_out.S_forw));
+    sim_out.S_adj = (real_t*) calloc(NX+NU, sizeof(*sim_out.S_adj));
+    sim_out.info = &info;
+
+    sim_irk_create_arguments(&rk_opts, num_stages, "Radau");
+    void *work = malloc(sim_implicit_irk_calculate_workspace_size(&sim_in, &rk_opts));
+
+    // converged reference with a fixed number of iterations
+    rk_opts.newton_iter = 10;
+    sim_implicit_irk_memory irk_mem;
+    sim_implicit_irk_create_memory(&sim_in, &rk_opts, &irk_mem);
+    REQUIRE(sim_implicit_irk(&sim_in, &sim_out, &rk_opts, &irk_mem, work) == 0);
+    REQUIRE(info.num_newton_iter == 10 * sim_in.num_steps);
+    VectorXd xn_ref = Eigen::Map<VectorXd>(sim_out.xn, NX);
+    MatrixXd S_forw_ref = Eigen::Map<MatrixXd>(sim_out.S_forw, NX, NX+NU);
+    VectorXd adj_ref = Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU);
+    sim_implicit_irk_free_memory(&irk_mem);
+
+    rk_opts.newton_iter = 20;
+    rk_opts.newton_tol = 1e-12;
+    for (int_t reuse = 0; reuse < 2; reuse++) {
+        rk_opts.newton_reuse = reuse;
+        sim_implicit_irk_create_memory(&sim_in, &rk_opts, &irk_mem);
+
+        long allocations = malloc_count();
+        REQUIRE(sim_implicit_irk(&sim_in, &sim_out, &rk_opts, &irk_mem, work) == 0);
+        if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+        REQUIRE(Eigen::Map<VectorXd>(sim_out.xn, NX).isApprox(xn_ref, 1e-12));
+        REQUIRE(Eigen::Map<MatrixXd>(sim_out.S_forw, NX, NX+NU).isApprox(S_forw_ref, 1e-10));
+        REQUIRE(Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU).isApprox(adj_ref, 1e-10));
+
+        // the iterations stop before the fixed number, matrices are reused
+        REQUIRE(info.num_newton_iter < 10 * sim_in.num_steps);
+        if (reuse)
+            REQUIRE(info.num_factorizations < info.num_newton_iter);
+        else
+            REQUIRE(info.num_factorizations == info.num_newton_iter);
+
+        // the stage variables of the last call have converged
+        REQUIRE(sim_implicit_irk(&sim_in, &sim_out, &rk_opts, &irk_mem, work) == 0);
+        REQUIRE(info.num_newton_iter == 0);
+        REQUIRE(info.num_factorizations == 0);
+
+        sim_implicit_irk_free_memory(&irk_mem);
+    }
+
+    // the tolerance is not met within one iteration of a cold start
+    rk_opts.newton_iter = 1;
+    sim_implicit_irk_create_memory(&sim_in, &rk_opts, &irk_mem);
+    REQUIRE(sim_implicit_irk(&sim_in, &sim_out, &rk_opts, &irk_mem, work) == ACADOS_MAXITER);
+    sim_implicit_irk_free_memory(&irk_mem);
+
+    free(work);
+    free(sim_out.xn);
+    free(sim_out.S_forw);
+    free(sim_out.S_adj);
+}
+
+// Nonlinearity g(x) of a pendulum written as xdot = A*x + B*u + c + g(x), with
+// the linearization around the downward position in A
+static int pendulum_nonlinearity(const real_t **arg, real_t **res, int *iw, real_t *w, int mem) {
+    (void)iw;
+    (void)w;
+    (void)mem;
+    const real_t *x = arg[0];
+    res[0][0] = 0.0;
+    res[0][1] = -sin(x[0]) + 2.0 * x[0];
+    real_t jac[] = {0.0, -cos(x[0]) + 2.0, 0.0, 0.0};
+    for (int i = 0; i < 4; i++) res[1][i] = jac[i];
+    return 0;
+}
+
+static VectorXd semilinear_pendulum(const VectorXd &x, real_t u, bool linear) {
+    VectorXd xdot(2);
+    xdot << x(1), -2.0 * x(0) - 0.3 * x(1) + u + 0.1;
+    if (!linear) xdot(1) += -sin(x(0)) + 2.0 * x(0);
+    return xdot;
+}
+
+TEST_CASE("Exponential integrators", "[simulation]") {
+    int_t NX = 2;
+    int_t NU = 1;
+    real_t T = 5.0;  // large enough for the scaling and squaring
+
+    sim_in  sim_in;
+    sim_out sim_out;
+    sim_info info;
+
+    real_t x[] = {0.8, -0.5}, u[] = {0.3}, seed[] = {1.0, -2.0, 0.5};
+    real_t A[] = {0.0, -2.0, 1.0, -0.3}, B[] = {0.0, 1.0}, c[] = {0.0, 0.1};
+    sim_in.nx = NX;
+    sim_in.nu = NU;
+    sim_in.x = x;
+    sim_in.u = u;
+    sim_in.S_adj = seed;
+    sim_in.sens_forw = true;
+    sim_in.sens_adj = true;
+    sim_in.sens_hess = false;
+    sim_in.num_forw_sens = NX+NU;
+    sim_in.A_lin = A;
+    sim_in.B_lin = B;
+    sim_in.c_lin = c;
+    sim_in.jac = pendulum_nonlinearity;
+    sim_in.jacobian_wrapper = &jac_fun;
+    MatrixXd S_forw_in = MatrixXd::Identity(NX, NX+NU);
+    sim_in.S_forw = S_forw_in.data();
+
+    sim_out.xn = (real_t*) calloc(NX, sizeof(*sim_out.xn));
+    sim_out.S_forw = (real_t*) calloc(NX*(NX+NU), sizeof(*sim_out.S_forw));
+    sim_out.S_adj = (real_t*) calloc(NX+NU, sizeof(*sim_out.S_adj));
+    sim_out.info = &info;
+
+    for (bool linear : {true, false}) {
+        // reference solution with RK4 on a fine grid
+        int_t num_steps_ref = 2000;
+        real_t h = T / num_steps_ref;
+        VectorXd x_ref = Eigen::Map<VectorXd>(x, NX);
+        for (int_t i = 0; i < num_steps_ref; i++) {
+            VectorXd k1 = semilinear_pendulum(x_ref, u[0], linear);
+            VectorXd k2 = semilinear_pendulum(x_ref + 0.5 * h * k1, u[0], linear);
+            VectorXd k3 = semilinear_pendulum(x_ref + 0.5 * h * k2, u[0], linear);
+            VectorXd k4 = semilinear_pendulum(x_ref + h * k3, u[0], linear);
+            x_ref += h / 6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+        }
+
+        auto integrator = linear ? sim_exact_linear : sim_exp_rk;
+        auto workspace_size = linear ? sim_exact_linear_calculate_workspace_size
+                                     : sim_exp_rk_calculate_workspace_size;
+        real_t error[2];
+        for (int_t k = 0; k < 2; k++) {
+            sim_in.num_steps = linear ? 1 : 40 * (k + 1);
+            sim_in.step = T / sim_in.num_steps;
+            sim_exact_linear_memory mem;
+            sim_exact_linear_create_memory(&sim_in, NULL, &mem);
+            void *work = malloc(workspace_size(&sim_in, NULL));
+
+            REQUIRE(integrator(&sim_in, &sim_out, NULL, &mem, work) == 0);
+            VectorXd xn = Eigen::Map<VectorXd>(sim_out.xn, NX);
+            MatrixXd S_forw = Eigen::Map<MatrixXd>(sim_out.S_forw, NX, NX+NU);
+            VectorXd adj = Eigen::Map<VectorXd>(sim_out.S_adj, NX+NU);
+            error[k] = (xn - x_ref).norm();
+
+            // the factors are cached, further calls do not allocate
+            REQUIRE(mem.T == sim_in.step);
+            long allocations = malloc_count();
+            REQUIRE(integrator(&sim_in, &sim_out, NULL, &mem, work) == 0);
+            if (malloc_count_enabled()) REQUIRE(malloc_count() == allocations);
+            REQUIRE(Eigen::Map<VectorXd>(sim_out.xn, NX) == xn);
+
+            // forward sensitivities by finite differences
+            sim_in.sens_forw = false;
+            sim_in.sens_adj = false;
+            MatrixXd S_forw_fd(NX, NX+NU);
+            for (int_t j = 0; j < NX+NU; j++) {
+                real_t *xu = (j < NX) ? &x[j] : &u[j-NX];
+                *xu += FD_EPS;
+                integrator(&sim_in, &sim_out, NULL, &mem, work);
+                *xu -= FD_EPS;
+                S_forw_fd.col(j) = (Eigen::Map<VectorXd>(sim_out.xn, NX) - xn) / FD_EPS;
+            }
+            sim_in.sens_forw = true;
+            sim_in.sens_adj = true;
+            REQUIRE(S_forw.isApprox(S_forw_fd, COMPARISON_TOLERANCE_FD));
+
+            // the seed of the controls is passed through
+            VectorXd adj_ref = S_forw.transpose() * Eigen::Map<VectorXd>(seed, NX);
+            adj_ref(NX) += seed[NX];
+            REQUIRE(adj.isApprox(adj_ref, 1e-12));
+
+            free(work);
+            sim_exact_linear_free_memory(&mem);
+        }
+        if (linear) {
+            // exact up to the accuracy of the matrix exponential
+            REQUIRE(error[0] < 1e-10);
+        } else {
+            // second order
+            REQUIRE(log2(error[0] / error[1]) == Approx(2.0).epsilon(0.1));
+        }
+    }
+
+    free(sim_out.xn);
+    free(sim_out.S_forw);
+    free(sim_out.S_adj);
+}
@@ -0,0 +1,82 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "test/test_utils/malloc_count.h"
+
+#include <errno.h>
+#include <stdlib.h>
+
+#ifdef __GLIBC__
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t num, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+
+static long num_allocations = 0;
+
+void *malloc(size_t size) {
+    __sync_fetch_and_add(&num_allocations, 1);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t num, size_t size) {
+    __sync_fetch_and_add(&num_allocations, 1);
+    return __libc_calloc(num, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    __sync_fetch_and_add(&num_allocations, 1);
+    return __libc_realloc(ptr, size);
+}
+
+// the aligned allocations of BLASFEO (v_zeros_align) and of C11
+int posix_memalign(void **ptr, size_t alignment, size_t size) {
+    __sync_fetch_and_add(&num_allocations, 1);
+    if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) return EINVAL;
+    void *mem = __libc_memalign(alignment, size);
+    if (mem == NULL && size != 0) return ENOMEM;
+    *ptr = mem;
+    return 0;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+    __sync_fetch_and_add(&num_allocations, 1);
+    return __libc_memalign(alignment, size);
+}
+
+int malloc_count_enabled(void) {
+    return 1;
+}
+
+long malloc_count(void) {
+    return __sync_fetch_and_add(&num_allocations, 0);
+}
+
+#else
+
+int malloc_count_enabled(void) {
+    return 0;
+}
+
+long malloc_count(void) {
+    return 0;
+}
+
+#endif  // __GLIBC__
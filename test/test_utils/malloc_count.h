@@ -0,0 +1,40 @@
+/*
+ *    This file is part of acados.
+ *
+ *    acados is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    acados is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with acados; if not, write to the Free Software Foundation,
+ *    Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef TEST_TEST_UTILS_MALLOC_COUNT_H_
+#define TEST_TEST_UTILS_MALLOC_COUNT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counts the calls to malloc, calloc, realloc, posix_memalign and
+// aligned_alloc of the test executable. The counting wraps the glibc
+// allocator, elsewhere malloc_count_enabled returns 0 and the count stays at
+// zero.
+
+int malloc_count_enabled(void);
+
+long malloc_count(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif  // TEST_TEST_UTILS_MALLOC_COUNT_H_